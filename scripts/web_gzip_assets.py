@@ -0,0 +1,137 @@
+# ------------------------------------------------------
+# 소스명 : web_gzip_assets.py
+# 모듈명 : Smart Nature Wind Web UI 정적 자산 gzip / content hash (PlatformIO extra script)
+# ------------------------------------------------------
+# 기능 요약:
+# - data_v015/html_v2 의 html/css/js → 같은 위치에 <파일>.gz 생성 (gzip -9, mtime 0 → 재현 가능)
+# - 자산별 content hash(sha256 앞 16자) → /html_v2/asset_manifest.json
+#   W10_Web_Static: ETag / 304 / versioned URI(?v=<hash 8자>) 판정에 사용
+# - html.gz 내부의 로컬 css/js 참조를 "<파일>?v=<hash 8자>" 로 치환 (immutable 캐시 대상)
+#   (원본 html은 수정하지 않음: gzip 미지원 client는 ETag 재검증 경로)
+# - 페이지별 전송 바이트(html + pageAssets + 공통 assets) 원본 / gzip 비교 출력
+# ------------------------------------------------------
+# 사용:
+# - platformio.ini [common] extra_scripts = pre:scripts/web_gzip_assets.py
+#   → buildfs / uploadfs 대상일 때만 실행
+# - 단독 실행: python scripts/web_gzip_assets.py [data_dir]
+# ------------------------------------------------------
+
+import glob
+import gzip
+import hashlib
+import json
+import os
+import re
+import sys
+
+G_ASSET_DIR = "html_v2"
+G_ASSET_EXTS = (".html", ".css", ".js")
+G_MANIFEST_NAME = "asset_manifest.json"
+G_MANIFEST_VER = 1
+G_HASH_LEN = 16
+G_VER_LEN = 8
+
+# href="./P000_common_001.css" / src="P040_dashboard_003.js" (로컬 상대 참조만)
+G_REF_RE = re.compile(r'((?:href|src)\s*=\s*")(\./)?([A-Za-z0-9_\-]+\.(?:css|js))(")')
+
+
+def _hash(p_data):
+    return hashlib.sha256(p_data).hexdigest()[:G_HASH_LEN]
+
+
+def _gzip(p_data):
+    return gzip.compress(p_data, compresslevel=9, mtime=0)
+
+
+def _write_if_changed(p_path, p_data):
+    if os.path.exists(p_path):
+        with open(p_path, "rb") as v_f:
+            if v_f.read() == p_data:
+                return
+    with open(p_path, "wb") as v_f:
+        v_f.write(p_data)
+
+
+def _rewrite_html(p_html, p_hashes):
+    def _sub(p_m):
+        v_name = p_m.group(3)
+        v_h = p_hashes.get(v_name)
+        if not v_h:
+            return p_m.group(0)
+        return "%s%s%s?v=%s%s" % (p_m.group(1), p_m.group(2) or "", v_name, v_h[:G_VER_LEN], p_m.group(4))
+
+    return G_REF_RE.sub(_sub, p_html.decode("utf-8")).encode("utf-8")
+
+
+def _page_report(p_data_dir, p_files):
+    # cfg_pages_*.json 최신 버전 기준
+    v_cands = sorted(glob.glob(os.path.join(p_data_dir, "json", "cfg_pages_*.json")))
+    if not v_cands:
+        return
+    with open(v_cands[-1], "r", encoding="utf-8") as v_f:
+        v_pages = json.load(v_f)
+
+    v_common = [a.get("path") for a in v_pages.get("assets", [])]
+    print("[web_gzip] page load bytes (html + pageAssets + common):")
+    for v_page in v_pages.get("pages", []):
+        v_paths = [v_page.get("path")] + [a.get("path") for a in v_page.get("pageAssets", [])] + v_common
+        v_raw = sum(p_files[p]["size"] for p in v_paths if p in p_files)
+        v_gz = sum(p_files[p]["gz"] for p in v_paths if p in p_files)
+        if v_raw:
+            print("  %-32s raw %7d B  gzip %7d B  (%.0f%%)" % (v_page.get("uri"), v_raw, v_gz, 100.0 * v_gz / v_raw))
+
+
+def build_assets(p_data_dir):
+    v_dir = os.path.join(p_data_dir, G_ASSET_DIR)
+    if not os.path.isdir(v_dir):
+        print("[web_gzip] skip: %s not found" % v_dir)
+        return
+
+    v_names = sorted(n for n in os.listdir(v_dir) if n.endswith(G_ASSET_EXTS))
+    v_src = {}
+    for v_name in v_names:
+        with open(os.path.join(v_dir, v_name), "rb") as v_f:
+            v_src[v_name] = v_f.read()
+
+    # 1) css/js hash 먼저 (html 참조 치환에 사용)
+    v_hashes = {n: _hash(d) for n, d in v_src.items() if not n.endswith(".html")}
+
+    v_files = {}
+    for v_name in v_names:
+        v_data = v_src[v_name]
+        v_body = _rewrite_html(v_data, v_hashes) if v_name.endswith(".html") else v_data
+        v_gz = _gzip(v_body)
+        _write_if_changed(os.path.join(v_dir, v_name + ".gz"), v_gz)
+
+        v_files["/%s/%s" % (G_ASSET_DIR, v_name)] = {
+            "h": _hash(v_data),
+            "size": len(v_data),
+            "gzH": _hash(v_body),
+            "gz": len(v_gz),
+        }
+
+    # 원본이 삭제된 .gz 정리
+    for v_gz_name in os.listdir(v_dir):
+        if v_gz_name.endswith(".gz") and v_gz_name[:-3] not in v_src:
+            os.remove(os.path.join(v_dir, v_gz_name))
+
+    v_manifest = {"ver": G_MANIFEST_VER, "files": v_files}
+    _write_if_changed(os.path.join(v_dir, G_MANIFEST_NAME), json.dumps(v_manifest, separators=(",", ":"), sort_keys=True).encode("utf-8"))
+
+    v_raw = sum(f["size"] for f in v_files.values())
+    v_gz = sum(f["gz"] for f in v_files.values())
+    print("[web_gzip] %d assets: raw %d B -> gzip %d B" % (len(v_files), v_raw, v_gz))
+    _page_report(p_data_dir, v_files)
+
+
+# --------------------------------------------------
+# PlatformIO extra script (pre) / 단독 실행
+# --------------------------------------------------
+try:
+    Import("env")  # noqa: F821 (PlatformIO SCons 환경)
+
+    if any(t in ("buildfs", "uploadfs", "uploadfsota") for t in COMMAND_LINE_TARGETS):  # noqa: F821
+        build_assets(env.subst("$PROJECT_DATA_DIR"))  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        build_assets(sys.argv[1] if len(sys.argv) > 1 else os.path.join(os.path.dirname(__file__), "..", "src", "v015", "data_v015"))
@@ -10,6 +10,11 @@
  * - 모션센서, Watchdog, FactoryReset, LittleFS WebUI 포함
  * - Wi-Fi LED 상태표시 및 완전 초기화 지원
  * - [Refactored] CT10의 제어 상태 변경 시 브로드캐스트 책임을 위임받음
+ * - loop 대기: 고정 delay 대신 CT10 다음 deadline / WS 다음 전송 가능 시각 기준 대기 (task notify 기상)
+ * - 초기화 완료 시 boot→ready 시각 기록 (C10 이진 스냅샷 유/무 부팅 시간 비교)
+ * - loop마다 C10 RCU retire 목록 회수 (grace 경과 세대 delete)
+ * - loop마다 C10 설정 저장 예약(write-behind) coalesce 판정 → 저장
+ * - loop마다 /ws logs topic queue 전송 (로그 sink는 임의 task → client 순회는 loop task만)
  * ------------------------------------------------------
  * [구현 규칙]
  * - 주석 구조, 네이밍 규칙, ArduinoJson v7 단일 문서 정책 준수
@@ -77,6 +82,9 @@ CL_P10_PWM              g_P10_pwm;
 // ------------------------------------------------------
 constexpr int G_A00_LED_PIN = 2; // 내장 LED (ESP32 보드용)
 
+constexpr uint32_t G_A00_LOOP_WAIT_MIN_MS = 10;   // [ms] loop 최소 대기 (기존 delay(10))
+constexpr uint32_t G_A00_LOOP_WAIT_MAX_MS = 100;  // [ms] loop 최대 대기 (WS 최소 전송 주기 이하)
+
 // ------------------------------------------------------
 // Factory Reset 유틸 (모든 JSON 삭제 후 기본 복원)
 // ------------------------------------------------------
@@ -132,7 +140,11 @@ void A00_init() {
     CL_C10_ConfigManager::loadAll(g_A20_config_root);
     CL_N10_NvsManager::begin();
 
-    if (!g_A20_config_root.system || !g_A20_config_root.wifi) {
+    // 섹션 포인터 1회 load (RCU) → Wi-Fi init은 grace 이상 걸릴 수 있으므로 값 복사로 사용
+    const ST_A20_SystemConfig_t* v_sysPtr  = C10_rcuRead(g_A20_config_root.system);
+    const ST_A20_WifiConfig_t*   v_wifiPtr = C10_rcuRead(g_A20_config_root.wifi);
+
+    if (!v_sysPtr || !v_wifiPtr) {
         CL_D10_Logger::log(EN_L10_LOG_ERROR, "[A00] Config root invalid (system or wifi is null).");
         // 필요에 따라 FactoryReset 시도 or 안전 모드 진입
         // 예: FactoryReset 후 재부팅:
@@ -143,14 +155,14 @@ void A00_init() {
     }
 
     // 4. Wi-Fi 초기화
-    const ST_A20_WifiConfig_t&   v_wifi = *g_A20_config_root.wifi;
-    const ST_A20_SystemConfig_t& v_sys  = *g_A20_config_root.system;
+    const ST_A20_WifiConfig_t   v_wifi = *v_wifiPtr;
+    const ST_A20_SystemConfig_t v_sys  = *v_sysPtr;
 
     bool v_wifiOk = CL_WF10_WiFiManager::init(v_wifi, v_sys, g_A00_wifiMulti);
     digitalWrite(G_A00_LED_PIN, v_wifiOk ? HIGH : LOW);
 
     // 5. PWM + Control + Simulation
-    g_P10_pwm.P10_begin(*g_A20_config_root.system);
+    g_P10_pwm.P10_begin(v_sys);
     //
     CL_CT10_ControlManager::begin();
 
@@ -173,12 +185,16 @@ void A00_init() {
         CL_W10_WebAPI::wsCleanupTick,
         CL_W10_WebAPI::setWsIntervals
     );
+    // 스트리밍 payload 경로 (채널 고정 버퍼 직렬화 → 공유 버퍼 전송)
+    CT10_WS_setRawBroker(CL_W10_WebAPI::broadcastRaw);
     CT10_WS_begin();
 
     // 8. Watchdog 초기화 (10초)
     esp_task_wdt_init(10, true);
     esp_task_wdt_add(NULL);
 
+    // boot→ready 시각 기록 (C10 loadAll / 이진 스냅샷 효과 비교, /api/diag cfgSnap)
+    CL_C10_ConfigManager::markBootReady();
     CL_D10_Logger::log(EN_L10_LOG_INFO, "[A00] Init complete. Ready.");
 }
 
@@ -209,6 +225,15 @@ void A00_run() {
 
     CT10_WS_tick();
 
+    // /ws logs topic: 임의 task 로그 queue → 구독 client 전송 (loop task에서만 client 순회)
+    CL_W10_WebAPI::wsLogTick();
+
+    // RCU: grace 경과한 이전 설정 세대 해제
+    CL_C10_ConfigManager::rcuReclaim();
+
+    // write-behind: coalesce 구간 경과한 설정 저장 예약 처리
+    CL_C10_ConfigManager::saveTick();
+
 	/*
 
 	#if defined(G_A00_METRICS_DEBUG_LOG)
@@ -279,6 +304,13 @@ void A00_run() {
         digitalWrite(G_A00_LED_PIN, CL_WF10_WiFiManager::isStaConnected() ? HIGH : LOW);
     }
 
-    delay(10);
+    // CT10 다음 deadline 또는 WS pending 채널 전송 가능 시각까지 대기
+    // (외부 이벤트는 task notify로 즉시 기상, LED/WDT 주기를 위해 상한 유지)
+    uint32_t v_waitMs = v_ctrl.msUntilNextWake();
+    uint32_t v_wsDue  = CT10_WS_msUntilNextDue();
+    if (v_wsDue < v_waitMs) v_waitMs = v_wsDue;
+    if (v_waitMs < G_A00_LOOP_WAIT_MIN_MS) v_waitMs = G_A00_LOOP_WAIT_MIN_MS;
+    if (v_waitMs > G_A00_LOOP_WAIT_MAX_MS) v_waitMs = G_A00_LOOP_WAIT_MAX_MS;
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(v_waitMs));
 }
 
@@ -54,6 +54,8 @@ namespace A20_Const {
 // 펌웨어/파일버전
 constexpr char FW_VERSION[]    = "FW_Ver_1.0.0";
 constexpr char CFG_JSON_FILE[] = "/json/10_cfg_jsonFile.json";
+// 섹션 구조체 이진 스냅샷 (부팅 시 JSON 재파싱 생략용, C10 관리)
+constexpr char CFG_SNAPSHOT_FILE[] = "/json/10_cfg_snapshot.bin";
 
 // 모듈별 버전 (Web API 응답용)
 constexpr char VER_CONTROL[] = "CT10_ControlManager_026";
@@ -142,6 +144,45 @@ inline constexpr uint8_t  G_A20_WS_DEFAULT_CHART_THROTTLE_MUL = 2;
 // ------------------------------------------------------
 inline constexpr uint16_t G_A20_WS_DEFAULT_CLEANUP_MS = 2000;
 
+// ------------------------------------------------------
+// WS 스케줄러 1회 pass 전송 예산 기본값
+//  - 한 pass에서 due 채널을 우선순위대로 연속 전송, 누적 byte/경과 us가 예산 도달 시 중단
+//  - 예산과 무관하게 pass당 최소 1채널은 전송
+// ------------------------------------------------------
+inline constexpr uint16_t G_A20_WS_DEFAULT_PASS_BUDGET_BYTES = 4096;
+inline constexpr uint16_t G_A20_WS_DEFAULT_PASS_BUDGET_US    = 6000;
+
+// ------------------------------------------------------
+// client별 적응형 전송 간격 기본값 (W10 backpressure 기반)
+//  - 하한: 채널 wsIntervalMs, 상한: wsIntervalMs × wsAdaptMaxMul
+// ------------------------------------------------------
+inline constexpr bool     G_A20_WS_DEFAULT_ADAPT_ENABLED = true;
+inline constexpr uint8_t  G_A20_WS_DEFAULT_ADAPT_MAX_MUL = 8;
+
+// ------------------------------------------------------
+// chart 이력 window(sample) 정책
+//  - 최대값은 컴파일 타임 고정 (PSRAM 보드는 대용량 허용)
+// ------------------------------------------------------
+inline constexpr uint16_t G_A20_CHART_WINDOW_MIN        = 120;
+#if defined(BOARD_HAS_PSRAM)
+inline constexpr uint16_t G_A20_CHART_WINDOW_MAX        = 3600;
+#else
+inline constexpr uint16_t G_A20_CHART_WINDOW_MAX        = 240;
+#endif
+inline constexpr uint16_t G_A20_WS_DEFAULT_CHART_WINDOW = 120;
+
+// ------------------------------------------------------
+// 설정 저장 write-behind / 이진 스냅샷 재기록 기본값(ms) (system.storage)
+//  - saveCoalesceMs : 마지막 저장 요청 후 무요청 유지 시간 → 저장
+//  - saveMaxDelayMs : 연속 요청 중에도 최초 요청 후 이 시간 경과 시 저장 (>= saveCoalesceMs)
+//  - snapRefreshMs  : 마지막 저장 후 무저장 유지 시간 → 스냅샷 1회 재기록
+// ------------------------------------------------------
+inline constexpr uint16_t G_A20_SAVE_DEFAULT_COALESCE_MS     = 1500;
+inline constexpr uint16_t G_A20_SAVE_DEFAULT_MAX_DELAY_MS    = 10000;
+inline constexpr uint16_t G_A20_SAVE_DEFAULT_SNAP_REFRESH_MS = 30000;
+inline constexpr uint16_t G_A20_SAVE_COALESCE_MIN_MS         = 100;
+inline constexpr uint16_t G_A20_SAVE_TIMING_MAX_MS           = 60000;
+
 
 
 
@@ -272,6 +313,18 @@ typedef struct {
     // W10 cleanupClients 호출 주기(ms)
     uint16_t wsCleanupMs;
 
+    // chart 이력 보관 샘플 수 (G_A20_CHART_WINDOW_MIN ~ MAX)
+    uint16_t chartWindow;       // ex) 120
+
+    // 스케줄러 1회 pass 전송 예산 (누적 payload byte / 경과 us)
+    uint16_t wsPassBudgetBytes; // ex) 4096
+    uint16_t wsPassBudgetUs;    // ex) 6000
+
+    // client별 적응형 전송 간격 (queue 적재/canSend 실패/payload 크기 기반)
+    // - 활성 시 chart 강스로틀(chartThrottleMul)은 client별 조정으로 대체
+    bool     wsAdaptEnabled;    // ex) true
+    uint8_t  wsAdaptMaxMul;     // ex) 8 (상한 = wsIntervalMs * 8)
+
 } ST_A20_WebSocketConfig_t;
 
 
@@ -279,6 +332,7 @@ typedef struct {
 // SYSTEM 설정 (cfg_system_xxx.json) : camelCase 정합
 //   meta.version, meta.deviceName, meta.lastUpdate
 //   system.logging.level, system.logging.maxEntries
+//   system.storage{saveCoalesceMs,saveMaxDelayMs,snapRefreshMs}
 //   hw.fanPwm{pin,channel,freq,res}
 //   hw.fanConfig{startPercentMin,comfortPercentMin,comfortPercentMax,hardPercentMax}
 //   hw.pir{enabled,pin,debounceSec,holdSec}
@@ -301,6 +355,11 @@ typedef struct {
             uint16_t maxEntries;
         } logging;
         ST_A20_WebSocketConfig_t webSocket;
+        struct {
+            uint16_t saveCoalesceMs;
+            uint16_t saveMaxDelayMs;
+            uint16_t snapRefreshMs;
+        } storage;
     } system;
 
     struct {
@@ -422,7 +481,9 @@ typedef enum : uint8_t {
 
 /* ======================================================
  * Segment Mode <-> String 매핑 유틸
+ * - A20_Const_Func_042.h 동일 블록 중복 정의 방지 guard
  * ====================================================== */
+#define A20_SEG_MODE_UTIL_DEFINED
 inline constexpr const char* g_A20_SEG_MODE_NAMES[EN_A20_SEG_MODE_COUNT] = {"PRESET", "FIXED"};
 
 inline EN_A20_segment_mode_t A20_modeFromString(const char* p_str) {
@@ -7,6 +7,7 @@
  * ------------------------------------------------------
  * 기능 요약
  *  - 공용 헬퍼(Clamp/SafeCopy/Random)
+ *  - Seed 지정 가능 PRNG(xoshiro128**) + 일괄 생성(batch fill), owner별 상태 인스턴스(p_st) 지원
  *  - Mode String 매핑 유틸
  *  - Default Reset 함수들 (Root/Config/Item/Dict)
  *  - WindProfileDict 검색 유틸
@@ -66,12 +67,130 @@ inline void A20_safe_strlcpy(char* p_dst, const char* p_src, size_t p_n) {
     strlcpy(p_dst, p_src, p_n);
 }
 
+// ------------------------------------------------------
+// PRNG 엔진 (xoshiro128**)
+// - HW 엔트로피(esp_random)는 시드 생성에만 사용
+// - 동일 seed => 동일 난수열 (시뮬레이션 재현용)
+// - 엔진 교체 시 T_A20_PrngEngine_t 별칭만 변경
+// ------------------------------------------------------
+class CL_A20_PrngXoshiro128 {
+  public:
+    void seed(uint32_t p_seed) {
+        // splitmix32로 32bit seed -> 128bit state 확장 (all-zero state 방지)
+        uint32_t v_x = p_seed;
+        for (uint8_t v_i = 0; v_i < 4; v_i++) {
+            v_x += 0x9E3779B9u;
+            uint32_t v_z = v_x;
+            v_z = (v_z ^ (v_z >> 16)) * 0x85EBCA6Bu;
+            v_z = (v_z ^ (v_z >> 13)) * 0xC2B2AE35u;
+            _s[v_i] = v_z ^ (v_z >> 16);
+        }
+        if ((_s[0] | _s[1] | _s[2] | _s[3]) == 0u) _s[0] = 1u;
+    }
+
+    uint32_t nextU32() {
+        const uint32_t v_result = _rotl(_s[1] * 5u, 7) * 9u;
+        const uint32_t v_t      = _s[1] << 9;
+
+        _s[2] ^= _s[0];
+        _s[3] ^= _s[1];
+        _s[1] ^= _s[2];
+        _s[0] ^= _s[3];
+        _s[2] ^= v_t;
+        _s[3] = _rotl(_s[3], 11);
+
+        return v_result;
+    }
+
+    // [0,1) 균등분포 (상위 24bit 사용)
+    float next01() {
+        return (float)(nextU32() >> 8) * (1.0f / 16777216.0f);
+    }
+
+  private:
+    uint32_t _s[4] = { 1u, 0u, 0u, 0u };
+
+    static inline uint32_t _rotl(uint32_t p_x, int p_k) {
+        return (p_x << p_k) | (p_x >> (32 - p_k));
+    }
+};
+
+typedef CL_A20_PrngXoshiro128 T_A20_PrngEngine_t;
+
+typedef struct {
+    T_A20_PrngEngine_t engine;
+    uint32_t           seed   = 0;      // 마지막 적용 seed
+    bool               seeded = false;
+} ST_A20_PrngState_t;
+
+// 공용 기본 인스턴스 (인자 없는 A20_rand* API 전용)
+// - 잠금 없음: 여러 task가 난수를 쓰는 모듈은 ST_A20_PrngState_t를 직접 소유하고
+//   p_st 인자 버전을 사용 (예: CL_S10_Simulation::_prng)
+inline ST_A20_PrngState_t g_A20_prng;
+
+/**
+ * @brief PRNG seed 적용. p_seed == 0 이면 HW 엔트로피(esp_random)로 seed 생성
+ */
+inline uint32_t A20_prngSeed(ST_A20_PrngState_t& p_st, uint32_t p_seed) {
+    uint32_t v_seed = p_seed;
+    while (v_seed == 0u) v_seed = esp_random();
+
+    p_st.engine.seed(v_seed);
+    p_st.seed   = v_seed;
+    p_st.seeded = true;
+    return v_seed;
+}
+
+inline uint32_t A20_randU32(ST_A20_PrngState_t& p_st) {
+    if (!p_st.seeded) A20_prngSeed(p_st, 0u);
+    return p_st.engine.nextU32();
+}
+
+inline float A20_getRandom01(ST_A20_PrngState_t& p_st) {
+    if (!p_st.seeded) A20_prngSeed(p_st, 0u);
+    return p_st.engine.next01();
+}
+
+inline float A20_randRange(ST_A20_PrngState_t& p_st, float p_min, float p_max) {
+    return p_min + (A20_getRandom01(p_st) * (p_max - p_min));
+}
+
+/**
+ * @brief [p_min, p_max) 균등분포 난수 p_count개를 p_out에 일괄 생성
+ */
+inline void A20_randFillRange(ST_A20_PrngState_t& p_st, float* p_out, uint16_t p_count, float p_min, float p_max) {
+    if (!p_out) return;
+    if (!p_st.seeded) A20_prngSeed(p_st, 0u);
+
+    const float v_span = p_max - p_min;
+    for (uint16_t v_i = 0; v_i < p_count; v_i++) {
+        p_out[v_i] = p_min + p_st.engine.next01() * v_span;
+    }
+}
+
+// 공용 기본 인스턴스(g_A20_prng) 버전
+inline uint32_t A20_prngSeed(uint32_t p_seed) {
+    return A20_prngSeed(g_A20_prng, p_seed);
+}
+
+inline uint32_t A20_prngGetSeed() {
+    return g_A20_prng.seed;
+}
+
+inline uint32_t A20_randU32() {
+    return A20_randU32(g_A20_prng);
+}
+
 inline float A20_getRandom01() {
-    return (float)esp_random() / (float)UINT32_MAX;
+    return A20_getRandom01(g_A20_prng);
 }
 
 inline float A20_randRange(float p_min, float p_max) {
-    return p_min + (A20_getRandom01() * (p_max - p_min));
+    return A20_randRange(g_A20_prng, p_min, p_max);
+}
+
+inline void A20_randFillRange(float* p_out, uint16_t p_count, float p_min, float p_max) {
+    A20_randFillRange(g_A20_prng, p_out, p_count, p_min, p_max);
 }
 
 // ======================================================
@@ -122,6 +241,17 @@ static inline void A20_resetWebSocketDefault(ST_A20_WebSocketConfig_t& p_ws) {
 
     // cleanup tick
     p_ws.wsCleanupMs = G_A20_WS_DEFAULT_CLEANUP_MS;
+
+    // chart history window
+    p_ws.chartWindow = G_A20_WS_DEFAULT_CHART_WINDOW;
+
+    // scheduler pass budget
+    p_ws.wsPassBudgetBytes = G_A20_WS_DEFAULT_PASS_BUDGET_BYTES;
+    p_ws.wsPassBudgetUs    = G_A20_WS_DEFAULT_PASS_BUDGET_US;
+
+    // per-client adaptive interval
+    p_ws.wsAdaptEnabled = G_A20_WS_DEFAULT_ADAPT_ENABLED;
+    p_ws.wsAdaptMaxMul  = G_A20_WS_DEFAULT_ADAPT_MAX_MUL;
 }
 
 inline void A20_resetSystemDefault(ST_A20_SystemConfig_t& p_cfg) {
@@ -139,6 +269,11 @@ inline void A20_resetSystemDefault(ST_A20_SystemConfig_t& p_cfg) {
     // webSocket
     A20_resetWebSocketDefault(p_cfg.system.webSocket);
 
+    // storage (write-behind / snapshot)
+    p_cfg.system.storage.saveCoalesceMs = G_A20_SAVE_DEFAULT_COALESCE_MS;
+    p_cfg.system.storage.saveMaxDelayMs = G_A20_SAVE_DEFAULT_MAX_DELAY_MS;
+    p_cfg.system.storage.snapRefreshMs  = G_A20_SAVE_DEFAULT_SNAP_REFRESH_MS;
+
     // hw: fanPwm
     p_cfg.hw.fanPwm.pin     = 6;
     p_cfg.hw.fanPwm.channel = 0;
@@ -0,0 +1,158 @@
+#pragma once
+/*
+ * ------------------------------------------------------
+ * 소스명 : A20_JsonDocSink_041.h
+ * 모듈약어 : A20
+ * 모듈명 : Smart Nature Wind JsonDocument field sink (CL_A20_JsonWriter 동일 인터페이스)
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - beginObject/endObject/beginArray/endArray/kv/kvNull/value 호출을 JsonObject 트리 생성으로 변환
+ * - field list 템플릿(S10_emit* / CT10 emit*)을 writer·JsonDocument 두 경로에서 공용
+ *   → REST/fallback(JsonDocument)과 WS 스트리밍 payload의 key 이름/순서가 구조적으로 동일
+ * - root beginObject(): 생성자에 전달된 JsonObject에 그대로 기록 (기존 key 유지, merge 용도)
+ *   하위 beginObject(key)/beginArray(key): 해당 key를 새 object/array로 교체
+ * - 문자열 값/key는 const char*로 전달 → ArduinoJson 복사 저장 (로컬 스냅샷 포인터 보존 안 함)
+ * ------------------------------------------------------
+ * [구현 규칙]
+ * - 항상 소스 시작 주석 부분 체계 유지 및 내용 업데이트
+ * - 소스 시작 주석 부분 구현규칙, 코드네이밍규칙 내용 그대로 유지, 수정금지
+ * - ArduinoJson v7.x.x 사용 (v6 이하 사용 금지)
+ * - JsonDocument 단일 타입만 사용
+ * - createNestedArray/Object/containsKey 사용 금지
+ * - memset + strlcpy 기반 안전 초기화
+ * - 주석/필드명은 JSON 구조와 동일하게 유지
+ * ------------------------------------------------------
+ * [코드 네이밍 규칙]
+ * - 전역 상수,매크로      : G_모듈약어_ 접두사
+ * - 전역 변수             : g_모듈약어_ 접두사
+ * - 전역 함수             : 모듈약어_ 접두사
+ * - type                  : T_모듈약어_ 접두사
+ * - typedef               : _t  접미사
+ * - enum 상수             : EN_모듈약어_ 접두사
+ * - 구조체                : ST_모듈약어_ 접미사
+ * - 클래스명              : CL_모듈약어_ 접미사
+ * - 클래스 private 멤버   : _ 접두사
+ * - 클래스 멤버(함수/변수) : 모듈약어 접두사 미사용
+ * - 클래스 정적 멤버      : s_ 접두사
+ * - 함수 로컬 변수        : v_ 접두사
+ * - 함수 인자             : p_ 접두사
+ * ------------------------------------------------------
+ */
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#include "A20_JsonWriter_041.h"
+
+// 문서 root object 확보 (object가 아니면 새 object, 기존 key는 유지)
+static inline JsonObject A20_docRootObject(JsonDocument& p_doc) {
+	if (!p_doc.is<JsonObject>()) return p_doc.to<JsonObject>();
+	return p_doc.as<JsonObject>();
+}
+
+// ======================================================
+// CL_A20_JsonDocSink
+// - 사용 예:
+//     CL_A20_JsonDocSink v_s(A20_docRootObject(p_doc));
+//     v_s.beginObject();
+//     S10_emitSimState(v_s, v_snap);   // writer와 동일 field list
+//     v_s.endObject();
+// ======================================================
+class CL_A20_JsonDocSink {
+  public:
+	explicit CL_A20_JsonDocSink(JsonObject p_root) : _root(p_root) {}
+
+	// --------------------------------------------------
+	// 구조 (p_key == nullptr: root 또는 array 원소)
+	// --------------------------------------------------
+	void beginObject(const char* p_key = nullptr) {
+		if (_depth == 0) {
+			_push(_root);
+			return;
+		}
+		JsonVariant v_top = _stack[_depth - 1];
+		if (p_key) {
+			_push(v_top[p_key].to<JsonObject>());
+		} else {
+			_push(v_top.add<JsonObject>());
+		}
+	}
+	void endObject() {
+		_pop();
+	}
+	void beginArray(const char* p_key = nullptr) {
+		if (_depth == 0) {
+			_overflow = true;	 // root array 미지원 (payload root는 항상 object)
+			return;
+		}
+		JsonVariant v_top = _stack[_depth - 1];
+		if (p_key) {
+			_push(v_top[p_key].to<JsonArray>());
+		} else {
+			_push(v_top.add<JsonArray>());
+		}
+	}
+	void endArray() {
+		_pop();
+	}
+
+	// --------------------------------------------------
+	// key/value (object 내부)
+	// --------------------------------------------------
+	void kv(const char* p_key, const char* p_v) {
+		if (_depth == 0) return;
+		_stack[_depth - 1][p_key] = p_v;
+	}
+	void kv(const char* p_key, char* p_v) {
+		kv(p_key, (const char*)p_v);
+	}
+	void kvNull(const char* p_key) {
+		if (_depth == 0) return;
+		_stack[_depth - 1][p_key] = nullptr;
+	}
+	template <typename T>
+	void kv(const char* p_key, T p_v) {
+		if (_depth == 0) return;
+		_stack[_depth - 1][p_key] = p_v;
+	}
+
+	// --------------------------------------------------
+	// value (array 내부)
+	// --------------------------------------------------
+	void value(const char* p_v) {
+		if (_depth == 0) return;
+		_stack[_depth - 1].add(p_v);
+	}
+	template <typename T>
+	void value(T p_v) {
+		if (_depth == 0) return;
+		_stack[_depth - 1].add(p_v);
+	}
+
+	bool overflow() const {
+		return _overflow;
+	}
+
+  private:
+	void _push(JsonVariant p_v) {
+		if (_depth >= G_A20_JSONW_DEPTH_MAX) {
+			_overflow = true;
+			return;
+		}
+		_stack[_depth++] = p_v;
+	}
+
+	void _pop() {
+		if (_depth == 0) {
+			_overflow = true;
+			return;
+		}
+		_depth--;
+	}
+
+  private:
+	JsonObject	_root;
+	JsonVariant _stack[G_A20_JSONW_DEPTH_MAX];
+	uint8_t		_depth	  = 0;
+	bool		_overflow = false;
+};
@@ -0,0 +1,403 @@
+#pragma once
+/*
+ * ------------------------------------------------------
+ * 소스명 : A20_JsonWriter_041.h
+ * 모듈약어 : A20
+ * 모듈명 : Smart Nature Wind 고정 버퍼 스트리밍 JSON Writer
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - 호출자가 제공한 고정 버퍼에 JSON을 순차 기록 (heap 할당 없음, 중간 트리 없음)
+ * - 고정 구조 payload(WS state/metrics/chart/summary) 전용: key 순서 = 호출 순서
+ * - 용량 초과 시 overflow 플래그만 세우고 이후 기록 무시 (호출자가 JsonDocument 경로로 fallback)
+ * - 문자열 escape: " \ 및 제어문자 (ArduinoJson serializeJson과 동일 규칙)
+ * - float: ArduinoJson 7 serializeJson과 동일 출력 (TextFormatter::writeFloat/decomposeFloat 규칙)
+ *   . float 소수 6자리 / double 9자리 (float로 정확히 표현되는 double은 6자리), 후행 0 제거
+ *   . 1e7 이상 / 1e-5 이하는 지수 표기(예: 1e7, 1.5e-6), NaN/Inf → null
+ * - CL_A20_JsonDocSink(A20_JsonDocSink_041.h)와 동일 인터페이스: field list 템플릿 1벌로 두 경로 공용
+ * ------------------------------------------------------
+ * [구현 규칙]
+ * - 항상 소스 시작 주석 부분 체계 유지 및 내용 업데이트
+ * - 소스 시작 주석 부분 구현규칙, 코드네이밍규칙 내용 그대로 유지, 수정금지
+ * - ArduinoJson v7.x.x 사용 (v6 이하 사용 금지)
+ * - JsonDocument 단일 타입만 사용
+ * - createNestedArray/Object/containsKey 사용 금지
+ * - memset + strlcpy 기반 안전 초기화
+ * - 주석/필드명은 JSON 구조와 동일하게 유지
+ * ------------------------------------------------------
+ * [코드 네이밍 규칙]
+ * - 전역 상수,매크로      : G_모듈약어_ 접두사
+ * - 전역 변수             : g_모듈약어_ 접두사
+ * - 전역 함수             : 모듈약어_ 접두사
+ * - type                  : T_모듈약어_ 접두사
+ * - typedef               : _t  접미사
+ * - enum 상수             : EN_모듈약어_ 접두사
+ * - 구조체                : ST_모듈약어_ 접미사
+ * - 클래스명              : CL_모듈약어_ 접미사
+ * - 클래스 private 멤버   : _ 접두사
+ * - 클래스 멤버(함수/변수) : 모듈약어 접두사 미사용
+ * - 클래스 정적 멤버      : s_ 접두사
+ * - 함수 로컬 변수        : v_ 접두사
+ * - 함수 인자             : p_ 접두사
+ * ------------------------------------------------------
+ */
+
+#include <Arduino.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <type_traits>
+
+// float/double 소수 자릿수 (ArduinoJson 7 JsonSerializer: sizeof(T) >= 8 ? 9 : 6)
+static const int8_t G_A20_JSONW_FLOAT_DEC_F32 = 6;
+static const int8_t G_A20_JSONW_FLOAT_DEC_F64 = 9;
+// object/array 최대 중첩 깊이 (element 구분자 상태 bit 수)
+static const uint8_t G_A20_JSONW_DEPTH_MAX = 16u;
+
+// ======================================================
+// CL_A20_JsonWriter
+// - 사용 예:
+//     char v_buf[512];
+//     CL_A20_JsonWriter v_w(v_buf, sizeof(v_buf));
+//     v_w.beginObject();
+//     v_w.beginObject("summary");
+//     v_w.kv("wind", 3.2f);
+//     v_w.endObject();
+//     v_w.endObject();
+//     if (!v_w.overflow()) send(v_w.c_str(), v_w.length());
+// ======================================================
+class CL_A20_JsonWriter {
+  public:
+	CL_A20_JsonWriter(char* p_buf, size_t p_cap) : _buf(p_buf), _cap(p_cap) {
+		reset();
+	}
+
+	void reset() {
+		_len	  = 0;
+		_depth	  = 0;
+		_first	  = 1u;
+		_overflow = (_buf == nullptr || _cap == 0);
+		if (!_overflow) _buf[0] = '\0';
+	}
+
+	const char* c_str() const {
+		return _buf;
+	}
+	size_t length() const {
+		return _overflow ? 0 : _len;
+	}
+	bool overflow() const {
+		return _overflow;
+	}
+
+	// --------------------------------------------------
+	// 구조 (p_key == nullptr: root 또는 array 원소)
+	// --------------------------------------------------
+	void beginObject(const char* p_key = nullptr) {
+		_open(p_key, '{');
+	}
+	void endObject() {
+		_close('}');
+	}
+	void beginArray(const char* p_key = nullptr) {
+		_open(p_key, '[');
+	}
+	void endArray() {
+		_close(']');
+	}
+
+	// --------------------------------------------------
+	// key/value (object 내부)
+	// --------------------------------------------------
+	void kv(const char* p_key, const char* p_v) {
+		_key(p_key);
+		_putValue(p_v);
+	}
+	void kv(const char* p_key, char* p_v) {
+		kv(p_key, (const char*)p_v);
+	}
+	void kvNull(const char* p_key) {
+		_key(p_key);
+		_putRaw("null", 4);
+	}
+	template <typename T>
+	void kv(const char* p_key, T p_v) {
+		_key(p_key);
+		_putValue(p_v);
+	}
+
+	// --------------------------------------------------
+	// value (array 내부)
+	// --------------------------------------------------
+	void value(const char* p_v) {
+		_sep();
+		_putValue(p_v);
+	}
+	template <typename T>
+	void value(T p_v) {
+		_sep();
+		_putValue(p_v);
+	}
+
+  private:
+	// --------------------------------------------------
+	// 구분자 / key
+	// --------------------------------------------------
+	void _sep() {
+		const uint32_t v_bit = 1u << _depth;
+		if (_first & v_bit) {
+			_first &= ~v_bit;
+		} else {
+			_put(',');
+		}
+	}
+
+	void _key(const char* p_key) {
+		_sep();
+		_put('"');
+		_putRaw(p_key, strlen(p_key));	// key는 코드 상수 (escape 불필요)
+		_put('"');
+		_put(':');
+	}
+
+	void _open(const char* p_key, char p_ch) {
+		if (p_key) {
+			_key(p_key);
+		} else if (_depth > 0) {
+			_sep();
+		}
+		_put(p_ch);
+		if (_depth + 1u >= G_A20_JSONW_DEPTH_MAX) {
+			_overflow = true;
+			return;
+		}
+		_depth++;
+		_first |= (1u << _depth);
+	}
+
+	void _close(char p_ch) {
+		if (_depth == 0) {
+			_overflow = true;
+			return;
+		}
+		_first &= ~(1u << _depth);
+		_depth--;
+		_put(p_ch);
+	}
+
+	// --------------------------------------------------
+	// 저수준 기록 (NUL 종료 유지, 초과 시 overflow)
+	// --------------------------------------------------
+	void _put(char p_ch) {
+		if (_overflow) return;
+		if (_len + 1u >= _cap) {
+			_overflow = true;
+			return;
+		}
+		_buf[_len++] = p_ch;
+		_buf[_len]	 = '\0';
+	}
+
+	void _putRaw(const char* p_s, size_t p_n) {
+		if (_overflow) return;
+		if (_len + p_n >= _cap) {
+			_overflow = true;
+			return;
+		}
+		memcpy(_buf + _len, p_s, p_n);
+		_len += p_n;
+		_buf[_len] = '\0';
+	}
+
+	void _putU32(uint32_t p_v) {
+		char	v_tmp[10];
+		uint8_t v_n = 0;
+		do {
+			v_tmp[v_n++] = (char)('0' + (p_v % 10u));
+			p_v /= 10u;
+		} while (p_v != 0u);
+		if (_overflow) return;
+		if (_len + v_n >= _cap) {
+			_overflow = true;
+			return;
+		}
+		while (v_n > 0) _buf[_len++] = v_tmp[--v_n];
+		_buf[_len] = '\0';
+	}
+
+	// --------------------------------------------------
+	// 값 직렬화
+	// --------------------------------------------------
+	void _putValue(const char* p_s) {
+		if (!p_s) {
+			_putRaw("null", 4);
+			return;
+		}
+		_put('"');
+		for (const char* v_p = p_s; *v_p && !_overflow; v_p++) {
+			const uint8_t v_c = (uint8_t)*v_p;
+			switch (v_c) {
+				case '"':
+					_putRaw("\\\"", 2);
+					break;
+				case '\\':
+					_putRaw("\\\\", 2);
+					break;
+				case '\b':
+					_putRaw("\\b", 2);
+					break;
+				case '\f':
+					_putRaw("\\f", 2);
+					break;
+				case '\n':
+					_putRaw("\\n", 2);
+					break;
+				case '\r':
+					_putRaw("\\r", 2);
+					break;
+				case '\t':
+					_putRaw("\\t", 2);
+					break;
+				default:
+					if (v_c < 0x20u) {
+						static const char s_hex[] = "0123456789abcdef";
+						char			  v_u[6]  = {'\\', 'u', '0', '0', s_hex[v_c >> 4], s_hex[v_c & 0x0Fu]};
+						_putRaw(v_u, 6);
+					} else {
+						_put((char)v_c);
+					}
+					break;
+			}
+		}
+		_put('"');
+	}
+
+	template <typename T>
+	void _putValue(T p_v) {
+		if constexpr (std::is_same<T, char*>::value) {
+			_putValue((const char*)p_v);
+		} else if constexpr (std::is_same<T, bool>::value) {
+			if (p_v) {
+				_putRaw("true", 4);
+			} else {
+				_putRaw("false", 5);
+			}
+		} else if constexpr (std::is_floating_point<T>::value) {
+			// double도 float로 정확히 표현되면 float 저장/6자리 (ArduinoJson VariantData::setFloat)
+			const double v_d = (double)p_v;
+			_putFloat(v_d, (sizeof(T) < 8 || v_d == (double)(float)v_d) ? G_A20_JSONW_FLOAT_DEC_F32 : G_A20_JSONW_FLOAT_DEC_F64);
+		} else if constexpr (std::is_integral<T>::value && std::is_signed<T>::value) {
+			const int32_t v_i = (int32_t)p_v;
+			if (v_i < 0) {
+				_put('-');
+				_putU32((uint32_t)0u - (uint32_t)v_i);
+			} else {
+				_putU32((uint32_t)v_i);
+			}
+		} else if constexpr (std::is_integral<T>::value) {
+			_putU32((uint32_t)p_v);
+		} else {
+			static_assert(std::is_arithmetic<T>::value, "CL_A20_JsonWriter: unsupported value type");
+		}
+	}
+
+	// 1e7 이상 / 1e-5 이하 → [1,10) 정규화, 반환: 10 지수 (ArduinoJson normalize, 이진 거듭제곱 분해)
+	static int16_t _normalize(double& p_v) {
+		static const double s_pos[]		  = {1e1, 1e2, 1e4, 1e8, 1e16, 1e32, 1e64, 1e128, 1e256};
+		static const double s_neg[]		  = {1e-1, 1e-2, 1e-4, 1e-8, 1e-16, 1e-32, 1e-64, 1e-128, 1e-256};
+		static const double s_negPlusOne[] = {1e0, 1e-1, 1e-3, 1e-7, 1e-15, 1e-31, 1e-63, 1e-127, 1e-255};
+
+		int16_t v_exp	= 0;
+		int8_t	v_index = 8;
+		int		v_bit	= 1 << v_index;
+
+		if (p_v >= 1e7) {
+			for (; v_index >= 0; v_index--) {
+				if (p_v >= s_pos[v_index]) {
+					p_v *= s_neg[v_index];
+					v_exp = (int16_t)(v_exp + v_bit);
+				}
+				v_bit >>= 1;
+			}
+		}
+		if (p_v > 0 && p_v <= 1e-5) {
+			for (; v_index >= 0; v_index--) {
+				if (p_v < s_negPlusOne[v_index]) {
+					p_v *= s_pos[v_index];
+					v_exp = (int16_t)(v_exp - v_bit);
+				}
+				v_bit >>= 1;
+			}
+		}
+		return v_exp;
+	}
+
+	// 정수부 + 소수부(정수부 자릿수만큼 소수 자릿수 축소, 반올림, 후행 0 제거) + 지수 (printf 미사용)
+	void _putFloat(double p_v, int8_t p_dec) {
+		if (isnan(p_v) || isinf(p_v)) {
+			_putRaw("null", 4);
+			return;
+		}
+		if (p_v < 0.0) {
+			_put('-');
+			p_v = -p_v;
+		}
+
+		static const uint32_t s_pow10[] = {1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u, 1000000000u};
+
+		uint32_t v_maxDec = s_pow10[p_dec];
+		int16_t	 v_exp	  = _normalize(p_v);
+		uint32_t v_int	  = (uint32_t)p_v;
+		for (uint32_t v_t = v_int; v_t >= 10u; v_t /= 10u) {
+			v_maxDec /= 10u;
+			p_dec--;
+		}
+
+		double	 v_rem = (p_v - (double)v_int) * (double)v_maxDec;
+		uint32_t v_dec = (uint32_t)v_rem;
+		v_rem -= (double)v_dec;
+		v_dec += (uint32_t)(v_rem * 2.0);	 // 0.5 이상 올림
+		if (v_dec >= v_maxDec) {
+			v_dec = 0u;
+			v_int++;
+			if (v_exp && v_int >= 10u) {
+				v_exp++;
+				v_int = 1u;
+			}
+		}
+		while (p_dec > 0 && (v_dec % 10u) == 0u) {
+			v_dec /= 10u;
+			p_dec--;
+		}
+
+		_putU32(v_int);
+
+		if (p_dec > 0) {
+			char v_tmp[12];
+			v_tmp[0] = '.';
+			for (int8_t i = p_dec; i > 0; i--) {
+				v_tmp[i] = (char)('0' + (v_dec % 10u));
+				v_dec /= 10u;
+			}
+			_putRaw(v_tmp, (size_t)p_dec + 1u);
+		}
+
+		if (v_exp) {
+			_put('e');
+			if (v_exp < 0) {
+				_put('-');
+				_putU32((uint32_t)(-(int32_t)v_exp));
+			} else {
+				_putU32((uint32_t)v_exp);
+			}
+		}
+	}
+
+  private:
+	char*	 _buf	   = nullptr;
+	size_t	 _cap	   = 0;
+	size_t	 _len	   = 0;
+	uint32_t _first	   = 1u;  // bit(depth)=1: 해당 depth 첫 원소 대기 (구분자 생략)
+	uint8_t	 _depth	   = 0;
+	bool	 _overflow = false;
+};
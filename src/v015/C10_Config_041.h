@@ -10,8 +10,15 @@
  *  - 설정 파일 단위 분리 관리 (system / wifi / motion / schedules / userProfiles / windProfile / nvsSpec / webPage)
  *  - 구조체 ↔ JSON 직렬화 및 역직렬화 (ArduinoJson v7 전용)
  *  - 파일 백업(.bak) / 복구 / 공장초기화(factoryResetFromDefault) 지원
+ *  - 저장: compact JSON → .tmp 기록 후 rename (중단 시 .tmp/.bak 복구), write-behind coalesce (requestSave/saveTick)
  *  - PATCH 기반 부분 업데이트(patchConfigFromJson) 지원
  *  - Lazy-Load 하이브리드 구성 (필요 섹션만 동적 로드)
+ *  - 섹션 loader: ArduinoJson Filter + NestingLimit 부분 파싱, 큰 배열은 항목 단위 스트리밍 파싱
+ *  - 섹션 구조체 이진 스냅샷(CRC/schema hash/원본 size·내용 CRC 검증) → 부팅 시 JSON 재파싱 생략
+ *  - RCU 섹션 세대: writer는 복제본 수정 후 포인터 교체(publish), 이전 섹션은 retire 목록 등록 후
+ *    A00 loop(rcuReclaim)에서 grace 기간 경과분만 해제 (writer는 mutex 보유 중 대기 없음)
+ *    (reader는 lock 없이 섹션 포인터 1회 load → C10_rcuRead)
+ *  - windDict 변경 세대(windDictGen): CT10 코드 intern / ResolvedWind 캐시 무효화 키
  *  - Wi-Fi 등 재초기화 판단 로직 확장 가능
  * ------------------------------------------------------
  * [구현 규칙]
@@ -50,15 +57,69 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <type_traits>
+
 #include "A20_Const_041.h"	 // ST_A20_ConfigRoot_t, ST_A20_* 구조체, 상수 정의
 #include "D10_Logger_040.h"	 // CL_D10_Logger, EN_L10_LOG_*
 
 // ------------------------------------------------------
 // JSON I/O Helper 함수 선언 (Core cpp에서 구현)
 // ------------------------------------------------------
-bool ioLoadJson(const char* p_path, JsonDocument& p_doc);
+// 섹션 loader 파싱 nesting 제한
+//  - SECTION : 섹션 문서 (root → section → group → array → 값)
+//  - ITEM    : 스트리밍 배열 항목 (item → segments[] → segment → adjust → 값)
+#ifndef G_C10_JSON_NEST_SECTION
+#	define G_C10_JSON_NEST_SECTION 5
+#endif
+#ifndef G_C10_JSON_NEST_ITEM
+#	define G_C10_JSON_NEST_ITEM 5
+#endif
+
+// p_filter: DeserializationOption::Filter 용 JSON 텍스트 (nullptr → 전체)
+bool ioLoadJson(const char* p_path, JsonDocument& p_doc, const char* p_filter = nullptr,
+				uint8_t p_nesting = ARDUINOJSON_DEFAULT_NESTING_LIMIT);
+// compact 직렬화 → "<path>.tmp" 기록/close(commit) → main→.bak, tmp→main rename
+//  - 보류 구간(C10_ioDeferBegin~End, saveDirtyConfigs/saveAll) 중 섹션 파일은 메모리 직렬화만 수행
+//    → C10 mutex 해제 후 C10_ioCommitPending 이 기록
 bool ioSaveJson(const char* p_path, const JsonDocument& p_doc);
 
+// 직렬화 완료 본문 기록 (tmp → bak → rename, IO lock 보유) (Core cpp에서 구현)
+bool C10_ioWriteAtomic(const char* p_path, const uint8_t* p_buf, size_t p_len);
+
+// 파일별 쓰기 통계 기록 (Journal cpp에서 구현, ioSaveJson / 스냅샷 기록에서 호출)
+void C10_recordFileWrite(const char* p_path, uint32_t p_bytes, bool p_ok);
+
+// ------------------------------------------------------
+// 설정 파일 IO 직렬화 / 저장 보류 (Journal cpp에서 구현)
+//  - C10_ioLock       : 섹션 파일/스냅샷 rename 구간 lock (재진입 가능, C10 mutex와 별개)
+//  - C10_ioDeferBegin : 호출 task의 ioSaveJson(섹션 파일)을 섹션별 보류 본문으로 대체 (최신 본문만 유지)
+//  - C10_ioDeferEnd   : 최외곽 구간 종료 시 true → 호출자가 mutex 해제 후 C10_ioCommitPending
+//  - C10_ioDeferJson  : ioSaveJson 내부용, 보류 처리 시 true (p_ok = 직렬화 성공)
+//  - C10_ioCommitPending : 보류 본문 기록 → 실패 섹션 mask 반환 (bit = EN_C10_SNAP_SEC_*)
+//  - C10_ioPendingMask   : 기록 대기 본문 섹션 mask (스냅샷 재기록 보류 판단)
+//  - write-behind 시간은 system.storage (saveCoalesceMs / saveMaxDelayMs / snapRefreshMs)
+// ------------------------------------------------------
+void    C10_ioLock();
+void    C10_ioUnlock();
+void    C10_ioDeferBegin();
+bool    C10_ioDeferEnd();
+bool    C10_ioDeferJson(const char* p_path, const JsonDocument& p_doc, bool& p_ok);
+uint8_t C10_ioCommitPending();
+uint8_t C10_ioPendingMask();
+
+// ------------------------------------------------------
+// 스트리밍 파싱 Helper (Parse cpp에서 구현)
+// ------------------------------------------------------
+// 배열 항목 callback: p_idx == 0 → 새 pass 시작 (fallback 재시도 포함), false 반환 → 중단 (용량 도달)
+typedef bool (*T_C10_JsonItemFn_t)(JsonObjectConst p_item, uint16_t p_idx, void* p_ctx);
+
+// p_keys 경로(root → 배열 key)의 배열을 항목 단위로 파싱 → 반환: callback 수락 항목 수 (-1: 실패)
+int16_t ioForEachJsonItem(const char* p_path, const char* const* p_keys, uint8_t p_keyCount, uint8_t p_nesting,
+						  T_C10_JsonItemFn_t p_fn, void* p_ctx);
+
+// loader 문서 전용 allocator (pool 바이트 계측 → parseStatsToJson)
+ArduinoJson::Allocator* C10_jsonAllocator();
+
 // Mutex Timeout 정의
 #ifndef G_C10_MUTEX_TIMEOUT
 #	define G_C10_MUTEX_TIMEOUT pdMS_TO_TICKS(100)
@@ -79,6 +140,63 @@ bool ioSaveJson(const char* p_path, const JsonDocument& p_doc);
 
 #define C10_MUTEX_RELEASE() CL_C10_ConfigManager::_mutex_Release();
 
+// ------------------------------------------------------
+// 이진 스냅샷 (Snapshot cpp에서 구현)
+//  - 0: 스냅샷 미사용 (항상 JSON 파싱, 부팅 시간 비교용)
+// ------------------------------------------------------
+#ifndef G_C10_SNAPSHOT_ENABLE
+#	define G_C10_SNAPSHOT_ENABLE 1
+#endif
+
+// 스냅샷 스키마 버전 (섹션 구조체 의미 변경 시 증가)
+//  - sizeof/offsetof 로 드러나는 변경은 schema hash 가 자동 검출, 크기·위치 불변 의미 변경만 수동 증가
+#define G_C10_SNAP_SCHEMA_VER 1
+
+// 섹션 index (스냅샷 entry 순서 = loadAll 로드 순서)
+typedef enum : uint8_t {
+	EN_C10_SNAP_SEC_SYSTEM = 0,
+	EN_C10_SNAP_SEC_WIFI,
+	EN_C10_SNAP_SEC_MOTION,
+	EN_C10_SNAP_SEC_NVS_SPEC,
+	EN_C10_SNAP_SEC_WIND_DICT,
+	EN_C10_SNAP_SEC_SCHEDULES,
+	EN_C10_SNAP_SEC_USER_PROFILES,
+	EN_C10_SNAP_SEC_WEB_PAGE,
+	EN_C10_SNAP_SEC_COUNT
+} EN_C10_snap_sec_t;
+
+#define G_C10_SNAP_BIT(p_sec) ((uint8_t)(1u << (p_sec)))
+
+// ------------------------------------------------------
+// RCU 섹션 세대 (Rcu cpp에서 구현)
+//  - writer : C10 mutex 내에서 clone → 수정 → publishSection (포인터 atomic 교체)
+//  - reader : C10_rcuRead()로 섹션 포인터 1회 load 후 해당 포인터만 사용 (lock 없음)
+//             → 한 번 load한 포인터를 grace 기간 이상 보관 금지 (값 복사로 보관)
+//  - retire : 교체된 섹션은 FIFO 등록만(writer 비차단), G_C10_RCU_GRACE_MS 경과 후 rcuReclaim()(A00 loop)에서 delete
+// ------------------------------------------------------
+#ifndef G_C10_RCU_GRACE_MS
+#	define G_C10_RCU_GRACE_MS 2000
+#endif
+
+// retire 대기 soft 상한 (초과 시 overCap 통계만 증가, 대기/강제 해제 없음)
+#ifndef G_C10_RCU_RETIRE_MAX
+#	define G_C10_RCU_RETIRE_MAX 24
+#endif
+
+typedef struct {
+	uint32_t retired;
+	uint32_t reclaimed;
+	uint32_t overCap;	   // 등록 시 pending > G_C10_RCU_RETIRE_MAX 횟수 (grace 내 publish 폭주)
+	uint32_t allocFail;	   // retire 노드 할당 실패 → 섹션 누수 처리 횟수
+	uint16_t pending;
+	uint16_t maxPending;
+} ST_C10_RcuStat_t;
+
+template <typename T>
+inline const T* C10_rcuRead(T* const& p_slot) {
+	return __atomic_load_n(&p_slot, __ATOMIC_ACQUIRE);
+}
+
 // 전역 Config Root (Core cpp에서 정의)
 extern ST_A20_ConfigRoot_t g_A20_config_root;
 
@@ -100,6 +218,88 @@ class CL_C10_ConfigManager {
 
 	static bool factoryResetFromDefault();
 
+	// =====================================================
+	// 1-1. 이진 스냅샷 (부팅 가속)
+	//  - loadAll: 스냅샷 유효 섹션은 memcpy 복원, 나머지만 JSON 파싱
+	//  - loadAll 직후 재기록, 저장 후에는 system.storage.snapRefreshMs 무저장 경과 시 1회 재기록 (saveTick)
+	// =====================================================
+	// p_path 지정 시 섹션 파일/cfg_jsonFile 경로일 때만 무효화 (ioSaveJson, 업로드)
+	static void invalidateSnapshot(const char* p_path = nullptr);
+	static void markBootReady();
+	static void snapshotStatsToJson(JsonObject p_obj);
+
+	// loadAll JSON 파싱 통계 (문서 peak / 최소 free heap / 섹션별 항목 수)
+	static void parseStatsToJson(JsonObject p_obj);
+
+	// =====================================================
+	// 1-2. RCU 섹션 세대 (g_A20_config_root 갱신 경로)
+	// =====================================================
+	// 현재 섹션 복제 (없으면 기본값) → writer 수정용
+	template <typename T>
+	static T* cloneSection(const T* p_cur, void (*p_reset)(T&)) {
+		T* v_next = new T();
+		if (p_cur) {
+			*v_next = *p_cur;
+		} else {
+			p_reset(*v_next);
+		}
+		return v_next;
+	}
+
+	// 섹션 포인터 교체 + 이전 섹션 retire (p_next = nullptr → 섹션 해제)
+	template <typename T>
+	static void publishSection(T*& p_slot, T* p_next) {
+		T* v_old = __atomic_exchange_n(&p_slot, p_next, __ATOMIC_ACQ_REL);
+		__atomic_add_fetch(&s_cfgGen, 1, __ATOMIC_RELEASE);
+		if constexpr (std::is_same<T, ST_A20_WindProfileDict_t>::value) {
+			// 포인터 교체 이후 증가 → 새 세대를 본 reader는 새 dict도 보장
+			__atomic_add_fetch(&s_windDictGen, 1, __ATOMIC_RELEASE);
+		}
+		if (v_old && v_old != p_next) {
+			_rcuRetire(v_old, [](void* p_ptr) { delete (T*)p_ptr; });
+		}
+	}
+
+	// 섹션 해제 (reader 보유 가능 → 즉시 delete 대신 retire)
+	template <typename T>
+	static void retireSection(T*& p_slot) {
+		publishSection(p_slot, (T*)nullptr);
+	}
+
+	// reader 비공개 섹션 즉시 해제 (publish 전 root 전용, 세대 변경 없음)
+	template <typename T>
+	static void _deleteSection(T*& p_slot) {
+		delete p_slot;
+		p_slot = nullptr;
+	}
+
+	// p_next의 할당된 섹션 전체를 g_A20_config_root로 publish (소유권 이전, p_next는 비워짐)
+	static void publishRoot(ST_A20_ConfigRoot_t& p_next);
+
+	// 파일 재로드 → 새 세대 publish (실패 시 기존 세대 유지)
+	static bool reloadAll();
+
+	// grace 기간 경과 retire 섹션 해제 (A00 loop 주기 호출, 유일한 해제 경로)
+	static void rcuReclaim();
+
+	static uint32_t configGen() {
+		return __atomic_load_n(&s_cfgGen, __ATOMIC_ACQUIRE);
+	}
+
+	// windDict 변경 세대 (publish/load 시 증가) → 반드시 dict 포인터 load 이전에 읽을 것
+	static uint32_t windDictGen() {
+		return __atomic_load_n(&s_windDictGen, __ATOMIC_ACQUIRE);
+	}
+
+	static void rcuStats(ST_C10_RcuStat_t& p_out);
+	static void rcuStatsToJson(JsonObject p_obj);
+
+	// 복제본 patch → 변경 시 publish (섹션 미할당 시 false)
+	static bool applySystemPatch(const JsonDocument& p_patch);
+	static bool applyWifiPatch(const JsonDocument& p_patch);
+	static bool applyMotionPatch(const JsonDocument& p_patch);
+	static bool applyUserProfilesPatch(const JsonDocument& p_patch);
+
 	// =====================================================
 	// 2. 목적물별 Load/Save
 	// =====================================================
@@ -127,6 +327,15 @@ class CL_C10_ConfigManager {
 
 	static void saveDirtyConfigs();
 	static void getDirtyStatus(JsonDocument& p_doc);
+
+	// write-behind 저장 (Journal cpp)
+	//  - requestSave      : 저장 예약 (Web CRUD/PATCH 경로), 구간 내 요청은 1회 저장으로 합침
+	//  - saveTick         : A00 loop 주기 호출 → coalesce 구간 경과 시 saveDirtyConfigs,
+	//                       예약 없음 + 저장 후 snapRefreshMs 경과 시 스냅샷 재기록
+	//  - flushPendingSave : 예약분 즉시 저장 (재부팅/OTA 직전)
+	static void requestSave();
+	static void saveTick();
+	static void flushPendingSave();
 	static void saveAll(const ST_A20_ConfigRoot_t& p_root);
 
 	// =====================================================
@@ -151,6 +360,16 @@ class CL_C10_ConfigManager {
 	static void toJson_UserProfiles(const ST_A20_UserProfilesRoot_t& p_cfg, JsonDocument& p_doc);
 	static void toJson_WindProfileDict(const ST_A20_WindProfileDict_t& p_cfg, JsonDocument& p_doc);
 
+	// 항목 1개 단위 Export (W10 chunked 응답: 목록 전체 문서 없이 항목별 직렬화)
+	static void toJson_ScheduleItem(const ST_A20_ScheduleItem_t& p_item, JsonObject p_obj);
+	static void toJson_UserProfileItem(const ST_A20_UserProfileItem_t& p_item, JsonObject p_obj);
+	static void toJson_WindPreset(const ST_A20_PresetEntry_t& p_item, JsonObject p_obj);
+	static void toJson_WindStyle(const ST_A20_StyleEntry_t& p_item, JsonObject p_obj);
+
+	// 항목 1개 단위 Import (loader 동일 기본값 적용, W10 chunked windDict 파일 스트리밍)
+	static void fromJson_WindPreset(JsonObjectConst p_js, ST_A20_PresetEntry_t& p_item);
+	static void fromJson_WindStyle(JsonObjectConst p_js, ST_A20_StyleEntry_t& p_item);
+
 	static void toJson_NvsSpec(const ST_A20_NvsSpecConfig_t& p_cfg, JsonDocument& p_doc);
 	static void toJson_WebPage(const ST_A20_WebPageConfig_t& p_cfg, JsonDocument& p_doc);
 
@@ -176,6 +395,11 @@ class CL_C10_ConfigManager {
 	static bool updateScheduleFromJson(uint16_t p_id, const JsonDocument& p_patch);
 	static bool deleteSchedule(uint16_t p_id);
 
+	// schedules 변경 세대(load/patch/CRUD/free 시 증가) → CT10 스케줄 구간 테이블 재컴파일 판단용
+	static uint32_t schedulesGen() {
+		return s_schedulesGen;
+	}
+
 	static int addUserProfilesFromJson(const JsonDocument& p_doc);
 	static bool updateUserProfilesFromJson(uint16_t p_id, const JsonDocument& p_patch);
 	static bool deleteUserProfiles(uint16_t p_id);
@@ -195,12 +419,48 @@ class CL_C10_ConfigManager {
 	static bool _dirty_nvsSpec;
 	static bool _dirty_webPage;
 
+	// schedules 변경 세대
+	static uint32_t s_schedulesGen;
+
+	// windDict 변경 세대
+	static uint32_t s_windDictGen;
+
+	// RCU: 전체 섹션 publish 세대 / retire 등록
+	static uint32_t s_cfgGen;
+	static void _rcuRetire(void* p_ptr, void (*p_delete)(void*));
+
+	template <typename T>
+	static bool _cowPatch(T*& p_slot, bool (*p_patch)(T&, const JsonDocument&), const JsonDocument& p_doc);
+
 	// cfg_jsonFile.json 매핑
 	static ST_A20_cfg_jsonFile_t s_cfgJsonFileMap;
 
 	// cfg_jsonFile.json 로더
 	static bool _loadCfgJsonFile();
 
+	// write-behind 예약 해제 (saveDirtyConfigs 진입 시) / 쓰기 통계 JSON (Journal cpp)
+	static void _saveSchedClear();
+	static void _writeStatsToJson(JsonDocument& p_doc);
+
+	// 보류 본문 기록 (C10 mutex 해제 후) → 실패 섹션 dirty 복구 + 재예약, 스냅샷 재기록 요청 (Core cpp)
+	static void _ioCommit();
+	static void _setDirtyMask(uint8_t p_mask);
+
+	// loadAll 파싱 통계 (Parse cpp에서 구현)
+	static void _parseStatBegin();
+	static void _parseStatSection(uint8_t p_sec);
+	static void _parseStatEnd();
+
+	// 이진 스냅샷 (Snapshot cpp에서 구현)
+	//  - _snapLoad     : 유효 섹션 복원 → 복원된 섹션 mask 반환
+	//  - _snapLoadDone : loadAll 통계 기록 + JSON 파싱 섹션이 있으면 재기록
+	//  - _snapRequest  : 저장 후 재기록 요청 (요청 시각 갱신 → 연속 저장은 1회 재기록으로 합침)
+	//  - _snapRefreshTick : 요청 후 p_idleMs 경과 시 clean 섹션 재기록 (loop task, 무효화된 경우에만)
+	static uint8_t _snapLoad(ST_A20_ConfigRoot_t& p_root);
+	static void _snapLoadDone(const ST_A20_ConfigRoot_t& p_root, uint8_t p_snapMask, uint8_t p_okMask, uint32_t p_us);
+	static void _snapRequest();
+	static void _snapRefreshTick(uint32_t p_idleMs);
+
 	// Mutex
 	static SemaphoreHandle_t s_configMutex;
 
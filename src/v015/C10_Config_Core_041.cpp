@@ -7,11 +7,15 @@
  * 기능 요약:
  *  - 전체 Config Root 로드/해제/저장 관리
  *  - LittleFS 기반 JSON I/O(ioLoadJson/ioSaveJson) + .bak 자동 복구
- *  - Dirty Flag 기반 saveDirtyConfigs / saveAll
+ *    (ioLoadJson: 섹션별 Filter / NestingLimit 옵션)
+ *  - Dirty Flag 기반 saveDirtyConfigs / saveAll (write-behind 예약은 Journal cpp)
+ *  - ioSaveJson: compact JSON → .tmp 기록 → main→.bak → .tmp→main rename (중단 시 load에서 복구)
+ *    (saveDirtyConfigs/saveAll: mutex 내 직렬화만, 파일 기록은 mutex 해제 후 IO lock 구간 → _ioCommit)
  *  - 전체 JSON Export(toJson_All)
  *  - 공장 초기화(factoryResetFromDefault)
  *  - 공용 뮤텍스 관리 (_mutex_Acquire/_mutex_Release)
  *  - cfg_jsonFile.json(=10_cfg_jsonFile.json) 기반 섹션 파일 경로 매핑 로드
+ *  - loadAll: 이진 스냅샷 유효 섹션 복원 후 나머지만 JSON 파싱 (Snapshot cpp)
  * ------------------------------------------------------
  * [구현 규칙]
  *  - 항상 소스 시작 주석 체계 유지
@@ -20,7 +24,7 @@
  *  - createNestedArray/Object/containsKey 사용 금지
  *  - memset + strlcpy 기반 안전 초기화
  *  - 주석/필드명은 JSON 구조와 동일하게 유지
- *  - 모듈별 헤더(h) + 목적물별 cpp 분리 구성 (Core/System/Schedule)
+ *  - 모듈별 헤더(h) + 목적물별 cpp 분리 구성 (Core/System/Schedule/Snapshot/Rcu/Parse)
  * ------------------------------------------------------
  * [코드 네이밍 규칙]
  *   - 전역 상수,매크로      : G_모듈약어_ 접두사
@@ -62,6 +66,9 @@ bool CL_C10_ConfigManager::_dirty_windProfile = false;
 bool CL_C10_ConfigManager::_dirty_nvsSpec     = false;
 bool CL_C10_ConfigManager::_dirty_webPage     = false;
 
+uint32_t CL_C10_ConfigManager::s_schedulesGen  = 0;
+uint32_t CL_C10_ConfigManager::s_windDictGen   = 0;
+
 // cfg_jsonFile.json 매핑 초기값 (비어있는 상태)
 ST_A20_cfg_jsonFile_t CL_C10_ConfigManager::s_cfgJsonFileMap{};
 
@@ -72,20 +79,41 @@ SemaphoreHandle_t CL_C10_ConfigManager::s_configMutex = nullptr;
 // JSON IO Helper 구현
 //  - main 파싱 실패 시 .bak을 재시도 및 필요 시 복구
 //  - .bak 파일명 규칙: "<path>.bak"
+//  - p_filter 지정 시 filter 일치 key만 문서에 적재 (섹션 loader peak heap 축소)
 // ------------------------------------------------------
-bool ioLoadJson(const char* p_path, JsonDocument& p_doc) {
+bool ioLoadJson(const char* p_path, JsonDocument& p_doc, const char* p_filter, uint8_t p_nesting) {
 	if (!p_path || !p_path[0]) {
 		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[C10] ioLoadJson: invalid path (null/empty)");
 		return false;
 	}
 
+	JsonDocument v_filter(C10_jsonAllocator());
+	if (p_filter && deserializeJson(v_filter, p_filter)) {
+		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[C10] ioLoadJson: invalid filter (%s)", p_path);
+		return false;
+	}
+
+	auto parseFile = [&](JsonDocument& p_dst, File& p_file) -> DeserializationError {
+		if (p_filter) {
+			return deserializeJson(p_dst, p_file, DeserializationOption::Filter(v_filter), DeserializationOption::NestingLimit(p_nesting));
+		}
+		return deserializeJson(p_dst, p_file, DeserializationOption::NestingLimit(p_nesting));
+	};
+
 	char v_bakPath[A20_Const::LEN_PATH + 5];
 	memset(v_bakPath, 0, sizeof(v_bakPath));
 	snprintf(v_bakPath, sizeof(v_bakPath), "%s.bak", p_path);
 
-	// 1) main 없으면 bak로 복구 시도
+	// 1) main 없으면 tmp(저장 commit 직전 중단) → bak 순으로 복구 시도
 	if (!LittleFS.exists(p_path)) {
-		if (LittleFS.exists(v_bakPath)) {
+		char v_tmpPath[A20_Const::LEN_PATH + 5];
+		memset(v_tmpPath, 0, sizeof(v_tmpPath));
+		snprintf(v_tmpPath, sizeof(v_tmpPath), "%s.tmp", p_path);
+
+		if (LittleFS.exists(v_tmpPath) && LittleFS.rename(v_tmpPath, p_path)) {
+			// tmp는 close 완료 후에만 main rename 대상 → 파싱 실패 시 아래 bak 재시도
+			CL_D10_Logger::log(EN_L10_LOG_WARN, "[C10] Recovered pending write: %s -> %s", v_tmpPath, p_path);
+		} else if (LittleFS.exists(v_bakPath)) {
 			if (!LittleFS.rename(v_bakPath, p_path)) {
 				CL_D10_Logger::log(EN_L10_LOG_ERROR, "[C10] Restore rename failed: %s -> %s", v_bakPath, p_path);
 				return false;
@@ -105,7 +133,7 @@ bool ioLoadJson(const char* p_path, JsonDocument& p_doc) {
 			return false;
 		}
 
-		DeserializationError v_e = deserializeJson(p_doc, v_f);
+		DeserializationError v_e = parseFile(p_doc, v_f);
 		v_f.close();
 
 		if (!v_e) {
@@ -121,14 +149,14 @@ bool ioLoadJson(const char* p_path, JsonDocument& p_doc) {
 		return false;
 	}
 
-	JsonDocument v_bakDoc;
+	JsonDocument v_bakDoc(C10_jsonAllocator());
 	{
 		File v_fb = LittleFS.open(v_bakPath, "r");
 		if (!v_fb) {
 			CL_D10_Logger::log(EN_L10_LOG_ERROR, "[C10] Backup open failed: %s", v_bakPath);
 			return false;
 		}
-		DeserializationError v_eb = deserializeJson(v_bakDoc, v_fb);
+		DeserializationError v_eb = parseFile(v_bakDoc, v_fb);
 		v_fb.close();
 
 		if (v_eb) {
@@ -151,58 +179,91 @@ bool ioLoadJson(const char* p_path, JsonDocument& p_doc) {
 	return true;
 }
 
-bool ioSaveJson(const char* p_path, const JsonDocument& p_doc) {
-	if (!p_path || !p_path[0]) {
-		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[C10] ioSaveJson: invalid path (null/empty)");
-		return false;
-	}
+// 원자 기록 본체: p_doc(스트리밍 직렬화) 또는 p_buf(직렬화 완료 본문) 중 하나
+static bool C10_ioWriteFile(const char* p_path, const JsonDocument* p_doc, const uint8_t* p_buf, size_t p_len) {
+	// 섹션 파일 변경 → 이진 스냅샷 무효 (저장 후 snapRefreshMs 무저장 경과 시 재기록)
+	CL_C10_ConfigManager::invalidateSnapshot(p_path);
 
 	char v_bakPath[A20_Const::LEN_PATH + 5];
+	char v_tmpPath[A20_Const::LEN_PATH + 5];
 	memset(v_bakPath, 0, sizeof(v_bakPath));
+	memset(v_tmpPath, 0, sizeof(v_tmpPath));
 	snprintf(v_bakPath, sizeof(v_bakPath), "%s.bak", p_path);
+	snprintf(v_tmpPath, sizeof(v_tmpPath), "%s.tmp", p_path);
 
-	bool v_hadMain = LittleFS.exists(p_path);
+	// 1) 새 내용은 tmp에 기록 (main/bak 미변경 상태에서 중단되어도 기존 파일 유지)
+	size_t v_expect = p_len;
+	File   v_f		= LittleFS.open(v_tmpPath, "w");
+	if (!v_f) {
+		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[C10] Save open failed: %s", v_tmpPath);
+		C10_recordFileWrite(p_path, 0, false);
+		return false;
+	}
+
+	// compact 직렬화 (pretty 대비 flash 쓰기량 감소)
+	size_t v_written = p_buf ? v_f.write(p_buf, p_len) : serializeJson(*p_doc, v_f);
+	v_f.flush();
+	v_f.close();  // LittleFS: close 시 metadata commit (fsync 상당)
+
+	if (v_written == 0 || v_written != v_expect) {
+		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[C10] Save write failed: %s (%u/%u)", v_tmpPath, (unsigned)v_written, (unsigned)v_expect);
+		LittleFS.remove(v_tmpPath);
+		C10_recordFileWrite(p_path, 0, false);
+		return false;
+	}
 
-	// 1) main -> bak
-	if (v_hadMain) {
+	// 2) main -> bak (직전 정상본 보존)
+	if (LittleFS.exists(p_path)) {
 		if (LittleFS.exists(v_bakPath)) {
 			LittleFS.remove(v_bakPath);
 		}
 		if (!LittleFS.rename(p_path, v_bakPath)) {
 			CL_D10_Logger::log(EN_L10_LOG_ERROR, "[C10] Backup rename failed: %s -> %s", p_path, v_bakPath);
+			LittleFS.remove(v_tmpPath);
+			C10_recordFileWrite(p_path, 0, false);
 			return false;
 		}
 	}
 
-	// 2) write new main
-	File v_f = LittleFS.open(p_path, "w");
-	if (!v_f) {
-		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[C10] Save open failed: %s", p_path);
+	// 3) tmp -> main (이 단계 이전 중단 시 ioLoadJson이 tmp/bak에서 복구)
+	if (!LittleFS.rename(v_tmpPath, p_path)) {
+		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[C10] Commit rename failed: %s -> %s", v_tmpPath, p_path);
 
 		// rollback
-		if (v_hadMain && LittleFS.exists(v_bakPath)) {
+		if (LittleFS.exists(v_bakPath)) {
 			LittleFS.rename(v_bakPath, p_path);
 		}
+		C10_recordFileWrite(p_path, 0, false);
 		return false;
 	}
 
-	size_t v_written = serializeJsonPretty(p_doc, v_f);
-	v_f.close();
+	C10_recordFileWrite(p_path, (uint32_t)v_written, true);
+	return true;
+}
 
-	if (v_written == 0) {
-		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[C10] Save write failed: %s", p_path);
+bool C10_ioWriteAtomic(const char* p_path, const uint8_t* p_buf, size_t p_len) {
+	if (!p_path || !p_path[0] || !p_buf) return false;
 
-		// rollback
-		if (LittleFS.exists(p_path)) {
-			LittleFS.remove(p_path);
-		}
-		if (v_hadMain && LittleFS.exists(v_bakPath)) {
-			LittleFS.rename(v_bakPath, p_path);
-		}
+	C10_ioLock();
+	bool v_ok = C10_ioWriteFile(p_path, nullptr, p_buf, p_len);
+	C10_ioUnlock();
+	return v_ok;
+}
+
+bool ioSaveJson(const char* p_path, const JsonDocument& p_doc) {
+	if (!p_path || !p_path[0]) {
+		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[C10] ioSaveJson: invalid path (null/empty)");
 		return false;
 	}
 
-	return true;
+	// 저장 보류 구간 → 본문만 직렬화 (기록은 C10 mutex 해제 후 _ioCommit)
+	bool v_ok = false;
+	if (C10_ioDeferJson(p_path, p_doc, v_ok)) return v_ok;
+
+	C10_ioLock();
+	v_ok = C10_ioWriteFile(p_path, &p_doc, nullptr, measureJson(p_doc));
+	C10_ioUnlock();
+	return v_ok;
 }
 
 // ------------------------------------------------------
@@ -324,7 +385,8 @@ void CL_C10_ConfigManager::_mutex_Release() {
 // 1. 전체 관리 (Load/Free/Save)
 // =====================================================
 bool CL_C10_ConfigManager::loadAll(ST_A20_ConfigRoot_t& p_root) {
-	bool v_ok = true;
+	bool     v_ok = true;
+	uint32_t v_t0 = micros();
 
 	// 0) cfg_jsonFile.json 먼저 로드 (옵션 A)
 	if (!_loadCfgJsonFile()) {
@@ -352,107 +414,105 @@ bool CL_C10_ConfigManager::loadAll(ST_A20_ConfigRoot_t& p_root) {
 	A20_resetUserProfilesDefault(*p_root.userProfiles);
 	A20_resetWebPageDefault(*p_root.webPage);
 
-	// 3) 실제 파일 로드 (섹션별 loadXxx 안에서 s_cfgJsonFileMap 사용)
-	if (!loadSystemConfig(*p_root.system)) v_ok = false;
-	if (!loadWifiConfig(*p_root.wifi)) v_ok = false;
-	if (!loadMotionConfig(*p_root.motion)) v_ok = false;
-	if (!loadNvsSpecConfig(*p_root.nvsSpec)) v_ok = false;
-	if (!loadWindProfileDict(*p_root.windDict)) v_ok = false;
-	if (!loadSchedules(*p_root.schedules)) v_ok = false;
-	if (!loadUserProfiles(*p_root.userProfiles)) v_ok = false;
-	if (!loadWebPageConfig(*p_root.webPage)) v_ok = false;
+	// 3) 이진 스냅샷 복원 (원본 size/내용 CRC + 데이터 CRC 일치 섹션만)
+	uint8_t v_snapMask = _snapLoad(p_root);
+	uint8_t v_okMask   = v_snapMask;
+
+	// 4) 나머지 섹션 실제 파일 로드 (섹션별 loadXxx 안에서 s_cfgJsonFileMap 사용)
+	//    섹션별 파싱 문서 peak / 항목 수 계측 (Parse cpp)
+	_parseStatBegin();
+
+	auto loadSec = [&](uint8_t p_sec, auto p_load) {
+		if (v_snapMask & G_C10_SNAP_BIT(p_sec)) return;
+
+		_parseStatSection(p_sec);
+		if (p_load()) {
+			v_okMask |= G_C10_SNAP_BIT(p_sec);
+		} else {
+			v_ok = false;
+		}
+	};
+
+	loadSec(EN_C10_SNAP_SEC_SYSTEM,        [&] { return loadSystemConfig(*p_root.system); });
+	loadSec(EN_C10_SNAP_SEC_WIFI,          [&] { return loadWifiConfig(*p_root.wifi); });
+	loadSec(EN_C10_SNAP_SEC_MOTION,        [&] { return loadMotionConfig(*p_root.motion); });
+	loadSec(EN_C10_SNAP_SEC_NVS_SPEC,      [&] { return loadNvsSpecConfig(*p_root.nvsSpec); });
+	loadSec(EN_C10_SNAP_SEC_WIND_DICT,     [&] { return loadWindProfileDict(*p_root.windDict); });
+	loadSec(EN_C10_SNAP_SEC_SCHEDULES,     [&] { return loadSchedules(*p_root.schedules); });
+	loadSec(EN_C10_SNAP_SEC_USER_PROFILES, [&] { return loadUserProfiles(*p_root.userProfiles); });
+	loadSec(EN_C10_SNAP_SEC_WEB_PAGE,      [&] { return loadWebPageConfig(*p_root.webPage); });
+
+	_parseStatEnd();
 
 	CL_D10_Logger::log(EN_L10_LOG_INFO, "[C10] Config loaded (all sections, result=%d)", v_ok ? 1 : 0);
+
+	// 5) 소요 시간 기록 + JSON 파싱 섹션이 있었으면 스냅샷 재기록 (로드 실패 섹션 제외)
+	_snapLoadDone(p_root, v_snapMask, v_okMask, micros() - v_t0);
 	return v_ok;
 }
 
 void CL_C10_ConfigManager::freeLazySection(const char* p_section, ST_A20_ConfigRoot_t& p_root) {
 	if (!p_section) return;
 
+	// reader가 포인터를 보유 중일 수 있음 → retire (grace 기간 후 해제)
 	if (strcmp(p_section, "wifi") == 0) {
-		if (p_root.wifi) {
-			delete p_root.wifi;
-			p_root.wifi = nullptr;
-		}
+		retireSection(p_root.wifi);
 		return;
 	}
 	if (strcmp(p_section, "motion") == 0) {
-		if (p_root.motion) {
-			delete p_root.motion;
-			p_root.motion = nullptr;
-		}
+		retireSection(p_root.motion);
 		return;
 	}
 	if (strcmp(p_section, "nvsSpec") == 0) {
-		if (p_root.nvsSpec) {
-			delete p_root.nvsSpec;
-			p_root.nvsSpec = nullptr;
-		}
+		retireSection(p_root.nvsSpec);
 		return;
 	}
 	if (strcmp(p_section, "schedules") == 0) {
 		if (p_root.schedules) {
-			delete p_root.schedules;
-			p_root.schedules = nullptr;
+			retireSection(p_root.schedules);
+			s_schedulesGen++;
 		}
 		return;
 	}
 	if (strcmp(p_section, "userProfiles") == 0) {
-		if (p_root.userProfiles) {
-			delete p_root.userProfiles;
-			p_root.userProfiles = nullptr;
-		}
+		retireSection(p_root.userProfiles);
 		return;
 	}
 	if (strcmp(p_section, "windDict") == 0) {
-		if (p_root.windDict) {
-			delete p_root.windDict;
-			p_root.windDict = nullptr;
-		}
+		retireSection(p_root.windDict);
 		return;
 	}
 	if (strcmp(p_section, "webPage") == 0) {
-		if (p_root.webPage) {
-			delete p_root.webPage;
-			p_root.webPage = nullptr;
-		}
+		retireSection(p_root.webPage);
 		return;
 	}
 }
 
 void CL_C10_ConfigManager::freeAll(ST_A20_ConfigRoot_t& p_root) {
-	if (p_root.system) {
-		delete p_root.system;
-		p_root.system = nullptr;
-	}
-	if (p_root.wifi) {
-		delete p_root.wifi;
-		p_root.wifi = nullptr;
-	}
-	if (p_root.motion) {
-		delete p_root.motion;
-		p_root.motion = nullptr;
-	}
-	if (p_root.nvsSpec) {
-		delete p_root.nvsSpec;
-		p_root.nvsSpec = nullptr;
-	}
-	if (p_root.windDict) {
-		delete p_root.windDict;
-		p_root.windDict = nullptr;
+	// reader 비공개 root (reloadAll 실패 등): 공개된 적 없는 섹션 → 즉시 delete, 세대 변경 없음
+	if (&p_root != &g_A20_config_root) {
+		_deleteSection(p_root.system);
+		_deleteSection(p_root.wifi);
+		_deleteSection(p_root.motion);
+		_deleteSection(p_root.nvsSpec);
+		_deleteSection(p_root.windDict);
+		_deleteSection(p_root.schedules);
+		_deleteSection(p_root.userProfiles);
+		_deleteSection(p_root.webPage);
+		return;
 	}
+
+	retireSection(p_root.system);
+	retireSection(p_root.wifi);
+	retireSection(p_root.motion);
+	retireSection(p_root.nvsSpec);
+	retireSection(p_root.windDict);
 	if (p_root.schedules) {
-		delete p_root.schedules;
-		p_root.schedules = nullptr;
-	}
-	if (p_root.userProfiles) {
-		delete p_root.userProfiles;
-		p_root.userProfiles = nullptr;
-	}
-	if (p_root.webPage) {
-		delete p_root.webPage;
-		p_root.webPage = nullptr;
+		retireSection(p_root.schedules);
+		s_schedulesGen++;
 	}
+	retireSection(p_root.userProfiles);
+	retireSection(p_root.webPage);
 
 	CL_D10_Logger::log(EN_L10_LOG_INFO, "[C10] All config objects freed");
 }
@@ -463,6 +523,12 @@ void CL_C10_ConfigManager::freeAll(ST_A20_ConfigRoot_t& p_root) {
 void CL_C10_ConfigManager::saveDirtyConfigs() {
 	C10_MUTEX_ACQUIRE_VOID();
 
+	// write-behind 예약분 포함 저장 → 예약 해제 (이후 requestSave는 새 구간)
+	_saveSchedClear();
+
+	// mutex 보유 중에는 직렬화만 (save* 성공 = 본문 보류 완료, 기록 실패 시 _ioCommit에서 dirty 복구)
+	C10_ioDeferBegin();
+
 	if (_dirty_system && g_A20_config_root.system) {
 		if (saveSystemConfig(*g_A20_config_root.system)) _dirty_system = false;
 	}
@@ -488,8 +554,39 @@ void CL_C10_ConfigManager::saveDirtyConfigs() {
 		if (saveWebPageConfig(*g_A20_config_root.webPage)) _dirty_webPage = false;
 	}
 
-	CL_D10_Logger::log(EN_L10_LOG_INFO, "[C10] All dirty configs saved to storage.");
+	const bool v_commit = C10_ioDeferEnd();
 	C10_MUTEX_RELEASE();
+
+	// 파일 기록 (tmp → bak → rename)은 mutex 밖 → 저장 중 PATCH/reader 비차단
+	if (v_commit) _ioCommit();
+
+	CL_D10_Logger::log(EN_L10_LOG_INFO, "[C10] All dirty configs saved to storage.");
+}
+
+void CL_C10_ConfigManager::_ioCommit() {
+	const uint8_t v_fail = C10_ioCommitPending();
+	if (v_fail) {
+		// 기록 실패 섹션 → dirty 복구 후 다음 coalesce 구간에 재시도
+		C10_MUTEX_ACQUIRE_VOID();
+		_setDirtyMask(v_fail);
+		C10_MUTEX_RELEASE();
+		requestSave();
+		CL_D10_Logger::log(EN_L10_LOG_WARN, "[C10] Save commit failed (sections=0x%02X) → requeued", (unsigned)v_fail);
+	}
+
+	// 스냅샷은 즉시 재기록하지 않음 (연속 저장 → snapRefreshMs 무저장 경과 후 1회)
+	_snapRequest();
+}
+
+void CL_C10_ConfigManager::_setDirtyMask(uint8_t p_mask) {
+	if (p_mask & G_C10_SNAP_BIT(EN_C10_SNAP_SEC_SYSTEM))        _dirty_system       = true;
+	if (p_mask & G_C10_SNAP_BIT(EN_C10_SNAP_SEC_WIFI))          _dirty_wifi         = true;
+	if (p_mask & G_C10_SNAP_BIT(EN_C10_SNAP_SEC_MOTION))        _dirty_motion       = true;
+	if (p_mask & G_C10_SNAP_BIT(EN_C10_SNAP_SEC_NVS_SPEC))      _dirty_nvsSpec      = true;
+	if (p_mask & G_C10_SNAP_BIT(EN_C10_SNAP_SEC_WIND_DICT))     _dirty_windProfile  = true;
+	if (p_mask & G_C10_SNAP_BIT(EN_C10_SNAP_SEC_SCHEDULES))     _dirty_schedules    = true;
+	if (p_mask & G_C10_SNAP_BIT(EN_C10_SNAP_SEC_USER_PROFILES)) _dirty_userProfiles = true;
+	if (p_mask & G_C10_SNAP_BIT(EN_C10_SNAP_SEC_WEB_PAGE))      _dirty_webPage      = true;
 }
 
 // 현재 Dirty 상태 조회
@@ -505,22 +602,30 @@ void CL_C10_ConfigManager::getDirtyStatus(JsonDocument& p_doc) {
 	p_doc["windDict"]     = _dirty_windProfile;
 	p_doc["webPage"]      = _dirty_webPage;
 
+	// write-behind 예약 상태 + 파일별 쓰기 횟수
+	_writeStatsToJson(p_doc);
+
 	C10_MUTEX_RELEASE();
 }
 
 void CL_C10_ConfigManager::saveAll(const ST_A20_ConfigRoot_t& p_root) {
 	C10_MUTEX_ACQUIRE_VOID();
 
-	if (p_root.system)       saveSystemConfig(*p_root.system);
-	if (p_root.wifi)         saveWifiConfig(*p_root.wifi);
-	if (p_root.motion)       saveMotionConfig(*p_root.motion);
-	if (p_root.nvsSpec)      saveNvsSpecConfig(*p_root.nvsSpec);
-	if (p_root.schedules)    saveSchedules(*p_root.schedules);
+	// saveDirtyConfigs 와 동일: mutex 내 직렬화, 기록은 해제 후
+	C10_ioDeferBegin();
+	if (p_root.system) saveSystemConfig(*p_root.system);
+	if (p_root.wifi) saveWifiConfig(*p_root.wifi);
+	if (p_root.motion) saveMotionConfig(*p_root.motion);
+	if (p_root.nvsSpec) saveNvsSpecConfig(*p_root.nvsSpec);
+	if (p_root.schedules) saveSchedules(*p_root.schedules);
 	if (p_root.userProfiles) saveUserProfiles(*p_root.userProfiles);
-	if (p_root.windDict)     saveWindProfileDict(*p_root.windDict);
-	if (p_root.webPage)      saveWebPageConfig(*p_root.webPage);
+	if (p_root.windDict) saveWindProfileDict(*p_root.windDict);
+	if (p_root.webPage) saveWebPageConfig(*p_root.webPage);
+	const bool v_commit = C10_ioDeferEnd();
 
 	C10_MUTEX_RELEASE();
+
+	if (v_commit) _ioCommit();
 }
 
 // -----------------------------------------------------
@@ -652,7 +757,18 @@ bool CL_C10_ConfigManager::factoryResetFromDefault() {
 
 	if (!v_fileFound) {
 		CL_D10_Logger::log(EN_L10_LOG_INFO, "[C10] Factory Reset: Using hardcoded defaults in C++.");
-		A20_resetToDefault(g_A20_config_root);
+
+		// 기본값 새 세대 구성 → publish (reader가 보는 섹션은 in-place 변경 금지)
+		ST_A20_ConfigRoot_t v_root;
+		v_root.system       = cloneSection<ST_A20_SystemConfig_t>(nullptr, A20_resetSystemDefault);
+		v_root.wifi         = cloneSection<ST_A20_WifiConfig_t>(nullptr, A20_resetWifiDefault);
+		v_root.motion       = cloneSection<ST_A20_MotionConfig_t>(nullptr, A20_resetMotionDefault);
+		v_root.nvsSpec      = cloneSection<ST_A20_NvsSpecConfig_t>(nullptr, A20_resetNvsSpecDefault);
+		v_root.windDict     = cloneSection<ST_A20_WindProfileDict_t>(nullptr, A20_resetWindProfileDictDefault);
+		v_root.schedules    = cloneSection<ST_A20_SchedulesRoot_t>(nullptr, A20_resetSchedulesDefault);
+		v_root.userProfiles = cloneSection<ST_A20_UserProfilesRoot_t>(nullptr, A20_resetUserProfilesDefault);
+		v_root.webPage      = cloneSection<ST_A20_WebPageConfig_t>(nullptr, A20_resetWebPageDefault);
+		publishRoot(v_root);
 		saveAll(g_A20_config_root);
 	}
 
@@ -5,7 +5,7 @@
  * 모듈명 : Smart Nature Wind Configuration Manager - Extras (NvsSpec/WebPage)
  * ------------------------------------------------------
  * 기능 요약:
- *  - NvsSpec / WebPage 설정 Load/Save
+ *  - NvsSpec / WebPage 설정 Load/Save (Load: Filter 부분 파싱, pages[]는 항목 단위 스트리밍)
  *  - NvsSpec / WebPage 설정 JSON Patch 적용
  *  - NvsSpec / WebPage 설정 JSON Export
  *  - camelCase only (snake_case fallback 제거)
@@ -84,9 +84,62 @@ static JsonObjectConst C10_pickRootObject(JsonDocument& p_doc, const char* p_wra
 
 // =====================================================
 // 2-x. 목적물별 Load 구현 (NvsSpec / WebPage)
+//  - NvsSpec: Filter 부분 파싱 (랩핑/루트형 모두)
+//  - WebPage: pages[]는 항목 단위 스트리밍, reDirect/assets는 Filter 문서
 // =====================================================
+static const char G_C10_FILTER_NVS_SPEC[] =
+	"{\"nvsSpec\":{\"namespace\":true,\"entries\":true},\"namespace\":true,\"entries\":true}";
+static const char G_C10_FILTER_WEB_PAGE[] = "{\"reDirect\":true,\"assets\":true}";
+static const char* const G_C10_KEYS_WEB_PAGES[] = {"pages"};
+
+// pages[] 항목 → ST_A20_PageItem_t (uri/path 없는 항목은 스킵)
+static bool C10_fromJson_PageItem(JsonObjectConst p_jp, uint16_t p_idx, void* p_ctx) {
+	ST_A20_WebPageConfig_t& v_cfg = *(ST_A20_WebPageConfig_t*)p_ctx;
+	if (p_idx == 0) v_cfg.pageCount = 0;
+	if (v_cfg.pageCount >= A20_Const::MAX_PAGES) return false;
+
+	ST_A20_PageItem_t& v_p = v_cfg.pages[v_cfg.pageCount];
+	memset(&v_p, 0, sizeof(v_p));
+
+	strlcpy(v_p.uri,   C10_getStr(p_jp, "uri", ""), sizeof(v_p.uri));
+	strlcpy(v_p.path,  C10_getStr(p_jp, "path", ""), sizeof(v_p.path));
+	strlcpy(v_p.label, C10_getStr(p_jp, "label", ""), sizeof(v_p.label));
+
+	v_p.enable = C10_getBool(p_jp, "enable", true);
+	v_p.isMain = C10_getBool(p_jp, "isMain", false);
+	v_p.order  = C10_getNum<uint16_t>(p_jp, "order", 0);
+
+	// pageAssets[]
+	v_p.pageAssetCount = 0;
+	JsonArrayConst j_assets = C10_getArr(p_jp, "pageAssets");
+	if (!j_assets.isNull()) {
+		for (JsonObjectConst j_a : j_assets) {
+			if (v_p.pageAssetCount >= A20_Const::MAX_PAGE_ASSETS) break;
+
+			ST_A20_PageAsset_t& v_a = v_p.pageAssets[v_p.pageAssetCount];
+			memset(&v_a, 0, sizeof(v_a));
+
+			strlcpy(v_a.uri,  C10_getStr(j_a, "uri", ""), sizeof(v_a.uri));
+			strlcpy(v_a.path, C10_getStr(j_a, "path", ""), sizeof(v_a.path));
+
+			// 불량 방지
+			if (v_a.uri[0] == '\0' || v_a.path[0] == '\0') continue;
+
+			v_p.pageAssetCount++;
+		}
+	}
+
+	// uri/path 둘 중 하나라도 없으면 스킵(불량 방지)
+	if (v_p.uri[0] == '\0' || v_p.path[0] == '\0') {
+		return true;
+	}
+
+	v_cfg.pageCount++;
+	return true;
+}
+
 bool CL_C10_ConfigManager::loadNvsSpecConfig(ST_A20_NvsSpecConfig_t& p_cfg) {
-	JsonDocument v_doc;
+	JsonDocument v_doc(C10_jsonAllocator());
 
 	const char* v_cfgJsonPath = nullptr;
 	if (s_cfgJsonFileMap.nvsSpec[0] != '\0') {
@@ -96,7 +149,7 @@ bool CL_C10_ConfigManager::loadNvsSpecConfig(ST_A20_NvsSpecConfig_t& p_cfg) {
 		return false;
 	}
 
-	if (!ioLoadJson(v_cfgJsonPath, v_doc)) {
+	if (!ioLoadJson(v_cfgJsonPath, v_doc, G_C10_FILTER_NVS_SPEC, G_C10_JSON_NEST_SECTION)) {
 		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[C10] loadNvsSpecConfig: ioLoadJson failed (%s)", v_cfgJsonPath);
 		return false;
 	}
@@ -148,7 +201,7 @@ bool CL_C10_ConfigManager::loadNvsSpecConfig(ST_A20_NvsSpecConfig_t& p_cfg) {
 }
 
 bool CL_C10_ConfigManager::loadWebPageConfig(ST_A20_WebPageConfig_t& p_cfg) {
-	JsonDocument v_doc;
+	JsonDocument v_doc(C10_jsonAllocator());
 
 	const char* v_cfgJsonPath = nullptr;
 	if (s_cfgJsonFileMap.webPage[0] != '\0') {
@@ -158,7 +211,7 @@ bool CL_C10_ConfigManager::loadWebPageConfig(ST_A20_WebPageConfig_t& p_cfg) {
 		return false;
 	}
 
-	if (!ioLoadJson(v_cfgJsonPath, v_doc)) {
+	if (!ioLoadJson(v_cfgJsonPath, v_doc, G_C10_FILTER_WEB_PAGE, G_C10_JSON_NEST_SECTION)) {
 		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[C10] loadWebPageConfig: ioLoadJson failed (%s)", v_cfgJsonPath);
 		return false;
 	}
@@ -172,52 +225,14 @@ bool CL_C10_ConfigManager::loadWebPageConfig(ST_A20_WebPageConfig_t& p_cfg) {
 
 	memset(&p_cfg, 0, sizeof(p_cfg));
 
-	// pages[]
+	// pages[]: 항목 단위 스트리밍 (reDirect/assets 문서와 별도 pass)
 	p_cfg.pageCount = 0;
-	JsonArrayConst j_pages = C10_getArr(j_root, "pages");
-	if (!j_pages.isNull()) {
-		for (JsonObjectConst j_p : j_pages) {
-			if (p_cfg.pageCount >= A20_Const::MAX_PAGES) break;
-
-			ST_A20_PageItem_t& v_p = p_cfg.pages[p_cfg.pageCount];
-			memset(&v_p, 0, sizeof(v_p));
-
-			strlcpy(v_p.uri,   C10_getStr(j_p, "uri", ""), sizeof(v_p.uri));
-			strlcpy(v_p.path,  C10_getStr(j_p, "path", ""), sizeof(v_p.path));
-			strlcpy(v_p.label, C10_getStr(j_p, "label", ""), sizeof(v_p.label));
-
-			v_p.enable = C10_getBool(j_p, "enable", true);
-			v_p.isMain = C10_getBool(j_p, "isMain", false);
-			v_p.order  = C10_getNum<uint16_t>(j_p, "order", 0);
-
-			// pageAssets[]
-			v_p.pageAssetCount = 0;
-			JsonArrayConst j_assets = C10_getArr(j_p, "pageAssets");
-			if (!j_assets.isNull()) {
-				for (JsonObjectConst j_a : j_assets) {
-					if (v_p.pageAssetCount >= A20_Const::MAX_PAGE_ASSETS) break;
-
-					ST_A20_PageAsset_t& v_a = v_p.pageAssets[v_p.pageAssetCount];
-					memset(&v_a, 0, sizeof(v_a));
-
-					strlcpy(v_a.uri,  C10_getStr(j_a, "uri", ""), sizeof(v_a.uri));
-					strlcpy(v_a.path, C10_getStr(j_a, "path", ""), sizeof(v_a.path));
-
-					// 불량 방지
-					if (v_a.uri[0] == '\0' || v_a.path[0] == '\0') continue;
-
-					v_p.pageAssetCount++;
-				}
-			}
-
-			// uri/path 둘 중 하나라도 없으면 스킵(불량 방지)
-			if (v_p.uri[0] == '\0' || v_p.path[0] == '\0') {
-				continue;
-			}
-
-			p_cfg.pageCount++;
-		}
-	} else {
+	int16_t v_pages = ioForEachJsonItem(v_cfgJsonPath, G_C10_KEYS_WEB_PAGES, 1, G_C10_JSON_NEST_ITEM, C10_fromJson_PageItem, &p_cfg);
+	if (v_pages < 0) {
+		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[C10] loadWebPageConfig: pages load failed (%s)", v_cfgJsonPath);
+		return false;
+	}
+	if (v_pages == 0) {
 		CL_D10_Logger::log(EN_L10_LOG_WARN, "[C10] loadWebPageConfig: missing 'pages' (empty config)");
 	}
 
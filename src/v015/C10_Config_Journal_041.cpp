@@ -0,0 +1,358 @@
+/*
+ * ------------------------------------------------------
+ * 소스명 : C10_Config_Journal_041.cpp
+ * 모듈 약어 : C10
+ * 모듈명 : Smart Nature Wind Configuration Manager - Write-behind Journal
+ * ------------------------------------------------------
+ * 기능 요약:
+ *  - 설정 저장 write-behind: requestSave()는 저장 예약만, saveTick()(A00 loop)이 coalesce 후 1회 저장
+ *      . 마지막 요청 후 system.storage.saveCoalesceMs 무요청 → 저장
+ *      . 연속 요청 중에도 최초 요청 후 system.storage.saveMaxDelayMs 경과 시 강제 저장
+ *      . 명시 저장(/api/config/save) / 재부팅 전 flushPendingSave() 즉시 저장
+ *      . 예약 없음 + 마지막 저장 후 snapRefreshMs 경과 → 이진 스냅샷 1회 재기록 (_snapRefreshTick)
+ *  - 저장 보류: saveDirtyConfigs/saveAll 은 C10 mutex 보유 중 섹션 본문 직렬화만,
+ *    파일 기록(tmp → bak → rename)은 mutex 해제 후 IO lock 구간에서 수행 (C10_ioCommitPending)
+ *  - 파일별 쓰기 통계 (ioSaveJson / 스냅샷 → C10_recordFileWrite): 횟수/바이트/실패/마지막 시각
+ *  - /api/config/dirty 응답에 예약 상태 + 파일별 쓰기 통계 추가
+ * ------------------------------------------------------
+ * [구현 규칙]
+ *  - 항상 소스 시작 주석 체계 유지
+ *  - ArduinoJson v7.x.x 사용 (v6 이하 사용 금지)
+ *  - JsonDocument 단일 타입만 사용
+ *  - createNestedArray/Object/containsKey 사용 금지
+ *  - memset + strlcpy 기반 안전 초기화
+ *  - 주석/필드명은 JSON 구조와 동일하게 유지
+ *  - 모듈별 헤더(h) + 목적물별 cpp 분리 구성 (Core/System/Schedule/Snapshot/Rcu/Parse/Journal)
+ * ------------------------------------------------------
+ * [코드 네이밍 규칙]
+ *   - 전역 상수,매크로      : G_모듈약어_ 접두사
+ *   - 전역 변수             : g_모듈약어_ 접두사
+ *   - 전역 함수             : 모듈약어_ 접두사
+ *   - type                  : T_모듈약어_ 접두사
+ *   - typedef               : _t  접미사
+ *   - enum 상수             : EN_모듈약어_ 접두사
+ *   - 구조체                : ST_모듈약어_ 접두사
+ *   - 클래스명              : CL_모듈약어_ 접두사
+ *   - 클래스 private 멤버   : _ 접두사
+ *   - 클래스 멤버(함수/변수) : 모듈약어 접두사 미사용
+ *   - 클래스 정적 멤버      : s_ 접두사
+ *   - 함수 로컬 변수        : v_ 접두사
+ *   - 함수 인자             : p_ 접두사
+ * ------------------------------------------------------
+ */
+
+#include <Arduino.h>
+#include <freertos/task.h>
+
+#include "C10_Config_041.h"
+
+// ------------------------------------------------------
+// 저장 예약 상태
+// ------------------------------------------------------
+typedef struct {
+	bool     pending;
+	uint32_t firstReqMs;  // 예약 구간 최초 요청 시각
+	uint32_t lastReqMs;	  // 예약 구간 마지막 요청 시각
+	uint32_t requests;	  // 누적 requestSave 호출 수
+	uint32_t windowReqs;  // 현재 예약 구간 요청 수
+	uint32_t coalesced;	  // 저장 1회로 흡수된 요청 수 (구간 요청 - 1 누적)
+	uint32_t flushes;	  // 누적 실제 저장(saveDirtyConfigs) 수 (명시 저장 포함)
+	uint32_t forced;	  // saveMaxDelayMs 도달 강제 저장 수
+	uint32_t ioFails;	  // 보류 본문 기록 실패 → 재예약 수
+} ST_C10_SaveSched_t;
+
+// 파일별 쓰기 통계 (index: EN_C10_SNAP_SEC_*, 이후 스냅샷 / 기타 파일)
+typedef struct {
+	uint32_t count;
+	uint32_t bytes;
+	uint32_t fails;
+	uint32_t lastMs;
+} ST_C10_FileWriteStat_t;
+
+#define G_C10_WRITE_STAT_SNAPSHOT EN_C10_SNAP_SEC_COUNT
+#define G_C10_WRITE_STAT_OTHER    (EN_C10_SNAP_SEC_COUNT + 1)
+#define G_C10_WRITE_STAT_COUNT    (EN_C10_SNAP_SEC_COUNT + 2)
+
+// 보류 본문 (섹션별 최신 1개, malloc 버퍼)
+typedef struct {
+	char*  buf;
+	size_t len;
+	char   path[A20_Const::LEN_PATH];
+} ST_C10_IoPending_t;
+
+static ST_C10_SaveSched_t     s_saveSched = {false, 0, 0, 0, 0, 0, 0, 0, 0};
+static ST_C10_FileWriteStat_t s_writeStat[G_C10_WRITE_STAT_COUNT];
+static portMUX_TYPE           s_saveMux   = portMUX_INITIALIZER_UNLOCKED;
+
+static ST_C10_IoPending_t s_ioPending[EN_C10_SNAP_SEC_COUNT];
+static SemaphoreHandle_t  s_ioMutex       = nullptr;
+static TaskHandle_t       s_ioDeferOwner  = nullptr;  // 보류 구간 task (C10 mutex 보유자만 변경)
+static uint8_t            s_ioDeferDepth  = 0;
+
+// 경로 → 통계 index (cfg_jsonFile 매핑 기준, 스냅샷 파일 별도)
+static uint8_t C10_writeStatIndex(const char* p_path) {
+	const ST_A20_cfg_jsonFile_t& v_map = CL_C10_ConfigManager::getCfgJsonFileMap();
+
+	const char* const v_paths[EN_C10_SNAP_SEC_COUNT] = {
+		v_map.system, v_map.wifi, v_map.motion, v_map.nvsSpec,
+		v_map.windDict, v_map.schedules, v_map.userProfiles, v_map.webPage};
+
+	for (uint8_t v_i = 0; v_i < EN_C10_SNAP_SEC_COUNT; v_i++) {
+		if (v_paths[v_i][0] != '\0' && strcmp(v_paths[v_i], p_path) == 0) return v_i;
+	}
+	if (strcmp(p_path, A20_Const::CFG_SNAPSHOT_FILE) == 0) return G_C10_WRITE_STAT_SNAPSHOT;
+	return G_C10_WRITE_STAT_OTHER;
+}
+
+// system.storage 런타임 값 (섹션 미로드 시 기본값, maxDelay >= coalesce 보정)
+static void C10_saveTiming(uint32_t& p_coalesceMs, uint32_t& p_maxDelayMs, uint32_t& p_snapMs) {
+	const ST_A20_SystemConfig_t* v_sys = C10_rcuRead(g_A20_config_root.system);
+
+	p_coalesceMs = v_sys ? v_sys->system.storage.saveCoalesceMs : G_A20_SAVE_DEFAULT_COALESCE_MS;
+	p_maxDelayMs = v_sys ? v_sys->system.storage.saveMaxDelayMs : G_A20_SAVE_DEFAULT_MAX_DELAY_MS;
+	p_snapMs     = v_sys ? v_sys->system.storage.snapRefreshMs : G_A20_SAVE_DEFAULT_SNAP_REFRESH_MS;
+
+	if (p_coalesceMs == 0) p_coalesceMs = G_A20_SAVE_DEFAULT_COALESCE_MS;
+	if (p_snapMs == 0) p_snapMs = G_A20_SAVE_DEFAULT_SNAP_REFRESH_MS;
+	if (p_maxDelayMs < p_coalesceMs) p_maxDelayMs = p_coalesceMs;
+}
+
+void C10_recordFileWrite(const char* p_path, uint32_t p_bytes, bool p_ok) {
+	if (!p_path) return;
+
+	uint8_t  v_idx = C10_writeStatIndex(p_path);
+	uint32_t v_now = millis();
+
+	portENTER_CRITICAL(&s_saveMux);
+	ST_C10_FileWriteStat_t& v_st = s_writeStat[v_idx];
+	if (p_ok) {
+		v_st.count++;
+		v_st.bytes += p_bytes;
+		v_st.lastMs = v_now;
+	} else {
+		v_st.fails++;
+	}
+	portEXIT_CRITICAL(&s_saveMux);
+}
+
+// =====================================================
+// 파일 IO lock / 저장 보류
+// =====================================================
+void C10_ioLock() {
+	if (!__atomic_load_n(&s_ioMutex, __ATOMIC_ACQUIRE)) {
+		SemaphoreHandle_t v_new	 = xSemaphoreCreateRecursiveMutex();
+		SemaphoreHandle_t v_null = nullptr;
+		if (!v_new) {
+			CL_D10_Logger::log(EN_L10_LOG_ERROR, "[C10] IO mutex create failed!");
+			return;
+		}
+		// 동시 최초 호출 → 1개만 채택
+		if (!__atomic_compare_exchange_n(&s_ioMutex, &v_null, v_new, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+			vSemaphoreDelete(v_new);
+		}
+	}
+	xSemaphoreTakeRecursive(s_ioMutex, portMAX_DELAY);
+}
+
+void C10_ioUnlock() {
+	if (s_ioMutex) xSemaphoreGiveRecursive(s_ioMutex);
+}
+
+void C10_ioDeferBegin() {
+	if (s_ioDeferDepth++ == 0) {
+		__atomic_store_n(&s_ioDeferOwner, xTaskGetCurrentTaskHandle(), __ATOMIC_RELEASE);
+	}
+}
+
+bool C10_ioDeferEnd() {
+	if (s_ioDeferDepth == 0 || --s_ioDeferDepth != 0) return false;
+	__atomic_store_n(&s_ioDeferOwner, (TaskHandle_t) nullptr, __ATOMIC_RELEASE);
+	return true;
+}
+
+bool C10_ioDeferJson(const char* p_path, const JsonDocument& p_doc, bool& p_ok) {
+	if (__atomic_load_n(&s_ioDeferOwner, __ATOMIC_ACQUIRE) != xTaskGetCurrentTaskHandle()) return false;
+
+	const uint8_t v_idx = C10_writeStatIndex(p_path);
+	if (v_idx >= EN_C10_SNAP_SEC_COUNT) return false;
+
+	// heap 부족 → 호출자가 즉시 기록 (스트리밍 직렬화, mutex 보유 중)
+	const size_t v_len = measureJson(p_doc);
+	char*		 v_buf = (char*)malloc(v_len + 1);
+	if (!v_buf) return false;
+
+	if (v_len == 0 || serializeJson(p_doc, v_buf, v_len + 1) != v_len) {
+		free(v_buf);
+		C10_recordFileWrite(p_path, 0, false);
+		p_ok = false;
+		return true;
+	}
+
+	// 이전 보류 본문은 새 본문으로 대체 (기록 전 재저장 → 최신 1회만 기록)
+	portENTER_CRITICAL(&s_saveMux);
+	ST_C10_IoPending_t& v_p	  = s_ioPending[v_idx];
+	char*				v_old = v_p.buf;
+	v_p.buf					  = v_buf;
+	v_p.len					  = v_len;
+	strlcpy(v_p.path, p_path, sizeof(v_p.path));
+	portEXIT_CRITICAL(&s_saveMux);
+
+	if (v_old) free(v_old);
+	p_ok = true;
+	return true;
+}
+
+uint8_t C10_ioCommitPending() {
+	uint8_t v_fail = 0;
+
+	C10_ioLock();
+	for (uint8_t v_i = 0; v_i < EN_C10_SNAP_SEC_COUNT; v_i++) {
+		char   v_path[A20_Const::LEN_PATH];
+		char*  v_buf = nullptr;
+		size_t v_len = 0;
+
+		portENTER_CRITICAL(&s_saveMux);
+		ST_C10_IoPending_t& v_p = s_ioPending[v_i];
+		if (v_p.buf) {
+			v_buf = v_p.buf;
+			v_len = v_p.len;
+			memcpy(v_path, v_p.path, sizeof(v_path));
+			v_p.buf = nullptr;
+			v_p.len = 0;
+		}
+		portEXIT_CRITICAL(&s_saveMux);
+
+		if (!v_buf) continue;
+		if (!C10_ioWriteAtomic(v_path, (const uint8_t*)v_buf, v_len)) v_fail |= G_C10_SNAP_BIT(v_i);
+		free(v_buf);
+	}
+	C10_ioUnlock();
+
+	if (v_fail) {
+		portENTER_CRITICAL(&s_saveMux);
+		s_saveSched.ioFails++;
+		portEXIT_CRITICAL(&s_saveMux);
+	}
+	return v_fail;
+}
+
+uint8_t C10_ioPendingMask() {
+	uint8_t v_mask = 0;
+
+	portENTER_CRITICAL(&s_saveMux);
+	for (uint8_t v_i = 0; v_i < EN_C10_SNAP_SEC_COUNT; v_i++) {
+		if (s_ioPending[v_i].buf) v_mask |= G_C10_SNAP_BIT(v_i);
+	}
+	portEXIT_CRITICAL(&s_saveMux);
+	return v_mask;
+}
+
+// =====================================================
+// 저장 예약 / coalesce
+// =====================================================
+void CL_C10_ConfigManager::requestSave() {
+	uint32_t v_now = millis();
+
+	portENTER_CRITICAL(&s_saveMux);
+	if (!s_saveSched.pending) {
+		s_saveSched.pending    = true;
+		s_saveSched.firstReqMs = v_now;
+	}
+	s_saveSched.lastReqMs = v_now;
+	s_saveSched.requests++;
+	s_saveSched.windowReqs++;
+	portEXIT_CRITICAL(&s_saveMux);
+}
+
+void CL_C10_ConfigManager::saveTick() {
+	uint32_t v_coalesceMs = 0;
+	uint32_t v_maxDelayMs = 0;
+	uint32_t v_snapMs	  = 0;
+	C10_saveTiming(v_coalesceMs, v_maxDelayMs, v_snapMs);
+
+	uint32_t v_now	   = millis();
+	bool	 v_pending = false;
+	bool	 v_due	   = false;
+	bool	 v_forced  = false;
+
+	portENTER_CRITICAL(&s_saveMux);
+	v_pending = s_saveSched.pending;
+	if (v_pending) {
+		v_forced = (uint32_t)(v_now - s_saveSched.firstReqMs) >= v_maxDelayMs;
+		v_due	 = v_forced || (uint32_t)(v_now - s_saveSched.lastReqMs) >= v_coalesceMs;
+		if (v_forced) s_saveSched.forced++;
+	}
+	portEXIT_CRITICAL(&s_saveMux);
+
+	// 예약 해제는 saveDirtyConfigs 진입 시 (_saveSchedClear)
+	if (v_due) {
+		saveDirtyConfigs();
+		return;
+	}
+
+	// 저장 예약 없음 → 무저장 구간이 snapRefreshMs 이어졌을 때만 스냅샷 재기록
+	if (!v_pending) _snapRefreshTick(v_snapMs);
+}
+
+void CL_C10_ConfigManager::flushPendingSave() {
+	portENTER_CRITICAL(&s_saveMux);
+	bool v_pending = s_saveSched.pending;
+	portEXIT_CRITICAL(&s_saveMux);
+
+	if (v_pending) saveDirtyConfigs();
+}
+
+void CL_C10_ConfigManager::_saveSchedClear() {
+	portENTER_CRITICAL(&s_saveMux);
+	if (s_saveSched.windowReqs > 1) s_saveSched.coalesced += s_saveSched.windowReqs - 1;
+	s_saveSched.pending	   = false;
+	s_saveSched.windowReqs = 0;
+	s_saveSched.flushes++;
+	portEXIT_CRITICAL(&s_saveMux);
+}
+
+// =====================================================
+// 통계 (/api/config/dirty)
+// =====================================================
+void CL_C10_ConfigManager::_writeStatsToJson(JsonDocument& p_doc) {
+	static const char* const s_names[G_C10_WRITE_STAT_COUNT] = {
+		"system", "wifi", "motion", "nvsSpec", "windDict", "schedules", "userProfiles", "webPage", "snapshot", "other"};
+
+	uint32_t v_coalesceMs = 0;
+	uint32_t v_maxDelayMs = 0;
+	uint32_t v_snapMs	  = 0;
+	C10_saveTiming(v_coalesceMs, v_maxDelayMs, v_snapMs);
+
+	ST_C10_SaveSched_t     v_sched;
+	ST_C10_FileWriteStat_t v_stat[G_C10_WRITE_STAT_COUNT];
+
+	portENTER_CRITICAL(&s_saveMux);
+	v_sched = s_saveSched;
+	memcpy(v_stat, s_writeStat, sizeof(v_stat));
+	portEXIT_CRITICAL(&s_saveMux);
+
+	uint32_t   v_now = millis();
+	JsonObject v_sv	 = p_doc["save"].to<JsonObject>();
+	v_sv["pending"]	   = v_sched.pending;
+	v_sv["coalesceMs"] = v_coalesceMs;
+	v_sv["maxDelayMs"] = v_maxDelayMs;
+	v_sv["snapRefreshMs"] = v_snapMs;
+	if (v_sched.pending) {
+		uint32_t v_idle = v_now - v_sched.lastReqMs;
+		v_sv["dueInMs"] = v_idle >= v_coalesceMs ? 0 : (uint32_t)(v_coalesceMs - v_idle);
+	}
+	v_sv["requests"]  = v_sched.requests;
+	v_sv["flushes"]	  = v_sched.flushes;
+	v_sv["forced"]	  = v_sched.forced;
+	v_sv["coalesced"] = v_sched.coalesced;
+	v_sv["ioFails"]	  = v_sched.ioFails;
+
+	JsonObject v_wr = p_doc["writes"].to<JsonObject>();
+	for (uint8_t v_i = 0; v_i < G_C10_WRITE_STAT_COUNT; v_i++) {
+		JsonObject v_o = v_wr[s_names[v_i]].to<JsonObject>();
+		v_o["count"] = v_stat[v_i].count;
+		v_o["bytes"] = v_stat[v_i].bytes;
+		v_o["fails"] = v_stat[v_i].fails;
+		if (v_stat[v_i].count > 0) v_o["agoMs"] = v_now - v_stat[v_i].lastMs;
+	}
+}
@@ -0,0 +1,179 @@
+#pragma once
+/*
+ * ------------------------------------------------------
+ * 소스명 : C10_Config_JsonSeek_041.h
+ * 모듈 약어 : C10
+ * 모듈명 : Smart Nature Wind Configuration Manager - JSON Stream Key Seek
+ * ------------------------------------------------------
+ * 기능 요약:
+ *  - ioForEachJsonItem(C10_Config_Parse_041.cpp) 배열 위치 탐색용 Stream 스캐너
+ *  - C10_ioSeekKey: 현재 위치의 object 직속 member key만 비교 → 값 시작 위치로 이동
+ *      . 반환 1=찾음 / 0=key 없음 / -1=형식 오류·EOF (호출측 전체 문서 fallback)
+ *      . 다른 member 값(문자열/중첩 object·array/scalar)은 문자열 escape·중첩 깊이 추적하며 건너뜀
+ *      . 하위 object/배열 항목 안의 같은 이름 key, 문자열 값 안의 "key": 텍스트는 일치로 보지 않음
+ *  - C10_ioSeekArray: key 경로(root → 배열 key) 순서대로 seek → 배열 '[' 다음으로 이동
+ *  - C10_ioNextItem : 배열 항목 pull 순회 (항목 '{' 직전 위치 / ']' 종료), 호출측이 항목 파싱
+ *      . ioForEachJsonItem(callback 일괄) / W10 chunked 응답(항목 단위 pull, 파일 열린 채 유지) 공용
+ *  - 재귀/버퍼 없음 (깊이 카운터만, key 비교 버퍼 G_C10_SEEK_KEY_MAX)
+ *  - Stream peek/read만 사용 (host 테스트: test/host T10_TestJsonSeek_040.cpp)
+ * ------------------------------------------------------
+ * [구현 규칙]
+ *  - 항상 소스 시작 주석 체계 유지
+ *  - ArduinoJson v7.x.x 사용 (v6 이하 사용 금지)
+ *  - JsonDocument 단일 타입만 사용
+ *  - createNestedArray/Object/containsKey 사용 금지
+ *  - memset + strlcpy 기반 안전 초기화
+ *  - 주석/필드명은 JSON 구조와 동일하게 유지
+ *  - 모듈별 헤더(h) + 목적물별 cpp 분리 구성 (Core/System/Schedule/Snapshot/Rcu/Parse)
+ * ------------------------------------------------------
+ * [코드 네이밍 규칙]
+ *   - 전역 상수,매크로      : G_모듈약어_ 접두사
+ *   - 전역 변수             : g_모듈약어_ 접두사
+ *   - 전역 함수             : 모듈약어_ 접두사
+ *   - type                  : T_모듈약어_ 접두사
+ *   - typedef               : _t  접미사
+ *   - enum 상수             : EN_모듈약어_ 접두사
+ *   - 구조체                : ST_모듈약어_ 접두사
+ *   - 클래스명              : CL_모듈약어_ 접두사
+ *   - 클래스 private 멤버   : _ 접두사
+ *   - 클래스 멤버(함수/변수) : 모듈약어 접두사 미사용
+ *   - 클래스 정적 멤버      : s_ 접두사
+ *   - 함수 로컬 변수        : v_ 접두사
+ *   - 함수 인자             : p_ 접두사
+ * ------------------------------------------------------
+ */
+
+#include <Arduino.h>
+#include <string.h>
+
+// 비교 대상 key 최대 길이 (A20_Const::LEN_NAME, 초과 key는 불일치로 건너뜀)
+#define G_C10_SEEK_KEY_MAX 64
+
+// 공백 건너뛴 다음 문자 peek (소비 안 함), EOF → -1
+static inline int C10_ioPeekNonWs(Stream& p_s) {
+	for (;;) {
+		int v_c = p_s.peek();
+		if (v_c == ' ' || v_c == '\t' || v_c == '\r' || v_c == '\n') {
+			p_s.read();
+			continue;
+		}
+		return v_c;
+	}
+}
+
+// 여는 '"' 소비 후 호출 → 닫는 '"' 까지 소비
+//  - p_buf != nullptr: 내용 복사 (p_size 초과 시 p_fit=false, escape는 원문 그대로)
+static inline bool C10_ioReadString(Stream& p_s, char* p_buf, size_t p_size, bool& p_fit) {
+	size_t v_len = 0;
+	p_fit		 = true;
+	for (;;) {
+		int v_c = p_s.read();
+		if (v_c < 0) return false;
+		if (v_c == '"') break;
+		if (v_c == '\\') {
+			if (p_buf && v_len + 1 < p_size) p_buf[v_len++] = (char)v_c;
+			else p_fit = false;
+			v_c = p_s.read();
+			if (v_c < 0) return false;
+		}
+		if (p_buf && v_len + 1 < p_size) p_buf[v_len++] = (char)v_c;
+		else p_fit = false;
+	}
+	if (p_buf && p_size) p_buf[v_len] = '\0';
+	return true;
+}
+
+// 값 1개 건너뜀 (object/array는 문자열 인식 + 깊이 추적, scalar는 구분자 직전까지)
+static inline bool C10_ioSkipValue(Stream& p_s) {
+	bool v_fit;
+	int	 v_c = C10_ioPeekNonWs(p_s);
+	if (v_c < 0) return false;
+
+	if (v_c == '"') {
+		p_s.read();
+		return C10_ioReadString(p_s, nullptr, 0, v_fit);
+	}
+
+	if (v_c == '{' || v_c == '[') {
+		uint16_t v_depth = 0;
+		for (;;) {
+			v_c = p_s.read();
+			if (v_c < 0) return false;
+			if (v_c == '"') {
+				if (!C10_ioReadString(p_s, nullptr, 0, v_fit)) return false;
+			} else if (v_c == '{' || v_c == '[') {
+				v_depth++;
+			} else if (v_c == '}' || v_c == ']') {
+				if (--v_depth == 0) return true;
+			}
+		}
+	}
+
+	// number / true / false / null
+	for (;;) {
+		v_c = p_s.peek();
+		if (v_c < 0 || v_c == ',' || v_c == '}' || v_c == ']' || v_c == ' ' || v_c == '\t' || v_c == '\r' || v_c == '\n') return true;
+		p_s.read();
+	}
+}
+
+// 현재 위치 object의 직속 member "p_key" 탐색 → ':' 뒤(값 시작)로 이동
+//  - 현재 위치 다음 비공백 문자가 '{' 여야 함 (파일 시작 = root, 이전 seek 결과 = 해당 값)
+//  - 반환: 1 = 찾음, 0 = 해당 object에 key 없음(값이 object 아님 포함), -1 = 형식 오류/EOF
+static inline int8_t C10_ioSeekKey(Stream& p_s, const char* p_key) {
+	char v_key[G_C10_SEEK_KEY_MAX + 1];
+	bool v_fit;
+
+	int v_c = C10_ioPeekNonWs(p_s);
+	if (v_c < 0) return -1;
+	if (v_c != '{') return 0;
+	p_s.read();
+
+	if (C10_ioPeekNonWs(p_s) == '}') return 0;  // 빈 object
+
+	for (;;) {
+		if (C10_ioPeekNonWs(p_s) != '"') return -1;
+		p_s.read();
+		if (!C10_ioReadString(p_s, v_key, sizeof(v_key), v_fit)) return -1;
+
+		if (C10_ioPeekNonWs(p_s) != ':') return -1;
+		p_s.read();
+
+		if (v_fit && strcmp(v_key, p_key) == 0) return 1;
+
+		if (!C10_ioSkipValue(p_s)) return -1;
+
+		v_c = C10_ioPeekNonWs(p_s);
+		if (v_c == '}') return 0;
+		if (v_c != ',') return -1;
+		p_s.read();
+	}
+}
+
+// key 경로 순서대로 seek → 배열 시작 '[' 소비
+//  - 반환: 1 = 배열 시작, 0 = key 없음/배열 아님 (항목 0개), -1 = 형식 오류/EOF
+static inline int8_t C10_ioSeekArray(Stream& p_s, const char* const* p_keys, uint8_t p_keyCount) {
+	for (uint8_t v_i = 0; v_i < p_keyCount; v_i++) {
+		int8_t v_r = C10_ioSeekKey(p_s, p_keys[v_i]);
+		if (v_r <= 0) return v_r;
+	}
+	if (C10_ioPeekNonWs(p_s) != '[') return 0;
+	p_s.read();
+	return 1;
+}
+
+// 다음 항목 위치로 이동 (p_idx: 지금까지 읽은 항목 수, 0 이후는 ',' 구분자 소비)
+//  - 반환: 1 = 항목 object '{' 직전 (호출측이 파싱/건너뜀), 0 = 배열 끝 (']' 소비), -1 = 형식 오류/EOF
+static inline int8_t C10_ioNextItem(Stream& p_s, uint16_t p_idx) {
+	int v_c = C10_ioPeekNonWs(p_s);
+	if (v_c == ']') {
+		p_s.read();
+		return 0;
+	}
+	if (p_idx > 0) {
+		if (v_c != ',') return -1;
+		p_s.read();
+		v_c = C10_ioPeekNonWs(p_s);
+	}
+	return v_c == '{' ? 1 : -1;
+}
@@ -0,0 +1,290 @@
+/*
+ * ------------------------------------------------------
+ * 소스명 : C10_Config_Parse_041.cpp
+ * 모듈 약어 : C10
+ * 모듈명 : Smart Nature Wind Configuration Manager - Streaming JSON Parse
+ * ------------------------------------------------------
+ * 기능 요약:
+ *  - 섹션 loader 전용 JsonDocument allocator (pool 바이트 현재/최대 계측)
+ *  - ioForEachJsonItem: 배열 항목 단위 스트리밍 파싱
+ *      . 파일 stream에서 key 경로로 배열 시작 '[' 까지 이동 (각 단계 object 직속 key만 일치, 중첩/문자열 값 내 동명 key 무시)
+ *      . 항목 1개씩 deserializeJson(NestingLimit) → callback → 문서 clear
+ *      . 배열 전체가 JsonDocument에 올라오지 않음 (peak = 항목 1개 크기)
+ *      . 스트리밍 실패(main 없음/파싱 오류) 시 ioLoadJson(filter=배열 key 경로) fallback (.bak 복구 포함)
+ *  - loadAll 파싱 통계 (/api/diag "cfgParse"): 문서 peak, 최소 free heap, 섹션별 peak/항목 수
+ * ------------------------------------------------------
+ * [구현 규칙]
+ *  - 항상 소스 시작 주석 체계 유지
+ *  - ArduinoJson v7.x.x 사용 (v6 이하 사용 금지)
+ *  - JsonDocument 단일 타입만 사용
+ *  - createNestedArray/Object/containsKey 사용 금지
+ *  - memset + strlcpy 기반 안전 초기화
+ *  - 주석/필드명은 JSON 구조와 동일하게 유지
+ *  - 모듈별 헤더(h) + 목적물별 cpp 분리 구성 (Core/System/Schedule/Snapshot/Rcu/Parse)
+ * ------------------------------------------------------
+ * [코드 네이밍 규칙]
+ *   - 전역 상수,매크로      : G_모듈약어_ 접두사
+ *   - 전역 변수             : g_모듈약어_ 접두사
+ *   - 전역 함수             : 모듈약어_ 접두사
+ *   - type                  : T_모듈약어_ 접두사
+ *   - typedef               : _t  접미사
+ *   - enum 상수             : EN_모듈약어_ 접두사
+ *   - 구조체                : ST_모듈약어_ 접두사
+ *   - 클래스명              : CL_모듈약어_ 접두사
+ *   - 클래스 private 멤버   : _ 접두사
+ *   - 클래스 멤버(함수/변수) : 모듈약어 접두사 미사용
+ *   - 클래스 정적 멤버      : s_ 접두사
+ *   - 함수 로컬 변수        : v_ 접두사
+ *   - 함수 인자             : p_ 접두사
+ * ------------------------------------------------------
+ */
+
+#include <Arduino.h>
+#include <FS.h>
+#include <LittleFS.h>
+
+#include "C10_Config_041.h"
+#include "C10_Config_JsonSeek_041.h"
+
+// ------------------------------------------------------
+// 파싱 통계
+// ------------------------------------------------------
+#define G_C10_PARSE_SEC_NONE 0xFF
+
+typedef struct {
+	uint32_t docCur;							   // 현재 할당 pool 바이트 (loader 문서 합계)
+	uint32_t docPeak;							   // loadAll 중 최대 pool 바이트
+	uint32_t heapFreeStart;						   // loadAll 시작 free heap
+	uint32_t heapMinFree;						   // loadAll 중 최소 free heap (할당 시점 표본)
+	uint32_t secPeak[EN_C10_SNAP_SEC_COUNT];	   // 섹션별 최대 pool 바이트
+	uint16_t secItems[EN_C10_SNAP_SEC_COUNT];	   // 섹션별 스트리밍 항목 수
+	uint16_t fallback;							   // 스트리밍 실패 → 전체 문서 fallback 횟수
+	uint8_t  curSec;
+	bool     active;
+	bool     valid;								   // 1회 이상 계측 완료
+} ST_C10_ParseStat_t;
+
+static ST_C10_ParseStat_t s_parseStat;
+static portMUX_TYPE       s_parseMux = portMUX_INITIALIZER_UNLOCKED;
+
+// ------------------------------------------------------
+// 계측 allocator
+//  - 블록 앞 8바이트에 요청 크기 기록 (deallocate 시 크기 복원)
+// ------------------------------------------------------
+#define G_C10_ALLOC_HDR 8
+
+static void C10_parseAccount(int32_t p_delta) {
+	uint32_t v_free = 0;
+	bool     v_active;
+
+	portENTER_CRITICAL(&s_parseMux);
+	s_parseStat.docCur = (uint32_t)((int32_t)s_parseStat.docCur + p_delta);
+	v_active		   = s_parseStat.active;
+	if (v_active && p_delta > 0) {
+		if (s_parseStat.docCur > s_parseStat.docPeak) s_parseStat.docPeak = s_parseStat.docCur;
+		if (s_parseStat.curSec < EN_C10_SNAP_SEC_COUNT && s_parseStat.docCur > s_parseStat.secPeak[s_parseStat.curSec]) {
+			s_parseStat.secPeak[s_parseStat.curSec] = s_parseStat.docCur;
+		}
+	}
+	portEXIT_CRITICAL(&s_parseMux);
+
+	if (v_active && p_delta > 0) {
+		v_free = ESP.getFreeHeap();
+		portENTER_CRITICAL(&s_parseMux);
+		if (v_free < s_parseStat.heapMinFree) s_parseStat.heapMinFree = v_free;
+		portEXIT_CRITICAL(&s_parseMux);
+	}
+}
+
+class CL_C10_JsonAllocator : public ArduinoJson::Allocator {
+  public:
+	void* allocate(size_t p_size) override {
+		uint8_t* v_p = (uint8_t*)malloc(p_size + G_C10_ALLOC_HDR);
+		if (!v_p) return nullptr;
+		*(size_t*)v_p = p_size;
+		C10_parseAccount((int32_t)p_size);
+		return v_p + G_C10_ALLOC_HDR;
+	}
+
+	void deallocate(void* p_ptr) override {
+		if (!p_ptr) return;
+		uint8_t* v_p = (uint8_t*)p_ptr - G_C10_ALLOC_HDR;
+		C10_parseAccount(-(int32_t)(*(size_t*)v_p));
+		free(v_p);
+	}
+
+	void* reallocate(void* p_ptr, size_t p_size) override {
+		if (!p_ptr) return allocate(p_size);
+
+		uint8_t* v_old	   = (uint8_t*)p_ptr - G_C10_ALLOC_HDR;
+		size_t	 v_oldSize = *(size_t*)v_old;
+		uint8_t* v_p	   = (uint8_t*)realloc(v_old, p_size + G_C10_ALLOC_HDR);
+		if (!v_p) return nullptr;
+		*(size_t*)v_p = p_size;
+		C10_parseAccount((int32_t)p_size - (int32_t)v_oldSize);
+		return v_p + G_C10_ALLOC_HDR;
+	}
+};
+
+ArduinoJson::Allocator* C10_jsonAllocator() {
+	static CL_C10_JsonAllocator s_alloc;
+	return &s_alloc;
+}
+
+// =====================================================
+// 배열 항목 스트리밍 파싱
+// =====================================================
+// key 탐색/값 건너뛰기: C10_Config_JsonSeek_041.h (object 직속 member만 비교)
+
+// main 파일 스트리밍 pass
+//  - 반환: 항목 수, -1 = 스트리밍 불가(파일 없음/파싱 오류) → 호출측 fallback
+//  - key 경로 없음 → 0 (기존 loader의 "배열 없음 = 0개" 동작 유지)
+static int16_t C10_ioStreamItems(const char* p_path, const char* const* p_keys, uint8_t p_keyCount, uint8_t p_nesting,
+								 T_C10_JsonItemFn_t p_fn, void* p_ctx) {
+	if (!LittleFS.exists(p_path)) return -1;
+
+	File v_f = LittleFS.open(p_path, "r");
+	if (!v_f) return -1;
+
+	// EOF(잘린 파일)에서 deserializeJson Stream reader의 timedRead 대기 방지
+	v_f.setTimeout(0);
+
+	int8_t v_r = C10_ioSeekArray(v_f, p_keys, p_keyCount);
+	if (v_r <= 0) {
+		v_f.close();
+		return v_r < 0 ? -1 : 0;  // 형식 오류 → fallback(.bak 복구) / key·배열 없음 → 0개
+	}
+
+	JsonDocument v_item(C10_jsonAllocator());
+	int16_t      v_n = 0;
+
+	for (;;) {
+		v_r = C10_ioNextItem(v_f, (uint16_t)v_n);
+		if (v_r == 0) break;
+		if (v_r < 0) {
+			v_n = -1;
+			break;
+		}
+
+		v_item.clear();
+		DeserializationError v_e = deserializeJson(v_item, v_f, DeserializationOption::NestingLimit(p_nesting));
+		if (v_e) {
+			CL_D10_Logger::log(EN_L10_LOG_WARN, "[C10] stream item parse error(%s #%d): %s", p_path, v_n, v_e.c_str());
+			v_n = -1;
+			break;
+		}
+
+		if (!p_fn(v_item.as<JsonObjectConst>(), (uint16_t)v_n, p_ctx)) break;  // 수신측 용량 도달
+		v_n++;
+	}
+
+	v_f.close();
+	return v_n;
+}
+
+int16_t ioForEachJsonItem(const char* p_path, const char* const* p_keys, uint8_t p_keyCount, uint8_t p_nesting,
+						  T_C10_JsonItemFn_t p_fn, void* p_ctx) {
+	if (!p_path || !p_path[0] || !p_keys || p_keyCount == 0 || !p_fn) return -1;
+
+	int16_t v_n = C10_ioStreamItems(p_path, p_keys, p_keyCount, p_nesting, p_fn, p_ctx);
+
+	if (v_n < 0) {
+		// fallback: 배열 key 경로만 남기는 filter로 전체 문서 파싱 (.bak 복구 경로 재사용)
+		portENTER_CRITICAL(&s_parseMux);
+		s_parseStat.fallback++;
+		portEXIT_CRITICAL(&s_parseMux);
+
+		char   v_filter[128];
+		size_t v_len = 0;
+		for (uint8_t v_i = 0; v_i < p_keyCount && v_len < sizeof(v_filter); v_i++) {
+			v_len += snprintf(v_filter + v_len, sizeof(v_filter) - v_len, "{\"%s\":", p_keys[v_i]);
+		}
+		for (uint8_t v_i = 0; v_i <= p_keyCount && v_len < sizeof(v_filter); v_i++) {
+			v_len += snprintf(v_filter + v_len, sizeof(v_filter) - v_len, "%s", v_i == 0 ? "true" : "}");
+		}
+
+		JsonDocument v_doc(C10_jsonAllocator());
+		if (!ioLoadJson(p_path, v_doc, v_filter, (uint8_t)(p_nesting + p_keyCount + 1))) return -1;
+
+		JsonVariantConst v_node = v_doc.as<JsonVariantConst>();
+		for (uint8_t v_i = 0; v_i < p_keyCount; v_i++) {
+			v_node = v_node[p_keys[v_i]];
+		}
+
+		// p_idx == 0 → 새 pass 시작 (수신측 재초기화)
+		v_n = 0;
+		for (JsonObjectConst v_obj : v_node.as<JsonArrayConst>()) {
+			if (!p_fn(v_obj, (uint16_t)v_n, p_ctx)) break;
+			v_n++;
+		}
+	}
+
+	portENTER_CRITICAL(&s_parseMux);
+	if (s_parseStat.curSec < EN_C10_SNAP_SEC_COUNT) s_parseStat.secItems[s_parseStat.curSec] += (uint16_t)v_n;
+	portEXIT_CRITICAL(&s_parseMux);
+
+	return v_n;
+}
+
+// =====================================================
+// loadAll 파싱 통계
+// =====================================================
+void CL_C10_ConfigManager::_parseStatBegin() {
+	uint32_t v_free = ESP.getFreeHeap();
+
+	portENTER_CRITICAL(&s_parseMux);
+	uint32_t v_cur = s_parseStat.docCur;
+	memset(&s_parseStat, 0, sizeof(s_parseStat));
+	s_parseStat.docCur		  = v_cur;
+	s_parseStat.docPeak		  = v_cur;
+	s_parseStat.heapFreeStart = v_free;
+	s_parseStat.heapMinFree	  = v_free;
+	s_parseStat.curSec		  = G_C10_PARSE_SEC_NONE;
+	s_parseStat.active		  = true;
+	portEXIT_CRITICAL(&s_parseMux);
+}
+
+void CL_C10_ConfigManager::_parseStatSection(uint8_t p_sec) {
+	portENTER_CRITICAL(&s_parseMux);
+	s_parseStat.curSec = p_sec;
+	portEXIT_CRITICAL(&s_parseMux);
+}
+
+void CL_C10_ConfigManager::_parseStatEnd() {
+	ST_C10_ParseStat_t v_st;
+
+	portENTER_CRITICAL(&s_parseMux);
+	s_parseStat.active = false;
+	s_parseStat.valid  = true;
+	s_parseStat.curSec = G_C10_PARSE_SEC_NONE;
+	v_st			   = s_parseStat;
+	portEXIT_CRITICAL(&s_parseMux);
+
+	CL_D10_Logger::log(EN_L10_LOG_INFO, "[C10] loadAll parse: docPeak=%lu B, heap free %lu -> min %lu (peak use %lu B), fallback=%u",
+					   (unsigned long)v_st.docPeak, (unsigned long)v_st.heapFreeStart, (unsigned long)v_st.heapMinFree,
+					   (unsigned long)(v_st.heapFreeStart - v_st.heapMinFree), (unsigned)v_st.fallback);
+}
+
+void CL_C10_ConfigManager::parseStatsToJson(JsonObject p_obj) {
+	static const char* const s_secNames[EN_C10_SNAP_SEC_COUNT] = {
+		"system", "wifi", "motion", "nvsSpec", "windDict", "schedules", "userProfiles", "webPage"};
+
+	ST_C10_ParseStat_t v_st;
+	portENTER_CRITICAL(&s_parseMux);
+	v_st = s_parseStat;
+	portEXIT_CRITICAL(&s_parseMux);
+
+	p_obj["valid"]		   = v_st.valid;
+	p_obj["docPeak"]	   = v_st.docPeak;
+	p_obj["heapFreeStart"] = v_st.heapFreeStart;
+	p_obj["heapMinFree"]   = v_st.heapMinFree;
+	p_obj["heapPeakUse"]   = v_st.heapFreeStart - v_st.heapMinFree;
+	p_obj["fallback"]	   = v_st.fallback;
+
+	JsonObject v_secs = p_obj["sections"].to<JsonObject>();
+	for (uint8_t v_i = 0; v_i < EN_C10_SNAP_SEC_COUNT; v_i++) {
+		JsonObject v_s = v_secs[s_secNames[v_i]].to<JsonObject>();
+		v_s["docPeak"] = v_st.secPeak[v_i];
+		v_s["items"]   = v_st.secItems[v_i];
+	}
+}
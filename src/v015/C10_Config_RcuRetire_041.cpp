@@ -0,0 +1,142 @@
+/*
+ * ------------------------------------------------------
+ * 소스명 : C10_Config_RcuRetire_041.cpp
+ * 모듈 약어 : C10
+ * 모듈명 : Smart Nature Wind Configuration Manager - RCU Retire List
+ * ------------------------------------------------------
+ * 기능 요약:
+ *  - publishSection으로 교체/해제된 이전 섹션의 지연 해제 목록 (FIFO)
+ *      . _rcuRetire  : 목록 끝에 등록만 수행 (대기/해제 없음 → C10 mutex 보유 writer 비차단)
+ *      . rcuReclaim  : A00 loop에서 주기 호출, G_C10_RCU_GRACE_MS 경과 항목만 delete
+ *  - 등록 시각 순 FIFO → 만료 항목은 항상 head 쪽에 모임 (회수 O(만료 수))
+ *  - G_C10_RCU_RETIRE_MAX 는 soft 상한: 초과 시 overCap 통계만 증가 (grace 전 강제 해제 금지)
+ *  - 노드 할당 실패 시 섹션은 해제하지 않고 누수 처리(allocFail 통계) → reader use-after-free 방지 우선
+ *  - JSON/LittleFS 미사용 (host 빌드 대상)
+ * ------------------------------------------------------
+ * [구현 규칙]
+ *  - 항상 소스 시작 주석 체계 유지
+ *  - ArduinoJson v7.x.x 사용 (v6 이하 사용 금지)
+ *  - JsonDocument 단일 타입만 사용
+ *  - createNestedArray/Object/containsKey 사용 금지
+ *  - memset + strlcpy 기반 안전 초기화
+ *  - 주석/필드명은 JSON 구조와 동일하게 유지
+ *  - 모듈별 헤더(h) + 목적물별 cpp 분리 구성 (Core/System/Schedule/Snapshot/Rcu)
+ * ------------------------------------------------------
+ * [코드 네이밍 규칙]
+ *   - 전역 상수,매크로      : G_모듈약어_ 접두사
+ *   - 전역 변수             : g_모듈약어_ 접두사
+ *   - 전역 함수             : 모듈약어_ 접두사
+ *   - type                  : T_모듈약어_ 접두사
+ *   - typedef               : _t  접미사
+ *   - enum 상수             : EN_모듈약어_ 접두사
+ *   - 구조체                : ST_모듈약어_ 접두사
+ *   - 클래스명              : CL_모듈약어_ 접두사
+ *   - 클래스 private 멤버   : _ 접두사
+ *   - 클래스 멤버(함수/변수) : 모듈약어 접두사 미사용
+ *   - 클래스 정적 멤버      : s_ 접두사
+ *   - 함수 로컬 변수        : v_ 접두사
+ *   - 함수 인자             : p_ 접두사
+ * ------------------------------------------------------
+ */
+
+#include <Arduino.h>
+
+#include <new>
+
+#include "C10_Config_041.h"
+
+// ------------------------------------------------------
+// 정적 멤버 정의
+// ------------------------------------------------------
+uint32_t CL_C10_ConfigManager::s_cfgGen = 0;
+
+// ------------------------------------------------------
+// retire 목록 (단일 연결 FIFO, 노드는 등록 시 할당)
+//  - 목록 조작은 s_rcuMux 구간에서 포인터 연결/분리만 수행
+//  - 노드 할당/섹션 delete 는 spinlock 밖에서 수행
+// ------------------------------------------------------
+typedef struct ST_C10_RcuRetired_t {
+	void*						ptr;
+	void						(*del)(void* p_ptr);
+	uint32_t					retireMs;
+	struct ST_C10_RcuRetired_t* next;
+} ST_C10_RcuRetired_t;
+
+static ST_C10_RcuRetired_t* s_rcuHead = nullptr;
+static ST_C10_RcuRetired_t* s_rcuTail = nullptr;
+static ST_C10_RcuStat_t		s_rcuStat = {0, 0, 0, 0, 0, 0};
+static portMUX_TYPE			s_rcuMux  = portMUX_INITIALIZER_UNLOCKED;
+
+void CL_C10_ConfigManager::_rcuRetire(void* p_ptr, void (*p_delete)(void*)) {
+	ST_C10_RcuRetired_t* v_node = new (std::nothrow) ST_C10_RcuRetired_t;
+	if (!v_node) {
+		// 해제 시점을 추적할 수 없음 → 누수로 남김 (grace 전 delete는 reader use-after-free)
+		portENTER_CRITICAL(&s_rcuMux);
+		s_rcuStat.allocFail++;
+		portEXIT_CRITICAL(&s_rcuMux);
+		return;
+	}
+	v_node->ptr		 = p_ptr;
+	v_node->del		 = p_delete;
+	v_node->retireMs = (uint32_t)millis();
+	v_node->next	 = nullptr;
+
+	portENTER_CRITICAL(&s_rcuMux);
+	if (s_rcuTail) {
+		s_rcuTail->next = v_node;
+	} else {
+		s_rcuHead = v_node;
+	}
+	s_rcuTail = v_node;
+	s_rcuStat.retired++;
+	s_rcuStat.pending++;
+	if (s_rcuStat.pending > s_rcuStat.maxPending) s_rcuStat.maxPending = s_rcuStat.pending;
+	if (s_rcuStat.pending > G_C10_RCU_RETIRE_MAX) s_rcuStat.overCap++;
+	portEXIT_CRITICAL(&s_rcuMux);
+}
+
+void CL_C10_ConfigManager::rcuReclaim() {
+	if (__atomic_load_n(&s_rcuHead, __ATOMIC_RELAXED) == nullptr) return;
+
+	// 1) 만료 구간(head 쪽 연속 항목) 분리
+	const uint32_t		 v_nowMs = (uint32_t)millis();
+	ST_C10_RcuRetired_t* v_list	 = nullptr;
+	uint16_t			 v_n	 = 0;
+
+	portENTER_CRITICAL(&s_rcuMux);
+	ST_C10_RcuRetired_t* v_last = nullptr;
+	ST_C10_RcuRetired_t* v_cur	= s_rcuHead;
+	while (v_cur && (uint32_t)(v_nowMs - v_cur->retireMs) >= G_C10_RCU_GRACE_MS) {
+		v_last = v_cur;
+		v_cur  = v_cur->next;
+		v_n++;
+	}
+	if (v_last) {
+		v_list		 = s_rcuHead;
+		v_last->next = nullptr;
+		s_rcuHead	 = v_cur;
+		if (!s_rcuHead) s_rcuTail = nullptr;
+		s_rcuStat.pending -= v_n;
+	}
+	portEXIT_CRITICAL(&s_rcuMux);
+
+	if (!v_list) return;
+
+	// 2) lock 밖에서 섹션/노드 delete
+	while (v_list) {
+		ST_C10_RcuRetired_t* v_next = v_list->next;
+		v_list->del(v_list->ptr);
+		delete v_list;
+		v_list = v_next;
+	}
+
+	portENTER_CRITICAL(&s_rcuMux);
+	s_rcuStat.reclaimed += v_n;
+	portEXIT_CRITICAL(&s_rcuMux);
+}
+
+void CL_C10_ConfigManager::rcuStats(ST_C10_RcuStat_t& p_out) {
+	portENTER_CRITICAL(&s_rcuMux);
+	p_out = s_rcuStat;
+	portEXIT_CRITICAL(&s_rcuMux);
+}
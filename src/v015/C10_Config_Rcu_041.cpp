@@ -0,0 +1,143 @@
+/*
+ * ------------------------------------------------------
+ * 소스명 : C10_Config_Rcu_041.cpp
+ * 모듈 약어 : C10
+ * 모듈명 : Smart Nature Wind Configuration Manager - RCU Config Generation
+ * ------------------------------------------------------
+ * 기능 요약:
+ *  - g_A20_config_root 섹션 copy-on-write 갱신
+ *      . writer : C10 mutex 내 clone → patch/CRUD → publishSection (포인터 atomic 교체)
+ *      . reader : C10_rcuRead() 1회 load, lock 없음 (S10 tick / CT10 tick / M10 / W10)
+ *  - retire 목록: 교체/해제된 섹션을 G_C10_RCU_GRACE_MS 경과 후 delete (C10_Config_RcuRetire_041.cpp)
+ *  - publishRoot / reloadAll: 파일 재로드 결과를 새 세대로 일괄 publish
+ *  - apply*Patch: Web PATCH 경로용 복제본 patch + publish
+ *  - RCU 통계 (/api/diag "cfgRcu")
+ * ------------------------------------------------------
+ * [구현 규칙]
+ *  - 항상 소스 시작 주석 체계 유지
+ *  - ArduinoJson v7.x.x 사용 (v6 이하 사용 금지)
+ *  - JsonDocument 단일 타입만 사용
+ *  - createNestedArray/Object/containsKey 사용 금지
+ *  - memset + strlcpy 기반 안전 초기화
+ *  - 주석/필드명은 JSON 구조와 동일하게 유지
+ *  - 모듈별 헤더(h) + 목적물별 cpp 분리 구성 (Core/System/Schedule/Snapshot/Rcu)
+ * ------------------------------------------------------
+ * [코드 네이밍 규칙]
+ *   - 전역 상수,매크로      : G_모듈약어_ 접두사
+ *   - 전역 변수             : g_모듈약어_ 접두사
+ *   - 전역 함수             : 모듈약어_ 접두사
+ *   - type                  : T_모듈약어_ 접두사
+ *   - typedef               : _t  접미사
+ *   - enum 상수             : EN_모듈약어_ 접두사
+ *   - 구조체                : ST_모듈약어_ 접두사
+ *   - 클래스명              : CL_모듈약어_ 접두사
+ *   - 클래스 private 멤버   : _ 접두사
+ *   - 클래스 멤버(함수/변수) : 모듈약어 접두사 미사용
+ *   - 클래스 정적 멤버      : s_ 접두사
+ *   - 함수 로컬 변수        : v_ 접두사
+ *   - 함수 인자             : p_ 접두사
+ * ------------------------------------------------------
+ */
+
+#include <Arduino.h>
+
+#include "C10_Config_041.h"
+
+// =====================================================
+// 세대 publish
+// =====================================================
+void CL_C10_ConfigManager::publishRoot(ST_A20_ConfigRoot_t& p_next) {
+	C10_MUTEX_ACQUIRE_VOID();
+
+	if (p_next.system) publishSection(g_A20_config_root.system, p_next.system);
+	if (p_next.wifi) publishSection(g_A20_config_root.wifi, p_next.wifi);
+	if (p_next.motion) publishSection(g_A20_config_root.motion, p_next.motion);
+	if (p_next.nvsSpec) publishSection(g_A20_config_root.nvsSpec, p_next.nvsSpec);
+	if (p_next.windDict) publishSection(g_A20_config_root.windDict, p_next.windDict);
+	if (p_next.schedules) {
+		publishSection(g_A20_config_root.schedules, p_next.schedules);
+		// publish 이후 증가 → CT10 스케줄 구간 테이블이 새 세대로 재컴파일
+		s_schedulesGen++;
+	}
+	if (p_next.userProfiles) publishSection(g_A20_config_root.userProfiles, p_next.userProfiles);
+	if (p_next.webPage) publishSection(g_A20_config_root.webPage, p_next.webPage);
+
+	// 소유권 이전 완료
+	p_next = ST_A20_ConfigRoot_t();
+
+	C10_MUTEX_RELEASE();
+}
+
+bool CL_C10_ConfigManager::reloadAll() {
+	// 새 세대는 reader 비공개 root에 로드 (기존 섹션 in-place 재파싱 금지)
+	ST_A20_ConfigRoot_t v_root;
+	if (!loadAll(v_root)) {
+		freeAll(v_root);
+		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[C10] reloadAll failed → keep current generation");
+		return false;
+	}
+
+	publishRoot(v_root);
+	CL_D10_Logger::log(EN_L10_LOG_INFO, "[C10] reloadAll published (gen=%lu)", (unsigned long)configGen());
+	return true;
+}
+
+// =====================================================
+// 복제본 patch → publish
+// =====================================================
+template <typename T>
+bool CL_C10_ConfigManager::_cowPatch(T*& p_slot, bool (*p_patch)(T&, const JsonDocument&), const JsonDocument& p_doc) {
+	C10_MUTEX_ACQUIRE_BOOL();
+
+	const T* v_cur = C10_rcuRead(p_slot);
+	if (!v_cur) {
+		C10_MUTEX_RELEASE();
+		return false;
+	}
+
+	// patch*FromJson 은 같은 recursive mutex 재진입
+	T*   v_next    = cloneSection<T>(v_cur, nullptr);
+	bool v_changed = p_patch(*v_next, p_doc);
+	if (v_changed) {
+		publishSection(p_slot, v_next);
+	} else {
+		delete v_next;
+	}
+
+	C10_MUTEX_RELEASE();
+	return v_changed;
+}
+
+bool CL_C10_ConfigManager::applySystemPatch(const JsonDocument& p_patch) {
+	return _cowPatch(g_A20_config_root.system, &CL_C10_ConfigManager::patchSystemFromJson, p_patch);
+}
+
+bool CL_C10_ConfigManager::applyWifiPatch(const JsonDocument& p_patch) {
+	return _cowPatch(g_A20_config_root.wifi, &CL_C10_ConfigManager::patchWifiFromJson, p_patch);
+}
+
+bool CL_C10_ConfigManager::applyMotionPatch(const JsonDocument& p_patch) {
+	return _cowPatch(g_A20_config_root.motion, &CL_C10_ConfigManager::patchMotionFromJson, p_patch);
+}
+
+bool CL_C10_ConfigManager::applyUserProfilesPatch(const JsonDocument& p_patch) {
+	return _cowPatch(g_A20_config_root.userProfiles, &CL_C10_ConfigManager::patchUserProfilesFromJson, p_patch);
+}
+
+// =====================================================
+// 통계
+// =====================================================
+void CL_C10_ConfigManager::rcuStatsToJson(JsonObject p_obj) {
+	ST_C10_RcuStat_t v_st;
+	rcuStats(v_st);
+
+	p_obj["gen"]        = configGen();
+	p_obj["graceMs"]    = (uint32_t)G_C10_RCU_GRACE_MS;
+	p_obj["retired"]    = v_st.retired;
+	p_obj["reclaimed"]  = v_st.reclaimed;
+	p_obj["pending"]    = v_st.pending;
+	p_obj["maxPending"] = v_st.maxPending;
+	p_obj["capacity"]   = (uint16_t)G_C10_RCU_RETIRE_MAX;
+	p_obj["overCap"]    = v_st.overCap;
+	p_obj["allocFail"]  = v_st.allocFail;
+}
@@ -5,8 +5,10 @@
  * 모듈명 : Smart Nature Wind Configuration Manager - Schedule/UserProfiles/WindProfile
  * ------------------------------------------------------
  * 기능 요약:
- *  - Schedules / UserProfiles / WindProfileDict Load/Save
+ *  - Schedules / UserProfiles / WindProfileDict Load/Save (Load: 배열 항목 단위 스트리밍 파싱)
  *  - 위 섹션들의 JSON Export / Patch
+ *  - 항목 단위 Export (schedule / userProfile / preset / style 1개 → JsonObject, chunked 응답용)
+ *  - preset / style 항목 단위 Import (fromJson_WindPreset/Style: 파일 항목 → loader 동일 정규화, chunked windDict)
  *  - Schedule / UserProfiles / WindProfile CRUD
  * ------------------------------------------------------
  * [구현 규칙]
@@ -201,12 +203,37 @@ static void C10_fromJson_WindPreset(const JsonObjectConst& p_js, ST_A20_PresetEn
 	p_p.base.thermalFreqBase  = v_b["thermalFreqBase"] | 0.022f; // camelCase
 }
 
+static void C10_fromJson_WindStyle(const JsonObjectConst& p_js, ST_A20_StyleEntry_t& p_s) {
+	strlcpy(p_s.name, p_js["name"] | "", sizeof(p_s.name));
+	strlcpy(p_s.code, p_js["code"] | "", sizeof(p_s.code));
+
+	JsonObjectConst v_f            = p_js["factors"].as<JsonObjectConst>();
+	p_s.factors.intensityFactor   = v_f["intensityFactor"] | 1.0f;   // camelCase
+	p_s.factors.variabilityFactor = v_f["variabilityFactor"] | 1.0f; // camelCase
+	p_s.factors.gustFactor        = v_f["gustFactor"] | 1.0f;        // camelCase
+	p_s.factors.thermalFactor     = v_f["thermalFactor"] | 1.0f;     // camelCase
+}
+
+// 항목 1개 단위 Import (W10 chunked windDict: 파일 항목 → loader와 같은 기본값/길이 정규화)
+void CL_C10_ConfigManager::fromJson_WindPreset(JsonObjectConst p_js, ST_A20_PresetEntry_t& p_item) {
+	C10_fromJson_WindPreset(p_js, p_item);
+}
+
+void CL_C10_ConfigManager::fromJson_WindStyle(JsonObjectConst p_js, ST_A20_StyleEntry_t& p_item) {
+	C10_fromJson_WindStyle(p_js, p_item);
+}
+
 // =====================================================
 // 2-1. 목적물별 Load 구현 (Schedules/UserProfiles/WindProfileDict)
+//  - 배열은 ioForEachJsonItem 항목 단위 스트리밍 → 배열 전체를 문서에 올리지 않음
+//  - callback은 p_idx 위치에 직접 기록, count = 수락 항목 수
 // =====================================================
-bool CL_C10_ConfigManager::loadSchedules(ST_A20_SchedulesRoot_t& p_cfg) {
-	JsonDocument d;
+static const char* const G_C10_KEYS_SCHEDULES[]     = {"schedules"};
+static const char* const G_C10_KEYS_USER_PROFILES[] = {"userProfiles", "profiles"};
+static const char* const G_C10_KEYS_WIND_PRESETS[]  = {"windDict", "presets"};
+static const char* const G_C10_KEYS_WIND_STYLES[]   = {"windDict", "styles"};
 
+bool CL_C10_ConfigManager::loadSchedules(ST_A20_SchedulesRoot_t& p_cfg) {
 	const char* v_cfgJsonPath = nullptr;
 	if (s_cfgJsonFileMap.schedules[0] != '\0') {
 		v_cfgJsonPath = s_cfgJsonFileMap.schedules;
@@ -215,27 +242,25 @@ bool CL_C10_ConfigManager::loadSchedules(ST_A20_SchedulesRoot_t& p_cfg) {
 		return false;
 	}
 
-	if (!ioLoadJson(v_cfgJsonPath, d)) {
+	int16_t v_n = ioForEachJsonItem(
+		v_cfgJsonPath, G_C10_KEYS_SCHEDULES, 1, G_C10_JSON_NEST_ITEM,
+		[](JsonObjectConst p_js, uint16_t p_idx, void* p_ctx) -> bool {
+			if (p_idx >= A20_Const::MAX_SCHEDULES) return false;
+			C10_fromJson_ScheduleItem(p_js, ((ST_A20_SchedulesRoot_t*)p_ctx)->items[p_idx]);
+			return true;
+		},
+		&p_cfg);
+	if (v_n < 0) {
 		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[C10] loadSchedules: ioLoadJson failed (%s)", v_cfgJsonPath);
 		return false;
 	}
+	p_cfg.count = (uint8_t)v_n;
 
-	JsonArrayConst arr = d["schedules"].as<JsonArrayConst>();
-	p_cfg.count        = 0;
-
-	for (JsonObjectConst js : arr) {
-		if (p_cfg.count >= A20_Const::MAX_SCHEDULES) break;
-
-		ST_A20_ScheduleItem_t& s = p_cfg.items[p_cfg.count++];
-		C10_fromJson_ScheduleItem(js, s);
-	}
-
+	s_schedulesGen++;
 	return true;
 }
 
 bool CL_C10_ConfigManager::loadUserProfiles(ST_A20_UserProfilesRoot_t& p_cfg) {
-	JsonDocument d;
-
 	const char* v_cfgJsonPath = nullptr;
 	if (s_cfgJsonFileMap.userProfiles[0] != '\0') {
 		v_cfgJsonPath = s_cfgJsonFileMap.userProfiles;
@@ -244,27 +269,24 @@ bool CL_C10_ConfigManager::loadUserProfiles(ST_A20_UserProfilesRoot_t& p_cfg) {
 		return false;
 	}
 
-	if (!ioLoadJson(v_cfgJsonPath, d)) {
+	int16_t v_n = ioForEachJsonItem(
+		v_cfgJsonPath, G_C10_KEYS_USER_PROFILES, 2, G_C10_JSON_NEST_ITEM,
+		[](JsonObjectConst p_jp, uint16_t p_idx, void* p_ctx) -> bool {
+			if (p_idx >= A20_Const::MAX_USER_PROFILES) return false;
+			C10_fromJson_UserProfile(p_jp, ((ST_A20_UserProfilesRoot_t*)p_ctx)->items[p_idx]);
+			return true;
+		},
+		&p_cfg);
+	if (v_n < 0) {
 		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[C10] loadUserProfiles: ioLoadJson failed (%s)", v_cfgJsonPath);
 		return false;
 	}
-
-	JsonArrayConst arr = d["userProfiles"]["profiles"].as<JsonArrayConst>();
-	p_cfg.count        = 0;
-
-	for (JsonObjectConst jp : arr) {
-		if (p_cfg.count >= A20_Const::MAX_USER_PROFILES) break;
-
-		ST_A20_UserProfileItem_t& up = p_cfg.items[p_cfg.count++];
-		C10_fromJson_UserProfile(jp, up);
-	}
+	p_cfg.count = (uint8_t)v_n;
 
 	return true;
 }
 
 bool CL_C10_ConfigManager::loadWindProfileDict(ST_A20_WindProfileDict_t& p_dict) {
-	JsonDocument d;
-
 	const char* v_cfgJsonPath = nullptr;
 	if (s_cfgJsonFileMap.windDict[0] != '\0') {
 		v_cfgJsonPath = s_cfgJsonFileMap.windDict;
@@ -273,43 +295,36 @@ bool CL_C10_ConfigManager::loadWindProfileDict(ST_A20_WindProfileDict_t& p_dict)
 		return false;
 	}
 
-	if (!ioLoadJson(v_cfgJsonPath, d)) {
+	// presets / styles: 배열별 1 pass (파일 내 순서 무관)
+	int16_t v_n = ioForEachJsonItem(
+		v_cfgJsonPath, G_C10_KEYS_WIND_PRESETS, 2, G_C10_JSON_NEST_ITEM,
+		[](JsonObjectConst p_js, uint16_t p_idx, void* p_ctx) -> bool {
+			if (p_idx >= 16) return false;
+			C10_fromJson_WindPreset(p_js, ((ST_A20_WindProfileDict_t*)p_ctx)->presets[p_idx]);
+			return true;
+		},
+		&p_dict);
+	if (v_n < 0) {
 		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[C10] loadWindProfileDict: ioLoadJson failed (%s)", v_cfgJsonPath);
 		return false;
 	}
-
-	JsonObjectConst j = d["windDict"].as<JsonObjectConst>();
-
-	p_dict.presetCount = 0;
-	if (j["presets"].is<JsonArrayConst>()) {
-		JsonArrayConst v_arr = j["presets"].as<JsonArrayConst>();
-		for (JsonObjectConst v_js : v_arr) {
-			if (p_dict.presetCount >= 16) break;
-
-			ST_A20_PresetEntry_t& v_p = p_dict.presets[p_dict.presetCount++];
-			C10_fromJson_WindPreset(v_js, v_p);
-		}
-	}
-
-	p_dict.styleCount = 0;
-	if (j["styles"].is<JsonArrayConst>()) {
-		JsonArrayConst v_arr = j["styles"].as<JsonArrayConst>();
-		for (JsonObjectConst v_js : v_arr) {
-			if (p_dict.styleCount >= 16) break;
-
-			ST_A20_StyleEntry_t& v_s = p_dict.styles[p_dict.styleCount++];
-
-			strlcpy(v_s.name, v_js["name"] | "", sizeof(v_s.name));
-			strlcpy(v_s.code, v_js["code"] | "", sizeof(v_s.code));
-
-			JsonObjectConst v_f            = v_js["factors"].as<JsonObjectConst>();
-			v_s.factors.intensityFactor   = v_f["intensityFactor"] | 1.0f;   // camelCase
-			v_s.factors.variabilityFactor = v_f["variabilityFactor"] | 1.0f; // camelCase
-			v_s.factors.gustFactor        = v_f["gustFactor"] | 1.0f;        // camelCase
-			v_s.factors.thermalFactor     = v_f["thermalFactor"] | 1.0f;     // camelCase
-		}
+	p_dict.presetCount = (uint8_t)v_n;
+
+	v_n = ioForEachJsonItem(
+		v_cfgJsonPath, G_C10_KEYS_WIND_STYLES, 2, G_C10_JSON_NEST_ITEM,
+		[](JsonObjectConst p_js, uint16_t p_idx, void* p_ctx) -> bool {
+			if (p_idx >= 16) return false;
+			C10_fromJson_WindStyle(p_js, ((ST_A20_WindProfileDict_t*)p_ctx)->styles[p_idx]);
+			return true;
+		},
+		&p_dict);
+	if (v_n < 0) {
+		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[C10] loadWindProfileDict: styles load failed (%s)", v_cfgJsonPath);
+		return false;
 	}
+	p_dict.styleCount = (uint8_t)v_n;
 
+	__atomic_add_fetch(&s_windDictGen, 1, __ATOMIC_RELEASE);
 	return true;
 }
 
@@ -488,153 +503,169 @@ bool CL_C10_ConfigManager::saveWindProfileDict(const ST_A20_WindProfileDict_t& p
 // =====================================================
 void CL_C10_ConfigManager::toJson_Schedules(const ST_A20_SchedulesRoot_t& p_cfg, JsonDocument& d) {
 	for (uint8_t v_i = 0; v_i < p_cfg.count; v_i++) {
-		const ST_A20_ScheduleItem_t& s  = p_cfg.items[v_i];
-		JsonObject                   js = d["schedules"][v_i];
-
-		js["schId"]          = s.schId;
-		js["schNo"]          = s.schNo;
-		js["name"]           = s.name;
-		js["enabled"]        = s.enabled;
-		js["repeatSegments"] = s.repeatSegments;
-		js["repeatCount"]    = s.repeatCount;
-
-		for (uint8_t v_d = 0; v_d < 7; v_d++) {
-			js["period"]["days"][v_d] = s.period.days[v_d];
-		}
-		js["period"]["startTime"] = s.period.startTime;
-		js["period"]["endTime"]   = s.period.endTime;
-
-		for (uint8_t v_k = 0; v_k < s.segCount; v_k++) {
-			const ST_A20_ScheduleSegment_t& sg   = s.segments[v_k];
-			JsonObject                      jseg = js["segments"][v_k];
-
-			jseg["segId"]      = sg.segId;
-			jseg["segNo"]      = sg.segNo;
-			jseg["onMinutes"]  = sg.onMinutes;
-			jseg["offMinutes"] = sg.offMinutes;
-			jseg["mode"]       = A20_modeToString(sg.mode);
-			jseg["presetCode"] = sg.presetCode;
-			jseg["styleCode"]  = sg.styleCode;
-
-			JsonObject adj                 = jseg["adjust"];
-			adj["windIntensity"]           = sg.adjust.windIntensity;
-			adj["windVariability"]         = sg.adjust.windVariability;
-			adj["gustFrequency"]           = sg.adjust.gustFrequency;
-			adj["fanLimit"]                = sg.adjust.fanLimit;
-			adj["minFan"]                  = sg.adjust.minFan;
-			adj["turbulenceLengthScale"]   = sg.adjust.turbulenceLengthScale;    // camelCase
-			adj["turbulenceIntensitySigma"] = sg.adjust.turbulenceIntensitySigma; // camelCase
+		toJson_ScheduleItem(p_cfg.items[v_i], d["schedules"][v_i]);
+	}
+}
 
-			jseg["fixedSpeed"] = sg.fixedSpeed; // camelCase
-		}
+void CL_C10_ConfigManager::toJson_ScheduleItem(const ST_A20_ScheduleItem_t& p_item, JsonObject p_obj) {
+	const ST_A20_ScheduleItem_t& s  = p_item;
+	JsonObject                   js = p_obj;
 
-		JsonObject ao              = js["autoOff"];
-		ao["timer"]["enabled"]     = s.autoOff.timer.enabled;
-		ao["timer"]["minutes"]     = s.autoOff.timer.minutes;
-		ao["offTime"]["enabled"]   = s.autoOff.offTime.enabled;
-		ao["offTime"]["time"]      = s.autoOff.offTime.time;
-		ao["offTemp"]["enabled"]   = s.autoOff.offTemp.enabled;
-		ao["offTemp"]["temp"]      = s.autoOff.offTemp.temp;
+	js["schId"]          = s.schId;
+	js["schNo"]          = s.schNo;
+	js["name"]           = s.name;
+	js["enabled"]        = s.enabled;
+	js["repeatSegments"] = s.repeatSegments;
+	js["repeatCount"]    = s.repeatCount;
 
-		js["motion"]["pir"]["enabled"]      = s.motion.pir.enabled;
-		js["motion"]["pir"]["holdSec"]      = s.motion.pir.holdSec;
-		js["motion"]["ble"]["enabled"]      = s.motion.ble.enabled;
-		js["motion"]["ble"]["rssiThreshold"] = s.motion.ble.rssiThreshold; // camelCase
-		js["motion"]["ble"]["holdSec"]      = s.motion.ble.holdSec;
+	for (uint8_t v_d = 0; v_d < 7; v_d++) {
+		js["period"]["days"][v_d] = s.period.days[v_d];
 	}
+	js["period"]["startTime"] = s.period.startTime;
+	js["period"]["endTime"]   = s.period.endTime;
+
+	for (uint8_t v_k = 0; v_k < s.segCount; v_k++) {
+		const ST_A20_ScheduleSegment_t& sg   = s.segments[v_k];
+		JsonObject                      jseg = js["segments"][v_k];
+
+		jseg["segId"]      = sg.segId;
+		jseg["segNo"]      = sg.segNo;
+		jseg["onMinutes"]  = sg.onMinutes;
+		jseg["offMinutes"] = sg.offMinutes;
+		jseg["mode"]       = A20_modeToString(sg.mode);
+		jseg["presetCode"] = sg.presetCode;
+		jseg["styleCode"]  = sg.styleCode;
+
+		JsonObject adj                 = jseg["adjust"];
+		adj["windIntensity"]           = sg.adjust.windIntensity;
+		adj["windVariability"]         = sg.adjust.windVariability;
+		adj["gustFrequency"]           = sg.adjust.gustFrequency;
+		adj["fanLimit"]                = sg.adjust.fanLimit;
+		adj["minFan"]                  = sg.adjust.minFan;
+		adj["turbulenceLengthScale"]   = sg.adjust.turbulenceLengthScale;    // camelCase
+		adj["turbulenceIntensitySigma"] = sg.adjust.turbulenceIntensitySigma; // camelCase
+
+		jseg["fixedSpeed"] = sg.fixedSpeed; // camelCase
+	}
+
+	JsonObject ao              = js["autoOff"];
+	ao["timer"]["enabled"]     = s.autoOff.timer.enabled;
+	ao["timer"]["minutes"]     = s.autoOff.timer.minutes;
+	ao["offTime"]["enabled"]   = s.autoOff.offTime.enabled;
+	ao["offTime"]["time"]      = s.autoOff.offTime.time;
+	ao["offTemp"]["enabled"]   = s.autoOff.offTemp.enabled;
+	ao["offTemp"]["temp"]      = s.autoOff.offTemp.temp;
+
+	js["motion"]["pir"]["enabled"]      = s.motion.pir.enabled;
+	js["motion"]["pir"]["holdSec"]      = s.motion.pir.holdSec;
+	js["motion"]["ble"]["enabled"]      = s.motion.ble.enabled;
+	js["motion"]["ble"]["rssiThreshold"] = s.motion.ble.rssiThreshold; // camelCase
+	js["motion"]["ble"]["holdSec"]      = s.motion.ble.holdSec;
 }
 
 void CL_C10_ConfigManager::toJson_UserProfiles(const ST_A20_UserProfilesRoot_t& p_cfg, JsonDocument& d) {
 	for (uint8_t v_i = 0; v_i < p_cfg.count; v_i++) {
-		const ST_A20_UserProfileItem_t& up = p_cfg.items[v_i];
-		JsonObject                      jp = d["userProfiles"]["profiles"][v_i];
-
-		jp["profileId"]      = up.profileId;
-		jp["profileNo"]      = up.profileNo;
-		jp["name"]           = up.name;
-		jp["enabled"]        = up.enabled;
-		jp["repeatSegments"] = up.repeatSegments;
-		jp["repeatCount"]    = up.repeatCount;
-
-		for (uint8_t v_k = 0; v_k < up.segCount; v_k++) {
-			const ST_A20_UserProfileSegment_t& sg   = up.segments[v_k];
-			JsonObject                         jseg = jp["segments"][v_k];
-
-			jseg["segId"]      = sg.segId;
-			jseg["segNo"]      = sg.segNo;
-			jseg["onMinutes"]  = sg.onMinutes;
-			jseg["offMinutes"] = sg.offMinutes;
-			jseg["mode"]       = A20_modeToString(sg.mode);
-			jseg["presetCode"] = sg.presetCode;
-			jseg["styleCode"]  = sg.styleCode;
-
-			JsonObject adj                 = jseg["adjust"];
-			adj["windIntensity"]           = sg.adjust.windIntensity;
-			adj["windVariability"]         = sg.adjust.windVariability;
-			adj["gustFrequency"]           = sg.adjust.gustFrequency;
-			adj["fanLimit"]                = sg.adjust.fanLimit;
-			adj["minFan"]                  = sg.adjust.minFan;
-			adj["turbulenceLengthScale"]   = sg.adjust.turbulenceLengthScale;    // camelCase
-			adj["turbulenceIntensitySigma"] = sg.adjust.turbulenceIntensitySigma; // camelCase
-
-			jseg["fixedSpeed"] = sg.fixedSpeed; // camelCase
-		}
-
-		JsonObject ao              = jp["autoOff"];
-		ao["timer"]["enabled"]     = up.autoOff.timer.enabled;
-		ao["timer"]["minutes"]     = up.autoOff.timer.minutes;
-		ao["offTime"]["enabled"]   = up.autoOff.offTime.enabled;
-		ao["offTime"]["time"]      = up.autoOff.offTime.time;
-		ao["offTemp"]["enabled"]   = up.autoOff.offTemp.enabled;
-		ao["offTemp"]["temp"]      = up.autoOff.offTemp.temp;
+		toJson_UserProfileItem(p_cfg.items[v_i], d["userProfiles"]["profiles"][v_i]);
+	}
+}
 
-		jp["motion"]["pir"]["enabled"]      = up.motion.pir.enabled;
-		jp["motion"]["pir"]["holdSec"]      = up.motion.pir.holdSec;
-		jp["motion"]["ble"]["enabled"]      = up.motion.ble.enabled;
-		jp["motion"]["ble"]["rssiThreshold"] = up.motion.ble.rssiThreshold; // camelCase
-		jp["motion"]["ble"]["holdSec"]      = up.motion.ble.holdSec;
+void CL_C10_ConfigManager::toJson_UserProfileItem(const ST_A20_UserProfileItem_t& p_item, JsonObject p_obj) {
+	const ST_A20_UserProfileItem_t& up = p_item;
+	JsonObject                      jp = p_obj;
+
+	jp["profileId"]      = up.profileId;
+	jp["profileNo"]      = up.profileNo;
+	jp["name"]           = up.name;
+	jp["enabled"]        = up.enabled;
+	jp["repeatSegments"] = up.repeatSegments;
+	jp["repeatCount"]    = up.repeatCount;
+
+	for (uint8_t v_k = 0; v_k < up.segCount; v_k++) {
+		const ST_A20_UserProfileSegment_t& sg   = up.segments[v_k];
+		JsonObject                         jseg = jp["segments"][v_k];
+
+		jseg["segId"]      = sg.segId;
+		jseg["segNo"]      = sg.segNo;
+		jseg["onMinutes"]  = sg.onMinutes;
+		jseg["offMinutes"] = sg.offMinutes;
+		jseg["mode"]       = A20_modeToString(sg.mode);
+		jseg["presetCode"] = sg.presetCode;
+		jseg["styleCode"]  = sg.styleCode;
+
+		JsonObject adj                 = jseg["adjust"];
+		adj["windIntensity"]           = sg.adjust.windIntensity;
+		adj["windVariability"]         = sg.adjust.windVariability;
+		adj["gustFrequency"]           = sg.adjust.gustFrequency;
+		adj["fanLimit"]                = sg.adjust.fanLimit;
+		adj["minFan"]                  = sg.adjust.minFan;
+		adj["turbulenceLengthScale"]   = sg.adjust.turbulenceLengthScale;    // camelCase
+		adj["turbulenceIntensitySigma"] = sg.adjust.turbulenceIntensitySigma; // camelCase
+
+		jseg["fixedSpeed"] = sg.fixedSpeed; // camelCase
 	}
+
+	JsonObject ao              = jp["autoOff"];
+	ao["timer"]["enabled"]     = up.autoOff.timer.enabled;
+	ao["timer"]["minutes"]     = up.autoOff.timer.minutes;
+	ao["offTime"]["enabled"]   = up.autoOff.offTime.enabled;
+	ao["offTime"]["time"]      = up.autoOff.offTime.time;
+	ao["offTemp"]["enabled"]   = up.autoOff.offTemp.enabled;
+	ao["offTemp"]["temp"]      = up.autoOff.offTemp.temp;
+
+	jp["motion"]["pir"]["enabled"]      = up.motion.pir.enabled;
+	jp["motion"]["pir"]["holdSec"]      = up.motion.pir.holdSec;
+	jp["motion"]["ble"]["enabled"]      = up.motion.ble.enabled;
+	jp["motion"]["ble"]["rssiThreshold"] = up.motion.ble.rssiThreshold; // camelCase
+	jp["motion"]["ble"]["holdSec"]      = up.motion.ble.holdSec;
 }
 
 void CL_C10_ConfigManager::toJson_WindProfileDict(const ST_A20_WindProfileDict_t& p_cfg, JsonDocument& d) {
 	for (uint8_t v_i = 0; v_i < p_cfg.presetCount; v_i++) {
-		const ST_A20_PresetEntry_t& v_p  = p_cfg.presets[v_i];
-		JsonObject                  v_js = d["windDict"]["presets"][v_i];
-
-		v_js["name"] = v_p.name;
-		v_js["code"] = v_p.code;
-
-		JsonObject v_b                 = v_js["base"];
-		v_b["windIntensity"]           = v_p.base.windIntensity;
-		v_b["gustFrequency"]           = v_p.base.gustFrequency;
-		v_b["windVariability"]         = v_p.base.windVariability;
-		v_b["fanLimit"]                = v_p.base.fanLimit;
-		v_b["minFan"]                  = v_p.base.minFan;
-		v_b["turbulenceLengthScale"]   = v_p.base.turbulenceLengthScale;    // camelCase
-		v_b["turbulenceIntensitySigma"] = v_p.base.turbulenceIntensitySigma; // camelCase
-		v_b["thermalBubbleStrength"]   = v_p.base.thermalBubbleStrength;    // camelCase
-		v_b["thermalBubbleRadius"]     = v_p.base.thermalBubbleRadius;      // camelCase
-
-		v_b["baseMinWind"]      = v_p.base.baseMinWind;      // camelCase
-		v_b["baseMaxWind"]      = v_p.base.baseMaxWind;      // camelCase
-		v_b["gustProbBase"]     = v_p.base.gustProbBase;     // camelCase
-		v_b["gustStrengthMax"]  = v_p.base.gustStrengthMax;  // camelCase
-		v_b["thermalFreqBase"]  = v_p.base.thermalFreqBase;  // camelCase
+		toJson_WindPreset(p_cfg.presets[v_i], d["windDict"]["presets"][v_i]);
 	}
 
 	for (uint8_t v_i = 0; v_i < p_cfg.styleCount; v_i++) {
-		const ST_A20_StyleEntry_t& v_s  = p_cfg.styles[v_i];
-		JsonObject                 v_js = d["windDict"]["styles"][v_i];
+		toJson_WindStyle(p_cfg.styles[v_i], d["windDict"]["styles"][v_i]);
+	}
+}
 
-		v_js["name"] = v_s.name;
-		v_js["code"] = v_s.code;
+void CL_C10_ConfigManager::toJson_WindPreset(const ST_A20_PresetEntry_t& p_item, JsonObject p_obj) {
+	const ST_A20_PresetEntry_t& v_p  = p_item;
+	JsonObject                  v_js = p_obj;
+
+	v_js["name"] = v_p.name;
+	v_js["code"] = v_p.code;
+
+	JsonObject v_b                 = v_js["base"];
+	v_b["windIntensity"]           = v_p.base.windIntensity;
+	v_b["gustFrequency"]           = v_p.base.gustFrequency;
+	v_b["windVariability"]         = v_p.base.windVariability;
+	v_b["fanLimit"]                = v_p.base.fanLimit;
+	v_b["minFan"]                  = v_p.base.minFan;
+	v_b["turbulenceLengthScale"]   = v_p.base.turbulenceLengthScale;    // camelCase
+	v_b["turbulenceIntensitySigma"] = v_p.base.turbulenceIntensitySigma; // camelCase
+	v_b["thermalBubbleStrength"]   = v_p.base.thermalBubbleStrength;    // camelCase
+	v_b["thermalBubbleRadius"]     = v_p.base.thermalBubbleRadius;      // camelCase
+
+	v_b["baseMinWind"]      = v_p.base.baseMinWind;      // camelCase
+	v_b["baseMaxWind"]      = v_p.base.baseMaxWind;      // camelCase
+	v_b["gustProbBase"]     = v_p.base.gustProbBase;     // camelCase
+	v_b["gustStrengthMax"]  = v_p.base.gustStrengthMax;  // camelCase
+	v_b["thermalFreqBase"]  = v_p.base.thermalFreqBase;  // camelCase
+}
 
-		JsonObject v_f           = v_js["factors"];
-		v_f["intensityFactor"]   = v_s.factors.intensityFactor;   // camelCase
-		v_f["variabilityFactor"] = v_s.factors.variabilityFactor; // camelCase
-		v_f["gustFactor"]        = v_s.factors.gustFactor;        // camelCase
-		v_f["thermalFactor"]     = v_s.factors.thermalFactor;     // camelCase
-	}
+void CL_C10_ConfigManager::toJson_WindStyle(const ST_A20_StyleEntry_t& p_item, JsonObject p_obj) {
+	const ST_A20_StyleEntry_t& v_s  = p_item;
+	JsonObject                 v_js = p_obj;
+
+	v_js["name"] = v_s.name;
+	v_js["code"] = v_s.code;
+
+	JsonObject v_f           = v_js["factors"];
+	v_f["intensityFactor"]   = v_s.factors.intensityFactor;   // camelCase
+	v_f["variabilityFactor"] = v_s.factors.variabilityFactor; // camelCase
+	v_f["gustFactor"]        = v_s.factors.gustFactor;        // camelCase
+	v_f["thermalFactor"]     = v_s.factors.thermalFactor;     // camelCase
 }
 
 // =====================================================
@@ -658,6 +689,7 @@ bool CL_C10_ConfigManager::patchSchedulesFromJson(ST_A20_SchedulesRoot_t& p_cfg,
 	}
 
 	_dirty_schedules = true;
+	s_schedulesGen++;
 	CL_D10_Logger::log(EN_L10_LOG_INFO, "[C10] Schedules patched (PUT). Dirty=true");
 
 	C10_MUTEX_RELEASE();
@@ -715,15 +747,7 @@ bool CL_C10_ConfigManager::patchWindProfileDictFromJson(ST_A20_WindProfileDict_t
 			if (p_cfg.styleCount >= 16) break;
 
 			ST_A20_StyleEntry_t& v_s = p_cfg.styles[p_cfg.styleCount++];
-
-			strlcpy(v_s.name, v_js["name"] | "", sizeof(v_s.name));
-			strlcpy(v_s.code, v_js["code"] | "", sizeof(v_s.code));
-
-			JsonObjectConst v_f            = v_js["factors"].as<JsonObjectConst>();
-			v_s.factors.intensityFactor   = v_f["intensityFactor"] | 1.0f;   // camelCase
-			v_s.factors.variabilityFactor = v_f["variabilityFactor"] | 1.0f; // camelCase
-			v_s.factors.gustFactor        = v_f["gustFactor"] | 1.0f;        // camelCase
-			v_s.factors.thermalFactor     = v_f["thermalFactor"] | 1.0f;     // camelCase
+			C10_fromJson_WindStyle(v_js, v_s);
 		}
 	}
 
@@ -736,21 +760,19 @@ bool CL_C10_ConfigManager::patchWindProfileDictFromJson(ST_A20_WindProfileDict_t
 
 // =====================================================
 // 5. CRUD - Schedules / UserProfiles / WindProfile
-//  (g_A20_config_root를 대상으로 동작)
+//  (g_A20_config_root를 대상으로 동작, 복제본 수정 → publishSection)
 // =====================================================
 
 // ---------- Schedule CRUD ----------
 int CL_C10_ConfigManager::addScheduleFromJson(const JsonDocument& p_doc) {
 	C10_MUTEX_ACQUIRE_BOOL();
 
-	if (!g_A20_config_root.schedules) {
-		g_A20_config_root.schedules = new ST_A20_SchedulesRoot_t();
-		A20_resetSchedulesDefault(*g_A20_config_root.schedules);
-	}
-
-	ST_A20_SchedulesRoot_t& v_root = *g_A20_config_root.schedules;
+	// RCU: 복제본 수정 후 publish (reader는 기존 세대 계속 사용)
+	ST_A20_SchedulesRoot_t* v_next = cloneSection<ST_A20_SchedulesRoot_t>(g_A20_config_root.schedules, A20_resetSchedulesDefault);
+	ST_A20_SchedulesRoot_t& v_root = *v_next;
 
 	if (v_root.count >= A20_Const::MAX_SCHEDULES) {
+		delete v_next;
 		C10_MUTEX_RELEASE();
 		return -1;
 	}
@@ -764,7 +786,9 @@ int CL_C10_ConfigManager::addScheduleFromJson(const JsonDocument& p_doc) {
 	int v_index = v_root.count;
 	v_root.count++;
 
+	publishSection(g_A20_config_root.schedules, v_next);
 	_dirty_schedules = true;
+	s_schedulesGen++;
 	CL_D10_Logger::log(EN_L10_LOG_INFO, "[C10] Schedule added (index=%d)", v_index);
 
 	C10_MUTEX_RELEASE();
@@ -779,7 +803,9 @@ bool CL_C10_ConfigManager::updateScheduleFromJson(uint16_t p_id, const JsonDocum
 		return false;
 	}
 
-	ST_A20_SchedulesRoot_t& v_root = *g_A20_config_root.schedules;
+	// RCU: 복제본 수정 후 publish (reader는 기존 세대 계속 사용)
+	ST_A20_SchedulesRoot_t* v_next = cloneSection<ST_A20_SchedulesRoot_t>(g_A20_config_root.schedules, A20_resetSchedulesDefault);
+	ST_A20_SchedulesRoot_t& v_root = *v_next;
 
 	int v_idx = -1;
 	for (uint8_t v_i = 0; v_i < v_root.count; v_i++) {
@@ -789,6 +815,7 @@ bool CL_C10_ConfigManager::updateScheduleFromJson(uint16_t p_id, const JsonDocum
 		}
 	}
 	if (v_idx < 0) {
+		delete v_next;
 		C10_MUTEX_RELEASE();
 		return false;
 	}
@@ -798,7 +825,9 @@ bool CL_C10_ConfigManager::updateScheduleFromJson(uint16_t p_id, const JsonDocum
 
 	C10_fromJson_ScheduleItem(js, v_root.items[(uint8_t)v_idx]);
 
+	publishSection(g_A20_config_root.schedules, v_next);
 	_dirty_schedules = true;
+	s_schedulesGen++;
 	CL_D10_Logger::log(EN_L10_LOG_INFO, "[C10] Schedule updated (id=%d, index=%d)", p_id, v_idx);
 
 	C10_MUTEX_RELEASE();
@@ -813,7 +842,9 @@ bool CL_C10_ConfigManager::deleteSchedule(uint16_t p_id) {
 		return false;
 	}
 
-	ST_A20_SchedulesRoot_t& v_root = *g_A20_config_root.schedules;
+	// RCU: 복제본 수정 후 publish (reader는 기존 세대 계속 사용)
+	ST_A20_SchedulesRoot_t* v_next = cloneSection<ST_A20_SchedulesRoot_t>(g_A20_config_root.schedules, A20_resetSchedulesDefault);
+	ST_A20_SchedulesRoot_t& v_root = *v_next;
 
 	int v_idx = -1;
 	for (uint8_t v_i = 0; v_i < v_root.count; v_i++) {
@@ -823,6 +854,7 @@ bool CL_C10_ConfigManager::deleteSchedule(uint16_t p_id) {
 		}
 	}
 	if (v_idx < 0) {
+		delete v_next;
 		C10_MUTEX_RELEASE();
 		return false;
 	}
@@ -832,7 +864,9 @@ bool CL_C10_ConfigManager::deleteSchedule(uint16_t p_id) {
 	}
 	if (v_root.count > 0) v_root.count--;
 
+	publishSection(g_A20_config_root.schedules, v_next);
 	_dirty_schedules = true;
+	s_schedulesGen++;
 	CL_D10_Logger::log(EN_L10_LOG_INFO, "[C10] Schedule deleted (id=%d, index=%d)", p_id, v_idx);
 
 	C10_MUTEX_RELEASE();
@@ -843,14 +877,12 @@ bool CL_C10_ConfigManager::deleteSchedule(uint16_t p_id) {
 int CL_C10_ConfigManager::addUserProfilesFromJson(const JsonDocument& p_doc) {
 	C10_MUTEX_ACQUIRE_BOOL();
 
-	if (!g_A20_config_root.userProfiles) {
-		g_A20_config_root.userProfiles = new ST_A20_UserProfilesRoot_t();
-		A20_resetUserProfilesDefault(*g_A20_config_root.userProfiles);
-	}
-
-	ST_A20_UserProfilesRoot_t& v_root = *g_A20_config_root.userProfiles;
+	// RCU: 복제본 수정 후 publish (reader는 기존 세대 계속 사용)
+	ST_A20_UserProfilesRoot_t* v_next = cloneSection<ST_A20_UserProfilesRoot_t>(g_A20_config_root.userProfiles, A20_resetUserProfilesDefault);
+	ST_A20_UserProfilesRoot_t& v_root = *v_next;
 
 	if (v_root.count >= A20_Const::MAX_USER_PROFILES) {
+		delete v_next;
 		C10_MUTEX_RELEASE();
 		return -1;
 	}
@@ -864,6 +896,7 @@ int CL_C10_ConfigManager::addUserProfilesFromJson(const JsonDocument& p_doc) {
 	int v_index = v_root.count;
 	v_root.count++;
 
+	publishSection(g_A20_config_root.userProfiles, v_next);
 	_dirty_userProfiles = true;
 	CL_D10_Logger::log(EN_L10_LOG_INFO, "[C10] UserProfile added (index=%d)", v_index);
 
@@ -879,7 +912,9 @@ bool CL_C10_ConfigManager::updateUserProfilesFromJson(uint16_t p_id, const JsonD
 		return false;
 	}
 
-	ST_A20_UserProfilesRoot_t& v_root = *g_A20_config_root.userProfiles;
+	// RCU: 복제본 수정 후 publish (reader는 기존 세대 계속 사용)
+	ST_A20_UserProfilesRoot_t* v_next = cloneSection<ST_A20_UserProfilesRoot_t>(g_A20_config_root.userProfiles, A20_resetUserProfilesDefault);
+	ST_A20_UserProfilesRoot_t& v_root = *v_next;
 
 	int v_idx = -1;
 	for (uint8_t v_i = 0; v_i < v_root.count; v_i++) {
@@ -889,6 +924,7 @@ bool CL_C10_ConfigManager::updateUserProfilesFromJson(uint16_t p_id, const JsonD
 		}
 	}
 	if (v_idx < 0) {
+		delete v_next;
 		C10_MUTEX_RELEASE();
 		return false;
 	}
@@ -898,6 +934,7 @@ bool CL_C10_ConfigManager::updateUserProfilesFromJson(uint16_t p_id, const JsonD
 
 	C10_fromJson_UserProfile(jp, v_root.items[(uint8_t)v_idx]);
 
+	publishSection(g_A20_config_root.userProfiles, v_next);
 	_dirty_userProfiles = true;
 	CL_D10_Logger::log(EN_L10_LOG_INFO, "[C10] UserProfile updated (id=%d, index=%d)", p_id, v_idx);
 
@@ -913,7 +950,9 @@ bool CL_C10_ConfigManager::deleteUserProfiles(uint16_t p_id) {
 		return false;
 	}
 
-	ST_A20_UserProfilesRoot_t& v_root = *g_A20_config_root.userProfiles;
+	// RCU: 복제본 수정 후 publish (reader는 기존 세대 계속 사용)
+	ST_A20_UserProfilesRoot_t* v_next = cloneSection<ST_A20_UserProfilesRoot_t>(g_A20_config_root.userProfiles, A20_resetUserProfilesDefault);
+	ST_A20_UserProfilesRoot_t& v_root = *v_next;
 
 	int v_idx = -1;
 	for (uint8_t v_i = 0; v_i < v_root.count; v_i++) {
@@ -923,6 +962,7 @@ bool CL_C10_ConfigManager::deleteUserProfiles(uint16_t p_id) {
 		}
 	}
 	if (v_idx < 0) {
+		delete v_next;
 		C10_MUTEX_RELEASE();
 		return false;
 	}
@@ -932,6 +972,7 @@ bool CL_C10_ConfigManager::deleteUserProfiles(uint16_t p_id) {
 	}
 	if (v_root.count > 0) v_root.count--;
 
+	publishSection(g_A20_config_root.userProfiles, v_next);
 	_dirty_userProfiles = true;
 	CL_D10_Logger::log(EN_L10_LOG_INFO, "[C10] UserProfile deleted (id=%d, index=%d)", p_id, v_idx);
 
@@ -943,14 +984,12 @@ bool CL_C10_ConfigManager::deleteUserProfiles(uint16_t p_id) {
 int CL_C10_ConfigManager::addWindProfileFromJson(const JsonDocument& p_doc) {
 	C10_MUTEX_ACQUIRE_BOOL();
 
-	if (!g_A20_config_root.windDict) {
-		g_A20_config_root.windDict = new ST_A20_WindProfileDict_t();
-		A20_resetWindProfileDictDefault(*g_A20_config_root.windDict);
-	}
-
-	ST_A20_WindProfileDict_t& v_root = *g_A20_config_root.windDict;
+	// RCU: 복제본 수정 후 publish (reader는 기존 세대 계속 사용)
+	ST_A20_WindProfileDict_t* v_next = cloneSection<ST_A20_WindProfileDict_t>(g_A20_config_root.windDict, A20_resetWindProfileDictDefault);
+	ST_A20_WindProfileDict_t& v_root = *v_next;
 
 	if (v_root.presetCount >= 16) {
+		delete v_next;
 		C10_MUTEX_RELEASE();
 		return -1;
 	}
@@ -964,6 +1003,7 @@ int CL_C10_ConfigManager::addWindProfileFromJson(const JsonDocument& p_doc) {
 	int v_index = v_root.presetCount;
 	v_root.presetCount++;
 
+	publishSection(g_A20_config_root.windDict, v_next);
 	_dirty_windProfile = true;
 	CL_D10_Logger::log(EN_L10_LOG_INFO, "[C10] WindPreset added (index=%d)", v_index);
 
@@ -979,9 +1019,12 @@ bool CL_C10_ConfigManager::updateWindProfileFromJson(uint16_t p_id, const JsonDo
 		return false;
 	}
 
-	ST_A20_WindProfileDict_t& v_root = *g_A20_config_root.windDict;
+	// RCU: 복제본 수정 후 publish (reader는 기존 세대 계속 사용)
+	ST_A20_WindProfileDict_t* v_next = cloneSection<ST_A20_WindProfileDict_t>(g_A20_config_root.windDict, A20_resetWindProfileDictDefault);
+	ST_A20_WindProfileDict_t& v_root = *v_next;
 
 	if (p_id >= v_root.presetCount) {
+		delete v_next;
 		C10_MUTEX_RELEASE();
 		return false;
 	}
@@ -991,6 +1034,7 @@ bool CL_C10_ConfigManager::updateWindProfileFromJson(uint16_t p_id, const JsonDo
 
 	C10_fromJson_WindPreset(v_js, v_root.presets[p_id]);
 
+	publishSection(g_A20_config_root.windDict, v_next);
 	_dirty_windProfile = true;
 	CL_D10_Logger::log(EN_L10_LOG_INFO, "[C10] WindPreset updated (index=%d)", p_id);
 
@@ -1006,9 +1050,12 @@ bool CL_C10_ConfigManager::deleteWindProfile(uint16_t p_id) {
 		return false;
 	}
 
-	ST_A20_WindProfileDict_t& v_root = *g_A20_config_root.windDict;
+	// RCU: 복제본 수정 후 publish (reader는 기존 세대 계속 사용)
+	ST_A20_WindProfileDict_t* v_next = cloneSection<ST_A20_WindProfileDict_t>(g_A20_config_root.windDict, A20_resetWindProfileDictDefault);
+	ST_A20_WindProfileDict_t& v_root = *v_next;
 
 	if (p_id >= v_root.presetCount) {
+		delete v_next;
 		C10_MUTEX_RELEASE();
 		return false;
 	}
@@ -1018,6 +1065,7 @@ bool CL_C10_ConfigManager::deleteWindProfile(uint16_t p_id) {
 	}
 	if (v_root.presetCount > 0) v_root.presetCount--;
 
+	publishSection(g_A20_config_root.windDict, v_next);
 	_dirty_windProfile = true;
 	CL_D10_Logger::log(EN_L10_LOG_INFO, "[C10] WindPreset deleted (index=%d)", p_id);
 
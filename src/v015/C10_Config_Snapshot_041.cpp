@@ -0,0 +1,607 @@
+/*
+ * ------------------------------------------------------
+ * 소스명 : C10_Config_Snapshot_041.cpp
+ * 모듈 약어 : C10
+ * 모듈명 : Smart Nature Wind Configuration Manager - Binary Snapshot
+ * ------------------------------------------------------
+ * 기능 요약:
+ *  - loadAll 결과(섹션 구조체 8종)를 이진 스냅샷(A20_Const::CFG_SNAPSHOT_FILE)으로 기록
+ *  - 부팅 시 스냅샷 유효 섹션은 memcpy 복원 → 해당 섹션 JSON 파싱 생략
+ *  - 유효성 검증
+ *      . header : magic / layout ver / schema hash / cfg_jsonFile 매핑 hash / header CRC
+ *        (schema hash = 섹션·하위 구조체 sizeof/alignof + 주요 필드 offsetof + G_C10_SNAP_SCHEMA_VER,
+ *         빌드 시각 미포함 → 구조체 변경 없는 재빌드/OTA 후에도 스냅샷 유지)
+ *      . section: 원본 JSON 파일 size + 내용 CRC32 일치 + 데이터 CRC32
+ *        (mtime 미사용: NTP 동기 전 시각/같은 초 내 재기록에 의존하지 않음)
+ *  - 무효화: 섹션 파일 저장(ioSaveJson) / JSON 업로드 시 스냅샷 삭제
+ *  - 재기록: loadAll(JSON 파싱 섹션 존재 시) 즉시, 저장 이후에는 지연·병합
+ *      . saveDirtyConfigs/saveAll → _snapRequest (요청 시각 갱신만)
+ *      . saveTick(loop task) → 저장 예약 없음 + snapRefreshMs 무저장 경과 시 clean 섹션 1회 기록
+ *      . 섹션 포인터는 C10 mutex 내 RCU load, 파일 기록은 mutex 밖 IO lock 구간
+ *      . 그 사이 무효화(invalidate 세대 변경) / 기록 대기 본문 존재 → 기록 생략 후 재요청
+ *  - 스냅샷 기록도 파일별 쓰기 통계(writes.snapshot)에 집계
+ *  - 부팅 시간 통계 (loadAll us, 전체 JSON 로드 us, boot→ready ms)
+ * ------------------------------------------------------
+ * [구현 규칙]
+ *  - 항상 소스 시작 주석 체계 유지
+ *  - ArduinoJson v7.x.x 사용 (v6 이하 사용 금지)
+ *  - JsonDocument 단일 타입만 사용
+ *  - createNestedArray/Object/containsKey 사용 금지
+ *  - memset + strlcpy 기반 안전 초기화
+ *  - 주석/필드명은 JSON 구조와 동일하게 유지
+ *  - 모듈별 헤더(h) + 목적물별 cpp 분리 구성 (Core/System/Schedule/Snapshot)
+ * ------------------------------------------------------
+ * [코드 네이밍 규칙]
+ *   - 전역 상수,매크로      : G_모듈약어_ 접두사
+ *   - 전역 변수             : g_모듈약어_ 접두사
+ *   - 전역 함수             : 모듈약어_ 접두사
+ *   - type                  : T_모듈약어_ 접두사
+ *   - typedef               : _t  접미사
+ *   - enum 상수             : EN_모듈약어_ 접두사
+ *   - 구조체                : ST_모듈약어_ 접두사
+ *   - 클래스명              : CL_모듈약어_ 접두사
+ *   - 클래스 private 멤버   : _ 접두사
+ *   - 클래스 멤버(함수/변수) : 모듈약어 접두사 미사용
+ *   - 클래스 정적 멤버      : s_ 접두사
+ *   - 함수 로컬 변수        : v_ 접두사
+ *   - 함수 인자             : p_ 접두사
+ * ------------------------------------------------------
+ */
+
+#include <Arduino.h>
+#include <FS.h>
+#include <LittleFS.h>
+#include <esp_rom_crc.h>
+
+#include <type_traits>
+
+#include "C10_Config_041.h"
+
+// 섹션 구조체는 memcpy 복원 대상 → 포인터/String 멤버 금지
+static_assert(std::is_trivially_copyable<ST_A20_SystemConfig_t>::value, "snapshot: system");
+static_assert(std::is_trivially_copyable<ST_A20_WifiConfig_t>::value, "snapshot: wifi");
+static_assert(std::is_trivially_copyable<ST_A20_MotionConfig_t>::value, "snapshot: motion");
+static_assert(std::is_trivially_copyable<ST_A20_NvsSpecConfig_t>::value, "snapshot: nvsSpec");
+static_assert(std::is_trivially_copyable<ST_A20_WindProfileDict_t>::value, "snapshot: windDict");
+static_assert(std::is_trivially_copyable<ST_A20_SchedulesRoot_t>::value, "snapshot: schedules");
+static_assert(std::is_trivially_copyable<ST_A20_UserProfilesRoot_t>::value, "snapshot: userProfiles");
+static_assert(std::is_trivially_copyable<ST_A20_WebPageConfig_t>::value, "snapshot: webPage");
+
+// ------------------------------------------------------
+// 스냅샷 파일 레이아웃
+//  [header(entries 포함)] [section data ...] (valid 섹션만 순서대로)
+// ------------------------------------------------------
+static constexpr uint32_t G_C10_SNAP_MAGIC      = 0x43574E53;  // "SNWC"
+static constexpr uint16_t G_C10_SNAP_LAYOUT_VER = 2;
+
+typedef struct {
+	uint8_t  valid;
+	uint8_t  reserved[3];
+	uint32_t srcSize;	// 원본 JSON 파일 size
+	uint32_t srcCrc;	// 원본 JSON 파일 내용 CRC32
+	uint32_t offset;
+	uint32_t len;		// = sizeof(섹션 구조체)
+	uint32_t crc;		// 섹션 데이터 CRC32
+} ST_C10_SnapEntry_t;
+
+typedef struct {
+	uint32_t           magic;
+	uint16_t           layoutVer;
+	uint16_t           sectionCount;
+	uint32_t           schemaHash;	  // 구조체 layout 표 + G_C10_SNAP_SCHEMA_VER
+	uint32_t           mapHash;		  // cfg_jsonFile 섹션 경로 매핑
+	uint32_t           jsonLoadUs;	  // 마지막 전체 JSON loadAll 소요 (비교 기준)
+	ST_C10_SnapEntry_t entries[EN_C10_SNAP_SEC_COUNT];
+	uint32_t           hdrCrc;		  // hdrCrc 이전 필드 CRC32
+} ST_C10_SnapHeader_t;
+
+// 섹션 descriptor (root 포인터 / 크기 / 원본 경로 / 기본값 reset)
+typedef struct {
+	void*       ptr;
+	uint32_t    size;
+	const char* path;
+	void (*reset)(void* p_ptr);
+} ST_C10_SnapSection_t;
+
+// ------------------------------------------------------
+// 통계 (/api/diag "cfgSnap")
+// ------------------------------------------------------
+typedef struct {
+	const char* state;			   // disabled / missing / stale / ok
+	uint32_t    loadUs;			   // 마지막 loadAll 소요
+	uint32_t    jsonLoadUs;		   // 전체 JSON 파싱 loadAll 소요 (스냅샷 header 보존값)
+	uint32_t    snapReadUs;		   // 스냅샷 검증 + 복원 소요
+	uint8_t     snapMask;		   // 스냅샷 복원 섹션
+	uint8_t     jsonMask;		   // JSON 파싱 섹션
+	uint8_t     srcMismatch;	   // 원본 size/CRC 불일치 섹션 수
+	uint8_t     crcFail;		   // 데이터 CRC 불일치 섹션 수
+	uint32_t    writeCount;
+	uint32_t    writeUs;		   // 마지막 기록 소요
+	uint32_t    bytes;			   // 마지막 기록 파일 크기
+	uint32_t    invalidateCount;
+	uint32_t    bootReadyMs;	   // A00_init 완료 시각 (millis)
+	uint32_t    refreshRequests;   // 저장 후 재기록 요청 수 (_snapRequest)
+	uint32_t    refreshRetries;	   // 기록 직전 무효화/대기 본문 → 재요청 수
+} ST_C10_SnapStat_t;
+
+static ST_C10_SnapStat_t s_snapStat = {"missing", 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+
+// 스냅샷 파일이 현재 섹션 파일과 일치하는 상태로 존재하는지 (invalidate 시 false)
+//  - 변경은 IO lock 구간에서만
+static bool s_snapOnFs = false;
+
+// 무효화 세대 (invalidateSnapshot 마다 증가) / 저장 후 재기록 요청
+static uint32_t		s_snapInvalGen	   = 0;
+static bool			s_snapRefreshReq   = false;
+static uint32_t		s_snapRefreshReqMs = 0;
+static portMUX_TYPE s_snapMux		   = portMUX_INITIALIZER_UNLOCKED;
+
+// ------------------------------------------------------
+// 내부 Helper
+// ------------------------------------------------------
+static uint32_t C10_snapFnv1a(uint32_t p_h, const void* p_data, size_t p_len) {
+	const uint8_t* v_p = (const uint8_t*)p_data;
+	for (size_t v_i = 0; v_i < p_len; v_i++) {
+		p_h ^= v_p[v_i];
+		p_h *= 16777619u;
+	}
+	return p_h;
+}
+
+// 구조체 layout 표 (sizeof / alignof / offsetof)
+//  - 필드 추가·삭제·타입 변경·순서 변경·배열 용량(A20_Const::MAX_*) 변경 → 값 변화 → 기존 스냅샷 무효
+//  - 크기/위치가 같은 의미 변경(단위, enum 값 재배치 등)은 표로 검출 불가 → G_C10_SNAP_SCHEMA_VER 증가
+#define G_C10_SNAP_SZ(T)     (uint32_t)sizeof(T), (uint32_t)alignof(T)
+#define G_C10_SNAP_OFF(T, m) (uint32_t)offsetof(T, m)
+
+static uint32_t C10_snapSchemaHash() {
+	static const uint32_t v_layout[] = {
+	    // system
+	    G_C10_SNAP_SZ(ST_A20_SystemConfig_t), G_C10_SNAP_SZ(ST_A20_WebSocketConfig_t), G_C10_SNAP_SZ(ST_A20_FanConfig_t),
+	    G_C10_SNAP_OFF(ST_A20_SystemConfig_t, system), G_C10_SNAP_OFF(ST_A20_SystemConfig_t, system.webSocket),
+	    G_C10_SNAP_OFF(ST_A20_SystemConfig_t, system.storage), G_C10_SNAP_OFF(ST_A20_SystemConfig_t, hw),
+	    G_C10_SNAP_OFF(ST_A20_SystemConfig_t, hw.fanConfig), G_C10_SNAP_OFF(ST_A20_SystemConfig_t, security),
+	    G_C10_SNAP_OFF(ST_A20_SystemConfig_t, time),
+	    G_C10_SNAP_OFF(ST_A20_WebSocketConfig_t, chartLargeBytes), G_C10_SNAP_OFF(ST_A20_WebSocketConfig_t, wsAdaptMaxMul),
+	    // wifi
+	    G_C10_SNAP_SZ(ST_A20_WifiConfig_t), G_C10_SNAP_SZ(ST_A20_STANetwork_t),
+	    G_C10_SNAP_OFF(ST_A20_WifiConfig_t, wifiModeDesc), G_C10_SNAP_OFF(ST_A20_WifiConfig_t, ap),
+	    G_C10_SNAP_OFF(ST_A20_WifiConfig_t, sta), G_C10_SNAP_OFF(ST_A20_WifiConfig_t, staCount),
+	    // motion
+	    G_C10_SNAP_SZ(ST_A20_MotionConfig_t), G_C10_SNAP_SZ(ST_A20_BLETrustedDevice_t),
+	    G_C10_SNAP_OFF(ST_A20_MotionConfig_t, ble), G_C10_SNAP_OFF(ST_A20_MotionConfig_t, ble.trustedCount),
+	    G_C10_SNAP_OFF(ST_A20_MotionConfig_t, ble.rssi), G_C10_SNAP_OFF(ST_A20_MotionConfig_t, timing),
+	    // nvsSpec
+	    G_C10_SNAP_SZ(ST_A20_NvsSpecConfig_t), G_C10_SNAP_SZ(ST_A20_NvsEntry_t),
+	    G_C10_SNAP_OFF(ST_A20_NvsSpecConfig_t, entryCount), G_C10_SNAP_OFF(ST_A20_NvsSpecConfig_t, entries),
+	    // windDict
+	    G_C10_SNAP_SZ(ST_A20_WindProfileDict_t), G_C10_SNAP_SZ(ST_A20_PresetEntry_t), G_C10_SNAP_SZ(ST_A20_StyleEntry_t),
+	    G_C10_SNAP_SZ(ST_A20_WindBase_t), G_C10_SNAP_SZ(ST_A20_StyleFactors_t),
+	    G_C10_SNAP_OFF(ST_A20_WindProfileDict_t, presets), G_C10_SNAP_OFF(ST_A20_WindProfileDict_t, styles),
+	    G_C10_SNAP_OFF(ST_A20_PresetEntry_t, base), G_C10_SNAP_OFF(ST_A20_StyleEntry_t, factors),
+	    // schedules
+	    G_C10_SNAP_SZ(ST_A20_SchedulesRoot_t), G_C10_SNAP_SZ(ST_A20_ScheduleItem_t), G_C10_SNAP_SZ(ST_A20_ScheduleSegment_t),
+	    G_C10_SNAP_SZ(ST_A20_AdjustDelta_t), G_C10_SNAP_SZ(ST_A20_SchAutoOff_t), G_C10_SNAP_SZ(ST_A20_Motion_t),
+	    G_C10_SNAP_OFF(ST_A20_SchedulesRoot_t, items), G_C10_SNAP_OFF(ST_A20_ScheduleItem_t, period),
+	    G_C10_SNAP_OFF(ST_A20_ScheduleItem_t, segments), G_C10_SNAP_OFF(ST_A20_ScheduleItem_t, autoOff),
+	    G_C10_SNAP_OFF(ST_A20_ScheduleItem_t, motion), G_C10_SNAP_OFF(ST_A20_ScheduleSegment_t, mode),
+	    G_C10_SNAP_OFF(ST_A20_ScheduleSegment_t, adjust), G_C10_SNAP_OFF(ST_A20_ScheduleSegment_t, fixedSpeed),
+	    // userProfiles
+	    G_C10_SNAP_SZ(ST_A20_UserProfilesRoot_t), G_C10_SNAP_SZ(ST_A20_UserProfileItem_t),
+	    G_C10_SNAP_SZ(ST_A20_UserProfileSegment_t), G_C10_SNAP_SZ(ST_A20_AutoOff_t),
+	    G_C10_SNAP_OFF(ST_A20_UserProfilesRoot_t, items), G_C10_SNAP_OFF(ST_A20_UserProfileItem_t, segments),
+	    G_C10_SNAP_OFF(ST_A20_UserProfileItem_t, autoOff), G_C10_SNAP_OFF(ST_A20_UserProfileItem_t, motion),
+	    G_C10_SNAP_OFF(ST_A20_UserProfileSegment_t, adjust),
+	    // webPage
+	    G_C10_SNAP_SZ(ST_A20_WebPageConfig_t), G_C10_SNAP_SZ(ST_A20_PageItem_t), G_C10_SNAP_SZ(ST_A20_PageAsset_t),
+	    G_C10_SNAP_SZ(ST_A20_ReDirectItem_t), G_C10_SNAP_SZ(ST_A20_CommonAsset_t),
+	    G_C10_SNAP_OFF(ST_A20_WebPageConfig_t, reDirect), G_C10_SNAP_OFF(ST_A20_WebPageConfig_t, assets),
+	    G_C10_SNAP_OFF(ST_A20_PageItem_t, pageAssets),
+	};
+
+	uint32_t v_h   = 2166136261u;
+	uint32_t v_ver = G_C10_SNAP_SCHEMA_VER;
+	v_h            = C10_snapFnv1a(v_h, &v_ver, sizeof(v_ver));
+	v_h            = C10_snapFnv1a(v_h, v_layout, sizeof(v_layout));
+	return v_h;
+}
+
+static uint32_t C10_snapMapHash() {
+	const ST_A20_cfg_jsonFile_t& v_map = CL_C10_ConfigManager::getCfgJsonFileMap();
+	return C10_snapFnv1a(2166136261u, &v_map, sizeof(v_map));
+}
+
+static uint32_t C10_snapHdrCrc(const ST_C10_SnapHeader_t& p_hdr) {
+	return esp_rom_crc32_le(0, (const uint8_t*)&p_hdr, offsetof(ST_C10_SnapHeader_t, hdrCrc));
+}
+
+static uint8_t C10_snapCount(uint8_t p_mask) {
+	uint8_t v_n = 0;
+	for (; p_mask; p_mask &= (uint8_t)(p_mask - 1)) v_n++;
+	return v_n;
+}
+
+// 섹션 index → descriptor (root 섹션 미할당 시 ptr = nullptr)
+static ST_C10_SnapSection_t C10_snapSection(const ST_A20_ConfigRoot_t& p_root, uint8_t p_sec) {
+	const ST_A20_cfg_jsonFile_t& v_map = CL_C10_ConfigManager::getCfgJsonFileMap();
+
+	switch (p_sec) {
+		case EN_C10_SNAP_SEC_SYSTEM:
+			return {p_root.system, sizeof(ST_A20_SystemConfig_t), v_map.system,
+			        [](void* p) { A20_resetSystemDefault(*(ST_A20_SystemConfig_t*)p); }};
+		case EN_C10_SNAP_SEC_WIFI:
+			return {p_root.wifi, sizeof(ST_A20_WifiConfig_t), v_map.wifi,
+			        [](void* p) { A20_resetWifiDefault(*(ST_A20_WifiConfig_t*)p); }};
+		case EN_C10_SNAP_SEC_MOTION:
+			return {p_root.motion, sizeof(ST_A20_MotionConfig_t), v_map.motion,
+			        [](void* p) { A20_resetMotionDefault(*(ST_A20_MotionConfig_t*)p); }};
+		case EN_C10_SNAP_SEC_NVS_SPEC:
+			return {p_root.nvsSpec, sizeof(ST_A20_NvsSpecConfig_t), v_map.nvsSpec,
+			        [](void* p) { A20_resetNvsSpecDefault(*(ST_A20_NvsSpecConfig_t*)p); }};
+		case EN_C10_SNAP_SEC_WIND_DICT:
+			return {p_root.windDict, sizeof(ST_A20_WindProfileDict_t), v_map.windDict,
+			        [](void* p) { A20_resetWindProfileDictDefault(*(ST_A20_WindProfileDict_t*)p); }};
+		case EN_C10_SNAP_SEC_SCHEDULES:
+			return {p_root.schedules, sizeof(ST_A20_SchedulesRoot_t), v_map.schedules,
+			        [](void* p) { A20_resetSchedulesDefault(*(ST_A20_SchedulesRoot_t*)p); }};
+		case EN_C10_SNAP_SEC_USER_PROFILES:
+			return {p_root.userProfiles, sizeof(ST_A20_UserProfilesRoot_t), v_map.userProfiles,
+			        [](void* p) { A20_resetUserProfilesDefault(*(ST_A20_UserProfilesRoot_t*)p); }};
+		case EN_C10_SNAP_SEC_WEB_PAGE:
+			return {p_root.webPage, sizeof(ST_A20_WebPageConfig_t), v_map.webPage,
+			        [](void* p) { A20_resetWebPageDefault(*(ST_A20_WebPageConfig_t*)p); }};
+		default:
+			return {nullptr, 0, nullptr, nullptr};
+	}
+}
+
+// 원본 JSON 파일 size / 내용 CRC32
+//  - p_expectSize 지정(≠0) 시 size 불일치면 내용 읽기 생략 (부팅 경로 조기 거부)
+//  - JSON 파싱 없이 순차 read만 수행 → 전체 설정 수십 KB 기준 파싱 대비 소량
+static bool C10_snapStatSource(const char* p_path, uint32_t& p_size, uint32_t& p_crc, uint32_t p_expectSize = 0) {
+	if (!p_path || !p_path[0]) return false;
+
+	File v_f = LittleFS.open(p_path, "r");
+	if (!v_f) return false;
+
+	p_size = (uint32_t)v_f.size();
+	p_crc  = 0;
+	if (p_expectSize != 0 && p_size != p_expectSize) {
+		v_f.close();
+		return true;
+	}
+
+	uint8_t  v_buf[256];
+	uint32_t v_left = p_size;
+	while (v_left > 0) {
+		size_t v_n = v_f.read(v_buf, v_left < sizeof(v_buf) ? v_left : sizeof(v_buf));
+		if (v_n == 0) break;
+		p_crc = esp_rom_crc32_le(p_crc, v_buf, v_n);
+		v_left -= (uint32_t)v_n;
+	}
+	v_f.close();
+	return v_left == 0;
+}
+
+// p_mask 섹션만 기록 (tmp 기록 후 rename)
+static bool C10_snapWrite(const ST_A20_ConfigRoot_t& p_root, uint8_t p_mask) {
+	uint32_t v_t0 = micros();
+
+	ST_C10_SnapHeader_t v_hdr;
+	memset(&v_hdr, 0, sizeof(v_hdr));
+	v_hdr.magic        = G_C10_SNAP_MAGIC;
+	v_hdr.layoutVer    = G_C10_SNAP_LAYOUT_VER;
+	v_hdr.sectionCount = EN_C10_SNAP_SEC_COUNT;
+	v_hdr.schemaHash   = C10_snapSchemaHash();
+	v_hdr.mapHash      = C10_snapMapHash();
+	v_hdr.jsonLoadUs   = s_snapStat.jsonLoadUs;
+
+	uint32_t v_offset = sizeof(ST_C10_SnapHeader_t);
+	for (uint8_t v_sec = 0; v_sec < EN_C10_SNAP_SEC_COUNT; v_sec++) {
+		if (!(p_mask & G_C10_SNAP_BIT(v_sec))) continue;
+
+		ST_C10_SnapSection_t v_s = C10_snapSection(p_root, v_sec);
+		ST_C10_SnapEntry_t&  v_e = v_hdr.entries[v_sec];
+		if (!v_s.ptr || !C10_snapStatSource(v_s.path, v_e.srcSize, v_e.srcCrc)) continue;
+
+		v_e.valid  = 1;
+		v_e.offset = v_offset;
+		v_e.len    = v_s.size;
+		v_e.crc    = esp_rom_crc32_le(0, (const uint8_t*)v_s.ptr, v_s.size);
+		v_offset += v_s.size;
+	}
+	v_hdr.hdrCrc = C10_snapHdrCrc(v_hdr);
+
+	char v_tmpPath[A20_Const::LEN_PATH + 5];
+	snprintf(v_tmpPath, sizeof(v_tmpPath), "%s.tmp", A20_Const::CFG_SNAPSHOT_FILE);
+
+	File v_f = LittleFS.open(v_tmpPath, "w");
+	if (!v_f) {
+		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[C10] Snapshot open failed: %s", v_tmpPath);
+		return false;
+	}
+
+	bool v_ok = (v_f.write((const uint8_t*)&v_hdr, sizeof(v_hdr)) == sizeof(v_hdr));
+	for (uint8_t v_sec = 0; v_ok && v_sec < EN_C10_SNAP_SEC_COUNT; v_sec++) {
+		if (!v_hdr.entries[v_sec].valid) continue;
+
+		ST_C10_SnapSection_t v_s = C10_snapSection(p_root, v_sec);
+		v_ok = (v_f.write((const uint8_t*)v_s.ptr, v_s.size) == v_s.size);
+	}
+	v_f.close();
+
+	if (!v_ok) {
+		LittleFS.remove(v_tmpPath);
+		C10_recordFileWrite(A20_Const::CFG_SNAPSHOT_FILE, 0, false);
+		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[C10] Snapshot write failed (fs full?)");
+		return false;
+	}
+
+	LittleFS.remove(A20_Const::CFG_SNAPSHOT_FILE);
+	if (!LittleFS.rename(v_tmpPath, A20_Const::CFG_SNAPSHOT_FILE)) {
+		LittleFS.remove(v_tmpPath);
+		C10_recordFileWrite(A20_Const::CFG_SNAPSHOT_FILE, 0, false);
+		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[C10] Snapshot rename failed");
+		return false;
+	}
+
+	s_snapOnFs = true;
+	s_snapStat.writeCount++;
+	s_snapStat.writeUs = micros() - v_t0;
+	s_snapStat.bytes   = v_offset;
+	C10_recordFileWrite(A20_Const::CFG_SNAPSHOT_FILE, v_offset, true);
+
+	CL_D10_Logger::log(EN_L10_LOG_INFO,
+	                   "[C10] Snapshot written: %lu B, sections=0x%02X (%lu us)",
+	                   (unsigned long)v_offset,
+	                   (unsigned)p_mask,
+	                   (unsigned long)s_snapStat.writeUs);
+	return true;
+}
+
+// =====================================================
+// 1-1. 이진 스냅샷
+// =====================================================
+uint8_t CL_C10_ConfigManager::_snapLoad(ST_A20_ConfigRoot_t& p_root) {
+#if G_C10_SNAPSHOT_ENABLE
+	uint32_t v_t0 = micros();
+
+	s_snapStat.srcMismatch = 0;
+	s_snapStat.crcFail     = 0;
+	s_snapStat.snapReadUs  = 0;
+
+	File v_f = LittleFS.open(A20_Const::CFG_SNAPSHOT_FILE, "r");
+	if (!v_f) {
+		s_snapStat.state = "missing";
+		s_snapOnFs       = false;
+		return 0;
+	}
+
+	ST_C10_SnapHeader_t v_hdr;
+	if (v_f.read((uint8_t*)&v_hdr, sizeof(v_hdr)) != sizeof(v_hdr) || v_hdr.magic != G_C10_SNAP_MAGIC ||
+	    v_hdr.layoutVer != G_C10_SNAP_LAYOUT_VER || v_hdr.sectionCount != EN_C10_SNAP_SEC_COUNT ||
+	    v_hdr.hdrCrc != C10_snapHdrCrc(v_hdr) || v_hdr.schemaHash != C10_snapSchemaHash() ||
+	    v_hdr.mapHash != C10_snapMapHash()) {
+		v_f.close();
+		s_snapStat.state = "stale";
+		s_snapOnFs       = false;
+		CL_D10_Logger::log(EN_L10_LOG_WARN, "[C10] Snapshot stale (header/schema/map mismatch) → JSON reparse");
+		return 0;
+	}
+
+	s_snapStat.jsonLoadUs = v_hdr.jsonLoadUs;
+
+	uint8_t v_mask = 0;
+	for (uint8_t v_sec = 0; v_sec < EN_C10_SNAP_SEC_COUNT; v_sec++) {
+		const ST_C10_SnapEntry_t& v_e = v_hdr.entries[v_sec];
+		if (!v_e.valid) continue;
+
+		ST_C10_SnapSection_t v_s = C10_snapSection(p_root, v_sec);
+		if (!v_s.ptr || v_e.len != v_s.size) continue;
+
+		// 원본 JSON이 스냅샷 이후 변경(업로드/외부 기록) → 해당 섹션만 JSON 파싱
+		uint32_t v_size = 0;
+		uint32_t v_crc  = 0;
+		if (!C10_snapStatSource(v_s.path, v_size, v_crc, v_e.srcSize) || v_size != v_e.srcSize || v_crc != v_e.srcCrc) {
+			s_snapStat.srcMismatch++;
+			continue;
+		}
+
+		if (!v_f.seek(v_e.offset) || v_f.read((uint8_t*)v_s.ptr, v_s.size) != v_s.size ||
+		    esp_rom_crc32_le(0, (const uint8_t*)v_s.ptr, v_s.size) != v_e.crc) {
+			// 부분 기록된 구조체 → 기본값 복귀 후 JSON 경로
+			v_s.reset(v_s.ptr);
+			s_snapStat.crcFail++;
+			continue;
+		}
+
+		v_mask |= G_C10_SNAP_BIT(v_sec);
+	}
+	v_f.close();
+
+	if (v_mask & G_C10_SNAP_BIT(EN_C10_SNAP_SEC_SCHEDULES)) {
+		s_schedulesGen++;
+	}
+	if (v_mask & G_C10_SNAP_BIT(EN_C10_SNAP_SEC_WIND_DICT)) {
+		__atomic_add_fetch(&s_windDictGen, 1, __ATOMIC_RELEASE);
+	}
+
+	s_snapStat.state      = "ok";
+	s_snapStat.snapReadUs = micros() - v_t0;
+	s_snapOnFs            = (s_snapStat.srcMismatch == 0 && s_snapStat.crcFail == 0);
+	return v_mask;
+#else
+	(void)p_root;
+	s_snapStat.state = "disabled";
+	return 0;
+#endif
+}
+
+void CL_C10_ConfigManager::_snapLoadDone(const ST_A20_ConfigRoot_t& p_root,
+                                         uint8_t                    p_snapMask,
+                                         uint8_t                    p_okMask,
+                                         uint32_t                   p_us) {
+	s_snapStat.loadUs   = p_us;
+	s_snapStat.snapMask = p_snapMask;
+	s_snapStat.jsonMask = (uint8_t)(p_okMask & ~p_snapMask);
+
+	// 스냅샷 미사용 전체 JSON 로드 → 비교 기준값 갱신
+	if (p_snapMask == 0) s_snapStat.jsonLoadUs = p_us;
+
+	CL_D10_Logger::log(EN_L10_LOG_INFO,
+	                   "[C10] loadAll %lu us (snapshot %u / json %u sections, full json %lu us)",
+	                   (unsigned long)p_us,
+	                   (unsigned)C10_snapCount(s_snapStat.snapMask),
+	                   (unsigned)C10_snapCount(s_snapStat.jsonMask),
+	                   (unsigned long)s_snapStat.jsonLoadUs);
+
+#if G_C10_SNAPSHOT_ENABLE
+	// JSON 파싱 섹션 존재(=스냅샷 누락/불일치) 시에만 재기록
+	if (s_snapStat.jsonMask != 0 || !s_snapOnFs) {
+		C10_ioLock();
+		(void)C10_snapWrite(p_root, p_okMask);
+		C10_ioUnlock();
+	}
+#else
+	(void)p_root;
+#endif
+}
+
+void CL_C10_ConfigManager::_snapRequest() {
+#if G_C10_SNAPSHOT_ENABLE
+	const uint32_t v_now = millis();
+
+	portENTER_CRITICAL(&s_snapMux);
+	s_snapRefreshReq   = true;
+	s_snapRefreshReqMs = v_now;
+	s_snapStat.refreshRequests++;
+	portEXIT_CRITICAL(&s_snapMux);
+#endif
+}
+
+void CL_C10_ConfigManager::_snapRefreshTick(uint32_t p_idleMs) {
+#if G_C10_SNAPSHOT_ENABLE
+	const uint32_t v_now = millis();
+
+	portENTER_CRITICAL(&s_snapMux);
+	const bool v_due = s_snapRefreshReq && (uint32_t)(v_now - s_snapRefreshReqMs) >= p_idleMs;
+	if (v_due) s_snapRefreshReq = false;
+	portEXIT_CRITICAL(&s_snapMux);
+	if (!v_due) return;
+
+	// 1) 섹션 포인터 + 무효화 세대 캡처 (loop task → rcuReclaim 전까지 포인터 유효)
+	//    v_view 는 C10_snapWrite 읽기 전용 (root 구조체가 비-const 포인터라 const 제거만)
+	C10_MUTEX_ACQUIRE_VOID();
+	ST_A20_ConfigRoot_t v_view;
+	v_view.system		= const_cast<ST_A20_SystemConfig_t*>(C10_rcuRead(g_A20_config_root.system));
+	v_view.wifi			= const_cast<ST_A20_WifiConfig_t*>(C10_rcuRead(g_A20_config_root.wifi));
+	v_view.motion		= const_cast<ST_A20_MotionConfig_t*>(C10_rcuRead(g_A20_config_root.motion));
+	v_view.nvsSpec		= const_cast<ST_A20_NvsSpecConfig_t*>(C10_rcuRead(g_A20_config_root.nvsSpec));
+	v_view.windDict		= const_cast<ST_A20_WindProfileDict_t*>(C10_rcuRead(g_A20_config_root.windDict));
+	v_view.schedules	= const_cast<ST_A20_SchedulesRoot_t*>(C10_rcuRead(g_A20_config_root.schedules));
+	v_view.userProfiles = const_cast<ST_A20_UserProfilesRoot_t*>(C10_rcuRead(g_A20_config_root.userProfiles));
+	v_view.webPage		= const_cast<ST_A20_WebPageConfig_t*>(C10_rcuRead(g_A20_config_root.webPage));
+
+	// 파일 내용과 일치하는 섹션(할당 + dirty 아님)만
+	uint8_t v_cleanMask = 0;
+	if (v_view.system && !_dirty_system)             v_cleanMask |= G_C10_SNAP_BIT(EN_C10_SNAP_SEC_SYSTEM);
+	if (v_view.wifi && !_dirty_wifi)                 v_cleanMask |= G_C10_SNAP_BIT(EN_C10_SNAP_SEC_WIFI);
+	if (v_view.motion && !_dirty_motion)             v_cleanMask |= G_C10_SNAP_BIT(EN_C10_SNAP_SEC_MOTION);
+	if (v_view.nvsSpec && !_dirty_nvsSpec)           v_cleanMask |= G_C10_SNAP_BIT(EN_C10_SNAP_SEC_NVS_SPEC);
+	if (v_view.windDict && !_dirty_windProfile)      v_cleanMask |= G_C10_SNAP_BIT(EN_C10_SNAP_SEC_WIND_DICT);
+	if (v_view.schedules && !_dirty_schedules)       v_cleanMask |= G_C10_SNAP_BIT(EN_C10_SNAP_SEC_SCHEDULES);
+	if (v_view.userProfiles && !_dirty_userProfiles) v_cleanMask |= G_C10_SNAP_BIT(EN_C10_SNAP_SEC_USER_PROFILES);
+	if (v_view.webPage && !_dirty_webPage)           v_cleanMask |= G_C10_SNAP_BIT(EN_C10_SNAP_SEC_WEB_PAGE);
+	const uint32_t v_gen = __atomic_load_n(&s_snapInvalGen, __ATOMIC_ACQUIRE);
+	C10_MUTEX_RELEASE();
+
+	// 2) mutex 밖 기록 (IO lock: 섹션 파일 rename / invalidate 와 직렬화)
+	C10_ioLock();
+	bool v_retry = false;
+	if (!s_snapOnFs && v_cleanMask != 0) {
+		if (v_gen != s_snapInvalGen || C10_ioPendingMask() != 0) {
+			v_retry = true;
+		} else {
+			(void)C10_snapWrite(v_view, v_cleanMask);
+		}
+	}
+	C10_ioUnlock();
+
+	if (v_retry) {
+		portENTER_CRITICAL(&s_snapMux);
+		s_snapRefreshReq   = true;
+		s_snapRefreshReqMs = millis();
+		s_snapStat.refreshRetries++;
+		portEXIT_CRITICAL(&s_snapMux);
+	}
+#else
+	(void)p_idleMs;
+#endif
+}
+
+void CL_C10_ConfigManager::invalidateSnapshot(const char* p_path) {
+	if (p_path) {
+		const ST_A20_cfg_jsonFile_t& v_map = s_cfgJsonFileMap;
+
+		bool v_hit = (strcmp(p_path, A20_Const::CFG_JSON_FILE) == 0) || (strcmp(p_path, v_map.system) == 0) ||
+		             (strcmp(p_path, v_map.wifi) == 0) || (strcmp(p_path, v_map.motion) == 0) ||
+		             (strcmp(p_path, v_map.nvsSpec) == 0) || (strcmp(p_path, v_map.windDict) == 0) ||
+		             (strcmp(p_path, v_map.schedules) == 0) || (strcmp(p_path, v_map.userProfiles) == 0) ||
+		             (strcmp(p_path, v_map.webPage) == 0);
+		if (!v_hit) return;
+	}
+
+	C10_ioLock();
+	// 진행 중 재기록 캡처분은 세대 비교로 폐기
+	__atomic_add_fetch(&s_snapInvalGen, 1, __ATOMIC_RELEASE);
+
+	if (!s_snapOnFs && !LittleFS.exists(A20_Const::CFG_SNAPSHOT_FILE)) {
+		C10_ioUnlock();
+		return;
+	}
+
+	LittleFS.remove(A20_Const::CFG_SNAPSHOT_FILE);
+	s_snapOnFs = false;
+	s_snapStat.invalidateCount++;
+	C10_ioUnlock();
+	CL_D10_Logger::log(EN_L10_LOG_DEBUG, "[C10] Snapshot invalidated (%s)", p_path ? p_path : "all");
+}
+
+void CL_C10_ConfigManager::markBootReady() {
+	s_snapStat.bootReadyMs = millis();
+
+	CL_D10_Logger::log(EN_L10_LOG_INFO,
+	                   "[C10] Boot→ready %lu ms (loadAll %lu us, snapshot=%s, full json %lu us)",
+	                   (unsigned long)s_snapStat.bootReadyMs,
+	                   (unsigned long)s_snapStat.loadUs,
+	                   s_snapStat.state,
+	                   (unsigned long)s_snapStat.jsonLoadUs);
+}
+
+void CL_C10_ConfigManager::snapshotStatsToJson(JsonObject p_obj) {
+	p_obj["enabled"]      = (G_C10_SNAPSHOT_ENABLE != 0);
+	p_obj["state"]        = s_snapStat.state;
+	p_obj["bootReadyMs"]  = s_snapStat.bootReadyMs;
+	p_obj["loadUs"]       = s_snapStat.loadUs;
+	p_obj["jsonLoadUs"]   = s_snapStat.jsonLoadUs;
+	p_obj["snapReadUs"]   = s_snapStat.snapReadUs;
+	p_obj["snapSections"] = C10_snapCount(s_snapStat.snapMask);
+	p_obj["jsonSections"] = C10_snapCount(s_snapStat.jsonMask);
+	p_obj["srcMismatch"]  = s_snapStat.srcMismatch;
+	p_obj["crcFail"]      = s_snapStat.crcFail;
+	p_obj["writeCount"]   = s_snapStat.writeCount;
+	p_obj["writeUs"]      = s_snapStat.writeUs;
+	p_obj["bytes"]        = s_snapStat.bytes;
+	p_obj["invalidated"]  = s_snapStat.invalidateCount;
+
+	portENTER_CRITICAL(&s_snapMux);
+	const bool     v_req     = s_snapRefreshReq;
+	const uint32_t v_reqMs   = s_snapRefreshReqMs;
+	const uint32_t v_reqN    = s_snapStat.refreshRequests;
+	const uint32_t v_retries = s_snapStat.refreshRetries;
+	portEXIT_CRITICAL(&s_snapMux);
+	p_obj["refreshPending"]  = v_req;
+	if (v_req) p_obj["refreshAgoMs"] = (uint32_t)(millis() - v_reqMs);
+	p_obj["refreshRequests"] = v_reqN;
+	p_obj["refreshRetries"]  = v_retries;
+}
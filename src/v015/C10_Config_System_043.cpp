@@ -5,7 +5,8 @@
  * 모듈명 : Smart Nature Wind Configuration Manager - System/Wifi/Motion
  * ------------------------------------------------------
  * 기능 요약:
- *  - System / Wifi / Motion 설정 Load/Save
+ *  - System / Wifi / Motion 설정 Load/Save (Load: 섹션별 Filter + NestingLimit 부분 파싱)
+ *  - system.storage: write-behind coalesce / 스냅샷 재기록 시간 (Journal saveTick 런타임 참조)
  *  - System / Wifi / Motion 설정 JSON Patch 적용
  *  - System / Wifi / Motion 설정 JSON Export
  * ------------------------------------------------------
@@ -139,13 +140,21 @@ static uint8_t C10_u8Clamp(uint32_t p_v, uint8_t p_lo, uint8_t p_hi) {
 
 // =====================================================
 // 2-1. 목적물별 Load 구현 (System/Wifi/Motion)
+//  - 섹션별 Filter: loader가 읽는 key만 문서에 적재 (version/jsonFile/미사용 key 제외)
 // =====================================================
+static const char G_C10_FILTER_SYSTEM[] =
+	"{\"meta\":true,\"system\":{\"logging\":true,\"webSocket\":true,\"storage\":true,\"hw\":true},"
+	"\"hw\":true,\"security\":true,\"time\":true}";
+static const char G_C10_FILTER_WIFI[] =
+	"{\"wifi\":{\"wifiMode\":true,\"wifiModeDesc\":true,\"ap\":true,\"sta\":true}}";
+static const char G_C10_FILTER_MOTION[] =
+	"{\"motion\":{\"pir\":true,\"ble\":true,\"timing\":true}}";
 
 bool CL_C10_ConfigManager::loadSystemConfig(ST_A20_SystemConfig_t& p_cfg) {
     // ✅ 0) 기본값 1회 선행 (누락 키 대응)
     A20_resetSystemDefault(p_cfg);
 
-    JsonDocument v_doc;
+    JsonDocument v_doc(C10_jsonAllocator());
 
     const char* v_cfgJsonPath = nullptr;
     if (s_cfgJsonFileMap.system[0] != '\0') {
@@ -155,7 +164,7 @@ bool CL_C10_ConfigManager::loadSystemConfig(ST_A20_SystemConfig_t& p_cfg) {
         return false; // 기본값 상태 유지
     }
 
-    if (!ioLoadJson(v_cfgJsonPath, v_doc)) {
+    if (!ioLoadJson(v_cfgJsonPath, v_doc, G_C10_FILTER_SYSTEM, G_C10_JSON_NEST_SECTION)) {
         CL_D10_Logger::log(EN_L10_LOG_ERROR, "[C10] loadSystemConfig: ioLoadJson failed (%s)", v_cfgJsonPath);
         return false; // 기본값 상태 유지
     }
@@ -239,6 +248,48 @@ bool CL_C10_ConfigManager::loadSystemConfig(ST_A20_SystemConfig_t& p_cfg) {
             uint32_t v_raw = j_ws["wsCleanupMs"].as<uint32_t>();
             if (v_raw > 0) p_cfg.system.webSocket.wsCleanupMs = C10_u16Clamp(v_raw, 200, 60000);
         }
+
+        // 5) chartWindow
+        if (j_ws["chartWindow"].is<uint32_t>()) {
+            uint32_t v_raw = j_ws["chartWindow"].as<uint32_t>();
+            if (v_raw > 0) p_cfg.system.webSocket.chartWindow = C10_u16Clamp(v_raw, G_A20_CHART_WINDOW_MIN, G_A20_CHART_WINDOW_MAX);
+        }
+
+        // 6) wsPassBudgetBytes / wsPassBudgetUs
+        if (j_ws["wsPassBudgetBytes"].is<uint32_t>()) {
+            uint32_t v_raw = j_ws["wsPassBudgetBytes"].as<uint32_t>();
+            if (v_raw > 0) p_cfg.system.webSocket.wsPassBudgetBytes = C10_u16Clamp(v_raw, 256, 60000);
+        }
+        if (j_ws["wsPassBudgetUs"].is<uint32_t>()) {
+            uint32_t v_raw = j_ws["wsPassBudgetUs"].as<uint32_t>();
+            if (v_raw > 0) p_cfg.system.webSocket.wsPassBudgetUs = C10_u16Clamp(v_raw, 500, 50000);
+        }
+
+        // 7) wsAdaptEnabled / wsAdaptMaxMul
+        if (j_ws["wsAdaptEnabled"].is<bool>()) p_cfg.system.webSocket.wsAdaptEnabled = j_ws["wsAdaptEnabled"].as<bool>();
+        if (j_ws["wsAdaptMaxMul"].is<uint32_t>()) {
+            uint32_t v_raw = j_ws["wsAdaptMaxMul"].as<uint32_t>();
+            if (v_raw > 0) p_cfg.system.webSocket.wsAdaptMaxMul = C10_u8Clamp(v_raw, 1, 32);
+        }
+    }
+
+    // -------------------------
+    // system.storage (있으면 덮어쓰기, saveMaxDelayMs < saveCoalesceMs 는 Journal에서 보정)
+    // -------------------------
+    JsonObjectConst j_st = j_sys["storage"].as<JsonObjectConst>();
+    if (!j_st.isNull()) {
+        if (j_st["saveCoalesceMs"].is<uint32_t>()) {
+            p_cfg.system.storage.saveCoalesceMs =
+                C10_u16Clamp(j_st["saveCoalesceMs"].as<uint32_t>(), G_A20_SAVE_COALESCE_MIN_MS, G_A20_SAVE_TIMING_MAX_MS);
+        }
+        if (j_st["saveMaxDelayMs"].is<uint32_t>()) {
+            p_cfg.system.storage.saveMaxDelayMs =
+                C10_u16Clamp(j_st["saveMaxDelayMs"].as<uint32_t>(), G_A20_SAVE_COALESCE_MIN_MS, G_A20_SAVE_TIMING_MAX_MS);
+        }
+        if (j_st["snapRefreshMs"].is<uint32_t>()) {
+            p_cfg.system.storage.snapRefreshMs =
+                C10_u16Clamp(j_st["snapRefreshMs"].as<uint32_t>(), G_A20_SAVE_COALESCE_MIN_MS, G_A20_SAVE_TIMING_MAX_MS);
+        }
     }
 
     // -------------------------
@@ -313,13 +364,13 @@ bool CL_C10_ConfigManager::loadWifiConfig(ST_A20_WifiConfig_t& p_cfg) {
     // ✅ 기본값 선행
     A20_resetWifiDefault(p_cfg);
 
-    JsonDocument d;
+    JsonDocument d(C10_jsonAllocator());
 
     const char* v_cfgJsonPath = nullptr;
     if (s_cfgJsonFileMap.wifi[0] != '\0') v_cfgJsonPath = s_cfgJsonFileMap.wifi;
     else return false;
 
-    if (!ioLoadJson(v_cfgJsonPath, d)) return false;
+    if (!ioLoadJson(v_cfgJsonPath, d, G_C10_FILTER_WIFI, G_C10_JSON_NEST_SECTION)) return false;
 
     JsonObjectConst j = d["wifi"].as<JsonObjectConst>();
     if (j.isNull()) return false;
@@ -365,13 +416,13 @@ bool CL_C10_ConfigManager::loadMotionConfig(ST_A20_MotionConfig_t& p_cfg) {
     // ✅ 기본값 선행
     A20_resetMotionDefault(p_cfg);
 
-    JsonDocument d;
+    JsonDocument d(C10_jsonAllocator());
 
     const char* v_cfgJsonPath = nullptr;
     if (s_cfgJsonFileMap.motion[0] != '\0') v_cfgJsonPath = s_cfgJsonFileMap.motion;
     else return false;
 
-    if (!ioLoadJson(v_cfgJsonPath, d)) return false;
+    if (!ioLoadJson(v_cfgJsonPath, d, G_C10_FILTER_MOTION, G_C10_JSON_NEST_SECTION)) return false;
 
     JsonObjectConst j = d["motion"].as<JsonObjectConst>();
     if (j.isNull()) return false;
@@ -772,6 +823,16 @@ bool CL_C10_ConfigManager::saveSystemConfig(const ST_A20_SystemConfig_t& p_cfg)
 	v_ws["chartLargeBytes"]  = p_cfg.system.webSocket.chartLargeBytes;
 	v_ws["chartThrottleMul"] = p_cfg.system.webSocket.chartThrottleMul;
 	v_ws["wsCleanupMs"]      = p_cfg.system.webSocket.wsCleanupMs;
+	v_ws["chartWindow"]      = p_cfg.system.webSocket.chartWindow;
+	v_ws["wsPassBudgetBytes"] = p_cfg.system.webSocket.wsPassBudgetBytes;
+	v_ws["wsPassBudgetUs"]    = p_cfg.system.webSocket.wsPassBudgetUs;
+	v_ws["wsAdaptEnabled"]    = p_cfg.system.webSocket.wsAdaptEnabled;
+	v_ws["wsAdaptMaxMul"]     = p_cfg.system.webSocket.wsAdaptMaxMul;
+
+	JsonObject v_st = v["system"]["storage"].to<JsonObject>();
+	v_st["saveCoalesceMs"] = p_cfg.system.storage.saveCoalesceMs;
+	v_st["saveMaxDelayMs"] = p_cfg.system.storage.saveMaxDelayMs;
+	v_st["snapRefreshMs"]  = p_cfg.system.storage.snapRefreshMs;
 
 
 	// hw.fanPwm (camelCase)
@@ -977,6 +1038,73 @@ bool CL_C10_ConfigManager::patchSystemFromJson(ST_A20_SystemConfig_t& p_config,
 					v_changed = true;
 				}
 			}
+
+			// chartWindow (S10 차트 이력 보관 샘플 수)
+			if (j_ws["chartWindow"].is<uint32_t>()) {
+				uint16_t v_new = C10_u16Clamp(j_ws["chartWindow"].as<uint32_t>(), G_A20_CHART_WINDOW_MIN, G_A20_CHART_WINDOW_MAX);
+				if (v_new != p_config.system.webSocket.chartWindow) {
+					p_config.system.webSocket.chartWindow = v_new;
+					v_changed = true;
+				}
+			}
+
+			// wsPassBudgetBytes / wsPassBudgetUs (CT10 스케줄러 pass 예산)
+			if (j_ws["wsPassBudgetBytes"].is<uint32_t>()) {
+				uint16_t v_new = C10_u16Clamp(j_ws["wsPassBudgetBytes"].as<uint32_t>(), 256, 60000);
+				if (v_new != p_config.system.webSocket.wsPassBudgetBytes) {
+					p_config.system.webSocket.wsPassBudgetBytes = v_new;
+					v_changed = true;
+				}
+			}
+			if (j_ws["wsPassBudgetUs"].is<uint32_t>()) {
+				uint16_t v_new = C10_u16Clamp(j_ws["wsPassBudgetUs"].as<uint32_t>(), 500, 50000);
+				if (v_new != p_config.system.webSocket.wsPassBudgetUs) {
+					p_config.system.webSocket.wsPassBudgetUs = v_new;
+					v_changed = true;
+				}
+			}
+
+			// wsAdaptEnabled / wsAdaptMaxMul (W10 client별 적응형 간격)
+			if (j_ws["wsAdaptEnabled"].is<bool>()) {
+				bool v_new = j_ws["wsAdaptEnabled"].as<bool>();
+				if (v_new != p_config.system.webSocket.wsAdaptEnabled) {
+					p_config.system.webSocket.wsAdaptEnabled = v_new;
+					v_changed = true;
+				}
+			}
+			if (j_ws["wsAdaptMaxMul"].is<uint32_t>()) {
+				uint8_t v_new = C10_u8Clamp(j_ws["wsAdaptMaxMul"].as<uint32_t>(), 1, 32);
+				if (v_new != p_config.system.webSocket.wsAdaptMaxMul) {
+					p_config.system.webSocket.wsAdaptMaxMul = v_new;
+					v_changed = true;
+				}
+			}
+		}
+
+		// storage (write-behind / snapshot 재기록 시간, 다음 saveTick부터 적용)
+		JsonObjectConst j_st = j_sys["storage"].as<JsonObjectConst>();
+		if (!j_st.isNull()) {
+			if (j_st["saveCoalesceMs"].is<uint32_t>()) {
+				uint16_t v_new = C10_u16Clamp(j_st["saveCoalesceMs"].as<uint32_t>(), G_A20_SAVE_COALESCE_MIN_MS, G_A20_SAVE_TIMING_MAX_MS);
+				if (v_new != p_config.system.storage.saveCoalesceMs) {
+					p_config.system.storage.saveCoalesceMs = v_new;
+					v_changed = true;
+				}
+			}
+			if (j_st["saveMaxDelayMs"].is<uint32_t>()) {
+				uint16_t v_new = C10_u16Clamp(j_st["saveMaxDelayMs"].as<uint32_t>(), G_A20_SAVE_COALESCE_MIN_MS, G_A20_SAVE_TIMING_MAX_MS);
+				if (v_new != p_config.system.storage.saveMaxDelayMs) {
+					p_config.system.storage.saveMaxDelayMs = v_new;
+					v_changed = true;
+				}
+			}
+			if (j_st["snapRefreshMs"].is<uint32_t>()) {
+				uint16_t v_new = C10_u16Clamp(j_st["snapRefreshMs"].as<uint32_t>(), G_A20_SAVE_COALESCE_MIN_MS, G_A20_SAVE_TIMING_MAX_MS);
+				if (v_new != p_config.system.storage.snapRefreshMs) {
+					p_config.system.storage.snapRefreshMs = v_new;
+					v_changed = true;
+				}
+			}
 		}
 
 
@@ -1328,6 +1456,16 @@ void CL_C10_ConfigManager::toJson_System(const ST_A20_SystemConfig_t& p, JsonDoc
 	d_ws["chartLargeBytes"]  = p.system.webSocket.chartLargeBytes;
 	d_ws["chartThrottleMul"] = p.system.webSocket.chartThrottleMul;
 	d_ws["wsCleanupMs"]      = p.system.webSocket.wsCleanupMs;
+	d_ws["chartWindow"]      = p.system.webSocket.chartWindow;
+	d_ws["wsPassBudgetBytes"] = p.system.webSocket.wsPassBudgetBytes;
+	d_ws["wsPassBudgetUs"]    = p.system.webSocket.wsPassBudgetUs;
+	d_ws["wsAdaptEnabled"]    = p.system.webSocket.wsAdaptEnabled;
+	d_ws["wsAdaptMaxMul"]     = p.system.webSocket.wsAdaptMaxMul;
+
+	JsonObject d_st = d["system"]["storage"].to<JsonObject>();
+	d_st["saveCoalesceMs"] = p.system.storage.saveCoalesceMs;
+	d_st["saveMaxDelayMs"] = p.system.storage.saveMaxDelayMs;
+	d_st["snapRefreshMs"]  = p.system.storage.snapRefreshMs;
 
 
 
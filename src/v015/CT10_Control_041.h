@@ -17,6 +17,20 @@
  * - 정적 싱글톤 인터페이스 제공 (W10_WebAPI에서 직접 사용)
  * - 구현은 cpp 3개로 분리:
  *    1) json 처리, 2) control 처리, 3) misc/유틸/보조
+ *    (+ S10 전용 task 모드: CT10_Control_Task_041.cpp)
+ *    (+ WS hot path 스트리밍 직렬화: CT10_Control_Stream_041.cpp)
+ * - (옵션) S10 physics + P10 duty 갱신을 core 1 전용 task(vTaskDelayUntil 고정주기)로 분리
+ *    - CT10 → S10 명령은 FreeRTOS queue 경유 (apply / stop / fixed duty)
+ * - Schedule 판정: schedules 변경 세대(C10) 기준 주간 구간 테이블 1회 컴파일
+ *    - tick에서는 "다음 전이 시각" 이전이면 캐시 결과 반환 (localtime/HH:MM 파싱 생략)
+ * - 제어 판정은 deadline 구동: override 종료/segment phase/AutoOff/schedule 전이가
+ *   다음 due 시각을 등록, 가장 이른 due 또는 외부 이벤트(notifyControlEvent) 시에만 전체 판정
+ *    - A00 loop는 msUntilNextWake() 기준으로 대기 (이벤트 시 task notify로 즉시 기상)
+ * - WS 스케줄러: pass당 byte/us 예산 내 due 채널 연속 전송 + fairness aging,
+ *   markDirty 시각 기록(dirtySinceMs)으로 채널별 전송 지연 측정
+ * - 설정 섹션은 C10 RCU 세대 read (C10_rcuRead 1회 load → const 참조, lock 없음)
+ * - Segment preset/style 코드는 설정 세대 변경 시 tick에서 dict 인덱스로 intern
+ *   → segment 전환/override는 인덱스 + ResolvedWind memo 캐시(S20)로 해석 (문자열 비교 없음)
  * ------------------------------------------------------
  * [구현 규칙]
  * - 주석 구조, 네이밍 규칙, ArduinoJson v7 단일 문서 정책 준수
@@ -47,6 +61,9 @@
 
 #include <Arduino.h>
 #include <ArduinoJson.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
 #include <string.h>
 #include <time.h>
 
@@ -80,12 +97,28 @@ typedef struct {
 	ST_A20_ResolvedWind_t resolved;			// 수동 바람 설정 (useFixed==false 일 때의 바람 파라미터)
 } ST_CT10_Override_t;
 
+// Segment preset/style 코드 intern 결과 (시퀀스 단위)
+//  - 키: segments 배열 + dict 포인터 + C10 configGen (섹션 재publish 시 주소 재사용 대비)
+static const uint8_t G_CT10_SEG_MAX = (A20_Const::MAX_SEGMENTS_PER_SCHEDULE > A20_Const::MAX_SEGMENTS_PER_PROFILE)
+										  ? A20_Const::MAX_SEGMENTS_PER_SCHEDULE
+										  : A20_Const::MAX_SEGMENTS_PER_PROFILE;
+
+typedef struct {
+	const void*						src;	  // intern 기준 segments 배열 (nullptr: 미구성)
+	const ST_A20_WindProfileDict_t* dict;	  // intern 기준 dict 세대
+	uint32_t						cfgGen;	  // intern 시점 C10 configGen
+	uint32_t						dictGen;  // intern 시점 C10 windDictGen (ResolvedWind 캐시 키)
+	int8_t							preset[G_CT10_SEG_MAX];	 // -1: dict 미등록 코드
+	int8_t							style[G_CT10_SEG_MAX];	 // -1: 스타일 없음/미등록
+} ST_CT10_SegWindIdx_t;
+
 // Segment 실행 상태 (Schedule 또는 Profile)
 typedef struct {
-	int8_t		  index;		 // 현재 seg index (-1이면 아직 시작 전)
-	bool		  onPhase;		 // true: On 구간(팬 작동), false: Off 구간(팬 정지)
-	unsigned long phaseStartMs;	 // 현재 phase 시작 시간 (Millis 기준)
-	uint8_t		  loopCount;	 // 반복 횟수 카운트 (0부터 시작)
+	int8_t				 index;			// 현재 seg index (-1이면 아직 시작 전)
+	bool				 onPhase;		// true: On 구간(팬 작동), false: Off 구간(팬 정지)
+	unsigned long		 phaseStartMs;	// 현재 phase 시작 시간 (Millis 기준)
+	uint8_t				 loopCount;		// 반복 횟수 카운트 (0부터 시작)
+	ST_CT10_SegWindIdx_t wind;			// segment 코드 intern (설정 세대 변경 시 tick에서 재구성)
 } ST_CT10_SegmentRuntime_t;
 
 // AutoOff 런타임 상태 (현재 적용된 AutoOff 조건)
@@ -101,11 +134,115 @@ typedef struct {
 	float		  offTemp;		   // AutoOff가 발동되는 온도 (섭씨)
 } ST_CT10_AutoOffRuntime_t;
 
+// ------------------------------------------------------
+// S10 전용 task 실행 모드 (옵션)
+//  - build flag: -D G_CT10_SIM_TASK_ENABLE=1
+//  - 0이면 기존대로 A00 loop → tickLoop()에서 sim.tick() 직접 호출
+// ------------------------------------------------------
+#ifndef G_CT10_SIM_TASK_ENABLE
+#define G_CT10_SIM_TASK_ENABLE 0
+#endif
+
+static const BaseType_t	 G_CT10_SIM_TASK_CORE		   = 1;		// Arduino loop와 동일 core (WiFi는 core 0)
+static const UBaseType_t G_CT10_SIM_TASK_PRIO		   = 5;		// loop(1) 보다 높게
+static const uint32_t	 G_CT10_SIM_TASK_STACK		   = 4096;	// [byte]
+static const uint8_t	 G_CT10_SIM_CMD_QUEUE_LEN	   = 8;		// [개]
+static const uint32_t	 G_CT10_SIM_TASK_PERIOD_MIN_MS = 10;	// [ms] 주기 하한
+
+// CT10 → S10 명령 종류 (전용 task 모드)
+typedef enum : uint8_t {
+	EN_CT10_SIMCMD_APPLY	  = 0,	// ResolvedWind 적용 + 시뮬레이션 시작
+	EN_CT10_SIMCMD_STOP		  = 1,	// 시뮬레이션 정지(duty 0)
+	EN_CT10_SIMCMD_FIXED_DUTY = 2	// 시뮬레이션 정지 + 고정 duty
+} EN_CT10_sim_cmd_t;
+
+typedef struct {
+	EN_CT10_sim_cmd_t	  type;
+	float				  dutyPct;	// FIXED_DUTY 전용 (0~100)
+	ST_A20_ResolvedWind_t wind;		// APPLY 전용
+} ST_CT10_SimCmd_t;
+
+// ------------------------------------------------------
+// Schedule 주간 구간 테이블
+//  - 주간 분(week-minute): 월 00:00 = 0 ~ 일 23:59 = 10079
+//  - 주간 전체를 연속 구간으로 분할: seg[k] = [startWm, seg[k+1].startWm)
+//  - 구간별 활성 schedule index (복수 중첩 시 낮은 index 우선, -1: 없음)
+// ------------------------------------------------------
+static const uint16_t G_CT10_WEEK_MINUTES		   = 7u * 1440u;  // [min]
+static const uint16_t G_CT10_SCH_SEG_MAX		   = (uint16_t)A20_Const::MAX_SCHEDULES * 7u * 4u + 2u;
+static const uint32_t G_CT10_SCH_RECHECK_MAX_S	   = 600u;		  // [s] 시계 보정/DST 대비 최대 재평가 간격
+
+typedef struct {
+	uint16_t startWm;  // [min] 구간 시작(주간 분)
+	int8_t	 schIdx;   // 활성 schedule index (-1: 없음)
+} ST_CT10_SchSeg_t;
+
+typedef struct {
+	ST_CT10_SchSeg_t			  seg[G_CT10_SCH_SEG_MAX];
+	uint16_t					  count;
+
+	// 컴파일 기준 (C10 변경 세대 / root 포인터)
+	bool						  compiled;
+	uint32_t					  gen;
+	const ST_A20_SchedulesRoot_t* root;
+
+	// 판정 캐시
+	bool						  evalValid;
+	int8_t						  activeIdx;
+	time_t						  evalAt;		 // [epoch s] 마지막 평가 시각
+	time_t						  nextChangeAt;	 // [epoch s] 다음 구간 전이 시각
+} ST_CT10_SchTable_t;
+
+
+// ------------------------------------------------------
+// 제어 판정 deadline 테이블 (tickLoop 이벤트 구동)
+//  - 항목별 다음 due 시각(millis 기준) 등록 → 가장 이른 due 도래 시에만 전체 판정
+//  - 항목 수가 고정/소수이므로 heap 대신 고정 배열 + 선형 min
+// ------------------------------------------------------
+typedef enum : uint8_t {
+	EN_CT10_DL_OVERRIDE		 = 0,  // override 종료(endMs)
+	EN_CT10_DL_SEGMENT		 = 1,  // segment on/off phase 전이
+	EN_CT10_DL_AUTOOFF_TIMER = 2,  // AutoOff timer 만료
+	EN_CT10_DL_AUTOOFF_TIME	 = 3,  // AutoOff 지정 시각(RTC)
+	EN_CT10_DL_AUTOOFF_TEMP	 = 4,  // AutoOff 온도 재측정
+	EN_CT10_DL_SCHEDULE		 = 5,  // schedule 구간 전이
+	EN_CT10_DL_IDLE			 = 6,  // 최대 무판정 간격(안전망: 시계 보정/설정 변경 등)
+	EN_CT10_DL_COUNT
+} EN_CT10_deadline_t;
+
+static const uint32_t G_CT10_DL_IDLE_MAX_MS = 1000u;  // [ms] 이벤트 누락 대비 최대 판정 간격
+static const uint32_t G_CT10_DL_TEMP_ITV_MS = 2000u;  // [ms] DHT22 최소 측정 간격과 동일
+
+typedef struct {
+	bool	 armed[EN_CT10_DL_COUNT];
+	uint32_t dueMs[EN_CT10_DL_COUNT];  // [ms] millis 기준 (wrap 허용, 부호 차이로 비교)
+	uint32_t nextMs;				   // [ms] 가장 이른 due
+	uint32_t evalCount;				   // 전체 판정 수행 횟수(누적)
+	uint32_t skipCount;				   // due 미도래로 판정 생략한 tick 수(누적)
+} ST_CT10_DeadlineTable_t;
+
+
+// WS 채널별 스트리밍 직렬화 고정 버퍼 [byte] (초과 시 해당 tick만 JsonDocument 경로 fallback)
+static const uint16_t G_CT10_WS_TXBUF_STATE_BYTES	= 1536u;
+static const uint16_t G_CT10_WS_TXBUF_METRICS_BYTES = 2048u;
+static const uint16_t G_CT10_WS_TXBUF_CHART_BYTES	= 512u;
+static const uint16_t G_CT10_WS_TXBUF_SUMMARY_BYTES = 384u;
 
 //// void CT10_WS_bindToW10();
 void CT10_WS_begin();
 void CT10_WS_tick();
 
+// 스트리밍 payload 누적 통계 (전송/fallback 수, 채널별 최대 길이)
+void CT10_WS_streamStatsToJson(JsonObject p_obj);
+
+// 스케줄러 pass 예산/지연 통계 (metrics.wsSched) - JsonDocument / 스트리밍 경로 공용 field list
+class CL_A20_JsonDocSink;
+void CT10_WS_writeSchedStats(CL_A20_JsonWriter& p_w);
+void CT10_WS_writeSchedStats(CL_A20_JsonDocSink& p_w);
+
+// pending 채널 중 가장 이른 전송 가능 시각까지 남은 시간 [ms] (pending 없음: UINT32_MAX)
+uint32_t CT10_WS_msUntilNextDue();
+
 // ------------------------------------------------------
 // S10 → CT10 Dirty 브리지 (inline, A00 의존 제거)
 // ------------------------------------------------------
@@ -122,6 +259,9 @@ void CT10_WS_setBrokers(
 	void (*p_setIntervalsFn)(const uint16_t p_itvMs[G_A20_WS_CH_COUNT])
 );
 
+// 스트리밍 payload broker (채널 인덱스 + 직렬화 완료 버퍼). 미주입 시 JsonDocument 경로만 사용
+void CT10_WS_setRawBroker(void (*p_raw)(uint8_t p_ch, const char* p_buf, size_t p_len));
+
 // ======================================================
 // CL_CT10_ControlManager 클래스
 // ======================================================
@@ -162,9 +302,20 @@ class CL_CT10_ControlManager {
 	// JSON 관련(구현은 json cpp)
 	void exportStateJson(JsonDocument& p_doc);
 	void exportChartJson(JsonDocument& p_doc, bool p_diffOnly);
+	// seq 범위 차트 (client별 delta sync, S10 toChartJsonFrom + CT10 meta). 반환: record 수
+	uint16_t exportChartJsonFrom(JsonDocument& p_doc, uint32_t p_fromSeq, uint16_t p_maxCount, uint32_t& p_nextSeq);
 	void exportSummaryJson(JsonDocument& p_doc);
 	void exportMetricsJson(JsonDocument& p_doc);
 
+	// 스트리밍 직렬화 (WS hot path, 구현은 stream cpp) - export*Json과 field list(emit*) 공용
+	// - 반환: 기록 바이트 수 (0: 보낼 내용 없음 또는 용량 초과 → p_w.overflow()로 구분)
+	size_t writeStateJson(CL_A20_JsonWriter& p_w);
+	size_t writeMetricsJson(CL_A20_JsonWriter& p_w);
+	size_t writeChartJson(CL_A20_JsonWriter& p_w);
+	size_t writeSummaryJson(CL_A20_JsonWriter& p_w);
+	// WS 채널 인덱스(G_A20_WS_CH_*) 기준 dispatch
+	size_t writeChannelJson(uint8_t p_ch, CL_A20_JsonWriter& p_w);
+
 	// 모드/프로파일/오버라이드
 	void setProfileMode(bool p_profileMode);
 	bool startUserProfileByNo(uint8_t p_profileNo);
@@ -175,15 +326,24 @@ class CL_CT10_ControlManager {
 	void applyManualResolved(const ST_A20_ResolvedWind_t& p_wind, uint32_t p_seconds);
 	void stopOverride();
 
+	// ResolvedWind 캐시/코드 intern 통계 (/api/diag "windCache")
+	void windCacheStatsToJson(JsonObject p_obj);
+
 	// tick(구현은 control cpp)
 	void tickLoop();
 
+	// deadline 구동: 외부 이벤트 통지 / 다음 기상까지 남은 시간(A00 loop 대기용)
+	void	 notifyControlEvent();
+	uint32_t msUntilNextWake() const;
+
 	// Dirty 플래그
 	void markDirty(const char* p_key);
 	bool consumeDirtyState();
 	bool consumeDirtyMetrics();
 	bool consumeDirtyChart();
 	bool consumeDirtySummary();
+	// 채널(G_A20_WS_CH_*) dirty 최초 설정 시각 [ms] (0: dirty 아님) - markDirty→전송 지연 측정용
+	uint32_t dirtySinceMs(uint8_t p_ch) const;
 
   public:
 	// --------------------------------------------------
@@ -207,6 +367,7 @@ class CL_CT10_ControlManager {
 	CL_M10_MotionLogic*		 motion = nullptr;
 
 	CL_S10_Simulation		 sim;
+	bool					 simTaskMode = false;	// true: S10 전용 task 구동 중
 
 	unsigned long			 lastTickMs		   = 0;
 	unsigned long			 lastMetricsPushMs = 0;
@@ -224,6 +385,35 @@ class CL_CT10_ControlManager {
 	bool _dirtyMetrics = false;
 	bool _dirtyChart   = false;
 	bool _dirtySummary = false;
+	// 채널별 dirty 최초 설정 시각 (false→true 전이 시에만 기록, consume 시 0)
+	uint32_t _dirtyAtMs[G_A20_WS_CH_COUNT] = {0, 0, 0, 0};
+
+  private:
+	// S10 전용 task 상태
+	QueueHandle_t _simCmdQueue		 = nullptr;
+	TaskHandle_t  _simTaskHandle	 = nullptr;
+	bool		  _simIntendedActive = false;	// 마지막으로 전달한 명령 기준 sim 활성 여부
+	float		  _simQueuedDuty	 = -1.0f;	// 마지막으로 전달한 정지 duty (-1: 해당 없음)
+	uint32_t	  _simCmdDrops		 = 0;		// queue full로 전달 실패한 명령 수(누적)
+
+  private:
+	// Schedule 주간 구간 테이블 (findActiveScheduleIndex 전용)
+	ST_CT10_SchTable_t _schTbl = {};
+
+  private:
+	// WindDict 코드 intern 테이블 (loop task 전용) / ResolvedWind memo 캐시 (control cpp s_windMux 보호)
+	ST_S20_WindCodeIndex_t _windCodes	   = {};
+	ST_S20_WindCache_t	   _windCache	   = {};
+	uint32_t			   _windInterns	   = 0;	 // segment 시퀀스 intern 재구성 횟수
+	uint32_t			   _windCodeBuilds = 0;	 // dict 코드 해시 테이블 재구성 횟수
+
+  private:
+	// 제어 판정 deadline 상태
+	ST_CT10_DeadlineTable_t _deadline		   = {};
+	volatile bool			_ctlEventPending   = false;	 // 외부 이벤트(모드/override/profile/reload) 대기
+	uint32_t				_dlSchedulesGen	   = 0;		 // 마지막 판정 시 C10 schedules 세대
+	bool					_dlPresence		   = false;	 // 마지막 판정 시 motion presence
+	TaskHandle_t			_loopTaskHandle	   = nullptr;  // tickLoop 호출 task (이벤트 기상용)
 
   private:
 	// --------------------------------------------------
@@ -231,17 +421,25 @@ class CL_CT10_ControlManager {
 	// --------------------------------------------------
 	uint32_t calcOverrideRemainSec() const;
 
+	void tickControl();
 	bool tickOverride();
 	bool tickUserProfile();
 	bool tickSchedule();
 
 	// segment 처리: schedule/profile 오버로드(템플릿 제거)
-	bool tickSegmentSequence(bool p_repeat, uint8_t p_repeatCount, ST_A20_ScheduleSegment_t* p_segs, uint8_t p_count, ST_CT10_SegmentRuntime_t& p_rt);
+	bool tickSegmentSequence(bool p_repeat, uint8_t p_repeatCount, const ST_A20_ScheduleSegment_t* p_segs, uint8_t p_count, ST_CT10_SegmentRuntime_t& p_rt);
 
-	bool tickSegmentSequence(bool p_repeat, uint8_t p_repeatCount, ST_A20_UserProfileSegment_t* p_segs, uint8_t p_count, ST_CT10_SegmentRuntime_t& p_rt);
+	bool tickSegmentSequence(bool p_repeat, uint8_t p_repeatCount, const ST_A20_UserProfileSegment_t* p_segs, uint8_t p_count, ST_CT10_SegmentRuntime_t& p_rt);
 
-	void applySegmentOn(const ST_A20_ScheduleSegment_t& p_seg);
-	void applySegmentOn(const ST_A20_UserProfileSegment_t& p_seg);
+	// segment 코드 intern (키 일치 시 즉시 반환, tick에서 선반영)
+	void internSegmentWind(const ST_A20_ScheduleSegment_t* p_segs, uint8_t p_count, ST_CT10_SegWindIdx_t& p_idx);
+	void internSegmentWind(const ST_A20_UserProfileSegment_t* p_segs, uint8_t p_count, ST_CT10_SegWindIdx_t& p_idx);
+	bool windIdxStale(const void* p_src, ST_CT10_SegWindIdx_t& p_idx);
+	bool resolveSegmentWind(const ST_CT10_SegWindIdx_t& p_idx, uint8_t p_i, const ST_A20_AdjustDelta_t& p_adj, ST_A20_ResolvedWind_t& p_out);
+	bool resolveWindShared(const ST_A20_WindProfileDict_t& p_dict, uint32_t p_dictGen, int16_t p_presetIdx, int16_t p_styleIdx, const ST_A20_AdjustDelta_t* p_adj, ST_A20_ResolvedWind_t& p_out);
+
+	void applySegmentOn(const ST_A20_ScheduleSegment_t* p_segs, uint8_t p_count, uint8_t p_i, ST_CT10_SegmentRuntime_t& p_rt);
+	void applySegmentOn(const ST_A20_UserProfileSegment_t* p_segs, uint8_t p_count, uint8_t p_i, ST_CT10_SegmentRuntime_t& p_rt);
 	void applySegmentOff();
 
 	void initAutoOffFromUserProfile(const ST_A20_UserProfileItem_t& p_up);
@@ -252,13 +450,41 @@ class CL_CT10_ControlManager {
 	static float getCurrentTemperatureMock();
 
 	int findActiveScheduleIndex(const ST_A20_SchedulesRoot_t& p_cfg);
+	void compileScheduleTable(const ST_A20_SchedulesRoot_t& p_cfg);
 	bool isMotionBlocked(const ST_A20_Motion_t& p_motionCfg);
 
 	void maybePushMetricsDirty();
-
-	// 로그 개선용: preset/style 이름 조회
-	const char* findPresetNameByCode(const char* p_code) const;
-	const char* findStyleNameByCode(const char* p_code) const;
+	void mergeChartMeta(JsonDocument& p_doc);
+
+	// field list (T: CL_A20_JsonWriter | CL_A20_JsonDocSink). 정의/명시적 인스턴스화: stream cpp
+	template <typename T> void emitControlFields(T& p_w);
+	template <typename T> void emitChartMetaFields(T& p_w);
+	template <typename T> void emitSummaryFields(T& p_w, const ST_S10_SimSnapshot_t& p_s);
+	template <typename T> void emitMetricsFields(T& p_w, const ST_S10_SimSnapshot_t& p_s);
+	static void writeChartMeta(CL_A20_JsonWriter& p_w, void* p_ctx);	 // T_S10_chartMetaFn_t
+
+	// deadline 테이블 (구현은 control cpp)
+	void rearmDeadlines(uint32_t p_nowMs);
+	void armDeadline(EN_CT10_deadline_t p_id, uint32_t p_dueMs);
+	bool isDeadlineDue(uint32_t p_nowMs) const;
+	bool pollControlInputsChanged();
+	const ST_CT10_SegmentRuntime_t* activeSegmentPhase(uint16_t& p_onMin, uint16_t& p_offMin) const;
+
+	// S10 구동/명령 경유 (구현은 task cpp)
+	// - loop 모드: sim 직접 호출 / task 모드: queue 전달(중복 명령 병합)
+	bool startSimTask();
+	void simCmdApply(const ST_A20_ResolvedWind_t& p_wind);
+	void simCmdStop();
+	void simCmdFixedDuty(float p_pct);
+	void simCmdTick();
+	bool simIsActive() const;
+	bool simCmdSend(const ST_CT10_SimCmd_t& p_cmd);
+	void simTaskRun();
+	static void simTaskMain(void* p_arg);
+
+	// 로그 개선용: intern 인덱스 → preset/style 이름
+	static const char* windPresetName(const ST_CT10_SegWindIdx_t& p_idx, uint8_t p_i);
+	static const char* windStyleName(const ST_CT10_SegWindIdx_t& p_idx, uint8_t p_i);
 
   private:
 	// 생성자 숨김
@@ -6,6 +6,7 @@
  * ------------------------------------------------------
  * 기능 요약:
  * - AutoOff 초기화/체크, Motion 체크, Schedule 활성 인덱스 계산
+ *   (주간 구간 테이블 컴파일 + 다음 전이 시각 캐시)
  * - Dirty 플래그 관리, override remain 계산, preset/style 이름 조회 유틸
  * ------------------------------------------------------
  */
@@ -160,8 +161,9 @@ float CL_CT10_ControlManager::getCurrentTemperatureMock() {
 	static float s_lastTemp = 24.0f; // Default fallback
 
 	// 1. Config Check
-	if (!g_A20_config_root.system) return s_lastTemp;
-	const auto& conf = g_A20_config_root.system->hw.tempHum;
+	const ST_A20_SystemConfig_t* v_sys = C10_rcuRead(g_A20_config_root.system);
+	if (!v_sys) return s_lastTemp;
+	const auto& conf = v_sys->hw.tempHum;
 
 	if (!conf.enabled) return 24.0f; // Sensor disabled
 
@@ -193,14 +195,122 @@ float CL_CT10_ControlManager::getCurrentTemperatureMock() {
 	return s_lastTemp;
 }
 
+// --------------------------------------------------
+// schedule 주간 구간 테이블 컴파일
+//  - 판정 의미는 기존 분 단위 비교와 동일:
+//    요일 d 활성 시 start<end → [start,end), start>end(자정 넘김) → [0,end) + [start,1440)
+//    start==end → 항상 OFF
+// --------------------------------------------------
+void CL_CT10_ControlManager::compileScheduleTable(const ST_A20_SchedulesRoot_t& p_cfg) {
+	typedef struct {
+		uint16_t s;
+		uint16_t e;
+		int8_t	 idx;
+	} ST_Ivl_t;
+
+	static const uint16_t v_ivlMax = (uint16_t)A20_Const::MAX_SCHEDULES * 7u * 2u;
+	ST_Ivl_t			  v_ivl[v_ivlMax];
+	uint16_t			  v_ivlCount = 0;
+
+	uint16_t			  v_bnd[G_CT10_SCH_SEG_MAX];
+	uint16_t			  v_bndCount = 0;
+
+	// 1) schedule × 요일 → 주간 분 구간 전개 (HH:MM 파싱은 여기서 1회)
+	const uint8_t v_count = (p_cfg.count > A20_Const::MAX_SCHEDULES) ? A20_Const::MAX_SCHEDULES : p_cfg.count;
+	for (uint8_t v_i = 0; v_i < v_count; v_i++) {
+		const ST_A20_ScheduleItem_t& v_s = p_cfg.items[v_i];
+		if (!v_s.enabled)
+			continue;
+
+		const uint16_t v_startMin = parseHHMMtoMin(v_s.period.startTime);
+		const uint16_t v_endMin	  = parseHHMMtoMin(v_s.period.endTime);
+		if (v_startMin == v_endMin)
+			continue;
+
+		for (uint8_t v_d = 0; v_d < 7; v_d++) {
+			if (!v_s.period.days[v_d])
+				continue;
+
+			const uint16_t v_base = (uint16_t)v_d * 1440u;
+			if (v_startMin < v_endMin) {
+				v_ivl[v_ivlCount++] = { (uint16_t)(v_base + v_startMin), (uint16_t)(v_base + v_endMin), (int8_t)v_i };
+			} else {
+				if (v_endMin > 0) {
+					v_ivl[v_ivlCount++] = { v_base, (uint16_t)(v_base + v_endMin), (int8_t)v_i };
+				}
+				v_ivl[v_ivlCount++] = { (uint16_t)(v_base + v_startMin), (uint16_t)(v_base + 1440u), (int8_t)v_i };
+			}
+		}
+	}
+
+	// 2) 경계 수집 + 정렬/중복 제거 (삽입 정렬, 최대 수백 개)
+	v_bnd[v_bndCount++] = 0;
+	for (uint16_t v_k = 0; v_k < v_ivlCount; v_k++) {
+		v_bnd[v_bndCount++] = v_ivl[v_k].s;
+		v_bnd[v_bndCount++] = v_ivl[v_k].e;
+	}
+	for (uint16_t v_a = 1; v_a < v_bndCount; v_a++) {
+		const uint16_t v_key = v_bnd[v_a];
+		int			   v_b	 = (int)v_a - 1;
+		while (v_b >= 0 && v_bnd[v_b] > v_key) {
+			v_bnd[v_b + 1] = v_bnd[v_b];
+			v_b--;
+		}
+		v_bnd[v_b + 1] = v_key;
+	}
+
+	// 3) 기본 구간별 우선 schedule 결정 + 인접 동일 구간 병합
+	_schTbl.count = 0;
+	for (uint16_t v_a = 0; v_a < v_bndCount; v_a++) {
+		const uint16_t v_wm = v_bnd[v_a];
+		if (v_wm >= G_CT10_WEEK_MINUTES)
+			break;
+		if (v_a > 0 && v_bnd[v_a - 1] == v_wm)
+			continue;
+
+		int8_t v_win = -1;
+		for (uint16_t v_k = 0; v_k < v_ivlCount; v_k++) {
+			if (v_wm >= v_ivl[v_k].s && v_wm < v_ivl[v_k].e && (v_win < 0 || v_ivl[v_k].idx < v_win)) {
+				v_win = v_ivl[v_k].idx;
+			}
+		}
+
+		if (_schTbl.count > 0 && _schTbl.seg[_schTbl.count - 1].schIdx == v_win)
+			continue;
+
+		_schTbl.seg[_schTbl.count].startWm = v_wm;
+		_schTbl.seg[_schTbl.count].schIdx  = v_win;
+		_schTbl.count++;
+	}
+
+	_schTbl.compiled  = true;
+	_schTbl.gen		  = CL_C10_ConfigManager::schedulesGen();
+	_schTbl.root	  = &p_cfg;
+	_schTbl.evalValid = false;
+
+	CL_D10_Logger::log(EN_L10_LOG_INFO, "[CT10] schedule table compiled (gen=%lu, segs=%u)", (unsigned long)_schTbl.gen, (unsigned)_schTbl.count);
+}
+
 // --------------------------------------------------
 // find active schedule
+//  - 다음 전이 시각 이전이면 캐시 결과 반환 (O(1))
+//  - 재평가 시에만 localtime + 구간 이진 탐색
 // --------------------------------------------------
 int CL_CT10_ControlManager::findActiveScheduleIndex(const ST_A20_SchedulesRoot_t& p_cfg) {
+	// 1) schedules 변경(load/patch/CRUD) 감지 → 재컴파일
+	if (!_schTbl.compiled || _schTbl.gen != CL_C10_ConfigManager::schedulesGen() || _schTbl.root != &p_cfg) {
+		compileScheduleTable(p_cfg);
+	}
+
 	if (p_cfg.count == 0)
 		return -1;
 
+	// 2) 캐시 유효 구간 (시계 역행 시 재평가)
 	time_t v_now = time(nullptr);
+	if (_schTbl.evalValid && v_now >= _schTbl.evalAt && v_now < _schTbl.nextChangeAt) {
+		return _schTbl.activeIdx;
+	}
+
 	struct tm* v_localTm = localtime(&v_now);
 	if (!v_localTm) {
 		CL_D10_Logger::log(EN_L10_LOG_WARN, "[CT10] findActiveScheduleIndex: localtime() null");
@@ -208,38 +318,44 @@ int CL_CT10_ControlManager::findActiveScheduleIndex(const ST_A20_SchedulesRoot_t
 	}
 
 	// Arduino: 0=Sun, Config: 0=Mon => 보정
-	uint8_t v_wday = (v_localTm->tm_wday == 0) ? 6 : (uint8_t)(v_localTm->tm_wday - 1);
-	uint16_t v_curMin = (uint16_t)v_localTm->tm_hour * 60 + (uint16_t)v_localTm->tm_min;
-
-	for (int v_i = 0; v_i < (int)p_cfg.count; v_i++) {
-		const ST_A20_ScheduleItem_t& v_s = p_cfg.items[v_i];
-
-		if (!v_s.enabled)
-			continue;
-
-		// days 체크
-		if (v_wday >= 7 || !v_s.period.days[v_wday])
-			continue;
+	uint8_t	 v_wday = (v_localTm->tm_wday == 0) ? 6 : (uint8_t)(v_localTm->tm_wday - 1);
+	uint16_t v_curWm = (uint16_t)v_wday * 1440u + (uint16_t)v_localTm->tm_hour * 60u + (uint16_t)v_localTm->tm_min;
+
+	// 3) 구간 이진 탐색: startWm <= curWm 인 마지막 구간
+	uint16_t v_lo = 0;
+	uint16_t v_hi = _schTbl.count;
+	while (v_hi - v_lo > 1u) {
+		const uint16_t v_mid = (uint16_t)((v_lo + v_hi) / 2u);
+		if (_schTbl.seg[v_mid].startWm <= v_curWm) {
+			v_lo = v_mid;
+		} else {
+			v_hi = v_mid;
+		}
+	}
 
-		uint16_t v_startMin = parseHHMMtoMin(v_s.period.startTime);
-		uint16_t v_endMin = parseHHMMtoMin(v_s.period.endTime);
+	const int8_t v_idx = (_schTbl.count > 0) ? _schTbl.seg[v_lo].schIdx : (int8_t)-1;
 
-		if (v_startMin == v_endMin) {
-			// start==end 이면 "항상 OFF"로 취급(필요 시 정책 변경 가능)
-			continue;
-		}
+	// 4) 다음 전이 시각 (주 경계: 마지막 구간과 첫 구간이 같으면 이어서 계산)
+	uint32_t v_endWm;
+	if ((uint16_t)(v_lo + 1u) < _schTbl.count) {
+		v_endWm = _schTbl.seg[v_lo + 1u].startWm;
+	} else if (_schTbl.count > 1 && _schTbl.seg[0].schIdx == v_idx) {
+		v_endWm = (uint32_t)G_CT10_WEEK_MINUTES + _schTbl.seg[1].startWm;
+	} else {
+		v_endWm = (uint32_t)G_CT10_WEEK_MINUTES;
+	}
 
-		if (v_startMin < v_endMin) {
-			if (v_curMin >= v_startMin && v_curMin < v_endMin)
-				return v_i;
-		} else {
-			// cross midnight
-			if (v_curMin >= v_startMin || v_curMin < v_endMin)
-				return v_i;
-		}
+	uint32_t v_remainS = (v_endWm - v_curWm) * 60u - (uint32_t)v_localTm->tm_sec;
+	if (v_remainS > G_CT10_SCH_RECHECK_MAX_S) {
+		v_remainS = G_CT10_SCH_RECHECK_MAX_S;
 	}
 
-	return -1;
+	_schTbl.activeIdx	 = v_idx;
+	_schTbl.evalAt		 = v_now;
+	_schTbl.nextChangeAt = v_now + (time_t)v_remainS;
+	_schTbl.evalValid	 = true;
+
+	return (int)v_idx;
 }
 
 // --------------------------------------------------
@@ -263,30 +379,16 @@ bool CL_CT10_ControlManager::isMotionBlocked(const ST_A20_Motion_t& p_motionCfg)
 
 
 // --------------------------------------------------
-// preset/style name lookup (log 개선용)
+// preset/style name lookup (log 개선용, intern 인덱스 기준)
 // --------------------------------------------------
-const char* CL_CT10_ControlManager::findPresetNameByCode(const char* p_code) const {
-	if (!g_A20_config_root.windDict || !p_code || !p_code[0])
+const char* CL_CT10_ControlManager::windPresetName(const ST_CT10_SegWindIdx_t& p_idx, uint8_t p_i) {
+	if (!p_idx.dict || p_i >= G_CT10_SEG_MAX || p_idx.preset[p_i] < 0)
 		return "";
-
-	const ST_A20_WindProfileDict_t& v_dict = *g_A20_config_root.windDict;
-	for (uint8_t v_i = 0; v_i < v_dict.presetCount; v_i++) {
-		if (strcasecmp(v_dict.presets[v_i].code, p_code) == 0) {
-			return v_dict.presets[v_i].name;
-		}
-	}
-	return "";
+	return p_idx.dict->presets[(uint8_t)p_idx.preset[p_i]].name;
 }
 
-const char* CL_CT10_ControlManager::findStyleNameByCode(const char* p_code) const {
-	if (!g_A20_config_root.windDict || !p_code || !p_code[0])
+const char* CL_CT10_ControlManager::windStyleName(const ST_CT10_SegWindIdx_t& p_idx, uint8_t p_i) {
+	if (!p_idx.dict || p_i >= G_CT10_SEG_MAX || p_idx.style[p_i] < 0)
 		return "";
-
-	const ST_A20_WindProfileDict_t& v_dict = *g_A20_config_root.windDict;
-	for (uint8_t v_i = 0; v_i < v_dict.styleCount; v_i++) {
-		if (strcasecmp(v_dict.styles[v_i].code, p_code) == 0) {
-			return v_dict.styles[v_i].name;
-		}
-	}
-	return "";
+	return p_idx.dict->styles[(uint8_t)p_idx.style[p_i]].name;
 }
@@ -7,10 +7,17 @@
  * 기능 요약:
  * - CT10 제어 상태 / 요약 / 메트릭 / 차트 JSON Export 구현
  * - sim JSON/차트는 S10 책임을 우선하고 CT10은 meta만 병합
+ * - summary/metrics의 sim 값은 S10 스냅샷(readSnapshot) 기준
+ * - metrics.windStats: 풍속 이동 통계(10s/60s/10min 평균/표준편차/min/max/EWMA/TI)
+ * - metrics.simStep: S10 step 주기 지터 / 전용 task 모드 / 명령 drop 수
+ * - metrics.ctlTick: deadline 구동 판정/생략 횟수, 다음 기상까지 남은 시간
+ * - metrics.wsSched: WS 스케줄러 pass 예산/통계, 채널별 markDirty→전송 지연
+ * - field list는 stream cpp emit* 템플릿 (CL_A20_JsonDocSink로 기록, WS 스트리밍 payload와 단일 정의)
  * ------------------------------------------------------
  */
 
 #include "CT10_Control_041.h"
+#include "A20_JsonDocSink_041.h"
 
 // --------------------------------------------------
 // 내부 Helper: safe JsonObject 확보 (타입 꼬임 방지)
@@ -39,42 +46,13 @@ void CL_CT10_ControlManager::toChartJson(JsonDocument& p_doc, bool p_diffOnly) {
 }
 
 void CL_CT10_ControlManager::exportStateJson(JsonDocument& p_doc) {
-    // control root
-    JsonObject v_control        = CT10_ensureObject(p_doc["control"]);
-    v_control["active"]         = active;
-    v_control["useProfileMode"] = useProfileMode;
-    v_control["runSource"]      = (int)runSource;
-    v_control["scheduleIdx"]    = curScheduleIndex;
-    v_control["profileIdx"]     = curProfileIndex;
-
-    // override
-    JsonObject v_override   = CT10_ensureObject(v_control["override"]);
-    v_override["active"]    = overrideState.active;
-    v_override["useFixed"]  = overrideState.useFixed;
-    v_override["resolved"]  = (!overrideState.useFixed && overrideState.active);
-    v_override["remainSec"] = calcOverrideRemainSec();
-
-    if (overrideState.active) {
-        if (overrideState.useFixed) {
-            v_override["fixedPercent"] = overrideState.fixedPercent;
-        } else if (overrideState.resolved.valid) {
-            // preset/style은 빈 문자열일 수 있으므로 그대로 Export (UI에서 처리 가능)
-            v_override["presetCode"] = overrideState.resolved.presetCode;
-            v_override["styleCode"]  = overrideState.resolved.styleCode;
-        }
-    }
-
-    // autoOff
-    JsonObject v_autoOff        = CT10_ensureObject(v_control["autoOff"]);
-    v_autoOff["timerArmed"]     = autoOffRt.timerArmed;
-    v_autoOff["timerMinutes"]   = autoOffRt.timerMinutes;
-    v_autoOff["offTimeEnabled"] = autoOffRt.offTimeEnabled;
-    v_autoOff["offTimeMinutes"] = autoOffRt.offTimeMinutes;
-    v_autoOff["offTempEnabled"] = autoOffRt.offTempEnabled;
-    v_autoOff["offTemp"]        = autoOffRt.offTemp;
-
-    // pwm
-    v_control["pwmDuty"] = pwm ? pwm->P10_getDutyPercent() : 0.0f;
+    // control root (field list: stream cpp emitControlFields, WS writeStateJson과 공용)
+    CL_A20_JsonDocSink v_sink(A20_docRootObject(p_doc));
+    v_sink.beginObject();
+    v_sink.beginObject("control");
+    emitControlFields(v_sink);
+    v_sink.endObject();
+    v_sink.endObject();
 
     // sim 상태(책임: S10) - S10이 p_doc 내부 sim 구조를 채움
     // CT10은 sim 호출 트리거 역할만 수행(구조/키는 S10에서 유지)
@@ -85,62 +63,52 @@ void CL_CT10_ControlManager::exportChartJson(JsonDocument& p_doc, bool p_diffOnl
     // 1) S10 차트 생성 (p_doc["sim"] 구조는 S10이 책임)
     sim.toChartJson(p_doc, p_diffOnly);
 
-    // 2) CT10 메타 병합: p_doc["sim"]["meta"] 안전 확보
+    // 2) CT10 메타 병합
+    mergeChartMeta(p_doc);
+}
+
+uint16_t CL_CT10_ControlManager::exportChartJsonFrom(JsonDocument& p_doc, uint32_t p_fromSeq, uint16_t p_maxCount, uint32_t& p_nextSeq) {
+    // 1) S10 seq 범위 차트 (새 샘플 없으면 문서 미작성)
+    uint16_t v_count = sim.toChartJsonFrom(p_doc, p_fromSeq, p_maxCount, p_nextSeq);
+    if (v_count == 0) return 0;
+
+    // 2) CT10 메타 병합
+    mergeChartMeta(p_doc);
+    return v_count;
+}
+
+void CL_CT10_ControlManager::mergeChartMeta(JsonDocument& p_doc) {
+    // p_doc["sim"]["meta"] 기존 key(S10 meta) 유지하며 CT10 meta 추가
     JsonObject v_sim  = CT10_ensureObject(p_doc["sim"]);
     JsonObject v_meta = CT10_ensureObject(v_sim["meta"]);
 
-    v_meta["pwmDuty"]   = pwm ? pwm->P10_getDutyPercent() : 0.0f;
-    v_meta["active"]    = active;
-    v_meta["runSource"] = (int)runSource;
-    v_meta["override"]  = overrideState.active ? (overrideState.useFixed ? "fixed" : "resolved") : "none";
+    CL_A20_JsonDocSink v_sink(v_meta);
+    v_sink.beginObject();
+    emitChartMetaFields(v_sink);
+    v_sink.endObject();
 }
 
 void CL_CT10_ControlManager::exportSummaryJson(JsonDocument& p_doc) {
-    JsonObject v_sum = CT10_ensureObject(p_doc["summary"]);
-
-    // phase index range 방어
-    uint8_t v_phase = (uint8_t)sim.phase;
-    if (v_phase >= (uint8_t)EN_A20_WEATHER_PHASE_COUNT) v_phase = 0;
-
-    v_sum["phase"]       = g_A20_WEATHER_PHASE_NAMES_Arr[v_phase];
-    v_sum["wind"]        = sim.currentWindSpeed;
-    v_sum["target"]      = sim.targetWindSpeed;
-    v_sum["pwmDuty"]     = pwm ? pwm->P10_getDutyPercent() : 0.0f;
-    v_sum["override"]    = overrideState.active;
-    v_sum["useProfile"]  = useProfileMode;
-    v_sum["scheduleIdx"] = curScheduleIndex;
-    v_sum["profileIdx"]  = curProfileIndex;
+    // sim 값은 S10 발행 스냅샷 기준(무잠금 복사)
+    ST_S10_SimSnapshot_t v_s = {};
+    (void)sim.readSnapshot(v_s);
+
+    CL_A20_JsonDocSink v_sink(A20_docRootObject(p_doc));
+    v_sink.beginObject();
+    v_sink.beginObject("summary");
+    emitSummaryFields(v_sink, v_s);
+    v_sink.endObject();
+    v_sink.endObject();
 }
 
 void CL_CT10_ControlManager::exportMetricsJson(JsonDocument& p_doc) {
-    JsonObject v_m = CT10_ensureObject(p_doc["metrics"]);
-
-    v_m["active"]         = active;
-    v_m["runSource"]      = (int)runSource;
-    v_m["useProfileMode"] = useProfileMode;
-    v_m["scheduleIdx"]    = curScheduleIndex;
-    v_m["profileIdx"]     = curProfileIndex;
-
-    v_m["overrideActive"] = overrideState.active;
-    v_m["overrideFixed"]  = overrideState.useFixed;
-    v_m["overrideRemain"] = calcOverrideRemainSec();
-
-    v_m["pwmDuty"] = pwm ? pwm->P10_getDutyPercent() : 0.0f;
-
-    // sim metrics (phase 범위 방어)
-    uint8_t v_phase = (uint8_t)sim.phase;
-    if (v_phase >= (uint8_t)EN_A20_WEATHER_PHASE_COUNT) v_phase = 0;
-
-    v_m["simActive"]  = sim.active;
-    v_m["simPhase"]   = g_A20_WEATHER_PHASE_NAMES_Arr[v_phase];
-    v_m["simWind"]    = sim.currentWindSpeed;
-    v_m["simTarget"]  = sim.targetWindSpeed;
-    v_m["simGust"]    = sim.gustActive;
-    v_m["simThermal"] = sim.thermalActive;
-
-    // AutoOff metrics
-    v_m["autoOffTimerArmed"]   = autoOffRt.timerArmed;
-    v_m["autoOffTimerMinutes"] = autoOffRt.timerMinutes;
-    v_m["autoOffOffTime"]      = autoOffRt.offTimeEnabled ? autoOffRt.offTimeMinutes : 0;
-    v_m["autoOffOffTemp"]      = autoOffRt.offTempEnabled ? autoOffRt.offTemp : 0.0f;
+    ST_S10_SimSnapshot_t v_s = {};
+    (void)sim.readSnapshot(v_s);
+
+    CL_A20_JsonDocSink v_sink(A20_docRootObject(p_doc));
+    v_sink.beginObject();
+    v_sink.beginObject("metrics");
+    emitMetricsFields(v_sink, v_s);
+    v_sink.endObject();
+    v_sink.endObject();
 }
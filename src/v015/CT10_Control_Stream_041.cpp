@@ -0,0 +1,228 @@
+/*
+ * ------------------------------------------------------
+ * 소스명 : CT10_Control_Stream_041.cpp
+ * 모듈약어 : CT10
+ * 모듈명 : Smart Nature Wind 제어 통합 Manager (v026, Stream IO)
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - WS 4채널(state/metrics/chart/summary) field list 단일 정의 (emit* 멤버 템플릿)
+ *   . CL_A20_JsonWriter: 호출자 고정 버퍼 직접 기록 (write*Json, JsonDocument/String 미사용)
+ *   . CL_A20_JsonDocSink: IO cpp의 export*Json (REST / fallback JsonDocument 경로)
+ *   → 두 경로 key 이름/순서/값 형식이 구조적으로 동일 (명시적 인스턴스화는 파일 끝)
+ * - sim 영역은 S10 emit 템플릿(S10_Simul_040.h) 책임, CT10은 control/meta만 기록
+ * ------------------------------------------------------
+ */
+
+#include "CT10_Control_041.h"
+#include "A20_JsonDocSink_041.h"
+
+// --------------------------------------------------
+// 내부 Helper: 풍속 이동 통계 1개 window
+// --------------------------------------------------
+template <typename T>
+static void CT10_emitWindStat(T& p_w, const char* p_key, const ST_S10_WindStat_t& p_st) {
+    p_w.beginObject(p_key);
+    p_w.kv("n",    p_st.count);
+    p_w.kv("mean", p_st.mean);
+    p_w.kv("std",  p_st.stddev);
+    p_w.kv("min",  p_st.min);
+    p_w.kv("max",  p_st.max);
+    p_w.kv("ewma", p_st.ewma);
+    p_w.kv("ti",   p_st.ti);
+    p_w.endObject();
+}
+
+size_t CL_CT10_ControlManager::writeChannelJson(uint8_t p_ch, CL_A20_JsonWriter& p_w) {
+    p_w.reset();
+    if (p_ch == G_A20_WS_CH_STATE)   return writeStateJson(p_w);
+    if (p_ch == G_A20_WS_CH_METRICS) return writeMetricsJson(p_w);
+    if (p_ch == G_A20_WS_CH_CHART)   return writeChartJson(p_w);
+    if (p_ch == G_A20_WS_CH_SUMMARY) return writeSummaryJson(p_w);
+    return 0;
+}
+
+// ==================================================
+// field list (writer / JsonDocSink 공용)
+// ==================================================
+// "control" object 내부
+template <typename T>
+void CL_CT10_ControlManager::emitControlFields(T& p_w) {
+    p_w.kv("active",         active);
+    p_w.kv("useProfileMode", useProfileMode);
+    p_w.kv("runSource",      (int)runSource);
+    p_w.kv("scheduleIdx",    curScheduleIndex);
+    p_w.kv("profileIdx",     curProfileIndex);
+
+    // override
+    p_w.beginObject("override");
+    p_w.kv("active",    overrideState.active);
+    p_w.kv("useFixed",  overrideState.useFixed);
+    p_w.kv("resolved",  (!overrideState.useFixed && overrideState.active));
+    p_w.kv("remainSec", calcOverrideRemainSec());
+    if (overrideState.active) {
+        if (overrideState.useFixed) {
+            p_w.kv("fixedPercent", overrideState.fixedPercent);
+        } else if (overrideState.resolved.valid) {
+            // preset/style은 빈 문자열일 수 있으므로 그대로 Export (UI에서 처리 가능)
+            p_w.kv("presetCode", (const char*)overrideState.resolved.presetCode);
+            p_w.kv("styleCode",  (const char*)overrideState.resolved.styleCode);
+        }
+    }
+    p_w.endObject();
+
+    // autoOff
+    p_w.beginObject("autoOff");
+    p_w.kv("timerArmed",     autoOffRt.timerArmed);
+    p_w.kv("timerMinutes",   autoOffRt.timerMinutes);
+    p_w.kv("offTimeEnabled", autoOffRt.offTimeEnabled);
+    p_w.kv("offTimeMinutes", autoOffRt.offTimeMinutes);
+    p_w.kv("offTempEnabled", autoOffRt.offTempEnabled);
+    p_w.kv("offTemp",        autoOffRt.offTemp);
+    p_w.endObject();
+
+    // pwm
+    p_w.kv("pwmDuty", pwm ? pwm->P10_getDutyPercent() : 0.0f);
+}
+
+// "sim.meta" object 내부 CT10 병합분
+template <typename T>
+void CL_CT10_ControlManager::emitChartMetaFields(T& p_w) {
+    p_w.kv("pwmDuty",   pwm ? pwm->P10_getDutyPercent() : 0.0f);
+    p_w.kv("active",    active);
+    p_w.kv("runSource", (int)runSource);
+    p_w.kv("override",  overrideState.active ? (overrideState.useFixed ? "fixed" : "resolved") : "none");
+}
+
+// "summary" object 내부 (sim 값은 S10 발행 스냅샷 기준)
+template <typename T>
+void CL_CT10_ControlManager::emitSummaryFields(T& p_w, const ST_S10_SimSnapshot_t& p_s) {
+    p_w.kv("phase",       S10_phaseName(p_s.phase));
+    p_w.kv("wind",        p_s.windSpeed);
+    p_w.kv("target",      p_s.targetWind);
+    p_w.kv("pwmDuty",     pwm ? pwm->P10_getDutyPercent() : 0.0f);
+    p_w.kv("override",    overrideState.active);
+    p_w.kv("useProfile",  useProfileMode);
+    p_w.kv("scheduleIdx", curScheduleIndex);
+    p_w.kv("profileIdx",  curProfileIndex);
+}
+
+// "metrics" object 내부
+template <typename T>
+void CL_CT10_ControlManager::emitMetricsFields(T& p_w, const ST_S10_SimSnapshot_t& p_s) {
+    p_w.kv("active",         active);
+    p_w.kv("runSource",      (int)runSource);
+    p_w.kv("useProfileMode", useProfileMode);
+    p_w.kv("scheduleIdx",    curScheduleIndex);
+    p_w.kv("profileIdx",     curProfileIndex);
+
+    p_w.kv("overrideActive", overrideState.active);
+    p_w.kv("overrideFixed",  overrideState.useFixed);
+    p_w.kv("overrideRemain", calcOverrideRemainSec());
+
+    p_w.kv("pwmDuty", pwm ? pwm->P10_getDutyPercent() : 0.0f);
+
+    // sim metrics (S10 발행 스냅샷 기준, phase 범위 방어)
+    p_w.kv("simActive",  p_s.active);
+    p_w.kv("simPhase",   S10_phaseName(p_s.phase));
+    p_w.kv("simWind",    p_s.windSpeed);
+    p_w.kv("simTarget",  p_s.targetWind);
+    p_w.kv("simGust",    p_s.gustActive);
+    p_w.kv("simThermal", p_s.thermalActive);
+
+    // 풍속 이동 통계 (1Hz, 10s/60s/10min)
+    p_w.beginObject("windStats");
+    CT10_emitWindStat(p_w, "w10s", p_s.stat10s);
+    CT10_emitWindStat(p_w, "w60s", p_s.stat60s);
+    CT10_emitWindStat(p_w, "w10m", p_s.stat10m);
+    p_w.endObject();
+
+    // S10 step 주기 지터 (직전 10s window)
+    p_w.beginObject("simStep");
+    p_w.kv("taskMode",    simTaskMode);
+    p_w.kv("fixedStep",   p_s.stepStats.fixedStep);
+    p_w.kv("periodMs",    p_s.stepStats.periodMs);
+    p_w.kv("count",       p_s.stepStats.count);
+    p_w.kv("jitterAvgUs", p_s.stepStats.jitterAvgUs);
+    p_w.kv("jitterMaxUs", p_s.stepStats.jitterMaxUs);
+    p_w.kv("cmdDrops",    _simCmdDrops);
+    p_w.endObject();
+
+    // 제어 판정 deadline 구동 상태
+    p_w.beginObject("ctlTick");
+    p_w.kv("evalCount",  _deadline.evalCount);
+    p_w.kv("skipCount",  _deadline.skipCount);
+    p_w.kv("nextWakeMs", msUntilNextWake());
+    p_w.endObject();
+
+    // WS 스케줄러 pass 예산 / 채널별 markDirty→전송 지연
+    p_w.beginObject("wsSched");
+    CT10_WS_writeSchedStats(p_w);
+    p_w.endObject();
+
+    // AutoOff metrics
+    p_w.kv("autoOffTimerArmed",   autoOffRt.timerArmed);
+    p_w.kv("autoOffTimerMinutes", autoOffRt.timerMinutes);
+    p_w.kv("autoOffOffTime",      autoOffRt.offTimeEnabled ? autoOffRt.offTimeMinutes : 0);
+    p_w.kv("autoOffOffTemp",      autoOffRt.offTempEnabled ? autoOffRt.offTemp : 0.0f);
+}
+
+template void CL_CT10_ControlManager::emitControlFields<CL_A20_JsonDocSink>(CL_A20_JsonDocSink&);
+template void CL_CT10_ControlManager::emitChartMetaFields<CL_A20_JsonDocSink>(CL_A20_JsonDocSink&);
+template void CL_CT10_ControlManager::emitSummaryFields<CL_A20_JsonDocSink>(CL_A20_JsonDocSink&, const ST_S10_SimSnapshot_t&);
+template void CL_CT10_ControlManager::emitMetricsFields<CL_A20_JsonDocSink>(CL_A20_JsonDocSink&, const ST_S10_SimSnapshot_t&);
+
+// ==================================================
+// 스트리밍 직렬화 (WS hot path)
+// ==================================================
+size_t CL_CT10_ControlManager::writeStateJson(CL_A20_JsonWriter& p_w) {
+    p_w.beginObject();
+
+    p_w.beginObject("control");
+    emitControlFields(p_w);
+    p_w.endObject();
+
+    // sim 상태(책임: S10)
+    (void)sim.writeJson(p_w);
+
+    p_w.endObject();
+    return p_w.length();
+}
+
+void CL_CT10_ControlManager::writeChartMeta(CL_A20_JsonWriter& p_w, void* p_ctx) {
+    CL_CT10_ControlManager* v_self = (CL_CT10_ControlManager*)p_ctx;
+    if (!v_self) return;
+    v_self->emitChartMetaFields(p_w);
+}
+
+size_t CL_CT10_ControlManager::writeChartJson(CL_A20_JsonWriter& p_w) {
+    p_w.beginObject();
+    bool v_has = sim.writeChartJson(p_w, &CL_CT10_ControlManager::writeChartMeta, this);
+    p_w.endObject();
+
+    // 차트 데이터 없음 → "{}" (전송 생략 대상)
+    return v_has ? p_w.length() : 0;
+}
+
+size_t CL_CT10_ControlManager::writeSummaryJson(CL_A20_JsonWriter& p_w) {
+    ST_S10_SimSnapshot_t v_s = {};
+    (void)sim.readSnapshot(v_s);
+
+    p_w.beginObject();
+    p_w.beginObject("summary");
+    emitSummaryFields(p_w, v_s);
+    p_w.endObject();
+    p_w.endObject();
+    return p_w.length();
+}
+
+size_t CL_CT10_ControlManager::writeMetricsJson(CL_A20_JsonWriter& p_w) {
+    ST_S10_SimSnapshot_t v_s = {};
+    (void)sim.readSnapshot(v_s);
+
+    p_w.beginObject();
+    p_w.beginObject("metrics");
+    emitMetricsFields(p_w, v_s);
+    p_w.endObject();
+    p_w.endObject();
+    return p_w.length();
+}
@@ -0,0 +1,191 @@
+/*
+ * ------------------------------------------------------
+ * 소스명 : CT10_Control_Task_041.cpp
+ * 모듈약어 : CT10
+ * 모듈명 : Smart Nature Wind 제어 통합 Manager (v026, Sim Task)
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - S10 구동/명령 경유 함수(simCmd*) 구현
+ *    - loop 모드: sim 직접 호출 (기존 동작 유지)
+ *    - task 모드: FreeRTOS queue 전달, 동일 정지 명령 병합
+ * - (옵션) S10 전용 task: core 1 고정, vTaskDelayUntil 고정주기(motion.timing.simIntervalMs)
+ *    - 주기마다 명령 queue 처리 → sim.tick()(physics + P10 duty)
+ * ------------------------------------------------------
+ */
+
+#include "CT10_Control_041.h"
+
+// --------------------------------------------------
+// 전용 task 시작 (begin에서 1회)
+// --------------------------------------------------
+bool CL_CT10_ControlManager::startSimTask() {
+	if (_simTaskHandle) {
+		return true;
+	}
+
+	_simCmdQueue = xQueueCreate(G_CT10_SIM_CMD_QUEUE_LEN, sizeof(ST_CT10_SimCmd_t));
+	if (!_simCmdQueue) {
+		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[CT10] sim task: queue create failed (loop mode)");
+		return false;
+	}
+
+	// task가 주기를 보장하므로 S10 내부 최소간격 게이트 생략
+	sim.setFixedStep(true);
+	_simIntendedActive = sim.active;
+	simTaskMode		   = true;
+
+	BaseType_t v_ok	   = xTaskCreatePinnedToCore(simTaskMain, "CT10_sim", G_CT10_SIM_TASK_STACK, this, G_CT10_SIM_TASK_PRIO, &_simTaskHandle, G_CT10_SIM_TASK_CORE);
+
+	if (v_ok != pdPASS) {
+		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[CT10] sim task: create failed (loop mode)");
+		simTaskMode	   = false;
+		_simTaskHandle = nullptr;
+		sim.setFixedStep(false);
+		vQueueDelete(_simCmdQueue);
+		_simCmdQueue = nullptr;
+		return false;
+	}
+
+	CL_D10_Logger::log(EN_L10_LOG_INFO, "[CT10] sim task started (core=%d prio=%u)", (int)G_CT10_SIM_TASK_CORE, (unsigned)G_CT10_SIM_TASK_PRIO);
+	return true;
+}
+
+void CL_CT10_ControlManager::simTaskMain(void* p_arg) {
+	static_cast<CL_CT10_ControlManager*>(p_arg)->simTaskRun();
+	vTaskDelete(nullptr);
+}
+
+// --------------------------------------------------
+// 전용 task 본체: 고정주기 → 명령 처리 → physics/duty
+// --------------------------------------------------
+void CL_CT10_ControlManager::simTaskRun() {
+	TickType_t		 v_lastWake = xTaskGetTickCount();
+	ST_CT10_SimCmd_t v_cmd;
+
+	for (;;) {
+		// 1) 주기: motion.timing.simIntervalMs (없으면 S10 기본값)
+		uint32_t v_periodMs = G_S10_TICK_MIN_BASE_MS;
+		const ST_A20_MotionConfig_t* v_motion = C10_rcuRead(g_A20_config_root.motion);
+		if (v_motion != nullptr && v_motion->timing.simIntervalMs > 0) {
+			v_periodMs = (uint32_t)v_motion->timing.simIntervalMs;
+		}
+		if (v_periodMs < G_CT10_SIM_TASK_PERIOD_MIN_MS) {
+			v_periodMs = G_CT10_SIM_TASK_PERIOD_MIN_MS;
+		}
+
+		vTaskDelayUntil(&v_lastWake, pdMS_TO_TICKS(v_periodMs));
+
+		// 2) CT10 명령 처리 (FIFO 순서 유지)
+		while (xQueueReceive(_simCmdQueue, &v_cmd, 0) == pdTRUE) {
+			switch (v_cmd.type) {
+				case EN_CT10_SIMCMD_APPLY:
+					sim.applyResolvedWind(v_cmd.wind);
+					break;
+				case EN_CT10_SIMCMD_STOP:
+					sim.stop();
+					break;
+				case EN_CT10_SIMCMD_FIXED_DUTY:
+					sim.stop();
+					if (pwm) {
+						pwm->P10_setDutyPercent(v_cmd.dutyPct);
+					}
+					break;
+				default:
+					break;
+			}
+		}
+
+		// 3) physics + P10 duty 갱신
+		sim.tick();
+	}
+}
+
+// --------------------------------------------------
+// queue 전달 (가득 차면 drop 카운트 후 false → 다음 tick에서 재시도)
+// --------------------------------------------------
+bool CL_CT10_ControlManager::simCmdSend(const ST_CT10_SimCmd_t& p_cmd) {
+	if (xQueueSend(_simCmdQueue, &p_cmd, 0) != pdTRUE) {
+		_simCmdDrops++;
+		CL_D10_Logger::log(EN_L10_LOG_WARN, "[CT10] sim cmd queue full (type=%u drops=%lu)", (unsigned)p_cmd.type, (unsigned long)_simCmdDrops);
+		return false;
+	}
+	return true;
+}
+
+// --------------------------------------------------
+// S10 명령 경유 함수
+// --------------------------------------------------
+void CL_CT10_ControlManager::simCmdApply(const ST_A20_ResolvedWind_t& p_wind) {
+	if (!simTaskMode) {
+		sim.applyResolvedWind(p_wind);
+		return;
+	}
+
+	ST_CT10_SimCmd_t v_cmd;
+	memset(&v_cmd, 0, sizeof(v_cmd));
+	v_cmd.type = EN_CT10_SIMCMD_APPLY;
+	v_cmd.wind = p_wind;
+
+	if (simCmdSend(v_cmd)) {
+		_simIntendedActive = true;
+		_simQueuedDuty	   = -1.0f;
+	}
+}
+
+void CL_CT10_ControlManager::simCmdStop() {
+	if (!simTaskMode) {
+		sim.stop();
+		return;
+	}
+
+	// 이미 정지(duty 0) 명령이 전달된 상태면 병합
+	if (!_simIntendedActive && _simQueuedDuty == 0.0f) {
+		return;
+	}
+
+	ST_CT10_SimCmd_t v_cmd;
+	memset(&v_cmd, 0, sizeof(v_cmd));
+	v_cmd.type = EN_CT10_SIMCMD_STOP;
+
+	if (simCmdSend(v_cmd)) {
+		_simIntendedActive = false;
+		_simQueuedDuty	   = 0.0f;
+	}
+}
+
+void CL_CT10_ControlManager::simCmdFixedDuty(float p_pct) {
+	if (!simTaskMode) {
+		sim.stop();
+		if (pwm) {
+			pwm->P10_setDutyPercent(p_pct);
+		}
+		return;
+	}
+
+	// 동일 duty가 이미 전달된 상태면 병합
+	if (!_simIntendedActive && _simQueuedDuty == p_pct) {
+		return;
+	}
+
+	ST_CT10_SimCmd_t v_cmd;
+	memset(&v_cmd, 0, sizeof(v_cmd));
+	v_cmd.type	  = EN_CT10_SIMCMD_FIXED_DUTY;
+	v_cmd.dutyPct = p_pct;
+
+	if (simCmdSend(v_cmd)) {
+		_simIntendedActive = false;
+		_simQueuedDuty	   = p_pct;
+	}
+}
+
+void CL_CT10_ControlManager::simCmdTick() {
+	// task 모드에서는 전용 task가 주기 구동
+	if (simTaskMode) {
+		return;
+	}
+	sim.tick();
+}
+
+bool CL_CT10_ControlManager::simIsActive() const {
+	return simTaskMode ? _simIntendedActive : sim.active;
+}
@@ -0,0 +1,155 @@
+#pragma once
+/*
+ * ------------------------------------------------------
+ * 소스명 : CT10_Control_WSSched_043.h
+ * 모듈약어 : CT10
+ * 모듈명 : Smart Nature Wind 제어 통합 Manager - WS Scheduler pass 계획
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - CT10_WS_tick(CT10_Control_WS_043.cpp) pass 1회의 순수 계산부 (millis/broker/JsonDocument 미사용)
+ *   - CT10_WS_rankDue   : due 채널 후보 정렬 (기본 우선순위 위치 - due 후 경과 / aging step)
+ *   - CT10_WS_runPass   : 후보 순서 연속 전송, 누적 byte / 경과 us 예산 도달 시 중단 (최소 1채널)
+ *   - CT10_WS_latencyRecord : markDirty → 전송 지연 (last / EWMA 1/8 / max)
+ * - host 테스트: test/host T10_TestWsSched_040.cpp (aging 유무별 하위 채널 지연/기아 비교)
+ * ------------------------------------------------------
+ * [구현 규칙]
+ *  - 항상 소스 시작 주석 부분 체계 유지 및 내용 업데이트
+ *  - 소스 시작 주석 부분 구현규칙, 코드네이밍규칙 내용 그대로 유지, 수정금지
+ *  - ArduinoJson v7.x.x 사용 (v6 이하 사용 금지)
+ *  - JsonDocument 단일 타입만 사용
+ *  - createNestedArray/Object/containsKey 사용 금지
+ *  - memset + strlcpy 기반 안전 초기화
+ *  - 주석/필드명은 JSON 구조와 동일하게 유지
+ *  - 변수명은 가능한 해석 가능하게
+ * ------------------------------------------------------
+ * [코드 네이밍 규칙]
+ *   - namespace 명        : 모듈약어_ 접두사
+ *   - namespace 내 상수    : 모둘약어 접두시 미사용
+ *   - 전역 상수,매크로      : G_모듈약어_ 접두사
+ *   - 전역 변수             : g_모듈약어_ 접두사
+ *   - 전역 함수             : 모듈약어_ 접두사
+ *   - type                  : T_모듈약어_ 접두사
+ *   - typedef               : _t  접미사
+ *   - enum 상수             : EN_모듈약어_ 접두사
+ *   - 구조체                : ST_모듈약어_ 접두사
+ *   - 클래스명              : CL_모듈약어_ 접두사 , 버전 제거
+ *   - 클래스 private 멤버   : _ 접두사
+ *   - 클래스 멤버(함수/변수) : 모듈약어 접두사 미사용
+ *   - 클래스 정적 멤버      : s_ 접두사
+ *   - 함수 로컬 변수        : v_ 접두사
+ *   - 함수 인자             : p_ 접두사
+ * ------------------------------------------------------
+ */
+
+#include <stdint.h>
+
+#include "A20_Const_041.h"  // G_A20_WS_CH_COUNT
+
+// WS 스케줄러 fairness aging: due 후 대기 시간 이 값마다 우선순위 1단계 상승 [ms]
+static const uint16_t G_CT10_WS_AGING_STEP_MS = 400u;
+
+// markDirty → 전송 지연 통계 (채널별)
+typedef struct {
+    uint32_t sent;      // 전송 횟수(누적)
+    uint32_t lastMs;    // 직전 전송 지연 [ms]
+    uint32_t avgMs;     // EWMA(1/8) [ms]
+    uint32_t maxMs;     // 최대 [ms]
+} ST_CT10_WsLatency_t;
+
+// pass 1회 결과
+typedef struct {
+    uint32_t bytes;           // 전송 payload 누적 [byte]
+    uint8_t  sent;            // 전송 채널 수
+    uint8_t  agedPromotions;  // 더 높은 기본 순위 후보보다 먼저 전송된 채널 수
+    bool     budgetStop;      // 예산 도달로 후보를 남기고 종료
+} ST_CT10_WsPassResult_t;
+
+// --------------------------------------------------
+// 전송 지연 기록 (정수 EWMA 1/8, 첫 표본은 그대로)
+// --------------------------------------------------
+static inline void CT10_WS_latencyRecord(ST_CT10_WsLatency_t& p_lat, uint32_t p_ms) {
+    p_lat.lastMs = p_ms;
+    p_lat.avgMs  = (p_lat.sent == 0) ? p_ms : (uint32_t)(((uint64_t)p_lat.avgMs * 7u + p_ms) / 8u);
+    if (p_ms > p_lat.maxMs) p_lat.maxMs = p_ms;
+    p_lat.sent++;
+}
+
+// --------------------------------------------------
+// due 채널 후보 정렬
+// - 유효 rank = 기본 우선순위 위치 - (due 후 경과 / p_agingStepMs), 삽입 정렬 (동률은 기본 우선순위 유지)
+// - pending 아님 / due 전(p_overdueMs < 0) 채널 제외
+// - p_cand: 전송 순서 채널, p_base: 각 후보의 기본 우선순위 위치 → 반환: 후보 수
+// --------------------------------------------------
+static inline uint8_t CT10_WS_rankDue(
+    const uint8_t p_prio[G_A20_WS_CH_COUNT],
+    const bool    p_pending[G_A20_WS_CH_COUNT],
+    const int32_t p_overdueMs[G_A20_WS_CH_COUNT],
+    uint16_t      p_agingStepMs,
+    uint8_t       p_cand[G_A20_WS_CH_COUNT],
+    uint8_t       p_base[G_A20_WS_CH_COUNT]
+) {
+    int32_t v_rank[G_A20_WS_CH_COUNT];
+    uint8_t v_n = 0;
+
+    for (uint8_t v_i = 0; v_i < G_A20_WS_CH_COUNT; v_i++) {
+        uint8_t v_ch = p_prio[v_i];
+        if (v_ch >= G_A20_WS_CH_COUNT || !p_pending[v_ch]) continue;
+
+        int32_t v_over = p_overdueMs[v_ch];
+        if (v_over < 0) continue;
+
+        int32_t v_r = (int32_t)v_i - v_over / (int32_t)(p_agingStepMs > 0 ? p_agingStepMs : 1u);
+        uint8_t v_k = v_n;
+        while (v_k > 0 && v_rank[v_k - 1] > v_r) {
+            p_cand[v_k] = p_cand[v_k - 1];
+            v_rank[v_k] = v_rank[v_k - 1];
+            p_base[v_k] = p_base[v_k - 1];
+            v_k--;
+        }
+        p_cand[v_k] = v_ch;
+        v_rank[v_k] = v_r;
+        p_base[v_k] = v_i;
+        v_n++;
+    }
+    return v_n;
+}
+
+// --------------------------------------------------
+// 후보 순서대로 연속 전송 (최소 1채널 보장)
+// - p_send(ch, bytes&) → 전송 여부 (pending 해소/지연 기록은 호출측)
+// - p_elapsedUs() → pass 시작 후 경과 [us]
+// --------------------------------------------------
+template <typename T_Send, typename T_Elapsed>
+static inline ST_CT10_WsPassResult_t CT10_WS_runPass(
+    const uint8_t* p_cand,
+    const uint8_t* p_base,
+    uint8_t        p_n,
+    uint32_t       p_budgetBytes,
+    uint32_t       p_budgetUs,
+    T_Send         p_send,
+    T_Elapsed      p_elapsedUs
+) {
+    ST_CT10_WsPassResult_t v_res = {0, 0, 0, false};
+
+    for (uint8_t v_k = 0; v_k < p_n; v_k++) {
+        if (v_res.sent > 0 && (v_res.bytes >= p_budgetBytes || p_elapsedUs() >= p_budgetUs)) {
+            v_res.budgetStop = true;
+            break;
+        }
+
+        uint32_t v_b = 0;
+        if (!p_send(p_cand[v_k], v_b)) continue;
+
+        // 더 높은 기본 순위 채널보다 먼저 나갔으면 aging 승격
+        for (uint8_t v_j = v_k + 1; v_j < p_n; v_j++) {
+            if (p_base[v_j] < p_base[v_k]) {
+                v_res.agedPromotions++;
+                break;
+            }
+        }
+
+        v_res.bytes += v_b;
+        v_res.sent++;
+    }
+    return v_res;
+}
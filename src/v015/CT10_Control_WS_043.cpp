@@ -8,7 +8,14 @@
  * - Dirty 기반 WS 브로드캐스트 스케줄러 (state/metrics/chart/summary)
  * - 전송 스로틀 + pending 플래그 (필수/즉효)
  * - priorityOrder[4] 정책 기반 우선순위 전송
+ *   - tick 1회(pass)에 due 채널을 연속 전송, 누적 byte/경과 us 예산(wsPassBudget*) 도달 시 중단
+ *   - fairness aging: due 후 대기 시간이 길수록 우선순위 상승 (예산 중단 시 하위 채널 기아 방지)
+ *   - 채널별 markDirty → 전송 지연(last/avg/max) 측정 → metrics.wsSched
+ *   - 후보 정렬/예산 pass/지연 기록은 CT10_Control_WSSched_043.h (host 테스트 공용)
  * - payload 크기 측정(measureJson) → chart 대형이면 자동 강스로틀
+ *   (wsAdaptEnabled 시 생략: W10 client별 적응형 간격이 느린 client만 늘림)
+ * - (raw broker 주입 시) 채널별 고정 버퍼 스트리밍 직렬화(CL_A20_JsonWriter)
+ *   → JsonDocument/String 생성 없이 전송, 버퍼 초과 시 해당 회차만 JsonDocument 경로 fallback
  * - W10 cleanupClients 주기 호출(권장)
  * - W10 setWsIntervals(setter)로 CT10 policy.itv 반영(통합)
  * ------------------------------------------------------
@@ -42,6 +49,8 @@
  */
 
 #include "CT10_Control_041.h"
+#include "A20_JsonDocSink_041.h"
+#include "CT10_Control_WSSched_043.h"
 
 
 void CT10_markDirtyFromSim(const char* p_key) {
@@ -58,6 +67,7 @@ static void (*s_bcast_chart)(JsonDocument&, bool)   = nullptr;
 static void (*s_bcast_summary)(JsonDocument&, bool) = nullptr;
 static void (*s_ws_cleanup)()                       = nullptr;
 static void (*s_setIntervals)(const uint16_t p_itvMs[G_A20_WS_CH_COUNT]) = nullptr;
+static void (*s_bcast_raw)(uint8_t, const char*, size_t)  = nullptr;
 
 // --------------------------------------------------
 // 내부 상태
@@ -88,10 +98,47 @@ static uint8_t s_prio[G_A20_WS_CH_COUNT] = {
 static uint16_t s_chartLargeBytes  = G_A20_WS_DEFAULT_CHART_LARGE_BYTES;
 static uint8_t  s_chartThrottleMul = G_A20_WS_DEFAULT_CHART_THROTTLE_MUL;
 static uint32_t s_chartLastPayload = 0;
+static bool     s_wsAdaptive       = G_A20_WS_DEFAULT_ADAPT_ENABLED;  // true: chart 강스로틀은 W10 client별 적응으로 대체
 
 // cleanupClients 호출 주기
 static uint16_t s_cleanupMs = G_A20_WS_DEFAULT_CLEANUP_MS;
 
+// 채널별 스트리밍 직렬화 고정 버퍼 (loop task 전용)
+static char s_txBufState[G_CT10_WS_TXBUF_STATE_BYTES];
+static char s_txBufMetrics[G_CT10_WS_TXBUF_METRICS_BYTES];
+static char s_txBufChart[G_CT10_WS_TXBUF_CHART_BYTES];
+static char s_txBufSummary[G_CT10_WS_TXBUF_SUMMARY_BYTES];
+
+static char* const    s_txBuf[G_A20_WS_CH_COUNT] = { s_txBufState, s_txBufMetrics, s_txBufChart, s_txBufSummary };
+static const uint16_t s_txCap[G_A20_WS_CH_COUNT] = {
+    G_CT10_WS_TXBUF_STATE_BYTES,
+    G_CT10_WS_TXBUF_METRICS_BYTES,
+    G_CT10_WS_TXBUF_CHART_BYTES,
+    G_CT10_WS_TXBUF_SUMMARY_BYTES
+};
+
+// 스트리밍 누적 통계
+static uint32_t s_streamSends                        = 0;
+static uint32_t s_streamFallbacks                    = 0;
+static uint16_t s_streamPeak[G_A20_WS_CH_COUNT]      = {0, 0, 0, 0};
+
+// pass 전송 예산 (기본값 fallback - 실제는 system.webSocket 정책으로 덮어씀)
+static uint16_t s_passBudgetBytes = G_A20_WS_DEFAULT_PASS_BUDGET_BYTES;
+static uint16_t s_passBudgetUs    = G_A20_WS_DEFAULT_PASS_BUDGET_US;
+
+// markDirty → 전송 지연 통계 (채널별, ST_CT10_WsLatency_t)
+static uint32_t            s_pendingSinceMs[G_A20_WS_CH_COUNT] = {0, 0, 0, 0};  // pending 최초 적립 기준 dirty 시각
+static ST_CT10_WsLatency_t s_latency[G_A20_WS_CH_COUNT]        = {};
+
+// pass 통계
+static uint32_t s_passCount      = 0;   // due 채널이 1개 이상이었던 pass 수
+static uint32_t s_multiSendPass  = 0;   // 2채널 이상 전송한 pass 수
+static uint32_t s_budgetStops    = 0;   // 예산 도달로 due 채널을 남기고 종료한 pass 수
+static uint32_t s_agedPromotions = 0;   // aging으로 기본 우선순위보다 앞서 전송된 횟수
+static uint32_t s_lastPassBytes  = 0;
+static uint32_t s_lastPassUs     = 0;
+static uint32_t s_peakPassUs     = 0;
+
 // --------------------------------------------------
 // 브로커 주입 API (CT10_Control_WS_Broker_xxx.cpp에서 호출)
 // --------------------------------------------------
@@ -111,6 +158,56 @@ void CT10_WS_setBrokers(
     s_setIntervals  = p_setIntervalsFn;
 }
 
+void CT10_WS_setRawBroker(void (*p_raw)(uint8_t p_ch, const char* p_buf, size_t p_len)) {
+    s_bcast_raw = p_raw;
+}
+
+void CT10_WS_streamStatsToJson(JsonObject p_obj) {
+    p_obj["enabled"]   = (s_bcast_raw != nullptr);
+    p_obj["sends"]     = s_streamSends;
+    p_obj["fallbacks"] = s_streamFallbacks;
+
+    JsonObject v_peak = p_obj["peakBytes"].to<JsonObject>();
+    JsonObject v_cap  = p_obj["capBytes"].to<JsonObject>();
+    for (uint8_t v_i = 0; v_i < G_A20_WS_CH_COUNT; v_i++) {
+        v_peak[G_A20_WS_CH_NAMES_Arr[v_i]] = s_streamPeak[v_i];
+        v_cap[G_A20_WS_CH_NAMES_Arr[v_i]]  = s_txCap[v_i];
+    }
+}
+
+// metrics.wsSched field list (writer / JsonDocSink 공용)
+template <typename T>
+static void CT10_WS_emitSchedStats(T& p_w) {
+    p_w.kv("budgetBytes",     s_passBudgetBytes);
+    p_w.kv("budgetUs",        s_passBudgetUs);
+    p_w.kv("passes",          s_passCount);
+    p_w.kv("multiSendPasses", s_multiSendPass);
+    p_w.kv("budgetStops",     s_budgetStops);
+    p_w.kv("agedPromotions",  s_agedPromotions);
+    p_w.kv("lastPassBytes",   s_lastPassBytes);
+    p_w.kv("lastPassUs",      s_lastPassUs);
+    p_w.kv("peakPassUs",      s_peakPassUs);
+
+    p_w.beginObject("latency");
+    for (uint8_t v_i = 0; v_i < G_A20_WS_CH_COUNT; v_i++) {
+        p_w.beginObject(G_A20_WS_CH_NAMES_Arr[v_i]);
+        p_w.kv("n",      s_latency[v_i].sent);
+        p_w.kv("lastMs", s_latency[v_i].lastMs);
+        p_w.kv("avgMs",  s_latency[v_i].avgMs);
+        p_w.kv("maxMs",  s_latency[v_i].maxMs);
+        p_w.endObject();
+    }
+    p_w.endObject();
+}
+
+void CT10_WS_writeSchedStats(CL_A20_JsonWriter& p_w) {
+    CT10_WS_emitSchedStats(p_w);
+}
+
+void CT10_WS_writeSchedStats(CL_A20_JsonDocSink& p_w) {
+    CT10_WS_emitSchedStats(p_w);
+}
+
 // --------------------------------------------------
 // priority 정규화: 중복 제거 + 누락 채움(운영급 방어)
 // --------------------------------------------------
@@ -197,9 +294,10 @@ static bool CT10_WS_intervalsChanged() {
 // policy 로드: system.webSocket → s_itvMs / priority / chart 정책 / cleanupMs
 // --------------------------------------------------
 static void CT10_WS_applyPolicyFromSystem() {
-    if (!g_A20_config_root.system) return;
+    const ST_A20_SystemConfig_t* v_sysP = C10_rcuRead(g_A20_config_root.system);
+    if (!v_sysP) return;
 
-    const ST_A20_SystemConfig_t&     v_sys = *g_A20_config_root.system;
+    const ST_A20_SystemConfig_t&     v_sys = *v_sysP;
     const ST_A20_WebSocketConfig_t&  v_ws  = v_sys.system.webSocket;
 
     // intervals
@@ -223,10 +321,15 @@ static void CT10_WS_applyPolicyFromSystem() {
     // chart payload policy
     if (v_ws.chartLargeBytes > 0)  s_chartLargeBytes  = v_ws.chartLargeBytes;
     if (v_ws.chartThrottleMul > 0) s_chartThrottleMul = v_ws.chartThrottleMul;
+    s_wsAdaptive = v_ws.wsAdaptEnabled;
 
     // cleanup tick
     if (v_ws.wsCleanupMs > 0) s_cleanupMs = v_ws.wsCleanupMs;
 
+    // pass budget
+    if (v_ws.wsPassBudgetBytes > 0) s_passBudgetBytes = v_ws.wsPassBudgetBytes;
+    if (v_ws.wsPassBudgetUs > 0)    s_passBudgetUs    = v_ws.wsPassBudgetUs;
+
     // W10 setter로도 전달(통합 요구사항)
     // if (s_setIntervals) s_setIntervals(s_itvMs);
 
@@ -238,14 +341,15 @@ static void CT10_WS_applyPolicyFromSystem() {
 
 		CL_D10_Logger::log(
 			EN_L10_LOG_INFO,
-			"[CT10][WS] policy applied: itv(%u/%u/%u/%u) prio(%u,%u,%u,%u) chart(%u,mul=%u) cleanup=%u",
+			"[CT10][WS] policy applied: itv(%u/%u/%u/%u) prio(%u,%u,%u,%u) chart(%u,mul=%u) cleanup=%u budget(%uB,%uus)",
 			(unsigned)s_itvMs[G_A20_WS_CH_STATE],
 			(unsigned)s_itvMs[G_A20_WS_CH_METRICS],
 			(unsigned)s_itvMs[G_A20_WS_CH_CHART],
 			(unsigned)s_itvMs[G_A20_WS_CH_SUMMARY],
 			(unsigned)s_prio[0], (unsigned)s_prio[1], (unsigned)s_prio[2], (unsigned)s_prio[3],
 			(unsigned)s_chartLargeBytes, (unsigned)s_chartThrottleMul,
-			(unsigned)s_cleanupMs
+			(unsigned)s_cleanupMs,
+			(unsigned)s_passBudgetBytes, (unsigned)s_passBudgetUs
 		);
 
 	}
@@ -260,8 +364,9 @@ void CT10_WS_begin() {
     CT10_WS_applyPolicyFromSystem();
 
     for (uint8_t v_i = 0; v_i < G_A20_WS_CH_COUNT; v_i++) {
-        s_lastSendMs[v_i] = 0;
-        s_pending[v_i]    = false;
+        s_lastSendMs[v_i]     = 0;
+        s_pending[v_i]        = false;
+        s_pendingSinceMs[v_i] = 0;
     }
 
     s_lastCleanupMs     = 0;
@@ -284,12 +389,27 @@ void CT10_WS_begin() {
 
 // --------------------------------------------------
 // 채널별 dirty 소비 → pending 적립
+// - pending 최초 적립 시 dirty 시각 보관 (전송 지연 측정 기준, 재적립은 유지)
 // --------------------------------------------------
-static void CT10_WS_collectPending(CL_CT10_ControlManager& p_ctrl) {
-    if (p_ctrl.consumeDirtyState())   s_pending[G_A20_WS_CH_STATE]   = true;
-    if (p_ctrl.consumeDirtyMetrics()) s_pending[G_A20_WS_CH_METRICS] = true;
-    if (p_ctrl.consumeDirtyChart())   s_pending[G_A20_WS_CH_CHART]   = true;
-    if (p_ctrl.consumeDirtySummary()) s_pending[G_A20_WS_CH_SUMMARY] = true;
+static void CT10_WS_collectOne(uint8_t p_ch, uint32_t p_sinceMs, bool p_dirty, uint32_t p_nowMs) {
+    if (!p_dirty) return;
+    if (!s_pending[p_ch]) s_pendingSinceMs[p_ch] = (p_sinceMs != 0) ? p_sinceMs : p_nowMs;
+    s_pending[p_ch] = true;
+}
+
+static void CT10_WS_collectPending(CL_CT10_ControlManager& p_ctrl, uint32_t p_nowMs) {
+    // dirtySinceMs는 consume 전에 읽음 (consume 시 0으로 초기화)
+    uint32_t v_since = p_ctrl.dirtySinceMs(G_A20_WS_CH_STATE);
+    CT10_WS_collectOne(G_A20_WS_CH_STATE, v_since, p_ctrl.consumeDirtyState(), p_nowMs);
+
+    v_since = p_ctrl.dirtySinceMs(G_A20_WS_CH_METRICS);
+    CT10_WS_collectOne(G_A20_WS_CH_METRICS, v_since, p_ctrl.consumeDirtyMetrics(), p_nowMs);
+
+    v_since = p_ctrl.dirtySinceMs(G_A20_WS_CH_CHART);
+    CT10_WS_collectOne(G_A20_WS_CH_CHART, v_since, p_ctrl.consumeDirtyChart(), p_nowMs);
+
+    v_since = p_ctrl.dirtySinceMs(G_A20_WS_CH_SUMMARY);
+    CT10_WS_collectOne(G_A20_WS_CH_SUMMARY, v_since, p_ctrl.consumeDirtySummary(), p_nowMs);
 }
 
 // --------------------------------------------------
@@ -300,46 +420,117 @@ static uint32_t CT10_WS_measurePayloadBytes(JsonDocument& p_doc) {
 }
 
 // --------------------------------------------------
-// 채널 1회 전송 시도 (스로틀 + pending 해소)
+// 채널 유효 인터벌 / due 경과 시간
 // --------------------------------------------------
-static bool CT10_WS_trySendOne(uint8_t p_ch, uint32_t p_nowMs) {
+static uint32_t CT10_WS_effectiveItvMs(uint8_t p_ch) {
+    uint32_t v_itv = s_itvMs[p_ch];
+
+    // chart는 payload 크기에 따라 추가 스로틀 (적응형 활성 시 W10이 client별로 늘림)
+    if (p_ch == G_A20_WS_CH_CHART && !s_wsAdaptive && s_chartLastPayload >= s_chartLargeBytes) {
+        uint32_t v_mul = (s_chartThrottleMul > 0) ? s_chartThrottleMul : 2;
+        v_itv *= v_mul;
+    }
+    return v_itv;
+}
+
+// 반환: due 이후 경과 [ms] (음수 = due까지 남은 시간)
+static int32_t CT10_WS_overdueMs(uint8_t p_ch, uint32_t p_nowMs) {
+    return (int32_t)(p_nowMs - s_lastSendMs[p_ch]) - (int32_t)CT10_WS_effectiveItvMs(p_ch);
+}
+
+// --------------------------------------------------
+// markDirty → 전송 지연 기록 (정수 EWMA 1/8)
+// --------------------------------------------------
+static void CT10_WS_recordLatency(uint8_t p_ch, uint32_t p_nowMs) {
+    uint32_t v_since = s_pendingSinceMs[p_ch];
+    s_pendingSinceMs[p_ch] = 0;
+    if (v_since == 0) return;
+
+    CT10_WS_latencyRecord(s_latency[p_ch], p_nowMs - v_since);
+}
+
+// --------------------------------------------------
+// 채널 1회 전송 (호출 전 due 확인 완료 전제, pending 해소)
+// - p_bytes: 전송 payload 크기 (pass 예산 누적용)
+// --------------------------------------------------
+static bool CT10_WS_trySendOne(uint8_t p_ch, uint32_t p_nowMs, uint32_t& p_bytes) {
+    p_bytes = 0;
     if (p_ch >= G_A20_WS_CH_COUNT) return false;
     if (!s_pending[p_ch]) return false;
 
-    uint16_t v_itv = s_itvMs[p_ch];
+    // 1) 스트리밍 경로: 채널 고정 버퍼에 직접 기록 → raw broker
+    //    (길이 0 = 보낼 내용 없음. chart는 seq 추적 client 전송을 위해 그대로 전달)
+    if (s_bcast_raw) {
+        CL_A20_JsonWriter v_w(s_txBuf[p_ch], s_txCap[p_ch]);
+        size_t            v_len = CL_CT10_ControlManager::instance().writeChannelJson(p_ch, v_w);
 
-    // chart는 payload 크기에 따라 추가 스로틀
-    if (p_ch == G_A20_WS_CH_CHART && s_chartLastPayload >= s_chartLargeBytes) {
-        uint32_t v_mul = (s_chartThrottleMul > 0) ? s_chartThrottleMul : 2;
-        v_itv = (uint16_t)((uint32_t)v_itv * v_mul);
-    }
+        if (!v_w.overflow()) {
+            if (p_ch == G_A20_WS_CH_CHART) s_chartLastPayload = (uint32_t)v_len;
+            if (v_len > s_streamPeak[p_ch]) s_streamPeak[p_ch] = (uint16_t)v_len;
+
+            s_bcast_raw(p_ch, v_w.c_str(), v_len);
+            s_streamSends++;
+
+            s_lastSendMs[p_ch] = p_nowMs;
+            s_pending[p_ch]    = false;
+            CT10_WS_recordLatency(p_ch, p_nowMs);
+            p_bytes = (uint32_t)v_len;
+            return true;
+        }
 
-    if (p_nowMs - s_lastSendMs[p_ch] < v_itv) return false;
+        // 버퍼 초과 → 이번 회차만 JsonDocument 경로
+        s_streamFallbacks++;
+        s_streamPeak[p_ch] = s_txCap[p_ch];
+    }
 
+    // 2) JsonDocument 경로 (raw broker 미주입 / 버퍼 초과 fallback)
     JsonDocument v_doc;
 
     // ✅ “인스턴스 오타 호출(v_ctrl.toJson)” 금지
     // ✅ static wrapper(toJsonxxx)만 사용
     if (p_ch == G_A20_WS_CH_STATE) {
         CL_CT10_ControlManager::toJson(v_doc);
+        p_bytes = CT10_WS_measurePayloadBytes(v_doc);
         if (s_bcast_state) s_bcast_state(v_doc, true);
     } else if (p_ch == G_A20_WS_CH_METRICS) {
         CL_CT10_ControlManager::toMetricsJson(v_doc);
+        p_bytes = CT10_WS_measurePayloadBytes(v_doc);
         if (s_bcast_metrics) s_bcast_metrics(v_doc, true);
     } else if (p_ch == G_A20_WS_CH_CHART) {
         CL_CT10_ControlManager::toChartJson(v_doc, true);
         s_chartLastPayload = CT10_WS_measurePayloadBytes(v_doc);
+        p_bytes            = s_chartLastPayload;
         if (s_bcast_chart) s_bcast_chart(v_doc, true);
     } else { // summary
         CL_CT10_ControlManager::toSummaryJson(v_doc);
+        p_bytes = CT10_WS_measurePayloadBytes(v_doc);
         if (s_bcast_summary) s_bcast_summary(v_doc, true);
     }
 
     s_lastSendMs[p_ch] = p_nowMs;
     s_pending[p_ch]    = false;
+    CT10_WS_recordLatency(p_ch, p_nowMs);
     return true;
 }
 
+// --------------------------------------------------
+// pending(또는 미수집 dirty) 채널 중 가장 이른 전송 가능 시각까지 남은 시간
+// --------------------------------------------------
+uint32_t CT10_WS_msUntilNextDue() {
+    CL_CT10_ControlManager& v_ctrl  = CL_CT10_ControlManager::instance();
+    uint32_t                v_nowMs = millis();
+    uint32_t                v_min   = UINT32_MAX;
+
+    for (uint8_t v_ch = 0; v_ch < G_A20_WS_CH_COUNT; v_ch++) {
+        if (!s_pending[v_ch] && v_ctrl.dirtySinceMs(v_ch) == 0) continue;
+
+        int32_t v_over = CT10_WS_overdueMs(v_ch, v_nowMs);
+        if (v_over >= 0) return 0;
+        if ((uint32_t)(-v_over) < v_min) v_min = (uint32_t)(-v_over);
+    }
+    return v_min;
+}
+
 // --------------------------------------------------
 // tick
 // --------------------------------------------------
@@ -358,15 +549,39 @@ void CT10_WS_tick() {
 
     // 1) dirty → pending 적립
     CL_CT10_ControlManager& v_ctrl = CL_CT10_ControlManager::instance();
-    CT10_WS_collectPending(v_ctrl);
+    CT10_WS_collectPending(v_ctrl, v_nowMs);
+
+    // 2) due 채널 후보: 유효 rank = 기본 우선순위 위치 - (due 후 경과 / aging step)
+    bool    v_pending[G_A20_WS_CH_COUNT];
+    int32_t v_over[G_A20_WS_CH_COUNT];
+    for (uint8_t v_ch = 0; v_ch < G_A20_WS_CH_COUNT; v_ch++) {
+        v_pending[v_ch] = s_pending[v_ch];
+        v_over[v_ch]    = CT10_WS_overdueMs(v_ch, v_nowMs);
+    }
 
-    // 2) 우선순위대로 "최대 1개"만 전송
-    for (uint8_t v_i = 0; v_i < G_A20_WS_CH_COUNT; v_i++) {
-        uint8_t v_ch = s_prio[v_i];
-        if (CT10_WS_trySendOne(v_ch, v_nowMs)) break;
+    uint8_t v_cand[G_A20_WS_CH_COUNT];
+    uint8_t v_base[G_A20_WS_CH_COUNT];
+    uint8_t v_n = CT10_WS_rankDue(s_prio, v_pending, v_over, G_CT10_WS_AGING_STEP_MS, v_cand, v_base);
+
+    // 3) 예산 내 연속 전송 (최소 1채널 보장)
+    if (v_n > 0) {
+        uint32_t v_t0Us = micros();
+
+        ST_CT10_WsPassResult_t v_pass = CT10_WS_runPass(
+            v_cand, v_base, v_n, s_passBudgetBytes, s_passBudgetUs,
+            [v_nowMs](uint8_t p_ch, uint32_t& p_bytes) { return CT10_WS_trySendOne(p_ch, v_nowMs, p_bytes); },
+            [v_t0Us]() { return (uint32_t)(micros() - v_t0Us); });
+
+        if (v_pass.budgetStop) s_budgetStops++;
+        s_agedPromotions += v_pass.agedPromotions;
+        s_passCount++;
+        if (v_pass.sent > 1) s_multiSendPass++;
+        s_lastPassBytes = v_pass.bytes;
+        s_lastPassUs    = micros() - v_t0Us;
+        if (s_lastPassUs > s_peakPassUs) s_peakPassUs = s_lastPassUs;
     }
 
-    // 3) cleanupClients 주기 호출
+    // 4) cleanupClients 주기 호출
     if (s_ws_cleanup && (v_nowMs - s_lastCleanupMs >= (uint32_t)s_cleanupMs)) {
         s_lastCleanupMs = v_nowMs;
         s_ws_cleanup();
@@ -378,18 +593,27 @@ void CT10_WS_tick() {
 // --------------------------------------------------
 // Dirty flags
 // --------------------------------------------------
+// false→true 전이 시에만 시각 기록 (연속 markDirty는 최초 시각 유지, 0은 "dirty 아님" 예약)
+static inline void CT10_setDirty(bool& p_flag, uint32_t& p_atMs) {
+	if (!p_flag) {
+		uint32_t v_nowMs = millis();
+		p_atMs			 = (v_nowMs != 0) ? v_nowMs : 1;
+	}
+	p_flag = true;
+}
+
 void CL_CT10_ControlManager::markDirty(const char* p_key) {
 	if (!p_key || p_key[0] == '\0')
 		return;
 
 	if (strcmp(p_key, "state") == 0) {
-		_dirtyState = true;
+		CT10_setDirty(_dirtyState, _dirtyAtMs[G_A20_WS_CH_STATE]);
 	} else if (strcmp(p_key, "chart") == 0) {
-		_dirtyChart = true;
+		CT10_setDirty(_dirtyChart, _dirtyAtMs[G_A20_WS_CH_CHART]);
 	} else if (strcmp(p_key, "metrics") == 0) {
-		_dirtyMetrics = true;
+		CT10_setDirty(_dirtyMetrics, _dirtyAtMs[G_A20_WS_CH_METRICS]);
 	} else if (strcmp(p_key, "summary") == 0) {
-		_dirtySummary = true;
+		CT10_setDirty(_dirtySummary, _dirtyAtMs[G_A20_WS_CH_SUMMARY]);
 	} else {
 		CL_D10_Logger::log(EN_L10_LOG_DEBUG, "[CT10] markDirty: unknown key=%s", p_key);
 	}
@@ -398,26 +622,35 @@ void CL_CT10_ControlManager::markDirty(const char* p_key) {
 bool CL_CT10_ControlManager::consumeDirtyState() {
 	bool v_ret = _dirtyState;
 	_dirtyState = false;
+	_dirtyAtMs[G_A20_WS_CH_STATE] = 0;
 	return v_ret;
 }
 
 bool CL_CT10_ControlManager::consumeDirtyMetrics() {
 	bool v_ret = _dirtyMetrics;
 	_dirtyMetrics = false;
+	_dirtyAtMs[G_A20_WS_CH_METRICS] = 0;
 	return v_ret;
 }
 
 bool CL_CT10_ControlManager::consumeDirtyChart() {
 	bool v_ret = _dirtyChart;
 	_dirtyChart = false;
+	_dirtyAtMs[G_A20_WS_CH_CHART] = 0;
 	return v_ret;
 }
 
 bool CL_CT10_ControlManager::consumeDirtySummary() {
 	bool v_ret = _dirtySummary;
 	_dirtySummary = false;
+	_dirtyAtMs[G_A20_WS_CH_SUMMARY] = 0;
 	return v_ret;
 }
+
+uint32_t CL_CT10_ControlManager::dirtySinceMs(uint8_t p_ch) const {
+	if (p_ch >= G_A20_WS_CH_COUNT) return 0;
+	return _dirtyAtMs[p_ch];
+}
 // --------------------------------------------------
 // metrics dirty push
 // --------------------------------------------------
@@ -8,14 +8,23 @@
  * - begin/tick 및 Override/Profile/Schedule 제어 루프 구현
  * - Segment 시퀀스 오버로드 구현(템플릿 제거)
  * - applySegmentOn 로그 포맷 개선(이름 출력)
+ * - segment/override 바람 해석: 코드 intern(설정 세대 변경 시 1회) → 인덱스 기반 ResolvedWind memo 캐시
+ * - S10 구동/명령은 simCmd*() 경유 (loop 직접 호출 또는 전용 task 큐 전달)
+ * - deadline 구동 tick: due 미도래 + 이벤트 없음이면 전체 판정 생략, 판정 후 due 재등록
+ * - 설정 섹션은 C10_rcuRead() 1회 load 후 const 참조만 사용 (RCU reader, lock 없음)
  * ------------------------------------------------------
  */
 
+#include <sys/time.h>
+
 #include "CT10_Control_041.h"
 
 // 외부 전역(프로젝트 기존 전역 PWM 가정)
 extern CL_P10_PWM g_P10_pwm;
 
+// _windCache 보호 (loop task tick ↔ web task override 시작), 조회/등록 구간만
+static portMUX_TYPE s_windMux = portMUX_INITIALIZER_UNLOCKED;
+
 bool CL_CT10_ControlManager::begin() {
 	instance().begin(g_P10_pwm);
 	return true;
@@ -42,7 +51,8 @@ void CL_CT10_ControlManager::clearManual() {
 }
 
 bool CL_CT10_ControlManager::reloadAll() {
-	bool v_ok = CL_C10_ConfigManager::loadAll(g_A20_config_root);
+	// 새 세대 로드 → publish (tick 중인 reader는 이전 세대 계속 사용)
+	bool v_ok = CL_C10_ConfigManager::reloadAll();
 	if (!v_ok)
 		return false;
 
@@ -60,7 +70,8 @@ bool CL_CT10_ControlManager::reloadAll() {
 	v_inst.scheduleSegRt.index = -1;
 	v_inst.profileSegRt.index  = -1;
 
-	v_inst.sim.stop();
+	v_inst.simCmdStop();
+	v_inst.notifyControlEvent();
 
 	v_inst.markDirty("state");
 	v_inst.markDirty("metrics");
@@ -88,8 +99,20 @@ void CL_CT10_ControlManager::begin(CL_P10_PWM& p_pwm) {
 	lastTickMs			= 0;
 	lastMetricsPushMs	= 0;
 
+	// deadline 테이블: 첫 tick에서 전체 판정
+	memset(&_deadline, 0, sizeof(_deadline));
+	_dlSchedulesGen		= CL_C10_ConfigManager::schedulesGen();
+	_dlPresence			= motion ? motion->isActive() : false;
+	_loopTaskHandle		= xTaskGetCurrentTaskHandle();	// begin()은 A00 setup(loop task)에서 호출
+	_ctlEventPending	= true;
+
 	sim.begin(p_pwm);
 
+	// (옵션) S10 전용 task 모드: 실패 시 loop 구동 유지
+	if (G_CT10_SIM_TASK_ENABLE) {
+		startSimTask();
+	}
+
 	active = true;
 
 	markDirty("state");
@@ -117,6 +140,8 @@ void CL_CT10_ControlManager::setProfileMode(bool p_profileMode) {
 		}
 	}
 
+	notifyControlEvent();
+
 	markDirty("state");
 	markDirty("metrics");
 
@@ -124,10 +149,11 @@ void CL_CT10_ControlManager::setProfileMode(bool p_profileMode) {
 }
 
 bool CL_CT10_ControlManager::startUserProfileByNo(uint8_t p_profileNo) {
-	if (!g_A20_config_root.userProfiles)
+	const ST_A20_UserProfilesRoot_t* v_cfgP = C10_rcuRead(g_A20_config_root.userProfiles);
+	if (!v_cfgP)
 		return false;
 
-	ST_A20_UserProfilesRoot_t& v_cfg = *g_A20_config_root.userProfiles;
+	const ST_A20_UserProfilesRoot_t& v_cfg = *v_cfgP;
 
 	for (uint8_t v_i = 0; v_i < v_cfg.count; v_i++) {
 		const ST_A20_UserProfileItem_t& v_p = v_cfg.items[v_i];
@@ -143,6 +169,7 @@ bool CL_CT10_ControlManager::startUserProfileByNo(uint8_t p_profileNo) {
 			profileSegRt.loopCount	  = 0;
 
 			initAutoOffFromUserProfile(v_p);
+			notifyControlEvent();
 
 			CL_D10_Logger::log(EN_L10_LOG_INFO, "[CT10] Start UserProfile #%u (%s)", (unsigned)p_profileNo, v_p.name);
 
@@ -163,7 +190,8 @@ void CL_CT10_ControlManager::stopUserProfile() {
 	curProfileIndex	   = -1;
 	profileSegRt.index = -1;
 
-	sim.stop();
+	simCmdStop();
+	notifyControlEvent();
 
 	markDirty("state");
 	markDirty("metrics");
@@ -180,6 +208,7 @@ void CL_CT10_ControlManager::startOverrideFixed(float p_percent, uint32_t p_seco
 	overrideState.useFixed	   = true;
 	overrideState.fixedPercent = constrain(p_percent, 0.0f, 100.0f);
 	overrideState.endMs		   = (p_seconds > 0) ? (millis() + (p_seconds * 1000UL)) : 0;
+	notifyControlEvent();
 
 	markDirty("state");
 	markDirty("metrics");
@@ -188,13 +217,19 @@ void CL_CT10_ControlManager::startOverrideFixed(float p_percent, uint32_t p_seco
 }
 
 void CL_CT10_ControlManager::startOverridePreset(const char* p_presetCode, const char* p_styleCode, const ST_A20_AdjustDelta_t* p_adj, uint32_t p_seconds) {
-	if (!g_A20_config_root.windDict)
+	// 세대 → 포인터 순 load (캐시 키 일관성)
+	const uint32_t					v_dictGen = CL_C10_ConfigManager::windDictGen();
+	const ST_A20_WindProfileDict_t* v_dict	  = C10_rcuRead(g_A20_config_root.windDict);
+	if (!v_dict)
 		return;
 
 	ST_A20_ResolvedWind_t v_resolved;
 	memset(&v_resolved, 0, sizeof(v_resolved));
 
-	bool v_ok = S20_resolveWindParams(*g_A20_config_root.windDict, p_presetCode, p_styleCode, p_adj, v_resolved);
+	// web task 1회성 호출: intern 테이블(loop task 전용) 미사용, dict 직접 코드 검색
+	const int16_t v_pi = A20_findPresetIndexByCode(*v_dict, p_presetCode);
+	const int16_t v_si = (p_styleCode && p_styleCode[0]) ? A20_findStyleIndexByCode(*v_dict, p_styleCode) : (int16_t)-1;
+	bool		  v_ok = resolveWindShared(*v_dict, v_dictGen, v_pi, v_si, p_adj, v_resolved);
 
 	if (!v_ok || !v_resolved.valid) {
 		CL_D10_Logger::log(EN_L10_LOG_WARN, "[CT10] startOverridePreset resolve failed (%s,%s)", p_presetCode ? p_presetCode : "", p_styleCode ? p_styleCode : "");
@@ -222,6 +257,7 @@ void CL_CT10_ControlManager::applyManualResolved(const ST_A20_ResolvedWind_t& p_
 	overrideState.fixedPercent	  = 0.0f;
 	overrideState.resolved		  = p_wind;
 	overrideState.endMs			  = (p_seconds > 0) ? (millis() + (p_seconds * 1000UL)) : 0;
+	notifyControlEvent();
 
 	markDirty("state");
 	markDirty("metrics");
@@ -235,6 +271,7 @@ void CL_CT10_ControlManager::stopOverride() {
 		return;
 
 	memset(&overrideState, 0, sizeof(overrideState));
+	notifyControlEvent();
 
 	markDirty("state");
 	markDirty("metrics");
@@ -254,9 +291,33 @@ void CL_CT10_ControlManager::tickLoop() {
 		return;
 	lastTickMs = v_nowMs;
 
+	// 0) deadline 미도래 + 외부 이벤트/입력 변화 없음 → 전체 판정 생략 (sim step/metrics만)
+	bool v_inputChanged = pollControlInputsChanged();
+	if (!_ctlEventPending && !v_inputChanged && !isDeadlineDue((uint32_t)v_nowMs)) {
+		_deadline.skipCount++;
+		if (simIsActive()) {
+			simCmdTick();
+		}
+		maybePushMetricsDirty();
+		return;
+	}
+
+	_ctlEventPending = false;
+	_deadline.evalCount++;
+
+	tickControl();
+
+	// 판정 결과(상태 전이 반영) 기준으로 다음 due 재등록
+	rearmDeadlines((uint32_t)millis());
+}
+
+// --------------------------------------------------
+// 전체 판정 (Override → Profile → Schedule 우선순위)
+// --------------------------------------------------
+void CL_CT10_ControlManager::tickControl() {
 	// 1) Override
 	if (tickOverride()) {
-		sim.tick();
+		simCmdTick();
 		maybePushMetricsDirty();
 		return;
 	}
@@ -264,10 +325,10 @@ void CL_CT10_ControlManager::tickLoop() {
 	// 2) Profile 전용 모드
 	if (useProfileMode) {
 		if (runSource == EN_CT10_RUN_USER_PROFILE && tickUserProfile()) {
-			sim.tick();
+			simCmdTick();
 			maybePushMetricsDirty();
-		} else if (sim.active) {
-			sim.stop();
+		} else if (simIsActive()) {
+			simCmdStop();
 			maybePushMetricsDirty();
 		}
 		return;
@@ -275,14 +336,14 @@ void CL_CT10_ControlManager::tickLoop() {
 
 	// 3) UserProfile(스케줄과 별개로 실행)
 	if (runSource == EN_CT10_RUN_USER_PROFILE && tickUserProfile()) {
-		sim.tick();
+		simCmdTick();
 		maybePushMetricsDirty();
 		return;
 	}
 
 	// 4) Schedule
 	if (tickSchedule()) {
-		sim.tick();
+		simCmdTick();
 		// ✅ chart dirty는 applySegmentOn/off, override 적용, sim 내부 변화에서만 발생하도록
 		// markDirty("chart");
 		maybePushMetricsDirty();
@@ -290,13 +351,188 @@ void CL_CT10_ControlManager::tickLoop() {
 	}
 
 	// 5) 아무 소스도 없는데 sim이 켜져 있으면 정지
-	if (sim.active) {
-		sim.stop();
+	if (simIsActive()) {
+		simCmdStop();
 		maybePushMetricsDirty();
 		markDirty("state");
 	}
 }
 
+// --------------------------------------------------
+// deadline 구동
+// --------------------------------------------------
+void CL_CT10_ControlManager::notifyControlEvent() {
+	_ctlEventPending = true;
+
+	// 다른 task(Web/BLE 콜백)에서 호출 시 loop 대기 즉시 해제
+	if (_loopTaskHandle && xTaskGetCurrentTaskHandle() != _loopTaskHandle) {
+		xTaskNotifyGive(_loopTaskHandle);
+	}
+}
+
+uint32_t CL_CT10_ControlManager::msUntilNextWake() const {
+	if (!active || !pwm)
+		return G_CT10_DL_IDLE_MAX_MS;
+
+	uint32_t v_nowMs	 = (uint32_t)millis();
+	int32_t	 v_gateLeft	 = (int32_t)((uint32_t)lastTickMs + S_TICK_MIN_INTERVAL_MS - v_nowMs);
+	if (v_gateLeft < 0)
+		v_gateLeft = 0;
+
+	// 이벤트 대기 중이거나 loop 모드 sim 구동 중이면 tick 주기가 상한
+	if (_ctlEventPending || (!simTaskMode && sim.active))
+		return (uint32_t)v_gateLeft;
+
+	int32_t v_left = (int32_t)(_deadline.nextMs - v_nowMs);
+	if (v_left < v_gateLeft)
+		v_left = v_gateLeft;
+	if ((uint32_t)v_left > G_CT10_DL_IDLE_MAX_MS)
+		v_left = (int32_t)G_CT10_DL_IDLE_MAX_MS;
+	return (uint32_t)v_left;
+}
+
+void CL_CT10_ControlManager::armDeadline(EN_CT10_deadline_t p_id, uint32_t p_dueMs) {
+	_deadline.armed[p_id] = true;
+	_deadline.dueMs[p_id] = p_dueMs;
+}
+
+bool CL_CT10_ControlManager::isDeadlineDue(uint32_t p_nowMs) const {
+	return (int32_t)(p_nowMs - _deadline.nextMs) >= 0;
+}
+
+// 판정 생략 중에도 감시해야 하는 외부 입력 (폴링 비용 낮음)
+bool CL_CT10_ControlManager::pollControlInputsChanged() {
+	bool v_changed = false;
+
+	uint32_t v_gen = CL_C10_ConfigManager::schedulesGen();
+	if (v_gen != _dlSchedulesGen) {
+		_dlSchedulesGen = v_gen;
+		v_changed		= true;
+	}
+
+	bool v_presence = motion ? motion->isActive() : false;
+	if (v_presence != _dlPresence) {
+		_dlPresence = v_presence;
+		v_changed	= true;
+	}
+
+	return v_changed;
+}
+
+// 현재 tick에서 진행 중인 segment runtime + on/off 분 (없으면 nullptr)
+const ST_CT10_SegmentRuntime_t* CL_CT10_ControlManager::activeSegmentPhase(uint16_t& p_onMin, uint16_t& p_offMin) const {
+	p_onMin	 = 0;
+	p_offMin = 0;
+
+	if (runSource == EN_CT10_RUN_USER_PROFILE) {
+		const ST_A20_UserProfilesRoot_t* v_cfgP = C10_rcuRead(g_A20_config_root.userProfiles);
+		if (!v_cfgP || curProfileIndex < 0)
+			return nullptr;
+		const ST_A20_UserProfilesRoot_t& v_cfg = *v_cfgP;
+		if ((uint8_t)curProfileIndex >= v_cfg.count)
+			return nullptr;
+		const ST_A20_UserProfileItem_t& v_p = v_cfg.items[(uint8_t)curProfileIndex];
+		if (profileSegRt.index >= 0 && (uint8_t)profileSegRt.index < v_p.segCount) {
+			p_onMin	 = v_p.segments[(uint8_t)profileSegRt.index].onMinutes;
+			p_offMin = v_p.segments[(uint8_t)profileSegRt.index].offMinutes;
+		}
+		return &profileSegRt;
+	}
+
+	if (runSource == EN_CT10_RUN_SCHEDULE && !useProfileMode) {
+		const ST_A20_SchedulesRoot_t* v_cfgP = C10_rcuRead(g_A20_config_root.schedules);
+		if (!v_cfgP || curScheduleIndex < 0)
+			return nullptr;
+		const ST_A20_SchedulesRoot_t& v_cfg = *v_cfgP;
+		if ((uint8_t)curScheduleIndex >= v_cfg.count)
+			return nullptr;
+		const ST_A20_ScheduleItem_t& v_s = v_cfg.items[(uint8_t)curScheduleIndex];
+		if (scheduleSegRt.index >= 0 && (uint8_t)scheduleSegRt.index < v_s.segCount) {
+			p_onMin	 = v_s.segments[(uint8_t)scheduleSegRt.index].onMinutes;
+			p_offMin = v_s.segments[(uint8_t)scheduleSegRt.index].offMinutes;
+		}
+		return &scheduleSegRt;
+	}
+
+	return nullptr;
+}
+
+// 전체 판정 직후 호출: 각 항목의 다음 due 등록 → 가장 이른 due 산출
+void CL_CT10_ControlManager::rearmDeadlines(uint32_t p_nowMs) {
+	memset(_deadline.armed, 0, sizeof(_deadline.armed));
+
+	// 1) override 종료
+	if (overrideState.active && overrideState.endMs != 0) {
+		armDeadline(EN_CT10_DL_OVERRIDE, (uint32_t)overrideState.endMs);
+	}
+
+	// 2) segment phase / AutoOff (override 중에는 source 판정 자체가 생략됨)
+	if (!overrideState.active && runSource != EN_CT10_RUN_NONE) {
+		uint16_t						v_onMin	 = 0;
+		uint16_t						v_offMin = 0;
+		const ST_CT10_SegmentRuntime_t* v_rt	 = activeSegmentPhase(v_onMin, v_offMin);
+
+		if (v_rt) {
+			if (v_rt->index < 0) {
+				armDeadline(EN_CT10_DL_SEGMENT, p_nowMs);  // 시작 대기
+			} else if (v_rt->onPhase && v_onMin > 0) {
+				armDeadline(EN_CT10_DL_SEGMENT, (uint32_t)v_rt->phaseStartMs + (uint32_t)v_onMin * 60000UL);
+			} else if (!v_rt->onPhase && v_offMin > 0) {
+				armDeadline(EN_CT10_DL_SEGMENT, (uint32_t)v_rt->phaseStartMs + (uint32_t)v_offMin * 60000UL);
+			}
+		}
+
+		if (autoOffRt.timerArmed && autoOffRt.timerMinutes > 0) {
+			armDeadline(EN_CT10_DL_AUTOOFF_TIMER, (uint32_t)autoOffRt.timerStartMs + autoOffRt.timerMinutes * 60000UL);
+		}
+
+		if (autoOffRt.offTimeEnabled) {
+			time_t	   v_t		 = time(nullptr);
+			struct tm* v_localTm = localtime(&v_t);
+			if (v_localTm) {
+				int32_t v_curSec = (int32_t)v_localTm->tm_hour * 3600 + (int32_t)v_localTm->tm_min * 60 + (int32_t)v_localTm->tm_sec;
+				int32_t v_offSec = (int32_t)autoOffRt.offTimeMinutes * 60;
+				// 이미 지난 시각이면 즉시(checkAutoOff 분 단위 비교와 동일 의미)
+				uint32_t v_waitMs = (v_curSec >= v_offSec) ? 0u : (uint32_t)(v_offSec - v_curSec) * 1000UL;
+				armDeadline(EN_CT10_DL_AUTOOFF_TIME, p_nowMs + v_waitMs);
+			}
+		}
+
+		if (autoOffRt.offTempEnabled) {
+			armDeadline(EN_CT10_DL_AUTOOFF_TEMP, p_nowMs + G_CT10_DL_TEMP_ITV_MS);
+		}
+	}
+
+	// 3) schedule 구간 전이 (주간 테이블 판정 캐시의 nextChangeAt)
+	//    - tickSchedule이 실제 판정되는 경로(override/profile 미실행)에서만 등록
+	if (!useProfileMode && !overrideState.active && runSource != EN_CT10_RUN_USER_PROFILE && g_A20_config_root.schedules && _schTbl.evalValid) {
+		struct timeval v_tv;
+		gettimeofday(&v_tv, nullptr);
+		int64_t v_leftMs = (int64_t)(_schTbl.nextChangeAt - v_tv.tv_sec) * 1000LL - (int64_t)(v_tv.tv_usec / 1000);
+		if (v_leftMs < 0)
+			v_leftMs = 0;
+		if (v_leftMs > (int64_t)G_CT10_DL_IDLE_MAX_MS)
+			v_leftMs = (int64_t)G_CT10_DL_IDLE_MAX_MS;
+		armDeadline(EN_CT10_DL_SCHEDULE, p_nowMs + (uint32_t)v_leftMs);
+	}
+
+	// 4) 안전망
+	armDeadline(EN_CT10_DL_IDLE, p_nowMs + G_CT10_DL_IDLE_MAX_MS);
+
+	// 가장 이른 due (항목 수 고정/소수 → 선형 min)
+	int32_t v_minLeft = (int32_t)G_CT10_DL_IDLE_MAX_MS;
+	for (uint8_t v_i = 0; v_i < (uint8_t)EN_CT10_DL_COUNT; v_i++) {
+		if (!_deadline.armed[v_i])
+			continue;
+		int32_t v_left = (int32_t)(_deadline.dueMs[v_i] - p_nowMs);
+		if (v_left < v_minLeft)
+			v_minLeft = v_left;
+	}
+	if (v_minLeft < 0)
+		v_minLeft = 0;
+	_deadline.nextMs = p_nowMs + (uint32_t)v_minLeft;
+}
+
 // --------------------------------------------------
 // override tick
 // --------------------------------------------------
@@ -317,10 +553,7 @@ bool CL_CT10_ControlManager::tickOverride() {
 
 	// fixed
 	if (overrideState.useFixed) {
-		sim.stop();
-		if (pwm) {
-			pwm->P10_setDutyPercent(overrideState.fixedPercent);
-		}
+		simCmdFixedDuty(overrideState.fixedPercent);
 		return true;
 	}
 
@@ -334,7 +567,7 @@ bool CL_CT10_ControlManager::tickOverride() {
 	}
 
 	if (!overrideState.resolvedApplied) {
-		sim.applyResolvedWind(overrideState.resolved);
+		simCmdApply(overrideState.resolved);
 		overrideState.resolvedApplied = true;
 		markDirty("chart");
 	}
@@ -346,21 +579,22 @@ bool CL_CT10_ControlManager::tickOverride() {
 // userProfiles tick
 // --------------------------------------------------
 bool CL_CT10_ControlManager::tickUserProfile() {
-	if (!g_A20_config_root.userProfiles)
+	const ST_A20_UserProfilesRoot_t* v_cfgP = C10_rcuRead(g_A20_config_root.userProfiles);
+	if (!v_cfgP)
 		return false;
 	if (curProfileIndex < 0)
 		return false;
 
-	ST_A20_UserProfilesRoot_t& v_cfg = *g_A20_config_root.userProfiles;
+	const ST_A20_UserProfilesRoot_t& v_cfg = *v_cfgP;
 	if ((uint8_t)curProfileIndex >= v_cfg.count)
 		return false;
 
-	ST_A20_UserProfileItem_t& v_profile = v_cfg.items[(uint8_t)curProfileIndex];
+	const ST_A20_UserProfileItem_t& v_profile = v_cfg.items[(uint8_t)curProfileIndex];
 	if (!v_profile.enabled || v_profile.segCount == 0)
 		return false;
 
 	if (checkAutoOff()) {
-		sim.stop();
+		simCmdStop();
 		runSource		= EN_CT10_RUN_NONE;
 		curProfileIndex = -1;
 
@@ -371,7 +605,7 @@ bool CL_CT10_ControlManager::tickUserProfile() {
 	}
 
 	if (isMotionBlocked(v_profile.motion)) {
-		sim.stop();
+		simCmdStop();
 		return true;
 	}
 
@@ -382,10 +616,11 @@ bool CL_CT10_ControlManager::tickUserProfile() {
 // schedule tick
 // --------------------------------------------------
 bool CL_CT10_ControlManager::tickSchedule() {
-	if (!g_A20_config_root.schedules)
+	const ST_A20_SchedulesRoot_t* v_cfgP = C10_rcuRead(g_A20_config_root.schedules);
+	if (!v_cfgP)
 		return false;
 
-	ST_A20_SchedulesRoot_t& v_cfg		= *g_A20_config_root.schedules;
+	const ST_A20_SchedulesRoot_t& v_cfg		= *v_cfgP;
 
 	int						v_activeIdx = findActiveScheduleIndex(v_cfg);
 	if (v_activeIdx < 0) {
@@ -409,12 +644,12 @@ bool CL_CT10_ControlManager::tickSchedule() {
 		markDirty("metrics");
 	}
 
-	ST_A20_ScheduleItem_t& v_schedule = v_cfg.items[(uint8_t)curScheduleIndex];
+	const ST_A20_ScheduleItem_t& v_schedule = v_cfg.items[(uint8_t)curScheduleIndex];
 	if (!v_schedule.enabled || v_schedule.segCount == 0)
 		return false;
 
 	if (checkAutoOff()) {
-		sim.stop();
+		simCmdStop();
 		runSource		 = EN_CT10_RUN_NONE;
 		curScheduleIndex = -1;
 
@@ -425,7 +660,7 @@ bool CL_CT10_ControlManager::tickSchedule() {
 	}
 
 	if (isMotionBlocked(v_schedule.motion)) {
-		sim.stop();
+		simCmdStop();
 		return true;
 	}
 
@@ -435,29 +670,32 @@ bool CL_CT10_ControlManager::tickSchedule() {
 // --------------------------------------------------
 // segment sequence (schedule)
 // --------------------------------------------------
-bool CL_CT10_ControlManager::tickSegmentSequence(bool p_repeat, uint8_t p_repeatCount, ST_A20_ScheduleSegment_t* p_segs, uint8_t p_count, ST_CT10_SegmentRuntime_t& p_rt) {
+bool CL_CT10_ControlManager::tickSegmentSequence(bool p_repeat, uint8_t p_repeatCount, const ST_A20_ScheduleSegment_t* p_segs, uint8_t p_count, ST_CT10_SegmentRuntime_t& p_rt) {
 	unsigned long v_nowMs = millis();
 
 	if (p_count == 0 || !p_segs) {
-		sim.stop();
+		simCmdStop();
 		return false;
 	}
 
+	// 설정 세대 변경 시에만 코드 intern 재구성 (segment 전환 시 문자열 비교 없음)
+	internSegmentWind(p_segs, p_count, p_rt.wind);
+
 	if (p_rt.index < 0) {
 		p_rt.index		  = 0;
 		p_rt.onPhase	  = true;
 		p_rt.phaseStartMs = v_nowMs;
 		p_rt.loopCount	  = 0;
-		applySegmentOn(p_segs[0]);
+		applySegmentOn(p_segs, p_count, 0, p_rt);
 		return true;
 	}
 
 	if ((uint8_t)p_rt.index >= p_count) {
-		sim.stop();
+		simCmdStop();
 		return false;
 	}
 
-	ST_A20_ScheduleSegment_t& v_seg	  = p_segs[(uint8_t)p_rt.index];
+	const ST_A20_ScheduleSegment_t& v_seg	  = p_segs[(uint8_t)p_rt.index];
 
 	uint32_t				  v_onMs  = (uint32_t)v_seg.onMinutes * 60000UL;
 	uint32_t				  v_offMs = (uint32_t)v_seg.offMinutes * 60000UL;
@@ -471,13 +709,13 @@ bool CL_CT10_ControlManager::tickSegmentSequence(bool p_repeat, uint8_t p_repeat
 
 		if ((uint8_t)p_rt.index >= p_count) {
 			if (!p_repeat) {
-				sim.stop();
+				simCmdStop();
 				return true;
 			}
 
 			if (p_repeatCount > 0) {
 				if (p_rt.loopCount + 1 >= p_repeatCount) {
-					sim.stop();
+					simCmdStop();
 					return true;
 				}
 				p_rt.loopCount++;
@@ -488,7 +726,7 @@ bool CL_CT10_ControlManager::tickSegmentSequence(bool p_repeat, uint8_t p_repeat
 
 		p_rt.onPhase	  = true;
 		p_rt.phaseStartMs = v_nowMs;
-		applySegmentOn(p_segs[(uint8_t)p_rt.index]);
+		applySegmentOn(p_segs, p_count, (uint8_t)p_rt.index, p_rt);
 	}
 
 	return true;
@@ -497,29 +735,32 @@ bool CL_CT10_ControlManager::tickSegmentSequence(bool p_repeat, uint8_t p_repeat
 // --------------------------------------------------
 // segment sequence (profile)
 // --------------------------------------------------
-bool CL_CT10_ControlManager::tickSegmentSequence(bool p_repeat, uint8_t p_repeatCount, ST_A20_UserProfileSegment_t* p_segs, uint8_t p_count, ST_CT10_SegmentRuntime_t& p_rt) {
+bool CL_CT10_ControlManager::tickSegmentSequence(bool p_repeat, uint8_t p_repeatCount, const ST_A20_UserProfileSegment_t* p_segs, uint8_t p_count, ST_CT10_SegmentRuntime_t& p_rt) {
 	unsigned long v_nowMs = millis();
 
 	if (p_count == 0 || !p_segs) {
-		sim.stop();
+		simCmdStop();
 		return false;
 	}
 
+	// 설정 세대 변경 시에만 코드 intern 재구성 (segment 전환 시 문자열 비교 없음)
+	internSegmentWind(p_segs, p_count, p_rt.wind);
+
 	if (p_rt.index < 0) {
 		p_rt.index		  = 0;
 		p_rt.onPhase	  = true;
 		p_rt.phaseStartMs = v_nowMs;
 		p_rt.loopCount	  = 0;
-		applySegmentOn(p_segs[0]);
+		applySegmentOn(p_segs, p_count, 0, p_rt);
 		return true;
 	}
 
 	if ((uint8_t)p_rt.index >= p_count) {
-		sim.stop();
+		simCmdStop();
 		return false;
 	}
 
-	ST_A20_UserProfileSegment_t& v_seg	 = p_segs[(uint8_t)p_rt.index];
+	const ST_A20_UserProfileSegment_t& v_seg	 = p_segs[(uint8_t)p_rt.index];
 
 	uint32_t					 v_onMs	 = (uint32_t)v_seg.onMinutes * 60000UL;
 	uint32_t					 v_offMs = (uint32_t)v_seg.offMinutes * 60000UL;
@@ -533,13 +774,13 @@ bool CL_CT10_ControlManager::tickSegmentSequence(bool p_repeat, uint8_t p_repeat
 
 		if ((uint8_t)p_rt.index >= p_count) {
 			if (!p_repeat) {
-				sim.stop();
+				simCmdStop();
 				return true;
 			}
 
 			if (p_repeatCount > 0) {
 				if (p_rt.loopCount + 1 >= p_repeatCount) {
-					sim.stop();
+					simCmdStop();
 					return true;
 				}
 				p_rt.loopCount++;
@@ -550,92 +791,189 @@ bool CL_CT10_ControlManager::tickSegmentSequence(bool p_repeat, uint8_t p_repeat
 
 		p_rt.onPhase	  = true;
 		p_rt.phaseStartMs = v_nowMs;
-		applySegmentOn(p_segs[(uint8_t)p_rt.index]);
+		applySegmentOn(p_segs, p_count, (uint8_t)p_rt.index, p_rt);
 	}
 
 	return true;
 }
 
 // --------------------------------------------------
-// apply segment on/off + 로그 개선(이름 출력)
+// segment 코드 intern
+//  - 키(segments 배열 / dict / configGen) 일치 시 즉시 반환
+//  - 재구성: dict 코드 해시 테이블(S20) 조회 → preset/style 인덱스 고정
 // --------------------------------------------------
-void CL_CT10_ControlManager::applySegmentOn(const ST_A20_ScheduleSegment_t& p_seg) {
-	if (!g_A20_config_root.windDict)
+bool CL_CT10_ControlManager::windIdxStale(const void* p_src, ST_CT10_SegWindIdx_t& p_idx) {
+	// 세대 → 포인터 순 load (세대가 같으면 섹션 교체 없음)
+	const uint32_t					v_cfgGen  = CL_C10_ConfigManager::configGen();
+	const uint32_t					v_dictGen = CL_C10_ConfigManager::windDictGen();
+	const ST_A20_WindProfileDict_t* v_dict	  = C10_rcuRead(g_A20_config_root.windDict);
+
+	if (p_idx.src == p_src && p_idx.dict == v_dict && p_idx.cfgGen == v_cfgGen)
+		return false;
+
+	p_idx.src	  = p_src;
+	p_idx.dict	  = v_dict;
+	p_idx.cfgGen  = v_cfgGen;
+	p_idx.dictGen = v_dictGen;
+	memset(p_idx.preset, -1, sizeof(p_idx.preset));
+	memset(p_idx.style, -1, sizeof(p_idx.style));
+	_windInterns++;
+	return true;
+}
+
+// intern 테이블은 loop task(tick) 전용 → 잠금 없음
+void CL_CT10_ControlManager::internSegmentWind(const ST_A20_ScheduleSegment_t* p_segs, uint8_t p_count, ST_CT10_SegWindIdx_t& p_idx) {
+	if (!windIdxStale(p_segs, p_idx) || !p_idx.dict)
 		return;
 
-	if (p_seg.mode == EN_A20_SEG_MODE_FIXED) {
-		sim.stop();
-		if (pwm) {
-			pwm->P10_setDutyPercent(p_seg.fixedSpeed);
-		}
+	if (S20_internWindCodes(_windCodes, *p_idx.dict, p_idx.dictGen)) _windCodeBuilds++;
+	for (uint8_t v_i = 0; v_i < p_count && v_i < G_CT10_SEG_MAX; v_i++) {
+		p_idx.preset[v_i] = (int8_t)S20_findPresetIdx(_windCodes, p_segs[v_i].presetCode);
+		p_idx.style[v_i]  = (int8_t)S20_findStyleIdx(_windCodes, p_segs[v_i].styleCode);
+	}
+}
+
+void CL_CT10_ControlManager::internSegmentWind(const ST_A20_UserProfileSegment_t* p_segs, uint8_t p_count, ST_CT10_SegWindIdx_t& p_idx) {
+	if (!windIdxStale(p_segs, p_idx) || !p_idx.dict)
+		return;
+
+	if (S20_internWindCodes(_windCodes, *p_idx.dict, p_idx.dictGen)) _windCodeBuilds++;
+	for (uint8_t v_i = 0; v_i < p_count && v_i < G_CT10_SEG_MAX; v_i++) {
+		p_idx.preset[v_i] = (int8_t)S20_findPresetIdx(_windCodes, p_segs[v_i].presetCode);
+		p_idx.style[v_i]  = (int8_t)S20_findStyleIdx(_windCodes, p_segs[v_i].styleCode);
+	}
+}
+
+// 공유 ResolvedWind 캐시 해석 (loop task tick ↔ web task override)
+//  - 키 구성/해석(solve)은 잠금 밖, s_windMux 구간은 키 비교 + 결과 복사(조회) / 슬롯 기록(등록)만
+bool CL_CT10_ControlManager::resolveWindShared(const ST_A20_WindProfileDict_t& p_dict, uint32_t p_dictGen, int16_t p_presetIdx, int16_t p_styleIdx, const ST_A20_AdjustDelta_t* p_adj, ST_A20_ResolvedWind_t& p_out) {
+	ST_S20_WindCacheKey_t v_key;
+	if (!S20_windCacheKey(p_dict, p_dictGen, p_presetIdx, p_styleIdx, p_adj, v_key)) {
+		memset(&p_out, 0, sizeof(p_out));
+		p_out.valid = false;
+		return false;
+	}
+
+	portENTER_CRITICAL(&s_windMux);
+	const bool v_hit = S20_windCacheLookup(_windCache, v_key, p_out);
+	portEXIT_CRITICAL(&s_windMux);
+	if (v_hit) return true;
+
+	if (!S20_resolveWindByIndex(p_dict, v_key.presetIdx, v_key.styleIdx, &v_key.adj, p_out)) return false;
+
+	portENTER_CRITICAL(&s_windMux);
+	S20_windCacheInsert(_windCache, v_key, p_out);
+	portEXIT_CRITICAL(&s_windMux);
+	return true;
+}
+
+// intern 시점 dict 세대로 해석 (retire 되어도 grace 내 유효)
+bool CL_CT10_ControlManager::resolveSegmentWind(const ST_CT10_SegWindIdx_t& p_idx, uint8_t p_i, const ST_A20_AdjustDelta_t& p_adj, ST_A20_ResolvedWind_t& p_out) {
+	if (!p_idx.dict || p_i >= G_CT10_SEG_MAX)
+		return false;
+
+	return resolveWindShared(*p_idx.dict, p_idx.dictGen, p_idx.preset[p_i], p_idx.style[p_i], &p_adj, p_out);
+}
+
+void CL_CT10_ControlManager::windCacheStatsToJson(JsonObject p_obj) {
+	uint32_t v_hits, v_misses, v_evict;
+	uint8_t	 v_used = 0;
+
+	portENTER_CRITICAL(&s_windMux);
+	v_hits	 = _windCache.hits;
+	v_misses = _windCache.misses;
+	v_evict	 = _windCache.evictions;
+	for (uint8_t v_i = 0; v_i < G_S20_WIND_CACHE_SIZE; v_i++) {
+		if (_windCache.entry[v_i].valid) v_used++;
+	}
+	portEXIT_CRITICAL(&s_windMux);
+
+	p_obj["dictGen"]	= CL_C10_ConfigManager::windDictGen();
+	p_obj["size"]		= (uint8_t)G_S20_WIND_CACHE_SIZE;
+	p_obj["used"]		= v_used;
+	p_obj["hits"]		= v_hits;
+	p_obj["misses"]		= v_misses;
+	p_obj["evictions"]	= v_evict;
+	p_obj["interns"]	= _windInterns;
+	p_obj["codeBuilds"] = _windCodeBuilds;
+}
+
+// --------------------------------------------------
+// apply segment on/off + 로그 개선(이름 출력)
+// --------------------------------------------------
+void CL_CT10_ControlManager::applySegmentOn(const ST_A20_ScheduleSegment_t* p_segs, uint8_t p_count, uint8_t p_i, ST_CT10_SegmentRuntime_t& p_rt) {
+	const ST_A20_ScheduleSegment_t& v_seg = p_segs[p_i];
+
+	if (v_seg.mode == EN_A20_SEG_MODE_FIXED) {
+		simCmdFixedDuty(v_seg.fixedSpeed);
 
 		markDirty("state");
 		markDirty("chart");
 
-		CL_D10_Logger::log(EN_L10_LOG_INFO, "[CT10] SegmentOn(SCH) FIXED duty=%.1f%%", p_seg.fixedSpeed);
+		CL_D10_Logger::log(EN_L10_LOG_INFO, "[CT10] SegmentOn(SCH) FIXED duty=%.1f%%", v_seg.fixedSpeed);
 		return;
 	}
 
+	// 같은 tick 내 설정 publish 경합 시에만 재구성
+	internSegmentWind(p_segs, p_count, p_rt.wind);
+	if (!p_rt.wind.dict)
+		return;
+
 	ST_A20_ResolvedWind_t v_resolved;
 	memset(&v_resolved, 0, sizeof(v_resolved));
 
-	bool v_ok = S20_resolveWindParams(*g_A20_config_root.windDict, p_seg.presetCode, p_seg.styleCode, &p_seg.adjust, v_resolved);
+	bool v_ok = resolveSegmentWind(p_rt.wind, p_i, v_seg.adjust, v_resolved);
 
 	if (v_ok && v_resolved.valid) {
-		sim.applyResolvedWind(v_resolved);
+		simCmdApply(v_resolved);
 
 		markDirty("state");
 		markDirty("chart");
 
-		const char* v_presetName = findPresetNameByCode(p_seg.presetCode);
-		const char* v_styleName	 = findStyleNameByCode(p_seg.styleCode);
-
 		// (요청사항) applySegmentOn 로그포맷: 이름 출력
-		CL_D10_Logger::log(EN_L10_LOG_INFO, "[CT10] SegmentOn(SCH) PRESET=%s(%s) STYLE=%s(%s) on=%u off=%u", p_seg.presetCode, v_presetName, p_seg.styleCode, v_styleName, (unsigned)p_seg.onMinutes, (unsigned)p_seg.offMinutes);
+		CL_D10_Logger::log(EN_L10_LOG_INFO, "[CT10] SegmentOn(SCH) PRESET=%s(%s) STYLE=%s(%s) on=%u off=%u", v_seg.presetCode, windPresetName(p_rt.wind, p_i), v_seg.styleCode, windStyleName(p_rt.wind, p_i), (unsigned)v_seg.onMinutes, (unsigned)v_seg.offMinutes);
 	} else {
-		CL_D10_Logger::log(EN_L10_LOG_WARN, "[CT10] SegmentOn(SCH) resolve failed preset=%s style=%s", p_seg.presetCode, p_seg.styleCode);
+		CL_D10_Logger::log(EN_L10_LOG_WARN, "[CT10] SegmentOn(SCH) resolve failed preset=%s style=%s", v_seg.presetCode, v_seg.styleCode);
 	}
 }
 
-void CL_CT10_ControlManager::applySegmentOn(const ST_A20_UserProfileSegment_t& p_seg) {
-	if (!g_A20_config_root.windDict)
-		return;
+void CL_CT10_ControlManager::applySegmentOn(const ST_A20_UserProfileSegment_t* p_segs, uint8_t p_count, uint8_t p_i, ST_CT10_SegmentRuntime_t& p_rt) {
+	const ST_A20_UserProfileSegment_t& v_seg = p_segs[p_i];
 
-	if (p_seg.mode == EN_A20_SEG_MODE_FIXED) {
-		sim.stop();
-		if (pwm) {
-			pwm->P10_setDutyPercent(p_seg.fixedSpeed);
-		}
+	if (v_seg.mode == EN_A20_SEG_MODE_FIXED) {
+		simCmdFixedDuty(v_seg.fixedSpeed);
 
 		markDirty("state");
 		markDirty("chart");
 
-		CL_D10_Logger::log(EN_L10_LOG_INFO, "[CT10] SegmentOn(PROFILE) FIXED duty=%.1f%%", p_seg.fixedSpeed);
+		CL_D10_Logger::log(EN_L10_LOG_INFO, "[CT10] SegmentOn(PROFILE) FIXED duty=%.1f%%", v_seg.fixedSpeed);
 		return;
 	}
 
+	// 같은 tick 내 설정 publish 경합 시에만 재구성
+	internSegmentWind(p_segs, p_count, p_rt.wind);
+	if (!p_rt.wind.dict)
+		return;
+
 	ST_A20_ResolvedWind_t v_resolved;
 	memset(&v_resolved, 0, sizeof(v_resolved));
 
-	bool v_ok = S20_resolveWindParams(*g_A20_config_root.windDict, p_seg.presetCode, p_seg.styleCode, &p_seg.adjust, v_resolved);
+	bool v_ok = resolveSegmentWind(p_rt.wind, p_i, v_seg.adjust, v_resolved);
 
 	if (v_ok && v_resolved.valid) {
-		sim.applyResolvedWind(v_resolved);
+		simCmdApply(v_resolved);
 
 		markDirty("state");
 		markDirty("chart");
 
-		const char* v_presetName = findPresetNameByCode(p_seg.presetCode);
-		const char* v_styleName	 = findStyleNameByCode(p_seg.styleCode);
-
-		CL_D10_Logger::log(EN_L10_LOG_INFO, "[CT10] SegmentOn(PROFILE) PRESET=%s(%s) STYLE=%s(%s) on=%u off=%u", p_seg.presetCode, v_presetName, p_seg.styleCode, v_styleName, (unsigned)p_seg.onMinutes, (unsigned)p_seg.offMinutes);
+		CL_D10_Logger::log(EN_L10_LOG_INFO, "[CT10] SegmentOn(PROFILE) PRESET=%s(%s) STYLE=%s(%s) on=%u off=%u", v_seg.presetCode, windPresetName(p_rt.wind, p_i), v_seg.styleCode, windStyleName(p_rt.wind, p_i), (unsigned)v_seg.onMinutes, (unsigned)v_seg.offMinutes);
 	} else {
-		CL_D10_Logger::log(EN_L10_LOG_WARN, "[CT10] SegmentOn(PROFILE) resolve failed preset=%s style=%s", p_seg.presetCode, p_seg.styleCode);
+		CL_D10_Logger::log(EN_L10_LOG_WARN, "[CT10] SegmentOn(PROFILE) resolve failed preset=%s style=%s", v_seg.presetCode, v_seg.styleCode);
 	}
 }
 
 void CL_CT10_ControlManager::applySegmentOff() {
-	sim.stop();
+	simCmdStop();
 	markDirty("state");
 	markDirty("chart");
 }
@@ -0,0 +1,62 @@
+/*
+ * ------------------------------------------------------
+ * 소스명 : D10_Logger_040.cpp
+ * 모듈약어 : D10
+ * 모듈명 : Smart Nature Wind Logger (v016, WebSocket + RingBuffer)
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - CL_D10_Logger 중 JSON/LittleFS/AsyncWebSocket 사용 함수 구현부
+ *   - broadcastLog  : 로그 1건 JSON 직렬화 → /ws/logs textAll + 외부 sink
+ *   - getLogsAsJson : RingBuffer 전체 → {"logs":[...]}
+ *   - saveToFile    : getLogsAsJson 결과 LittleFS 저장
+ * ------------------------------------------------------
+ */
+
+#include "D10_Logger_040.h"
+
+// --------------------------------------------------
+// WebSocket 브로드캐스트 (내부/외부 호출용)
+// --------------------------------------------------
+void CL_D10_Logger::broadcastLog(EN_L10_LogLevel_t p_level, const char* p_msg) {
+	if (!s_wsLogs && !s_logSink)
+		return;
+	JsonDocument v_doc;
+	v_doc["ts"]	 = millis();
+	v_doc["lv"]	 = (int)p_level;
+	v_doc["msg"] = p_msg;
+	String v_json;
+	serializeJson(v_doc, v_json);
+	if (s_wsLogs && s_wsLogs->count())
+		s_wsLogs->textAll(v_json);
+	if (s_logSink)
+		s_logSink(v_json.c_str(), v_json.length());
+}
+
+// --------------------------------------------------
+// 로그 전체를 JSON 형태로 내보내기
+// --------------------------------------------------
+void CL_D10_Logger::getLogsAsJson(JsonDocument& p_doc) {
+	JsonArray v_arr = p_doc["logs"].to<JsonArray>();
+	for (uint16_t v_i = 0; v_i < s_count; v_i++) {
+		uint16_t   v_idx = (s_head + v_i) % BUFFER_SIZE;
+		JsonObject v_j	 = v_arr.add<JsonObject>();
+		v_j["ts"]		 = s_buffer[v_idx].timestamp;
+		v_j["lv"]		 = (int)s_buffer[v_idx].level;
+		v_j["msg"]		 = s_buffer[v_idx].message;
+	}
+}
+
+// --------------------------------------------------
+// 로그 파일로 저장 (/json/debug.json)
+// --------------------------------------------------
+bool CL_D10_Logger::saveToFile(const char* p_path) {
+	File v_f = LittleFS.open(p_path, "w");
+	if (!v_f)
+		return false;
+
+	JsonDocument v_doc;
+	getLogsAsJson(v_doc);
+	serializeJsonPretty(v_doc, v_f);
+	v_f.close();
+	return true;
+}
@@ -10,8 +10,9 @@
  *  - INFO / WARN / ERROR / DEBUG 레벨 지원
  *  - RingBuffer(256개) 순환 로그 저장 및 JSON 조회(getLogsAsJson)
  *  - ANSI 컬러 포맷 지원 (시리얼 콘솔용)
- *  - WebSocket 연결 시 실시간 JSON 로그 전송
+ *  - WebSocket 연결 시 실시간 JSON 로그 전송 (+ 외부 sink: /ws 다중화 "logs" topic)
  *  - 로그 파일 저장(saveToFile) 및 메모리 기반 진단
+ *  - JSON/LittleFS/WebSocket 사용 함수는 D10_Logger_040.cpp 구현 (header inline은 Serial/RingBuffer만)
  * ------------------------------------------------------
  * [구현 규칙]
  *  - 항상 소스 시작 주석 부분 체계 유지 및 내용 업데이트
@@ -120,6 +121,11 @@ class CL_D10_Logger {
 		s_wsLogs = p_ws;
 	}
 
+	// 추가 로그 sink (직렬화 완료 JSON 전달, 예: W10 /ws "logs" topic 다중화)
+	static void attachLogSink(void (*p_sink)(const char* p_json, size_t p_len)) {
+		s_logSink = p_sink;
+	}
+
 	// --------------------------------------------------
 	// 로그 출력 (버퍼 저장 + Serial + WS 브로드캐스트)
 	// --------------------------------------------------
@@ -167,48 +173,12 @@ class CL_D10_Logger {
 	}
 
 	// --------------------------------------------------
-	// WebSocket 브로드캐스트 (내부/외부 호출용)
-	// --------------------------------------------------
-	static void broadcastLog(EN_L10_LogLevel_t p_level, const char* p_msg) {
-		if (!s_wsLogs)
-			return;
-		JsonDocument v_doc;
-		v_doc["ts"]	 = millis();
-		v_doc["lv"]	 = (int)p_level;
-		v_doc["msg"] = p_msg;
-		String v_json;
-		serializeJson(v_doc, v_json);
-		s_wsLogs->textAll(v_json);
-	}
-
-	// --------------------------------------------------
-	// 로그 전체를 JSON 형태로 내보내기
+	// WebSocket 브로드캐스트 / JSON 조회 / 파일 저장 (D10_Logger_040.cpp)
+	// - JSON/LittleFS/AsyncWebSocket 사용부는 TU로 분리 (header는 선언만 사용)
 	// --------------------------------------------------
-	static void getLogsAsJson(JsonDocument& p_doc) {
-		JsonArray v_arr = p_doc["logs"].to<JsonArray>();
-		for (uint16_t v_i = 0; v_i < s_count; v_i++) {
-			uint16_t   v_idx = (s_head + v_i) % BUFFER_SIZE;
-			JsonObject v_j	 = v_arr.add<JsonObject>();
-			v_j["ts"]		 = s_buffer[v_idx].timestamp;
-			v_j["lv"]		 = (int)s_buffer[v_idx].level;
-			v_j["msg"]		 = s_buffer[v_idx].message;
-		}
-	}
-
-	// --------------------------------------------------
-	// 로그 파일로 저장 (/json/debug.json)
-	// --------------------------------------------------
-	static bool saveToFile(const char* p_path = "/json/debug.json") {
-		File v_f = LittleFS.open(p_path, "w");
-		if (!v_f)
-			return false;
-
-		JsonDocument v_doc;
-		getLogsAsJson(v_doc);
-		serializeJsonPretty(v_doc, v_f);
-		v_f.close();
-		return true;
-	}
+	static void broadcastLog(EN_L10_LogLevel_t p_level, const char* p_msg);
+	static void getLogsAsJson(JsonDocument& p_doc);
+	static bool saveToFile(const char* p_path = "/json/debug.json");
 
 	// --------------------------------------------------
 	// 배너 출력
@@ -268,6 +238,7 @@ class CL_D10_Logger {
 	static bool				 _showMemUsage;
 
 	static AsyncWebSocket*	 s_wsLogs;
+	static void (*s_logSink)(const char* p_json, size_t p_len);
 	static ST_D10_LogEntry	 s_buffer[BUFFER_SIZE];
 	static uint16_t			 s_head;
 	static uint16_t			 s_count;
@@ -283,6 +254,7 @@ inline bool				 CL_D10_Logger::_showTimestamp = true;
 inline bool				 CL_D10_Logger::_showMemUsage  = false;
 
 inline AsyncWebSocket*	 CL_D10_Logger::s_wsLogs	   = nullptr;
+inline void (*CL_D10_Logger::s_logSink)(const char*, size_t) = nullptr;
 inline ST_D10_LogEntry	 CL_D10_Logger::s_buffer[BUFFER_SIZE];
 inline uint16_t			 CL_D10_Logger::s_head	= 0;
 inline uint16_t			 CL_D10_Logger::s_count = 0;
@@ -10,7 +10,7 @@
  *  - holdSec 기반 유지 로직 (최근 감지 후 일정시간 활성 유지)
  *  - BLE 신호는 외부 스캐너에서 RSSI 업데이트만 전달받음
  *  - CT10_ControlManager에서 tick() 호출 및 상태 조회
- *  - JSON 직렬화(toJson) 수행 (설정값은 g_A20_config_root.motion 참조)
+ *  - JSON 직렬화(toJson) 수행 (설정값은 g_A20_config_root.motion, 함수당 C10_rcuRead 1회 load)
  *  - 상태 변화 시 콜백(OnChange) 제공 (CT10 등에서 WebSocket diffOnly 활용 가능)
  * ------------------------------------------------------
  * [구현 규칙]
@@ -44,6 +44,7 @@
 #include <string.h>
 
 #include "A20_Const_041.h"
+#include "C10_Config_041.h"	 // C10_rcuRead
 #include "D10_Logger_040.h"
 
 // ------------------------------------------------------
@@ -112,8 +113,9 @@ class CL_M10_MotionLogic {
 	 * @param p_detected 감지 여부 (true일 경우 BLE 로직을 활성화합니다. RSSI 값은 무시)
 	 */
 	void feedBLE(bool p_detected) {
-		if (p_detected && g_A20_config_root.motion && g_A20_config_root.motion->ble.enabled) {
-			_ble.last_rssi		 = g_A20_config_root.motion->ble.rssi.on;
+		const ST_A20_MotionConfig_t* v_cfg = C10_rcuRead(g_A20_config_root.motion);
+		if (p_detected && v_cfg && v_cfg->ble.enabled) {
+			_ble.last_rssi		 = v_cfg->ble.rssi.on;
 			_ble.lastDetected_ms = millis();
 			_ble.active			 = true;
 		}
@@ -122,7 +124,8 @@ class CL_M10_MotionLogic {
 	// PIR 감지 이벤트
 	// --------------------------------------------------
 	void notifyPIRDetected() {
-		if (!g_A20_config_root.motion || !g_A20_config_root.motion->pir.enabled)
+		const ST_A20_MotionConfig_t* v_cfg = C10_rcuRead(g_A20_config_root.motion);
+		if (!v_cfg || !v_cfg->pir.enabled)
 			return;
 		_pir.lastDetected_ms = millis();
 		_pir.active			 = true;
@@ -132,11 +135,12 @@ class CL_M10_MotionLogic {
 	// BLE RSSI 입력 갱신
 	// --------------------------------------------------
 	void updateBLE_RSSI(int16_t p_rssi) {
-		if (!g_A20_config_root.motion || !g_A20_config_root.motion->ble.enabled)
+		const ST_A20_MotionConfig_t* v_cfg = C10_rcuRead(g_A20_config_root.motion);
+		if (!v_cfg || !v_cfg->ble.enabled)
 			return;
 
 		_ble.last_rssi = p_rssi;
-		if (p_rssi >= g_A20_config_root.motion->ble.rssi.on) {
+		if (p_rssi >= v_cfg->ble.rssi.on) {
 			_ble.lastDetected_ms = millis();
 			_ble.active			 = true;
 		}
@@ -146,9 +150,10 @@ class CL_M10_MotionLogic {
 	// tick 루프 (CT10에서 주기 호출)
 	// --------------------------------------------------
 	void tick() {
-		if (!g_A20_config_root.motion)
+		const ST_A20_MotionConfig_t* v_cfgPtr = C10_rcuRead(g_A20_config_root.motion);
+		if (!v_cfgPtr)
 			return;
-		const auto& v_cfg = *g_A20_config_root.motion;
+		const auto& v_cfg = *v_cfgPtr;
 		uint32_t	v_now = millis();
 
 		// PIR timeout
@@ -195,9 +200,10 @@ class CL_M10_MotionLogic {
 	// 상태 직렬화
 	// --------------------------------------------------
 	void toJson(JsonDocument& p_doc) const {
-		if (!g_A20_config_root.motion)
+		const ST_A20_MotionConfig_t* v_cfgPtr = C10_rcuRead(g_A20_config_root.motion);
+		if (!v_cfgPtr)
 			return;
-		const auto& v_cfg = *g_A20_config_root.motion;
+		const auto& v_cfg = *v_cfgPtr;
 
 		JsonObject v_o	 = p_doc["motion"].to<JsonObject>();
 		v_o["active"]	 = isActive();
@@ -239,9 +245,10 @@ class CL_M10_MotionLogic {
 	bool isActive() const {
 		unsigned long v_now	 = millis();
 		// holdSec 로직은 외부 config 사용 (예: g_A20_config_root.motion)
-		uint32_t	  v_hold = 0;
-		if (g_A20_config_root.motion) {
-			v_hold = (uint32_t)g_A20_config_root.motion->pir.holdSec;
+		uint32_t					 v_hold = 0;
+		const ST_A20_MotionConfig_t* v_cfg	= C10_rcuRead(g_A20_config_root.motion);
+		if (v_cfg) {
+			v_hold = (uint32_t)v_cfg->pir.holdSec;
 		}
 		if (_state.pirActive || _state.bleActive)
 			// if (pirActive || bleActive)
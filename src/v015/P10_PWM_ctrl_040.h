@@ -11,6 +11,7 @@
  *  - 0~100% 듀티 제어 (실제 레졸루션 스케일링)
  *  - 현재 듀티 조회 및 enable/disable 관리
  *  - 헤더 단일(h) 구성, 외부 모듈(S10/CT10)에서 사용
+ *  - 가상 출력 모드(beginVirtual): LEDC 미사용, duty 값만 유지 (S10 headless 구동용)
  * ------------------------------------------------------
  * [구현 규칙]
  *  - 항상 소스 시작 주석 부분 체계 유지 및 내용 업데이트
@@ -56,6 +57,7 @@ typedef struct {
 	uint8_t	 resolutionBits;
 	uint32_t maxDuty;	   // (1<<resolutionBits)-1
 	float	 dutyPercent;  // 0.0 ~ 100.0
+	bool	 virtualOut;   // true: LEDC 미사용(duty 값만 유지)
 } ST_P10_PWMState_t;
 
 // ------------------------------------------------------
@@ -114,6 +116,20 @@ class CL_P10_PWM {
 		CL_D10_Logger::log(EN_L10_LOG_INFO, "[P10] begin pin=%d ch=%u freq=%lu res=%u", (int)_state.pin, (unsigned)_state.channel, (unsigned long)_state.freq, (unsigned)_state.resolutionBits);
 	}
 
+	// ==================================================
+	// 가상 출력 초기화 (하드웨어 미접근)
+	//  - duty 계산/조회 경로는 실기와 동일, LEDC write만 생략
+	// ==================================================
+	void beginVirtual(uint8_t p_resolutionBits = 10) {
+		memset(&_state, 0, sizeof(_state));
+		_state.pin			  = -1;
+		_state.resolutionBits = p_resolutionBits;
+		_state.maxDuty		  = (p_resolutionBits >= 1 && p_resolutionBits <= 20) ? ((1UL << p_resolutionBits) - 1UL) : 1023;
+		_state.enabled		  = true;
+		_state.virtualOut	  = true;
+		_state.initialized	  = true;
+	}
+
 	// ==================================================
 	// Enable / Disable
 	// ==================================================
@@ -257,7 +273,7 @@ class CL_P10_PWM {
 
 	// 현재 하드웨어 RAW duty 조회용 (필요 시 사용)
 	uint32_t getRawDuty() const {
-		return (_state.initialized) ? ledcRead(_state.channel) : 0;
+		return (_state.initialized && !_state.virtualOut) ? ledcRead(_state.channel) : 0;
 	}
 
 	// --------------------------------------------------
@@ -292,6 +308,8 @@ class CL_P10_PWM {
 	void _setRawDuty(uint32_t p_raw) {
 		if (!_state.initialized)
 			return;
+		if (_state.virtualOut)
+			return;
 		if (p_raw > _state.maxDuty)
 			p_raw = _state.maxDuty;
 		ledcWrite(_state.channel, p_raw);
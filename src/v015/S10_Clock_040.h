@@ -0,0 +1,98 @@
+#pragma once
+/*
+ * ------------------------------------------------------
+ * 소스명 : S10_Clock_040.h
+ * 모듈약어 : S10
+ * 모듈명 : Smart Nature Wind 시뮬레이션 시계(Clock) 인터페이스
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - S10 tick 시간 캡처(_tickNowMs/_tickNowSec, step 지터 us) 공급원 추상화
+ * - CL_S10_SysClock     : millis()/micros() 기반 (기본값, 실기 구동)
+ * - CL_S10_VirtualClock : 외부에서 명시적으로 전진시키는 가상 시계 (headless 고속 구동)
+ * ------------------------------------------------------
+ * [구현 규칙]
+ * - 항상 소스 시작 주석 부분 체계 유지 및 내용 업데이트
+ * - 소스 시작 주석 부분 구현규칙, 코드네이밍규칙 내용 그대로 유지, 수정금지
+ * - ArduinoJson v7.x.x 사용 (v6 이하 사용 금지)
+ * - JsonDocument 단일 타입만 사용
+ * - createNestedArray/Object/containsKey 사용 금지
+ * - memset + strlcpy 기반 안전 초기화
+ * - 주석/필드명은 JSON 구조와 동일하게 유지
+ * ------------------------------------------------------
+ * [코드 네이밍 규칙]
+ * - 전역 상수,매크로      : G_모듈약어_ 접두사
+ * - 전역 변수             : g_모듈약어_ 접두사
+ * - 전역 함수             : 모듈약어_ 접두사
+ * - type                  : T_모듈약어_ 접두사
+ * - typedef               : _t  접미사
+ * - enum 상수             : EN_모듈약어_ 접두사
+ * - 구조체                : ST_모듈약어_ 접미사
+ * - 클래스명              : CL_모듈약어_ 접미사
+ * - 클래스 private 멤버   : _ 접두사
+ * - 클래스 멤버(함수/변수) : 모듈약어 접두사 미사용
+ * - 클래스 정적 멤버      : s_ 접두사
+ * - 함수 로컬 변수        : v_ 접두사
+ * - 함수 인자             : p_ 접두사
+ * ------------------------------------------------------
+ */
+
+#include <Arduino.h>
+
+// ======================================================
+// CL_S10_Clock (인터페이스)
+// - nowMs/nowUs는 millis()/micros()와 동일하게 32bit wrap 허용
+// ======================================================
+class CL_S10_Clock {
+  public:
+	virtual ~CL_S10_Clock() {}
+
+	virtual uint32_t nowMs() const = 0;	 // [ms]
+	virtual uint32_t nowUs() const = 0;	 // [us]
+};
+
+// ======================================================
+// CL_S10_SysClock : Arduino 시스템 시간
+// ======================================================
+class CL_S10_SysClock : public CL_S10_Clock {
+  public:
+	uint32_t nowMs() const override {
+		return (uint32_t)millis();
+	}
+	uint32_t nowUs() const override {
+		return (uint32_t)micros();
+	}
+};
+
+// ======================================================
+// CL_S10_VirtualClock : 가상 시계 (advance 호출 시에만 전진)
+// - 내부 us 누적은 64bit (장시간 시뮬레이션에서도 wrap 없음)
+// ======================================================
+class CL_S10_VirtualClock : public CL_S10_Clock {
+  public:
+	explicit CL_S10_VirtualClock(uint32_t p_startMs = 0u) {
+		setMs(p_startMs);
+	}
+
+	void setMs(uint32_t p_ms) {
+		_us = (uint64_t)p_ms * 1000ull;
+	}
+	void advanceMs(uint32_t p_ms) {
+		_us += (uint64_t)p_ms * 1000ull;
+	}
+	void advanceUs(uint32_t p_us) {
+		_us += (uint64_t)p_us;
+	}
+
+	uint32_t nowMs() const override {
+		return (uint32_t)(_us / 1000ull);
+	}
+	uint32_t nowUs() const override {
+		return (uint32_t)_us;
+	}
+
+  private:
+	uint64_t _us = 0;
+};
+
+// 기본 시계 (S10 인스턴스가 setClock 미지정 시 사용)
+inline CL_S10_SysClock g_S10_sysClock;
@@ -0,0 +1,579 @@
+/*
+ * ------------------------------------------------------
+ * 소스명 : S10_Headless_040.cpp
+ * 모듈약어 : S10
+ * 모듈명 : Smart Nature Wind 시뮬레이션 Headless 고속 구동기
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - CL_S10_HeadlessRunner 구현부
+ *   - 가상 시계 + 가상 PWM 기반 독립 인스턴스 구동
+ *   - stepMs 단위 가상 시간 전진 → tick() → sampleMs 마다 스냅샷 기록
+ *   - CSV / binary record 직렬화
+ * - 통계 프로파일(profile) / preset×style 회귀 검사(runSuite)
+ *   - PSD: Welch(비중첩 N=256, Hann, 평균 제거) + log-log 최소제곱 기울기
+ * ------------------------------------------------------
+ */
+
+#include "S10_Headless_040.h"
+
+#include <math.h>
+
+#include <new>
+
+#include "S20_WindSolver_040.h"
+
+// --------------------------------------------------
+// 내부 Helper: 독립 인스턴스 구동 컨텍스트 (open/close 쌍으로 사용)
+// --------------------------------------------------
+typedef struct {
+	CL_S10_Simulation*	sim;
+	CL_S10_VirtualClock clock;
+	CL_P10_PWM			pwm;
+	uint32_t			seed;
+} ST_S10_HeadlessCtx_t;
+
+static bool S10_headlessOpen(ST_S10_HeadlessCtx_t& p_ctx, const ST_A20_ResolvedWind_t& p_wind, uint32_t p_seed) {
+	// 10min 통계 배열 포함 → stack 대신 heap
+	p_ctx.sim = new (std::nothrow) CL_S10_Simulation();
+	if (!p_ctx.sim) {
+		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[S10] headless: alloc failed");
+		return false;
+	}
+
+	p_ctx.clock.setMs(G_S10_HEADLESS_T0_MS);
+	p_ctx.pwm.beginVirtual();
+
+	// 인스턴스 전용 PRNG에 재현 가능한 seed 적용 (실기 sim/전역 g_A20_prng 무관)
+	p_ctx.seed = p_ctx.sim->seedPrng(p_seed);
+
+	p_ctx.sim->setHeadless(true);
+	p_ctx.sim->setClock(&p_ctx.clock);
+	p_ctx.sim->setFixedStep(true);
+	p_ctx.sim->begin(p_ctx.pwm);
+	p_ctx.sim->applyResolvedWind(p_wind);
+	return true;
+}
+
+static void S10_headlessClose(ST_S10_HeadlessCtx_t& p_ctx) {
+	delete p_ctx.sim;
+	p_ctx.sim = nullptr;
+}
+
+static uint32_t S10_headlessClampStep(uint32_t p_stepMs) {
+	if (p_stepMs < G_S10_HEADLESS_STEP_MIN_MS) return G_S10_HEADLESS_STEP_MIN_MS;
+	if (p_stepMs > G_S10_HEADLESS_STEP_MAX_MS) return G_S10_HEADLESS_STEP_MAX_MS;
+	return p_stepMs;
+}
+
+// --------------------------------------------------
+// 내부 Helper: in-place radix-2 FFT (N = 2^k)
+// --------------------------------------------------
+static void S10_fftRadix2(float* p_re, float* p_im, uint16_t p_n) {
+	// bit-reversal 재배열
+	for (uint16_t v_i = 1, v_j = 0; v_i < p_n; v_i++) {
+		uint16_t v_bit = p_n >> 1;
+		for (; v_j & v_bit; v_bit >>= 1) v_j ^= v_bit;
+		v_j ^= v_bit;
+		if (v_i < v_j) {
+			float v_t = p_re[v_i];
+			p_re[v_i] = p_re[v_j];
+			p_re[v_j] = v_t;
+			v_t		  = p_im[v_i];
+			p_im[v_i] = p_im[v_j];
+			p_im[v_j] = v_t;
+		}
+	}
+
+	for (uint16_t v_len = 2; v_len <= p_n; v_len <<= 1) {
+		const float v_ang = -2.0f * (float)M_PI / (float)v_len;
+		const float v_wr  = cosf(v_ang);
+		const float v_wi  = sinf(v_ang);
+		for (uint16_t v_i = 0; v_i < p_n; v_i += v_len) {
+			float v_cr = 1.0f;
+			float v_ci = 0.0f;
+			for (uint16_t v_k = 0; v_k < (v_len >> 1); v_k++) {
+				const uint16_t v_a	= v_i + v_k;
+				const uint16_t v_b	= v_a + (v_len >> 1);
+				const float	   v_tr = p_re[v_b] * v_cr - p_im[v_b] * v_ci;
+				const float	   v_ti = p_re[v_b] * v_ci + p_im[v_b] * v_cr;
+				p_re[v_b]			= p_re[v_a] - v_tr;
+				p_im[v_b]			= p_im[v_a] - v_ti;
+				p_re[v_a] += v_tr;
+				p_im[v_a] += v_ti;
+				const float v_nr = v_cr * v_wr - v_ci * v_wi;
+				v_ci			 = v_cr * v_wi + v_ci * v_wr;
+				v_cr			 = v_nr;
+			}
+		}
+	}
+}
+
+// --------------------------------------------------
+// 내부 Helper: record 1개 직렬화
+// --------------------------------------------------
+static void S10_headlessWriteRec(Print& p_out, EN_S10_headless_fmt_t p_fmt, const ST_S10_HeadlessRec_t& p_rec) {
+	if (p_fmt == EN_S10_HEADLESS_FMT_BIN) {
+		p_out.write((const uint8_t*)&p_rec, sizeof(p_rec));
+		return;
+	}
+
+	char v_line[96];
+	int	 v_n = snprintf(v_line,
+						sizeof(v_line),
+						"%lu,%.3f,%.3f,%.2f,%u,%u,%u\n",
+						(unsigned long)p_rec.tMs,
+						(double)p_rec.wind,
+						(double)p_rec.target,
+						(double)p_rec.pwmDuty,
+						(unsigned)(p_rec.flags & 0x01u),
+						(unsigned)((p_rec.flags >> 1) & 0x01u),
+						(unsigned)p_rec.phase);
+	if (v_n > 0) {
+		p_out.write((const uint8_t*)v_line, (size_t)((v_n < (int)sizeof(v_line)) ? v_n : (int)sizeof(v_line) - 1));
+	}
+}
+
+void CL_S10_HeadlessRunner::defaultOpt(ST_S10_HeadlessOpt_t& p_opt) {
+	memset(&p_opt, 0, sizeof(p_opt));
+	p_opt.durationSec = 3600u;
+	p_opt.stepMs	  = 500u;
+	p_opt.sampleMs	  = 1000u;
+	p_opt.seed		  = 1u;
+	p_opt.format	  = EN_S10_HEADLESS_FMT_CSV;
+}
+
+/**
+ * @brief 가상 시간으로 시뮬레이션을 구동하고 풍속 계열을 p_out에 기록합니다.
+ * - stepMs는 [G_S10_HEADLESS_STEP_MIN_MS, G_S10_HEADLESS_STEP_MAX_MS]로 보정
+ * - sampleMs는 stepMs 이상, stepMs 배수로 보정
+ */
+uint32_t CL_S10_HeadlessRunner::run(const ST_A20_ResolvedWind_t& p_wind, const ST_S10_HeadlessOpt_t& p_opt, Print& p_out) {
+	if (!p_wind.valid || p_opt.durationSec == 0u) {
+		return 0;
+	}
+
+	// 1) 옵션 보정
+	const uint32_t v_stepMs = S10_headlessClampStep(p_opt.stepMs);
+
+	uint32_t v_sampleMs = (p_opt.sampleMs < v_stepMs) ? v_stepMs : p_opt.sampleMs;
+	v_sampleMs			= (v_sampleMs / v_stepMs) * v_stepMs;
+
+	const uint32_t v_durSec = (p_opt.durationSec > G_S10_HEADLESS_DUR_MAX_S) ? G_S10_HEADLESS_DUR_MAX_S : p_opt.durationSec;
+	const uint64_t v_durMs	= (uint64_t)v_durSec * 1000ull;
+	const uint32_t v_count	= (uint32_t)(v_durMs / v_sampleMs);
+
+	// 2) 독립 인스턴스 구동 준비 (가상 시계/가상 PWM/고정 seed)
+	ST_S10_HeadlessCtx_t v_ctx;
+	if (!S10_headlessOpen(v_ctx, p_wind, p_opt.seed)) {
+		return 0;
+	}
+	CL_S10_Simulation* v_sim  = v_ctx.sim;
+	const uint32_t	   v_seed = v_ctx.seed;
+
+	// 3) 헤더
+	if (p_opt.format == EN_S10_HEADLESS_FMT_BIN) {
+		ST_S10_HeadlessBinHdr_t v_hdr;
+		memset(&v_hdr, 0, sizeof(v_hdr));
+		v_hdr.magic	   = G_S10_HEADLESS_BIN_MAGIC;
+		v_hdr.version  = G_S10_HEADLESS_BIN_VERSION;
+		v_hdr.recSize  = (uint8_t)sizeof(ST_S10_HeadlessRec_t);
+		v_hdr.seed	   = v_seed;
+		v_hdr.stepMs   = v_stepMs;
+		v_hdr.sampleMs = v_sampleMs;
+		v_hdr.count	   = v_count;
+		p_out.write((const uint8_t*)&v_hdr, sizeof(v_hdr));
+	} else {
+		char v_hdrLine[96];
+		snprintf(v_hdrLine, sizeof(v_hdrLine), "# seed=%lu stepMs=%lu sampleMs=%lu\n", (unsigned long)v_seed, (unsigned long)v_stepMs, (unsigned long)v_sampleMs);
+		p_out.print(v_hdrLine);
+		p_out.print("t_ms,wind,target,pwm,gust,thermal,phase\n");
+	}
+
+	// 4) 가상 시간 전진 + tick + 샘플 기록
+	uint32_t			 v_written	  = 0;
+	uint64_t			 v_elapsedMs  = 0;
+	uint64_t			 v_nextSample = v_sampleMs;
+	ST_S10_SimSnapshot_t v_s;
+	ST_S10_HeadlessRec_t v_rec;
+
+	while (v_written < v_count) {
+		v_ctx.clock.advanceMs(v_stepMs);
+		v_elapsedMs += v_stepMs;
+		v_sim->tick();
+
+		if (v_elapsedMs < v_nextSample) {
+			continue;
+		}
+		v_nextSample += v_sampleMs;
+
+		(void)v_sim->readSnapshot(v_s);
+
+		memset(&v_rec, 0, sizeof(v_rec));
+		v_rec.tMs	  = (uint32_t)v_elapsedMs;
+		v_rec.wind	  = v_s.windSpeed;
+		v_rec.target  = v_s.targetWind;
+		v_rec.pwmDuty = v_s.pwmDuty;
+		v_rec.phase	  = (uint8_t)v_s.phase;
+		v_rec.flags	  = (uint8_t)((v_s.gustActive ? 0x01u : 0u) | (v_s.thermalActive ? 0x02u : 0u));
+
+		S10_headlessWriteRec(p_out, p_opt.format, v_rec);
+		v_written++;
+
+		// 장시간 구동 시 실기 watchdog 방지 (host shim에서는 no-op)
+		if ((v_written & 0x3FFu) == 0u) {
+			yield();
+		}
+	}
+
+	// 5) 정리
+	S10_headlessClose(v_ctx);
+
+	return v_written;
+}
+
+/**
+ * @brief WindDict에서 preset/style을 해석한 뒤 run()을 호출합니다.
+ */
+uint32_t CL_S10_HeadlessRunner::runPreset(const ST_A20_WindProfileDict_t& p_dict, const char* p_presetCode, const char* p_styleCode, const ST_S10_HeadlessOpt_t& p_opt, Print& p_out) {
+	ST_A20_ResolvedWind_t v_wind;
+	if (!S20_resolveWindParams(p_dict, p_presetCode, p_styleCode, nullptr, v_wind)) {
+		CL_D10_Logger::log(EN_L10_LOG_WARN, "[S10] headless: resolve failed preset=%s style=%s", p_presetCode ? p_presetCode : "", p_styleCode ? p_styleCode : "");
+		return 0;
+	}
+	return run(v_wind, p_opt, p_out);
+}
+
+/**
+ * @brief 가상 시간 구동 결과의 통계 프로파일을 산출합니다.
+ * - 평균/분산: step 단위 풍속 (Welford)
+ * - 돌풍/열기포: 비활성→활성 전이 횟수 / 가상 분
+ * - phase 체류시간: 완료된 구간만 평균 (시작/종료 미완 구간 제외)
+ * - PSD 기울기: fit 구간 [G_S10_PROFILE_PSD_FIT_LO, G_S10_PROFILE_PSD_FIT_HI] bin
+ */
+bool CL_S10_HeadlessRunner::profile(const ST_A20_ResolvedWind_t& p_wind, const ST_S10_HeadlessOpt_t& p_opt, ST_S10_WindProfileStat_t& p_out) {
+	memset(&p_out, 0, sizeof(p_out));
+	strlcpy(p_out.presetCode, p_wind.presetCode, sizeof(p_out.presetCode));
+	strlcpy(p_out.styleCode, p_wind.styleCode, sizeof(p_out.styleCode));
+
+	if (!p_wind.valid || p_opt.durationSec == 0u) {
+		return false;
+	}
+
+	const uint32_t v_stepMs = S10_headlessClampStep(p_opt.stepMs);
+	const uint32_t v_durSec = (p_opt.durationSec > G_S10_HEADLESS_DUR_MAX_S) ? G_S10_HEADLESS_DUR_MAX_S : p_opt.durationSec;
+	const uint32_t v_steps	= (uint32_t)(((uint64_t)v_durSec * 1000ull) / v_stepMs);
+
+	// PSD 누적 버퍼 (re/im segment + bin 평균)
+	const uint16_t v_n		= G_S10_PROFILE_PSD_N;
+	float*		   v_re		= new (std::nothrow) float[v_n];
+	float*		   v_im		= new (std::nothrow) float[v_n];
+	double*		   v_psd	= new (std::nothrow) double[v_n / 2u + 1u];
+	if (!v_re || !v_im || !v_psd) {
+		delete[] v_re;
+		delete[] v_im;
+		delete[] v_psd;
+		return false;
+	}
+	memset(v_psd, 0, sizeof(double) * (v_n / 2u + 1u));
+
+	ST_S10_HeadlessCtx_t v_ctx;
+	if (!S10_headlessOpen(v_ctx, p_wind, p_opt.seed)) {
+		delete[] v_re;
+		delete[] v_im;
+		delete[] v_psd;
+		return false;
+	}
+	CL_S10_Simulation* v_sim = v_ctx.sim;
+	p_out.seed				 = v_ctx.seed;
+
+	// 집계 상태
+	double	 v_mean		  = 0.0;
+	double	 v_m2		  = 0.0;
+	uint32_t v_gustCnt	  = 0;
+	uint32_t v_thermCnt	  = 0;
+	bool	 v_prevGust	  = v_sim->gustActive;
+	bool	 v_prevTherm  = v_sim->thermalActive;
+
+	uint8_t	 v_curPhase	  = (uint8_t)v_sim->phase;
+	uint32_t v_phaseSteps = 0;
+	bool	 v_firstSeg	  = true;  // 시작 구간(길이 불완전) 제외
+	double	 v_dwellSum[EN_A20_WEATHER_PHASE_COUNT] = { 0 };
+
+	uint16_t v_segFill	  = 0;
+	uint32_t v_segCount	  = 0;
+
+	const uint32_t v_wallStartUs = micros();
+
+	for (uint32_t v_i = 0; v_i < v_steps; v_i++) {
+		v_ctx.clock.advanceMs(v_stepMs);
+		v_sim->tick();
+
+		const float v_w = v_sim->currentWindSpeed;
+
+		// 1) 평균/분산 (Welford)
+		const double v_d = (double)v_w - v_mean;
+		v_mean += v_d / (double)(v_i + 1u);
+		v_m2 += v_d * ((double)v_w - v_mean);
+
+		// 2) 돌풍/열기포 시작 전이
+		if (v_sim->gustActive && !v_prevGust) v_gustCnt++;
+		if (v_sim->thermalActive && !v_prevTherm) v_thermCnt++;
+		v_prevGust	= v_sim->gustActive;
+		v_prevTherm = v_sim->thermalActive;
+
+		// 3) phase 체류
+		const uint8_t v_ph = (uint8_t)v_sim->phase;
+		if (v_ph != v_curPhase) {
+			if (!v_firstSeg && v_curPhase < (uint8_t)EN_A20_WEATHER_PHASE_COUNT) {
+				v_dwellSum[v_curPhase] += (double)v_phaseSteps * (double)v_stepMs / 1000.0;
+				p_out.phaseVisits[v_curPhase]++;
+			}
+			v_firstSeg	 = false;
+			v_curPhase	 = v_ph;
+			v_phaseSteps = 0;
+		}
+		v_phaseSteps++;
+
+		// 4) PSD segment 누적
+		v_re[v_segFill++] = v_w;
+		if (v_segFill == v_n) {
+			double v_segMean = 0.0;
+			for (uint16_t v_k = 0; v_k < v_n; v_k++) v_segMean += v_re[v_k];
+			v_segMean /= (double)v_n;
+
+			for (uint16_t v_k = 0; v_k < v_n; v_k++) {
+				const float v_hann = 0.5f - 0.5f * cosf(2.0f * (float)M_PI * (float)v_k / (float)(v_n - 1u));
+				v_re[v_k]		   = (float)(v_re[v_k] - v_segMean) * v_hann;
+				v_im[v_k]		   = 0.0f;
+			}
+			S10_fftRadix2(v_re, v_im, v_n);
+			for (uint16_t v_k = 0; v_k <= v_n / 2u; v_k++) {
+				v_psd[v_k] += (double)v_re[v_k] * v_re[v_k] + (double)v_im[v_k] * v_im[v_k];
+			}
+			v_segCount++;
+			v_segFill = 0;
+		}
+
+		if ((v_i & 0xFFFu) == 0xFFFu) {
+			yield();
+		}
+	}
+
+	const uint32_t v_wallUs = micros() - v_wallStartUs;
+
+	// 결과 정리
+	p_out.simSec		= v_durSec;
+	p_out.steps			= v_steps;
+	p_out.meanWind		= (float)v_mean;
+	p_out.varWind		= (v_steps > 1u) ? (float)(v_m2 / (double)(v_steps - 1u)) : 0.0f;
+	p_out.gustPerMin	= (float)v_gustCnt * 60.0f / (float)v_durSec;
+	p_out.thermalPerMin = (float)v_thermCnt * 60.0f / (float)v_durSec;
+	p_out.stepsPerSec	= (v_wallUs > 0u) ? (float)((double)v_steps * 1.0e6 / (double)v_wallUs) : 0.0f;
+
+	for (uint8_t v_p = 0; v_p < (uint8_t)EN_A20_WEATHER_PHASE_COUNT; v_p++) {
+		p_out.dwellSec[v_p] = (p_out.phaseVisits[v_p] > 0u) ? (float)(v_dwellSum[v_p] / (double)p_out.phaseVisits[v_p]) : 0.0f;
+	}
+
+	// PSD log-log 최소제곱 기울기 (bin 간격 상수 → 주파수 대신 bin index 사용 가능)
+	if (v_segCount > 0u) {
+		double	 v_sx = 0.0, v_sy = 0.0, v_sxx = 0.0, v_sxy = 0.0;
+		uint16_t v_cnt = 0;
+		for (uint16_t v_k = G_S10_PROFILE_PSD_FIT_LO; v_k <= G_S10_PROFILE_PSD_FIT_HI && v_k <= v_n / 2u; v_k++) {
+			const double v_p = v_psd[v_k] / (double)v_segCount;
+			if (v_p <= 0.0) continue;
+			const double v_x = log10((double)v_k);
+			const double v_y = log10(v_p);
+			v_sx += v_x;
+			v_sy += v_y;
+			v_sxx += v_x * v_x;
+			v_sxy += v_x * v_y;
+			v_cnt++;
+		}
+		const double v_den = (double)v_cnt * v_sxx - v_sx * v_sx;
+		if (v_cnt >= 2u && fabs(v_den) > 1e-12) {
+			p_out.psdSlope = (float)(((double)v_cnt * v_sxy - v_sx * v_sy) / v_den);
+		}
+	}
+
+	S10_headlessClose(v_ctx);
+	delete[] v_re;
+	delete[] v_im;
+	delete[] v_psd;
+	return true;
+}
+
+/**
+ * @brief 기본 허용 오차 (24h 구동 기준)
+ * - seed만 바꾼 동일 코드의 조합별 최대 편차(6 seed 쌍별, host 측정) 대비 약 1.5배
+ *   (mean 1.6% / var 1.9% / gust 0.24/min / thermal 0.09/min / dwell 31% / PSD 0.09)
+ * - 구동 시간이 짧을수록 표본 잡음이 커지므로 1h 미만 비교에는 부적합
+ */
+void CL_S10_HeadlessRunner::defaultTol(ST_S10_ProfileTol_t& p_tol) {
+	memset(&p_tol, 0, sizeof(p_tol));
+	p_tol.meanRel	  = 0.05f;
+	p_tol.varRel	  = 0.15f;
+	p_tol.rateAbs	  = 0.35f;
+	p_tol.dwellRel	  = 0.45f;
+	p_tol.psdSlopeAbs = 0.25f;
+}
+
+// --------------------------------------------------
+// 내부 Helper: 상대 오차 초과 여부 (기준값 0 근처는 절대 오차로 평가)
+// --------------------------------------------------
+static bool S10_relExceeds(float p_cur, float p_base, float p_tolRel) {
+	const float v_ref = fabsf(p_base);
+	if (v_ref < 1e-3f) {
+		return fabsf(p_cur - p_base) > p_tolRel;
+	}
+	return (fabsf(p_cur - p_base) / v_ref) > p_tolRel;
+}
+
+uint32_t CL_S10_HeadlessRunner::checkDrift(const ST_S10_WindProfileStat_t& p_cur, const ST_S10_WindProfileStat_t& p_base, const ST_S10_ProfileTol_t& p_tol) {
+	uint32_t v_mask = EN_S10_DRIFT_NONE;
+
+	if (S10_relExceeds(p_cur.meanWind, p_base.meanWind, p_tol.meanRel)) v_mask |= EN_S10_DRIFT_MEAN;
+	if (S10_relExceeds(p_cur.varWind, p_base.varWind, p_tol.varRel)) v_mask |= EN_S10_DRIFT_VAR;
+	if (fabsf(p_cur.gustPerMin - p_base.gustPerMin) > p_tol.rateAbs) v_mask |= EN_S10_DRIFT_GUST;
+	if (fabsf(p_cur.thermalPerMin - p_base.thermalPerMin) > p_tol.rateAbs) v_mask |= EN_S10_DRIFT_THERMAL;
+
+	for (uint8_t v_p = 0; v_p < (uint8_t)EN_A20_WEATHER_PHASE_COUNT; v_p++) {
+		// 한쪽만 관측된 phase는 구간 수 부족 → 체류시간 비교 생략
+		if (p_cur.phaseVisits[v_p] == 0u || p_base.phaseVisits[v_p] == 0u) continue;
+		if (S10_relExceeds(p_cur.dwellSec[v_p], p_base.dwellSec[v_p], p_tol.dwellRel)) {
+			v_mask |= EN_S10_DRIFT_DWELL;
+			break;
+		}
+	}
+
+	if (fabsf(p_cur.psdSlope - p_base.psdSlope) > p_tol.psdSlopeAbs) v_mask |= EN_S10_DRIFT_PSD;
+
+	return v_mask;
+}
+
+/**
+ * @brief 프로파일 1건을 G_S10_PROFILE_CSV_HEADER 열 순서의 CSV 1행으로 출력합니다.
+ */
+void CL_S10_HeadlessRunner::statToCsv(const ST_S10_WindProfileStat_t& p_st, uint32_t p_mask, Print& p_out) {
+	char v_line[256];
+	int	 v_n = snprintf(v_line,
+						sizeof(v_line),
+						"%s,%s,%lu,%lu,%.4f,%.4f,%.4f,%.4f,%.1f,%.1f,%.1f,%u,%u,%u,%.3f,%.0f,0x%02lx\n",
+						p_st.presetCode,
+						p_st.styleCode,
+						(unsigned long)p_st.seed,
+						(unsigned long)p_st.simSec,
+						(double)p_st.meanWind,
+						(double)p_st.varWind,
+						(double)p_st.gustPerMin,
+						(double)p_st.thermalPerMin,
+						(double)p_st.dwellSec[EN_A20_WEATHER_PHASE_CALM],
+						(double)p_st.dwellSec[EN_A20_WEATHER_PHASE_NORMAL],
+						(double)p_st.dwellSec[EN_A20_WEATHER_PHASE_STRONG],
+						(unsigned)p_st.phaseVisits[EN_A20_WEATHER_PHASE_CALM],
+						(unsigned)p_st.phaseVisits[EN_A20_WEATHER_PHASE_NORMAL],
+						(unsigned)p_st.phaseVisits[EN_A20_WEATHER_PHASE_STRONG],
+						(double)p_st.psdSlope,
+						(double)p_st.stepsPerSec,
+						(unsigned long)p_mask);
+	if (v_n > 0) {
+		p_out.write((const uint8_t*)v_line, (size_t)((v_n < (int)sizeof(v_line)) ? v_n : (int)sizeof(v_line) - 1));
+	}
+}
+
+/**
+ * @brief statToCsv 1행을 파싱합니다 (기준값 파일 로드용).
+ * - 헤더/주석('#')/빈 행은 false
+ * - stepsPerSec/drift 열은 읽지만 회귀 비교에는 사용하지 않음
+ */
+bool CL_S10_HeadlessRunner::statFromCsv(const char* p_line, ST_S10_WindProfileStat_t& p_out) {
+	memset(&p_out, 0, sizeof(p_out));
+	if (!p_line || p_line[0] == '\0' || p_line[0] == '#' || p_line[0] == '\n' || p_line[0] == '\r') return false;
+	if (strncmp(p_line, "preset,", 7) == 0) return false;
+
+	unsigned long v_seed = 0, v_simSec = 0;
+	unsigned	  v_vc = 0, v_vn = 0, v_vs = 0;
+	const int	  v_n  = sscanf(p_line,
+							"%23[^,],%23[^,],%lu,%lu,%f,%f,%f,%f,%f,%f,%f,%u,%u,%u,%f,%f",
+							p_out.presetCode,
+							p_out.styleCode,
+							&v_seed,
+							&v_simSec,
+							&p_out.meanWind,
+							&p_out.varWind,
+							&p_out.gustPerMin,
+							&p_out.thermalPerMin,
+							&p_out.dwellSec[EN_A20_WEATHER_PHASE_CALM],
+							&p_out.dwellSec[EN_A20_WEATHER_PHASE_NORMAL],
+							&p_out.dwellSec[EN_A20_WEATHER_PHASE_STRONG],
+							&v_vc,
+							&v_vn,
+							&v_vs,
+							&p_out.psdSlope,
+							&p_out.stepsPerSec);
+	if (v_n < 15) return false;
+
+	p_out.seed										  = (uint32_t)v_seed;
+	p_out.simSec									  = (uint32_t)v_simSec;
+	p_out.phaseVisits[EN_A20_WEATHER_PHASE_CALM]	  = (uint16_t)v_vc;
+	p_out.phaseVisits[EN_A20_WEATHER_PHASE_NORMAL]	  = (uint16_t)v_vn;
+	p_out.phaseVisits[EN_A20_WEATHER_PHASE_STRONG]	  = (uint16_t)v_vs;
+	return true;
+}
+
+/**
+ * @brief WindDict의 preset×style 전체 조합에 대해 profile + checkDrift 수행
+ * - 기준값 매칭: presetCode/styleCode (대소문자 무시)
+ */
+uint16_t CL_S10_HeadlessRunner::runSuite(const ST_A20_WindProfileDict_t&   p_dict,
+										 const ST_S10_HeadlessOpt_t&	   p_opt,
+										 const ST_S10_WindProfileStat_t* p_base,
+										 uint16_t						   p_baseCount,
+										 const ST_S10_ProfileTol_t&		   p_tol,
+										 Print&							   p_report,
+										 ST_S10_WindProfileStat_t*		   p_outStats,
+										 uint16_t						   p_outStatsCap) {
+	uint16_t v_fail = 0;
+	uint16_t v_idx	= 0;
+
+	p_report.print(G_S10_PROFILE_CSV_HEADER);
+
+	for (uint8_t v_pi = 0; v_pi < p_dict.presetCount; v_pi++) {
+		for (uint8_t v_si = 0; v_si < p_dict.styleCount; v_si++) {
+			const char*			  v_pc = p_dict.presets[v_pi].code;
+			const char*			  v_sc = p_dict.styles[v_si].code;
+
+			ST_A20_ResolvedWind_t	 v_wind;
+			ST_S10_WindProfileStat_t v_st;
+			uint32_t				 v_mask = EN_S10_DRIFT_NONE;
+
+			const bool v_ok = S20_resolveWindParams(p_dict, v_pc, v_sc, nullptr, v_wind) && profile(v_wind, p_opt, v_st);
+			if (!v_ok) {
+				memset(&v_st, 0, sizeof(v_st));
+				strlcpy(v_st.presetCode, v_pc, sizeof(v_st.presetCode));
+				strlcpy(v_st.styleCode, v_sc, sizeof(v_st.styleCode));
+				v_mask = EN_S10_DRIFT_MISSING;
+			} else if (p_base) {
+				const ST_S10_WindProfileStat_t* v_ref = nullptr;
+				for (uint16_t v_b = 0; v_b < p_baseCount; v_b++) {
+					if (strcasecmp(p_base[v_b].presetCode, v_pc) == 0 && strcasecmp(p_base[v_b].styleCode, v_sc) == 0) {
+						v_ref = &p_base[v_b];
+						break;
+					}
+				}
+				v_mask = v_ref ? checkDrift(v_st, *v_ref, p_tol) : (uint32_t)EN_S10_DRIFT_MISSING;
+			}
+
+			if (v_mask != EN_S10_DRIFT_NONE) {
+				v_fail++;
+			}
+			if (p_outStats && v_idx < p_outStatsCap) {
+				p_outStats[v_idx] = v_st;
+			}
+			v_idx++;
+
+			statToCsv(v_st, v_mask, p_report);
+		}
+	}
+
+	return v_fail;
+}
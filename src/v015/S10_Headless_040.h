@@ -0,0 +1,194 @@
+#pragma once
+/*
+ * ------------------------------------------------------
+ * 소스명 : S10_Headless_040.h
+ * 모듈약어 : S10
+ * 모듈명 : Smart Nature Wind 시뮬레이션 Headless 고속 구동기
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - 별도 CL_S10_Simulation 인스턴스를 가상 시계(CL_S10_VirtualClock)로 구동
+ *   (실시간 대기 없이 수 시간 분량 풍속 계열을 즉시 생성)
+ * - 가상 PWM(P10 beginVirtual)으로 duty 계산 경로는 실기와 동일하게 유지
+ * - 출력: CSV(text) 또는 고정 길이 binary record 스트림 (Print 대상: Serial/File/host shim)
+ * - 용도: cfg_windDict 프리셋 오프라인 튜닝 / 통계 특성 검증
+ * - 통계 프로파일(profile): 평균/분산/돌풍·열기포 분당 발생률/phase 체류시간/난류 PSD 기울기/steps per sec
+ * - 회귀 검사(runSuite/checkDrift): preset×style 전체 프로파일 → 기준값 대비 허용 오차 초과 항목 bitmask
+ * - 기준값 CSV(statToCsv/statFromCsv): runSuite 보고서 행 = 기준값 파일 행 (host: test/host/baseline)
+ * ------------------------------------------------------
+ * [구현 규칙]
+ * - 항상 소스 시작 주석 부분 체계 유지 및 내용 업데이트
+ * - 소스 시작 주석 부분 구현규칙, 코드네이밍규칙 내용 그대로 유지, 수정금지
+ * - ArduinoJson v7.x.x 사용 (v6 이하 사용 금지)
+ * - JsonDocument 단일 타입만 사용
+ * - createNestedArray/Object/containsKey 사용 금지
+ * - memset + strlcpy 기반 안전 초기화
+ * - 주석/필드명은 JSON 구조와 동일하게 유지
+ * ------------------------------------------------------
+ * [코드 네이밍 규칙]
+ * - 전역 상수,매크로      : G_모듈약어_ 접두사
+ * - 전역 변수             : g_모듈약어_ 접두사
+ * - 전역 함수             : 모듈약어_ 접두사
+ * - type                  : T_모듈약어_ 접두사
+ * - typedef               : _t  접미사
+ * - enum 상수             : EN_모듈약어_ 접두사
+ * - 구조체                : ST_모듈약어_ 접미사
+ * - 클래스명              : CL_모듈약어_ 접미사
+ * - 클래스 private 멤버   : _ 접두사
+ * - 클래스 멤버(함수/변수) : 모듈약어 접두사 미사용
+ * - 클래스 정적 멤버      : s_ 접두사
+ * - 함수 로컬 변수        : v_ 접두사
+ * - 함수 인자             : p_ 접두사
+ * ------------------------------------------------------
+ */
+
+#include <Arduino.h>
+
+#include "A20_Const_041.h"
+#include "S10_Simul_040.h"
+
+// ==================================================
+// [Headless 정책 상수]
+// ==================================================
+static const uint32_t G_S10_HEADLESS_T0_MS		  = 1000u;	// [ms] 가상 시작 시각(0은 "미캡처" 의미로 예약)
+static const uint32_t G_S10_HEADLESS_STEP_MIN_MS  = 10u;	// [ms]
+static const uint32_t G_S10_HEADLESS_STEP_MAX_MS  = 500u;	// [ms] tick dt clamp 상한과 동일
+static const uint32_t G_S10_HEADLESS_DUR_MAX_S	  = 7u * 24u * 3600u;  // [s] 1주
+static const uint32_t G_S10_HEADLESS_BIN_MAGIC	  = 0x48303153u;	   // "S10H" (LE)
+static const uint8_t  G_S10_HEADLESS_BIN_VERSION  = 1u;
+
+// 통계 프로파일: PSD(Welch) segment 길이 및 기울기 fit 구간(bin)
+static const uint16_t G_S10_PROFILE_PSD_N		  = 256u;  // [sample] 2의 거듭제곱
+static const uint16_t G_S10_PROFILE_PSD_FIT_LO	  = 2u;	   // [bin]
+static const uint16_t G_S10_PROFILE_PSD_FIT_HI	  = 64u;   // [bin] (N/4)
+
+// 통계 프로파일 CSV 열 (runSuite 보고서 / 기준값 파일 공용)
+static const char G_S10_PROFILE_CSV_HEADER[] =
+	"preset,style,seed,simSec,mean,var,gustPerMin,thermalPerMin,dwellCalm,dwellNormal,dwellStrong,"
+	"visitsCalm,visitsNormal,visitsStrong,psdSlope,stepsPerSec,drift\n";
+
+// ======================================================
+// 출력 형식
+// ======================================================
+typedef enum : uint8_t {
+	EN_S10_HEADLESS_FMT_CSV = 0,  // "t_ms,wind,target,pwm,gust,thermal,phase\n"
+	EN_S10_HEADLESS_FMT_BIN = 1	  // ST_S10_HeadlessBinHdr_t + ST_S10_HeadlessRec_t * N
+} EN_S10_headless_fmt_t;
+
+// ======================================================
+// 구동 옵션
+// ======================================================
+typedef struct {
+	uint32_t			  durationSec;	// [s]  시뮬레이션 길이
+	uint32_t			  stepMs;		// [ms] tick 간격 (실기 motion.timing.simIntervalMs 대응)
+	uint32_t			  sampleMs;		// [ms] 출력 샘플 간격 (stepMs 배수로 정렬)
+	uint32_t			  seed;			// PRNG seed (0: HW RNG)
+	EN_S10_headless_fmt_t format;
+} ST_S10_HeadlessOpt_t;
+
+// ======================================================
+// binary 스트림 레이아웃 (little-endian, packed)
+// ======================================================
+typedef struct __attribute__((packed)) {
+	uint32_t magic;		// G_S10_HEADLESS_BIN_MAGIC
+	uint8_t	 version;	// G_S10_HEADLESS_BIN_VERSION
+	uint8_t	 recSize;	// sizeof(ST_S10_HeadlessRec_t)
+	uint16_t reserved;
+	uint32_t seed;
+	uint32_t stepMs;	// [ms]
+	uint32_t sampleMs;	// [ms]
+	uint32_t count;		// record 수
+} ST_S10_HeadlessBinHdr_t;
+
+typedef struct __attribute__((packed)) {
+	uint32_t tMs;		// [ms] 시작 기준 경과
+	float	 wind;		// [m/s]
+	float	 target;	// [m/s]
+	float	 pwmDuty;	// [%]
+	uint8_t	 phase;		// T_A20_WindPhase_t
+	uint8_t	 flags;		// bit0=gust, bit1=thermal
+} ST_S10_HeadlessRec_t;
+
+// ======================================================
+// 통계 프로파일 결과 (preset×style 1조합)
+// ======================================================
+typedef struct {
+	char	 presetCode[A20_Const::MAX_CODE_LEN];
+	char	 styleCode[A20_Const::MAX_CODE_LEN];
+
+	uint32_t seed;
+	uint32_t simSec;								  // [s]   가상 구동 시간
+	uint32_t steps;									  // [step]
+
+	float	 meanWind;								  // [m/s]
+	float	 varWind;								  // [m²/s²]
+	float	 gustPerMin;							  // [1/min] 돌풍 시작 횟수
+	float	 thermalPerMin;							  // [1/min] 열기포 시작 횟수
+	float	 dwellSec[EN_A20_WEATHER_PHASE_COUNT];	  // [s]   phase별 평균 체류시간(완료 구간 기준)
+	uint16_t phaseVisits[EN_A20_WEATHER_PHASE_COUNT];  // [회]  phase별 완료 구간 수
+	float	 psdSlope;								  // [-]   log-log PSD 기울기 (Welch, Hann)
+	float	 stepsPerSec;							  // [step/s] 실제(벽시계) 처리 속도 (회귀 비교 제외)
+} ST_S10_WindProfileStat_t;
+
+// 회귀 허용 오차
+typedef struct {
+	float meanRel;	   // [-]     평균 상대 오차
+	float varRel;	   // [-]     분산 상대 오차
+	float rateAbs;	   // [1/min] 돌풍/열기포 발생률 절대 오차
+	float dwellRel;	   // [-]     phase 평균 체류시간 상대 오차
+	float psdSlopeAbs;	// [-]     PSD 기울기 절대 오차
+} ST_S10_ProfileTol_t;
+
+// 허용 오차 초과 항목 (checkDrift 반환 bitmask)
+typedef enum : uint32_t {
+	EN_S10_DRIFT_NONE	  = 0x00u,
+	EN_S10_DRIFT_MEAN	  = 0x01u,
+	EN_S10_DRIFT_VAR	  = 0x02u,
+	EN_S10_DRIFT_GUST	  = 0x04u,
+	EN_S10_DRIFT_THERMAL  = 0x08u,
+	EN_S10_DRIFT_DWELL	  = 0x10u,
+	EN_S10_DRIFT_PSD	  = 0x20u,
+	EN_S10_DRIFT_MISSING  = 0x80u  // 기준값 없음/구동 실패
+} EN_S10_drift_t;
+
+// ======================================================
+// CL_S10_HeadlessRunner
+// - 실기 sim 인스턴스와 독립 (차트 버퍼/CT10 dirty 미사용)
+// - PRNG는 구동 인스턴스 전용(seedPrng) → 실기 S10 task와 동시 구동해도 난수열 간섭 없음
+// ======================================================
+class CL_S10_HeadlessRunner {
+  public:
+	static void defaultOpt(ST_S10_HeadlessOpt_t& p_opt);
+
+	// 해석 완료된 ResolvedWind로 구동. 반환: 출력 record 수 (0: 실패)
+	static uint32_t run(const ST_A20_ResolvedWind_t& p_wind, const ST_S10_HeadlessOpt_t& p_opt, Print& p_out);
+
+	// WindDict + preset/style 코드로 해석 후 구동 (오프라인 프리셋 튜닝용)
+	static uint32_t runPreset(const ST_A20_WindProfileDict_t& p_dict, const char* p_presetCode, const char* p_styleCode, const ST_S10_HeadlessOpt_t& p_opt, Print& p_out);
+
+	// 통계 프로파일 산출 (p_opt.format/sampleMs 무시, step 단위 집계)
+	static bool profile(const ST_A20_ResolvedWind_t& p_wind, const ST_S10_HeadlessOpt_t& p_opt, ST_S10_WindProfileStat_t& p_out);
+
+	static void defaultTol(ST_S10_ProfileTol_t& p_tol);
+
+	// 기준값 대비 허용 오차 초과 항목 bitmask (EN_S10_drift_t 조합)
+	static uint32_t checkDrift(const ST_S10_WindProfileStat_t& p_cur, const ST_S10_WindProfileStat_t& p_base, const ST_S10_ProfileTol_t& p_tol);
+
+	// 프로파일 CSV 1행 출력/파싱 (G_S10_PROFILE_CSV_HEADER 열 순서, p_mask → drift 열)
+	static void statToCsv(const ST_S10_WindProfileStat_t& p_st, uint32_t p_mask, Print& p_out);
+	static bool statFromCsv(const char* p_line, ST_S10_WindProfileStat_t& p_out);
+
+	/**
+	 * preset×style 전체 프로파일 + 회귀 검사
+	 * - p_report: CSV 1행/조합 (drift mask 포함)
+	 * - p_base가 nullptr이면 기준값 생성 모드(검사 생략, p_outStats에 결과만 기록)
+	 * - 반환: drift 발생 조합 수
+	 */
+	static uint16_t runSuite(const ST_A20_WindProfileDict_t&   p_dict,
+							 const ST_S10_HeadlessOpt_t&	   p_opt,
+							 const ST_S10_WindProfileStat_t* p_base,
+							 uint16_t						   p_baseCount,
+							 const ST_S10_ProfileTol_t&		   p_tol,
+							 Print&							   p_report,
+							 ST_S10_WindProfileStat_t*		   p_outStats	   = nullptr,
+							 uint16_t						   p_outStatsCap = 0);
+};
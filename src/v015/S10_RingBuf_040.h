@@ -0,0 +1,188 @@
+#pragma once
+/*
+ * ------------------------------------------------------
+ * 소스명 : S10_RingBuf_040.h
+ * 모듈약어 : S10
+ * 모듈명 : Smart Nature Wind 고정 용량 순환 버퍼 (차트 이력용)
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - 컴파일 타임 용량(N) 고정 템플릿 순환 버퍼 (push/pop 시 heap 할당 없음)
+ * - 저장 공간은 begin()에서 1회만 확보 (PSRAM 우선 배치 옵션, 실패 시 내부 RAM)
+ * - 단조 증가 sequence 번호 기반 접근 (임의 seq부터 cursor 순회 가능)
+ * - 단일 writer / 다중 reader: reader는 잠금 없이 readAt() 후 덮어쓰기 여부 검증
+ * - 런타임 window(보관 샘플 수) 조정 지원 (window <= 용량)
+ * ------------------------------------------------------
+ * [구현 규칙]
+ * - 항상 소스 시작 주석 부분 체계 유지 및 내용 업데이트
+ * - 소스 시작 주석 부분 구현규칙, 코드네이밍규칙 내용 그대로 유지, 수정금지
+ * - ArduinoJson v7.x.x 사용 (v6 이하 사용 금지)
+ * - JsonDocument 단일 타입만 사용
+ * - createNestedArray/Object/containsKey 사용 금지
+ * - memset + strlcpy 기반 안전 초기화
+ * - 주석/필드명은 JSON 구조와 동일하게 유지
+ * ------------------------------------------------------
+ * [코드 네이밍 규칙]
+ * - 전역 상수,매크로      : G_모듈약어_ 접두사
+ * - 전역 변수             : g_모듈약어_ 접두사
+ * - 전역 함수             : 모듈약어_ 접두사
+ * - type                  : T_모듈약어_ 접두사
+ * - typedef               : _t  접미사
+ * - enum 상수             : EN_모듈약어_ 접두사
+ * - 구조체                : ST_모듈약어_ 접미사
+ * - 클래스명              : CL_모듈약어_ 접미사
+ * - 클래스 private 멤버   : _ 접두사
+ * - 클래스 멤버(함수/변수) : 모듈약어 접두사 미사용
+ * - 클래스 정적 멤버      : s_ 접두사
+ * - 함수 로컬 변수        : v_ 접두사
+ * - 함수 인자             : p_ 접두사
+ * ------------------------------------------------------
+ */
+
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <string.h>
+
+#include <atomic>
+
+// ======================================================
+// CL_S10_RingBuffer<T, N>
+// - T : POD 타입 (memcpy 복사)
+// - N : 최대 보관 샘플 수 (내부 slot은 N+1: 덮어쓰기 중인 slot 1개 여유)
+// ======================================================
+template <typename T, uint16_t N>
+class CL_S10_RingBuffer {
+  public:
+	/**
+	 * @brief 저장 공간 1회 확보 (이미 확보된 경우 no-op)
+	 * @param p_preferPsram true면 PSRAM 우선 배치
+	 * - 내부 RAM 할당 실패 시 용량을 절반씩 줄여 재시도 (최소 2 slot)
+	 */
+	bool begin(bool p_preferPsram) {
+		if (_buf) {
+			return true;
+		}
+
+		uint32_t v_slots = (uint32_t)N + 1u;
+
+		if (p_preferPsram && psramFound()) {
+			_buf = (T*)heap_caps_malloc(v_slots * sizeof(T), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+			if (_buf) {
+				_inPsram = true;
+			}
+		}
+
+		while (!_buf && v_slots >= 2u) {
+			_buf = (T*)heap_caps_malloc(v_slots * sizeof(T), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+			if (!_buf) {
+				v_slots /= 2u;
+			}
+		}
+
+		if (!_buf) {
+			_slots = 0;
+			return false;
+		}
+
+		memset(_buf, 0, v_slots * sizeof(T));
+		_slots = (uint16_t)v_slots;
+		setWindow(N);
+		return true;
+	}
+
+	// 최대 보관 가능 샘플 수 (할당 결과 반영)
+	uint16_t capacity() const {
+		return (_slots > 0) ? (uint16_t)(_slots - 1u) : 0;
+	}
+
+	bool inPsram() const {
+		return _inPsram;
+	}
+
+	/**
+	 * @brief 보관 window(샘플 수) 설정. [1, capacity()] 범위로 보정
+	 */
+	void setWindow(uint16_t p_window) {
+		const uint16_t v_cap = capacity();
+		uint16_t	   v_w	 = p_window;
+		if (v_w < 1u) v_w = 1u;
+		if (v_w > v_cap) v_w = v_cap;
+		_window = v_w;
+	}
+
+	uint16_t window() const {
+		return _window;
+	}
+
+	/**
+	 * @brief 샘플 추가 (단일 writer 전용)
+	 * - slot 기록 후 head를 release 순서로 발행
+	 */
+	void push(const T& p_item) {
+		if (!_buf || _slots == 0) {
+			return;
+		}
+		const uint32_t v_seq = _head.load(std::memory_order_relaxed);
+		memcpy(&_buf[v_seq % _slots], &p_item, sizeof(T));
+		_head.store(v_seq + 1u, std::memory_order_release);
+	}
+
+	// 다음에 기록될 seq (= 마지막 샘플 seq + 1)
+	uint32_t headSeq() const {
+		return _head.load(std::memory_order_acquire);
+	}
+
+	// window 기준 가장 오래된 유효 seq
+	uint32_t tailSeq() const {
+		const uint32_t v_head = headSeq();
+		return (v_head > _window) ? (v_head - _window) : 0u;
+	}
+
+	uint16_t size() const {
+		const uint32_t v_head = headSeq();
+		return (uint16_t)((v_head > _window) ? _window : v_head);
+	}
+
+	bool empty() const {
+		return headSeq() == 0u;
+	}
+
+	/**
+	 * @brief seq 위치 샘플을 잠금 없이 복사
+	 * @return window 범위 밖이거나 복사 중 덮어쓰기가 감지되면 false
+	 */
+	bool readAt(uint32_t p_seq, T& p_out) const {
+		if (!_buf || _slots == 0) {
+			return false;
+		}
+
+		const uint32_t v_h1 = _head.load(std::memory_order_acquire);
+		if (p_seq >= v_h1 || (v_h1 - p_seq) > _window) {
+			return false;
+		}
+
+		memcpy(&p_out, &_buf[p_seq % _slots], sizeof(T));
+
+		// 복사 중 writer가 해당 slot까지 돌아왔는지 검증
+		std::atomic_thread_fence(std::memory_order_acquire);
+		const uint32_t v_h2 = _head.load(std::memory_order_relaxed);
+		return (v_h2 - p_seq) < _slots;
+	}
+
+	/**
+	 * @brief 마지막 샘플 복사 (없으면 false)
+	 */
+	bool readLast(T& p_out) const {
+		const uint32_t v_head = headSeq();
+		if (v_head == 0u) {
+			return false;
+		}
+		return readAt(v_head - 1u, p_out);
+	}
+
+  private:
+	T*					  _buf	   = nullptr;
+	uint16_t			  _slots   = 0;
+	uint16_t			  _window  = 0;
+	bool				  _inPsram = false;
+	std::atomic<uint32_t> _head{ 0 };
+};
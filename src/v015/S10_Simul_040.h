@@ -11,10 +11,20 @@
  * - C10 해석 결과(ST_A20_ResolvedWind_t) 기반 파라미터 적용
  * - PresetCode + StyleCode 기반 풍속 특성(범위·확률·스펙트럼) 자동 세팅
  * - Von Kármán 스펙트럼 난류 모델 + Phase별 풍속 재생성 로직
+ *   (band 이득 캐시: L/σ 변경 시에만 재계산, 풍속은 매 tick 정확값 + sinf/cosf 1쌍 점화식 합성)
  * - 돌풍(Gust), 열기포(Thermal Bubble), 자연감 지터(Jitter) 확률적 발생
- * - 최근 60초 풍속 이력 순환 버퍼(history) 및 평균 캐시 관리
- * - 최근 120초 Chart 버퍼(1Hz 샘플링) 관리 및 JSON 직렬화 지원
+ * - 최근 60샘플 풍속 이력 순환 버퍼(history) 및 평균 캐시 관리(O(1) 누적합)
+ * - 1Hz 풍속 이동 통계(10s/60s/10min: 평균/표준편차/min/max/EWMA/TI) 산출
+ * - Chart 이력 고정 용량 순환 버퍼(1Hz 샘플링, window 120~N 설정, PSRAM 옵션) 및 JSON 직렬화 지원
  * - diffOnly 모드 지원 (WebSocket/REST 효율 전송)
+ * - WS hot path용 스트리밍 직렬화(writeJson/writeChartJson): 고정 버퍼 직접 기록, JsonDocument 미사용
+ * - Chart binary frame(toChartBinFrom): 헤더 + int16 양자화 풍속/PWM + flag bit-pack + varint 시간 delta
+ * - Chart seq 기반 범위 직렬화(toChartJsonFrom/toChartBinFrom): client별 누락 구간만 전송, 초과 시 resync
+ * - 상태 스냅샷 seqlock 발행(tick 1회) → Web/WS reader는 무잠금 복사 (연속 충돌 시 잠금 복사 fallback, 누락 없음)
+ * - 고정주기(전용 task) 구동 모드 + step 주기 지터 통계
+ * - 설정 섹션 RCU read (fanConfig는 tick마다 값 복사, 포인터 미보유)
+ * - 인스턴스 전용 PRNG(_prng): 실기/headless 인스턴스 간 난수열 공유 없음, seed 패치는 uint32 검증
+ * - 시간 공급원 추상화(CL_S10_Clock): 기본 millis(), 가상 시계 주입 시 headless 고속 구동
  * - Phase 변화 또는 급격한 풍속 변화 시 실시간 WebSocket 브로드캐스트
  * - C10_ControlManager 및 W10_WebAPI와 완전 호환 구조
  * ------------------------------------------------------
@@ -50,13 +60,17 @@
 #include <freertos/task.h>
 #include <string.h>
 
+#include <atomic>
 #include <cmath>
-#include <deque>
 
 #include "A20_Const_041.h"
+#include "A20_JsonWriter_041.h"
 #include "C10_Config_041.h"
 #include "D10_Logger_040.h"
 #include "P10_PWM_ctrl_040.h"
+#include "S10_Clock_040.h"
+#include "S10_RingBuf_040.h"
+#include "S10_Stats_040.h"
 
 
 // ------------------------------------------------------
@@ -95,6 +109,105 @@ static const uint32_t G_S10_CHART_HZ2_MS		   = 500u;	 // [ms] 이벤트 중 2Hz
 // 차트 Full Dump 최소 전송 간격(ms) (Web 부하 제어)
 static const uint32_t G_S10_CHART_FULL_MIN_MS	   = 10000u;  // [ms] 10s
 
+// 차트 binary frame (WS /chart opt-in, little-endian)
+//  - layout: ST_S10_ChartBinHdr_t
+//            + int16 wind[count]   (m/s  × G_S10_CHART_BIN_WIND_SCALE)
+//            + int16 pwm[count]    (%    × G_S10_CHART_BIN_PWM_SCALE)
+//            + uint8 gust[(count+7)/8], uint8 thermal[(count+7)/8]  (LSB first)
+//            + varint dtMs[count-1] (LEB128, 직전 record 대비 timestamp 증가분)
+//  - record는 seq 연속 (seq0부터 +1)
+static const uint16_t G_S10_CHART_BIN_MAGIC		   = 0x4353u;  // "SC" (LE)
+static const uint8_t  G_S10_CHART_BIN_VERSION	   = 2u;	   // v2: header seq0 추가
+static const float	  G_S10_CHART_BIN_WIND_SCALE   = 100.0f;   // [1/(m/s)] 0.01 m/s 해상도
+static const float	  G_S10_CHART_BIN_PWM_SCALE	   = 100.0f;   // [1/%]     0.01 % 해상도
+static const uint8_t  G_S10_CHART_BIN_FLAG_FULL	   = 0x01u;	   // hdr.flags: resync(client 데이터 교체, 0: 이어붙임)
+
+// seq 범위 직렬화 1회 최대 record 수 (JSON/binary 공통: resync 1회 payload·공유 버퍼 할당 상한)
+//  - PSRAM window(3600)도 resync는 최신 구간만, 나머지 누락분은 다음 주기 delta
+static const uint16_t G_S10_CHART_RANGE_MAX		   = 240u;	   // [sample]
+
+typedef struct __attribute__((packed)) {
+	uint16_t magic;		 // G_S10_CHART_BIN_MAGIC
+	uint8_t	 version;	 // G_S10_CHART_BIN_VERSION
+	uint8_t	 flags;		 // G_S10_CHART_BIN_FLAG_*
+	uint16_t count;		 // record 수
+	uint8_t	 phase;		 // meta: T_A20_WindPhase_t
+	uint8_t	 metaFlags;	 // meta: bit0=gust, bit1=thermal
+	uint32_t t0Ms;		 // [ms] 첫 record timestamp
+	int16_t	 avgWindQ;	 // meta: avgWind × WIND_SCALE
+	uint8_t	 samples;	 // meta: 평균 샘플 수
+	uint8_t	 reserved;
+	uint32_t seq0;		 // 첫 record seq (record i = seq0 + i)
+} ST_S10_ChartBinHdr_t;
+
+// 풍속 이동 통계 샘플 간격(ms) 및 window(sample)
+static const uint32_t G_S10_STAT_SAMPLE_MS		   = 1000u;	 // [ms] 1Hz (tick 평균)
+static const uint16_t G_S10_STAT_WIN_10S		   = 10u;	 // [sample] 10s
+static const uint16_t G_S10_STAT_WIN_60S		   = 60u;	 // [sample] 60s
+static const uint16_t G_S10_STAT_WIN_10M		   = 600u;	 // [sample] 10min
+
+// 차트 이력 순환 버퍼 용량(sample) / PSRAM 배치 여부
+static const uint16_t G_S10_CHART_CAPACITY		   = G_A20_CHART_WINDOW_MAX;  // [sample]
+#if defined(BOARD_HAS_PSRAM)
+static const bool	  G_S10_CHART_USE_PSRAM		   = true;
+#else
+static const bool	  G_S10_CHART_USE_PSRAM		   = false;
+#endif
+
+// ==================================================
+// [S10 난류(Von Kármán) band 정책 상수]
+// - band 이득(L, σ 의존)만 캐시, 풍속 U는 매 tick 정확값 사용 (진폭 ∝ U^-1/2, 위상속도 ∝ U)
+// ==================================================
+static const uint8_t  G_S10_TURB_BAND_COUNT		   = 12u;	  // [band]
+static const float	  G_S10_TURB_BAND_WIDTH		   = 0.083f;  // [-] band 폭(정규화)
+static const float	  G_S10_TURB_BAND_N_STEP	   = 0.1f;	  // [-] band i 의 정규화 주파수 n_i = (i+1)·step
+
+/**
+ * @brief band별 U 무관 이득 G_i 를 계산합니다.
+ * - S_i = 4σ²(L/U)(1+70.8n_i²)/(1+70.8n_i²)^(5/6) 이므로
+ *   진폭 sqrt(2·S_i·bw) = G_i / sqrt(U),  G_i = σ·sqrt(8·L·bw)·(1+70.8n_i²)^(1/12)
+ */
+inline void S10_turbBandGain(float p_L, float p_sigma, float* p_gain) {
+	const float v_k = p_sigma * sqrtf(8.0f * p_L * G_S10_TURB_BAND_WIDTH);
+	for (uint8_t v_i = 0; v_i < G_S10_TURB_BAND_COUNT; v_i++) {
+		const float v_n = (float)(v_i + 1) * G_S10_TURB_BAND_N_STEP;
+		p_gain[v_i]		= v_k * powf(1.0f + 70.8f * v_n * v_n, 1.0f / 12.0f);
+	}
+}
+
+/**
+ * @brief Σ_i (G_i/sqrt(U))·sin((i+1)·φ + j_i) 를 계산합니다.
+ * - band i 위상 = (i+1)·(phaseAcc + 2π·n_step·U·dt/L) + j_i 이므로 기본 위상 φ 하나로 표현
+ * - sin/cos((i+1)φ): Chebyshev 점화식 (sinf/cosf 1회)
+ * - sin/cos(j_i): |j_i| ≤ 0.1 → 다항 근사 (오차 < 1e-7)
+ */
+inline float S10_turbSynth(const float* p_gain, float p_U, float p_phi, const float* p_jitter) {
+	const float v_s1   = sinf(p_phi);
+	const float v_c1   = cosf(p_phi);
+	const float v_2c1  = 2.0f * v_c1;
+
+	float		v_sPrv = 0.0f, v_cPrv = 1.0f;	// k = 0
+	float		v_sk = v_s1, v_ck = v_c1;		// k = 1
+	float		v_sum  = 0.0f;
+
+	for (uint8_t v_i = 0; v_i < G_S10_TURB_BAND_COUNT; v_i++) {
+		const float v_j	 = p_jitter[v_i];
+		const float v_j2 = v_j * v_j;
+		const float v_sj = v_j * (1.0f - v_j2 * (1.0f / 6.0f));
+		const float v_cj = 1.0f - v_j2 * (0.5f - v_j2 * (1.0f / 24.0f));
+
+		v_sum += p_gain[v_i] * (v_sk * v_cj + v_ck * v_sj);
+
+		const float v_sNx = v_2c1 * v_sk - v_sPrv;
+		const float v_cNx = v_2c1 * v_ck - v_cPrv;
+		v_sPrv			  = v_sk;
+		v_cPrv			  = v_ck;
+		v_sk			  = v_sNx;
+		v_ck			  = v_cNx;
+	}
+	return v_sum / sqrtf(p_U);
+}
+
 // ==================================================
 // [S10 초(Seconds) 정책 상수] (Phase/Thermal duration)
 // - "초" 계열은 정책화하여 Physic CPP에서 사용
@@ -116,6 +229,78 @@ static const float	  G_S10_THERM_DUR_MAX_S		   = 14.0f;	 // [s]
 static const float	  G_S10_THERM_DUR_MUL_CALM	   = 1.3f;	// [-]
 static const float	  G_S10_THERM_DUR_MUL_STRONG   = 0.8f;	// [-]
 
+// step 주기 지터 통계 집계 window(ms)
+static const uint32_t G_S10_STEP_STAT_WINDOW_MS	   = 10000u;  // [ms] 10s
+
+// 스냅샷 seqlock reader 재시도 한도(writer 갱신 중 충돌 시)
+static const uint8_t  G_S10_SNAP_READ_RETRY_MAX	   = 64u;  // [회]
+
+// ======================================================
+// step 주기 지터 통계 (직전 window 결과)
+// ======================================================
+typedef struct {
+	uint32_t count;		   // [step] 직전 window step 수
+	uint32_t periodMs;	   // [ms]   목표 step 주기(motion.timing.simIntervalMs)
+	uint32_t jitterAvgUs;  // [us]   |실제 간격 - 목표 주기| 평균
+	uint32_t jitterMaxUs;  // [us]   |실제 간격 - 목표 주기| 최대
+	bool	 fixedStep;	   // 외부 고정주기(전용 task) 구동 여부
+} ST_S10_StepStats_t;
+
+// ======================================================
+// 시뮬레이션 상태 스냅샷 (seqlock 발행용 POD)
+// - writer: _simMutex 보유 상태에서 _publishSnapshot()
+// - reader: readSnapshot() (무잠금 재시도, G_S10_SNAP_READ_RETRY_MAX 초과 시 잠금 복사)
+// ======================================================
+typedef struct {
+	unsigned long	  tickMs;  // [ms] 발행 시점(_tickNowMs)
+
+	bool			  active;
+	bool			  fanPowerEnabled;
+	T_A20_WindPhase_t phase;
+
+	float			  windSpeed;
+	float			  targetWind;
+	float			  avgWind;
+	uint8_t			  samples;
+
+	bool			  gustActive;
+	bool			  thermalActive;
+	float			  pwmDuty;
+
+	char			  presetCode[24];
+	char			  styleCode[24];
+
+	float			  intensity;
+	float			  variability;
+	float			  gustFreq;
+	float			  fanLimit;
+	float			  minFan;
+
+	float			  turbSigma;
+	float			  turbLenScale;
+	float			  thermalStrength;
+	float			  thermalRadius;
+
+	float			  baseMinWind;
+	float			  baseMaxWind;
+	float			  gustProbBase;
+	float			  gustStrengthMax;
+	float			  thermalFreqBase;
+
+	uint32_t		  seed;
+
+	// 풍속 이동 통계 (1Hz 갱신)
+	ST_S10_WindStat_t stat10s;
+	ST_S10_WindStat_t stat60s;
+	ST_S10_WindStat_t stat10m;
+
+	// step 주기 지터 통계
+	ST_S10_StepStats_t stepStats;
+} ST_S10_SimSnapshot_t;
+
+// 스트리밍 차트 직렬화 시 sim.meta 확장 콜백 (CT10 meta 병합)
+typedef void (*T_S10_chartMetaFn_t)(CL_A20_JsonWriter& p_w, void* p_ctx);
+
 // ======================================================
 // CL_S10_Simulation
 // ======================================================
@@ -188,8 +373,8 @@ class CL_S10_Simulation {
 	float				 windMomentum		 = 0.0f;
 	unsigned long		 lastUpdateMs		 = 0;
 
-	// 최근 풍속 샘플 저장
-	static const uint8_t HISTORY_SIZE		 = 60;	// [sample] 1Hz 기준 60초
+	// 최근 풍속 샘플 저장 (tick 단위)
+	static const uint8_t HISTORY_SIZE		 = 60;	// [sample]
 	float				 history[HISTORY_SIZE];
 	uint8_t				 historyIndex  = 0;
 	uint8_t				 historyCount  = 0;
@@ -206,9 +391,9 @@ class CL_S10_Simulation {
 		bool		  gust_active;
 		bool		  thermal_active;
 	};
-	static std::deque<ST_ChartEntry> s_chartBuffer;
-	static unsigned long			 s_lastChartLogMs;
-	static unsigned long			 s_lastChartSampleMs;
+	static CL_S10_RingBuffer<ST_ChartEntry, G_S10_CHART_CAPACITY> s_chartBuffer;
+	static unsigned long										   s_lastChartLogMs;
+	static unsigned long										   s_lastChartSampleMs;
 
   public:
 	void begin(CL_P10_PWM& p_pwm);
@@ -216,33 +401,201 @@ class CL_S10_Simulation {
 	void resetDefaults();
 
 	void tick();
+	// true: 외부(전용 task)가 주기를 보장 → tick 내부 최소간격/지터 게이트 생략
+	void setFixedStep(bool p_enable);
+	// 시간 공급원 교체 (nullptr: 시스템 시계). begin() 이전 호출 권장
+	void setClock(const CL_S10_Clock* p_clock);
+	// true: 공유 자원(차트 버퍼/CT10 dirty bridge) 미사용 → 별도 인스턴스 오프라인 구동용. begin() 이전 호출
+	void setHeadless(bool p_enable);
 	void applyResolvedWind(const ST_A20_ResolvedWind_t& p_resolved);
+	// 인스턴스 전용 PRNG 재시드 (0: HW 엔트로피). 반환: 적용 seed. begin() 이전 호출 시 begin은 seed 유지
+	uint32_t seedPrng(uint32_t p_seed);
 
 	bool patchFromJson(const JsonDocument& p_doc);
 
 	void toJson(JsonDocument& p_doc);
 	void toChartJson(JsonDocument& p_doc, bool p_diffOnly = false);
 
+	/**
+	 * 스트리밍 직렬화 (WS hot path, toJson / toChartJson(diffOnly=true)와 동일 key·순서)
+	 * - 열린 object 안에 "sim" key를 기록. 스냅샷 실패/차트 없음 시 미기록(false)
+	 * - p_metaFn: sim.meta object 닫기 직전 호출 (CT10 meta 병합용, nullptr 허용)
+	 */
+	bool writeJson(CL_A20_JsonWriter& p_w);
+	bool writeChartJson(CL_A20_JsonWriter& p_w, T_S10_chartMetaFn_t p_metaFn, void* p_ctx);
+
+	/**
+	 * 차트 seq 범위 직렬화 (client별 delta sync, full dump 간격 제한 없음)
+	 * - [p_fromSeq, head) 전송. p_fromSeq==0(신규) 또는 누락 구간이 window/p_maxCount 초과 → resync(최근 p_maxCount개)
+	 * - p_nextSeq: 다음 요청 seq (= 직렬화한 마지막 seq + 1, 새 샘플 없으면 p_fromSeq)
+	 * - 반환: JSON → record 수 / binary → 기록 바이트 수 (0: 새 샘플 없음/용량 부족)
+	 */
+	uint16_t toChartJsonFrom(JsonDocument& p_doc, uint32_t p_fromSeq, uint16_t p_maxCount, uint32_t& p_nextSeq);
+	size_t	 toChartBinFrom(uint8_t* p_buf, size_t p_cap, uint32_t p_fromSeq, uint16_t p_maxCount, uint32_t& p_nextSeq) const;
+	static size_t chartBinMaxBytes(uint16_t p_count);
+	// toChartBinFrom 필요 버퍼 크기 (동일 인자 기준 record 수 상한)
+	static size_t chartBinCapFrom(uint32_t p_fromSeq, uint16_t p_maxCount);
+
+	static uint32_t chartHeadSeq() {
+		return s_chartBuffer.headSeq();
+	}
+
+	// 최신 발행 스냅샷 복사 (무잠금 재시도 → 한도 초과 시 _simMutex 잠금 복사, 항상 true)
+	bool readSnapshot(ST_S10_SimSnapshot_t& p_out) const;
+
+	// readSnapshot 잠금 fallback 누적 횟수 (진단용)
+	uint32_t snapLockedReads() const {
+		return _snapLockedReads.load(std::memory_order_relaxed);
+	}
+
   private:
+	// seq 범위 결정: 반환 true = resync
+	static bool chartRangeFrom(uint32_t p_fromSeq, uint16_t p_maxCount, uint32_t& p_start, uint32_t& p_head);
+
 	CL_P10_PWM*				  _pwm		  = nullptr;
 
-	const ST_A20_FanConfig_t* _fanCfgSnap = nullptr;
+	// 인스턴스 전용 PRNG (tick/patch 모두 _simMutex 보유 구간에서만 접근, 전역 g_A20_prng 미사용)
+	ST_A20_PrngState_t		  _prng;
 
-	portMUX_TYPE			  _simMutex	  = portMUX_INITIALIZER_UNLOCKED;
+	// fanConfig 값 복사 (RCU: system 섹션 포인터를 tick 간 보유하지 않음)
+	ST_A20_FanConfig_t		  _fanCfgVal  = {0, 0, 0, 0};
+	bool					  _fanCfgValid = false;
+
+	// readSnapshot 잠금 fallback에서도 사용 → mutable
+	mutable portMUX_TYPE	  _simMutex	  = portMUX_INITIALIZER_UNLOCKED;
+
+	// 상태 스냅샷 seqlock (홀수 = 갱신 중)
+	ST_S10_SimSnapshot_t	  _snap		  = {};
+	std::atomic<uint32_t>	  _snapSeq{ 0 };
+	mutable std::atomic<uint32_t> _snapLockedReads{ 0 };
+
+	const CL_S10_Clock*		  _clock	  = &g_S10_sysClock;
+	bool					  _headless	  = false;
+
+	// 차트 preset 인덱스 (presetCode 변경 시 1회 intern → 차트 샘플마다 코드 검색 생략)
+	int8_t					  _chartPresetIdx = -1;
 
 	unsigned long			  _tickNowMs  = 0;
 	float					  _tickNowSec = 0.0f;
 
+	// history 누적합 (avgWindCached O(1) 갱신, 1회전마다 재합산으로 오차 제거)
+	float					  _historySum = 0.0f;
+
+	// 풍속 이동 통계 (1Hz 평균 샘플 입력)
+	CL_S10_RollingStat<G_S10_STAT_WIN_10S> _stat10s;
+	CL_S10_RollingStat<G_S10_STAT_WIN_60S> _stat60s;
+	CL_S10_RollingStat<G_S10_STAT_WIN_10M> _stat10m;
+	ST_S10_WindStat_t		  _statRes[3]	= {};  // 0=10s, 1=60s, 2=10min
+	float					  _statAccSum	= 0.0f;
+	uint16_t				  _statAccCount = 0;
+	unsigned long			  _statLastMs	= 0;
+
+	// step 주기 지터 통계 (tick 내부 집계)
+	bool					  _fixedStep	  = false;
+	uint32_t				  _stepLastUs	  = 0;	// [us]
+	uint64_t				  _stepJitSumUs	  = 0;	// [us]
+	uint32_t				  _stepJitMaxUs	  = 0;	// [us]
+	uint32_t				  _stepJitCount	  = 0;
+	unsigned long			  _stepWinStartMs = 0;	// [ms]
+	ST_S10_StepStats_t		  _stepStats	  = {};
+
+	// 난류 band 이득 캐시 (calcTurb 전용, L/σ 변경 시에만 재계산)
+	float					  _turbBandGain[G_S10_TURB_BAND_COUNT] = { 0 };
+	float					  _turbCacheLen						   = -1.0f;
+	float					  _turbCacheSigma					   = -1.0f;
+	bool					  _turbCacheValid					   = false;
+
 	void applyFan(float p_pct);
 	void applyPresetCore(const char* p_code);
 	void initPhaseFromBase();
 	void updatePhase();
 	void calcTurb(float p_dt);
+	void _rebuildTurbCoeffs(float p_L, float p_sigma);
 	void calcThermalEnvelope();
 	void updateGust();
 	void updateThermal();
 	void generateTarget();
 
+	void _captureTickTime();
+	void _captureFanConfig();
+	void _publishSnapshot();
+	void _recordStepJitter(uint32_t p_periodMs);
+
 	void _updateWindHistory(float p_speed);
+	void _resetWindStats();
 	float _getAvgWindFast() const;
 };
+
+// ======================================================
+// field list (JsonDocument / 스트리밍 경로 공용)
+// - p_w: CL_A20_JsonWriter 또는 CL_A20_JsonDocSink (A20_JsonDocSink_041.h)
+// - toJson/writeJson, toChartJson/toChartJsonFrom/writeChartJson 모두 이 목록만 사용 → key 이름/순서 단일 정의
+// ======================================================
+static inline const char* S10_phaseName(T_A20_WindPhase_t p_phase) {
+	uint8_t v_phase = (uint8_t)p_phase;
+	if (v_phase >= (uint8_t)EN_A20_WEATHER_PHASE_COUNT) v_phase = 0;
+	return g_A20_WEATHER_PHASE_NAMES_Arr[v_phase];
+}
+
+// "sim" object 내부 (상태)
+template <typename T>
+void S10_emitSimState(T& p_w, const ST_S10_SimSnapshot_t& p_s) {
+	p_w.kv("active", p_s.active);
+	p_w.kv("fanPowerEnabled", p_s.fanPowerEnabled);
+
+	p_w.kv("phase", S10_phaseName(p_s.phase));
+	p_w.kv("windSpeed", p_s.windSpeed);
+	p_w.kv("targetWind", p_s.targetWind);
+
+	p_w.kv("gustActive", p_s.gustActive);
+	p_w.kv("thermalActive", p_s.thermalActive);
+
+	p_w.kv("pwmDuty", p_s.pwmDuty);
+
+	p_w.kv("presetCode", (const char*)p_s.presetCode);
+	p_w.kv("styleCode", (const char*)p_s.styleCode);
+
+	p_w.kv("intensity", p_s.intensity);
+	p_w.kv("variability", p_s.variability);
+	p_w.kv("gustFreq", p_s.gustFreq);
+
+	p_w.kv("fanLimit", p_s.fanLimit);
+	p_w.kv("minFan", p_s.minFan);
+
+	p_w.kv("turbSigma", p_s.turbSigma);
+	p_w.kv("turbLenScale", p_s.turbLenScale);
+
+	p_w.kv("thermalStrength", p_s.thermalStrength);
+	p_w.kv("thermalRadius", p_s.thermalRadius);
+
+	p_w.kv("baseMinWind", p_s.baseMinWind);
+	p_w.kv("baseMaxWind", p_s.baseMaxWind);
+	p_w.kv("gustProbBase", p_s.gustProbBase);
+	p_w.kv("gustStrengthMax", p_s.gustStrengthMax);
+	p_w.kv("thermalFreqBase", p_s.thermalFreqBase);
+
+	p_w.kv("seed", p_s.seed);
+}
+
+// "sim.meta" object 내부 (CT10 meta는 호출자가 이어서 기록)
+template <typename T>
+void S10_emitChartMeta(T& p_w, const ST_S10_SimSnapshot_t& p_s) {
+	p_w.kv("phase", S10_phaseName(p_s.phase));
+	p_w.kv("avgWind", p_s.avgWind);
+	p_w.kv("gustActive", p_s.gustActive);
+	p_w.kv("thermalActive", p_s.thermalActive);
+	p_w.kv("samples", p_s.samples);
+}
+
+// "sim.chart" 배열 원소 1개
+template <typename T>
+void S10_emitChartEntry(T& p_w, uint32_t p_seq, const CL_S10_Simulation::ST_ChartEntry& p_e) {
+	p_w.beginObject();
+	p_w.kv("seq", p_seq);
+	p_w.kv("ts", (uint32_t)(p_e.timestamp / 1000UL));
+	p_w.kv("wind", p_e.wind_speed);
+	p_w.kv("pwm", p_e.pwm_duty);
+	p_w.kv("gustActive", p_e.gust_active);
+	p_w.kv("thermalActive", p_e.thermal_active);
+	p_w.endObject();
+}
@@ -7,10 +7,15 @@
  * 기능 요약:
  * - CL_S10_Simulation Core 구현부
  *   - begin/stop/resetDefaults/tick/applyResolvedWind/applyFan
- * - tick 시간 캡처 일관성 유지(_tickNowMs/_tickNowSec)
+ *   - 최근 풍속 history / 1Hz 이동 통계 갱신(_updateWindHistory/_resetWindStats)
+ * - tick 시간 캡처 일관성 유지(_tickNowMs/_tickNowSec, 주입된 CL_S10_Clock 경유)
+ * - headless 모드: 공유 차트 버퍼/CT10 dirty bridge 미사용
  * - 주기 정책 상수는 S10_Simul_022.h로 승격되어 공용 사용
  * - fanConfig 포인터 스냅샷(락 내 1회 캡처) 기반 PWM 커브 적용
- * - 브로드캐스트는 락 밖에서 수행(JsonDocument 생성/A00_* 호출 금지 준수)
+ * - 브로드캐스트는 락 밖에서 dirty 통지만 수행(JsonDocument 미사용 → host 빌드 대상)
+ * - 상태 변경 지점(tick/applyResolvedWind/stop)에서 스냅샷 발행(_publishSnapshot)
+ * - applyResolvedWind: valid ResolvedWind는 base 포함 → WindDict 코드 검색 생략
+ * - 차트 preset 인덱스는 presetCode 변경 시 1회 intern(_chartPresetIdx) → 샘플마다 코드 검색 없음
  * ------------------------------------------------------
  */
 
@@ -33,28 +38,108 @@ void CL_S10_Simulation::begin(CL_P10_PWM& p_pwm) {
 	_pwm		= &p_pwm;
 
 	// fanConfig 스냅샷 초기화
-	_fanCfgSnap = nullptr;
+	_fanCfgValid = false;
+
+	// 인스턴스 전용 PRNG seed 확보 (seedPrng 미호출 시 HW RNG 기반 seed)
+	if (!_prng.seeded) {
+		A20_prngSeed(_prng, 0u);
+	}
 
 	resetDefaults();
 
-	// 풍속 이력 버퍼(history) 초기화 및 인덱스 리셋 (평균 풍속 계산용)
-	memset(history, 0, sizeof(history));
-	historyIndex  = 0;
-	historyCount  = 0;
-	avgWindCached = 0.0f;
+	// 풍속 이력 버퍼(history) 및 이동 통계 초기화 (평균/TI 계산용)
+	_resetWindStats();
+
+	// 초기 상태 스냅샷 발행
+	portENTER_CRITICAL(&_simMutex);
+	_publishSnapshot();
+	portEXIT_CRITICAL(&_simMutex);
+
+	// headless 인스턴스는 공유 차트 버퍼/로그 미사용
+	if (_headless) {
+		return;
+	}
+
+	CL_D10_Logger::log(EN_L10_LOG_INFO, "[S10] prng seed=%lu", (unsigned long)_prng.seed);
 
-	// ESP32 HW RNG 호출(시드/지터 유도)
-	(void)esp_random();
+	// 차트 이력 버퍼 저장 공간 1회 확보(PSRAM 우선 옵션)
+	if (!s_chartBuffer.begin(G_S10_CHART_USE_PSRAM)) {
+		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[S10] chart buffer alloc failed");
+	} else {
+		CL_D10_Logger::log(EN_L10_LOG_INFO, "[S10] chart buffer cap=%u psram=%d", (unsigned)s_chartBuffer.capacity(), s_chartBuffer.inPsram() ? 1 : 0);
+	}
 
 	CL_D10_Logger::log(EN_L10_LOG_INFO, "[S10] begin()");
 }
 
+/**
+ * @brief 시간 공급원 설정 (nullptr이면 시스템 시계)
+ * - 가상 시계 주입 시 tick 최소간격/phase/돌풍/통계 모두 가상 시간 기준으로 진행
+ */
+void CL_S10_Simulation::setClock(const CL_S10_Clock* p_clock) {
+	portENTER_CRITICAL(&_simMutex);
+	_clock		= p_clock ? p_clock : &g_S10_sysClock;
+	_stepLastUs = 0;
+	portEXIT_CRITICAL(&_simMutex);
+}
+
+/**
+ * @brief headless 모드 설정 (차트 버퍼/CT10 dirty bridge/로그 미사용)
+ */
+void CL_S10_Simulation::setHeadless(bool p_enable) {
+	portENTER_CRITICAL(&_simMutex);
+	_headless = p_enable;
+	portEXIT_CRITICAL(&_simMutex);
+}
+
+/**
+ * @brief 인스턴스 전용 PRNG 재시드 (0이면 HW 엔트로피)
+ * - 재현 구동(headless)은 begin() 이전에 호출 → resetDefaults의 phase 난수부터 동일 seed 적용
+ */
+uint32_t CL_S10_Simulation::seedPrng(uint32_t p_seed) {
+	portENTER_CRITICAL(&_simMutex);
+	const uint32_t v_seed = A20_prngSeed(_prng, p_seed);
+	portEXIT_CRITICAL(&_simMutex);
+	return v_seed;
+}
+
+/**
+ * @brief tick 기준 시간 1회 캡처 (_tickNowMs/_tickNowSec 일관성)
+ */
+void CL_S10_Simulation::_captureTickTime() {
+	_tickNowMs	= _clock->nowMs();
+	_tickNowSec = (float)_tickNowMs / 1000.0f;
+}
+
+/**
+ * @brief fanConfig 값 복사 (system 섹션 RCU 1회 load, 락 내 호출)
+ */
+void CL_S10_Simulation::_captureFanConfig() {
+	const ST_A20_SystemConfig_t* v_sys = C10_rcuRead(g_A20_config_root.system);
+	_fanCfgValid = (v_sys != nullptr);
+	if (_fanCfgValid) {
+		_fanCfgVal = v_sys->hw.fanConfig;
+	}
+}
+
+/**
+ * @brief 고정주기 구동 모드 설정 (전용 task 사용 시 true)
+ */
+void CL_S10_Simulation::setFixedStep(bool p_enable) {
+	portENTER_CRITICAL(&_simMutex);
+	_fixedStep	= p_enable;
+	_stepLastUs = 0;
+	portEXIT_CRITICAL(&_simMutex);
+}
+
 /**
  * @brief 시뮬레이션을 정지하고 팬을 끕니다.
  */
 void CL_S10_Simulation::stop() {
+	portENTER_CRITICAL(&_simMutex);
+
 	active				= false;
-	_fanCfgSnap			= nullptr;
+	_fanCfgValid		= false;
 
 	phase				= EN_A20_WEATHER_PHASE_CALM;
 	targetWindSpeed		= 0.0f;
@@ -65,9 +150,16 @@ void CL_S10_Simulation::stop() {
 	thermalActive		= false;
 	thermalContribution = 0.0f;
 
+	// 재개 시 첫 간격은 지터 통계에서 제외
+	_stepLastUs			= 0;
+
 	if (_pwm) {
 		_pwm->P10_setDutyPercent(0.0f);
 	}
+
+	_publishSnapshot();
+
+	portEXIT_CRITICAL(&_simMutex);
 }
 
 /**
@@ -75,7 +167,7 @@ void CL_S10_Simulation::stop() {
  */
 void CL_S10_Simulation::resetDefaults() {
 	active			= false;
-	_fanCfgSnap		= nullptr;
+	_fanCfgValid	= false;
 
 	fanPowerEnabled = true;
 
@@ -84,6 +176,7 @@ void CL_S10_Simulation::resetDefaults() {
 	memset(styleCode, 0, sizeof(styleCode));
 	strlcpy(presetCode, "OCEAN", sizeof(presetCode));
 	strlcpy(styleCode, "BALANCE", sizeof(styleCode));
+	_chartPresetIdx = A20_getPresetIndexByCode(presetCode);
 
 	// 사용자 설정
 	userIntensity		= 70.0f;
@@ -118,6 +211,7 @@ void CL_S10_Simulation::resetDefaults() {
 	spectralEnergyBuf	= 0.0f;
 	spectralPhaseAcc	= 0.0f;
 	turbTimeScale		= 5.0f;
+	_turbCacheValid		= false;
 
 	// 이벤트
 	gustActive			= false;
@@ -126,8 +220,7 @@ void CL_S10_Simulation::resetDefaults() {
 	thermalContribution = 0.0f;
 
 	// 시간 기준 초기화(캡처)
-	_tickNowMs			= millis();
-	_tickNowSec			= (float)_tickNowMs / 1000.0f;
+	_captureTickTime();
 	lastUpdateMs		= _tickNowMs;
 
 	// 체크 주기 타임스탬프
@@ -147,13 +240,8 @@ void CL_S10_Simulation::resetDefaults() {
  * 주기적으로 호출되어 풍속을 계산하고 PWM에 반영합니다.
  */
 void CL_S10_Simulation::tick() {
-	// ---- (A) 락 밖에서 브로드캐스트 수행을 위한 로컬 스냅샷 ----
-	bool			  v_needBroadcast = false;
-	float			  v_bc_avgWind	  = 0.0f;
-	float			  v_bc_target	  = 0.0f;
-	uint8_t			  v_bc_samples	  = 0;
-	float			  v_bc_delta	  = 0.0f;
-	T_A20_WindPhase_t v_bc_phase	  = EN_A20_WEATHER_PHASE_NORMAL;
+	// ---- (A) 락 밖에서 dirty 통지 여부 (값은 WS 송신 시 스냅샷에서 읽음) ----
+	bool v_needBroadcast = false;
 
 	portENTER_CRITICAL(&_simMutex);
 
@@ -164,30 +252,33 @@ void CL_S10_Simulation::tick() {
 	}
 
 	// 2) fanConfig 스냅샷(락 내 1회 캡처)
-	_fanCfgSnap = nullptr;
-	if (g_A20_config_root.system != nullptr) {
-		_fanCfgSnap = &g_A20_config_root.system->hw.fanConfig;
-	}
+	_captureFanConfig();
 
 	// 3) tick 기준 시간(딱 1회 캡처)
-	_tickNowMs					   = millis();
-	_tickNowSec					   = (float)_tickNowMs / 1000.0f;
+	_captureTickTime();
 
 	// 4) tick 업데이트 최소 간격(지터 포함)
 	// - BASE + [0..RANGE-1]
-	uint32_t v_baseMs = G_S10_TICK_MIN_BASE_MS;
-	if (g_A20_config_root.motion != nullptr) {
-		v_baseMs = (uint32_t)g_A20_config_root.motion->timing.simIntervalMs;
+	uint32_t					 v_baseMs  = G_S10_TICK_MIN_BASE_MS;
+	const ST_A20_MotionConfig_t* v_motion = C10_rcuRead(g_A20_config_root.motion);
+	if (v_motion != nullptr) {
+		v_baseMs = (uint32_t)v_motion->timing.simIntervalMs;
 	}
 
-	const uint32_t v_jitterMs	   = (G_S10_TICK_JITTER_RANGE_MS > 0u) ? (esp_random() % G_S10_TICK_JITTER_RANGE_MS) : 0u;
-	const uint32_t v_minIntervalMs = v_baseMs + v_jitterMs;
+	// - 고정주기 모드(전용 task)는 호출 주기 자체가 step 주기이므로 게이트 생략
+	if (!_fixedStep) {
+		const uint32_t v_jitterMs	   = (G_S10_TICK_JITTER_RANGE_MS > 0u) ? (A20_randU32(_prng) % G_S10_TICK_JITTER_RANGE_MS) : 0u;
+		const uint32_t v_minIntervalMs = v_baseMs + v_jitterMs;
 
-	if (_tickNowMs - lastUpdateMs < (unsigned long)v_minIntervalMs) {
-		portEXIT_CRITICAL(&_simMutex);
-		return;
+		if (_tickNowMs - lastUpdateMs < (unsigned long)v_minIntervalMs) {
+			portEXIT_CRITICAL(&_simMutex);
+			return;
+		}
 	}
 
+	// 4-1) step 주기 지터 통계
+	_recordStepJitter(v_baseMs);
+
 	// 5) dt 계산
 	float v_dt							= (_tickNowMs - lastUpdateMs) / 1000.0f;
 	v_dt								= A20_clampf(v_dt, 0.001f, 0.5f);
@@ -220,11 +311,11 @@ void CL_S10_Simulation::tick() {
 	// 11) 목표 재생성(확률)
 	const float v_th	 = 0.5f + (currentWindSpeed / 20.0f);
 	if (fabsf(v_diff) < v_th) {
-		if (A20_randRange(0.0f, 100.0f) < 30.0f) {
+		if (A20_randRange(_prng, 0.0f, 100.0f) < 30.0f) {
 			generateTarget();
 		}
 	} else {
-		if (A20_randRange(0.0f, 100.0f) < 6.0f) {
+		if (A20_randRange(_prng, 0.0f, 100.0f) < 6.0f) {
 			generateTarget();
 		}
 	}
@@ -242,18 +333,15 @@ void CL_S10_Simulation::tick() {
 	const float v_delta = fabsf(currentWindSpeed - v_prevWind);
 	if (phase != v_prevPhase || v_delta > 2.0f) {
 		v_needBroadcast = true;
-		v_bc_avgWind	= _getAvgWindFast();
-		v_bc_target		= targetWindSpeed;
-		v_bc_samples	= historyCount;
-		v_bc_delta		= v_delta;
-		v_bc_phase		= phase;
 	}
 
-	// 15) 차트 샘플링(1Hz / 이벤트 중 2Hz)
+	// 15) 차트 샘플링(1Hz / 이벤트 중 2Hz, headless는 공유 버퍼 미사용)
 	const uint32_t v_chartIntervalMs = (gustActive || thermalActive) ? G_S10_CHART_HZ2_MS : G_S10_CHART_HZ1_MS;
-	if (_tickNowMs - s_lastChartLogMs > (unsigned long)v_chartIntervalMs) {
-		if (s_chartBuffer.size() >= 120) {
-			s_chartBuffer.pop_front();
+	if (!_headless && _tickNowMs - s_lastChartLogMs > (unsigned long)v_chartIntervalMs) {
+		// 보관 window는 system.webSocket.chartWindow 정책을 따름 (용량 초과 시 버퍼에서 보정)
+		const ST_A20_SystemConfig_t* v_sys = C10_rcuRead(g_A20_config_root.system);
+		if (v_sys != nullptr && v_sys->system.webSocket.chartWindow > 0) {
+			s_chartBuffer.setWindow(v_sys->system.webSocket.chartWindow);
 		}
 
 		ST_ChartEntry v_e{};
@@ -263,39 +351,66 @@ void CL_S10_Simulation::tick() {
 		v_e.intensity		 = userIntensity;
 		v_e.variability		 = userVariability;
 		v_e.turbulence_sigma = turbSigma;
-		v_e.preset_index	 = (uint8_t)A20_getPresetIndexByCode(presetCode);
+		v_e.preset_index	 = (uint8_t)_chartPresetIdx;
 		v_e.gust_active		 = gustActive;
 		v_e.thermal_active	 = thermalActive;
 
-		s_chartBuffer.push_back(v_e);
+		s_chartBuffer.push(v_e);
 		s_lastChartLogMs = _tickNowMs;
 	}
 
-	portEXIT_CRITICAL(&_simMutex);
-
-	// ---- (B) 락 밖에서 브로드캐스트 수행 ----
-	if (v_needBroadcast) {
-		JsonDocument v_doc;	 // JsonDocument 단일 타입 사용
-		JsonObject	 v_sim = v_doc["sim"].to<JsonObject>();
+	// 16) 상태 스냅샷 발행(step당 1회, reader 무잠금 복사용)
+	_publishSnapshot();
 
-		v_sim["phase"]	   = g_A20_WEATHER_PHASE_NAMES_Arr[(uint8_t)v_bc_phase];
-		v_sim["avgWind"]   = v_bc_avgWind;
-		v_sim["target"]	   = v_bc_target;
-		v_sim["samples"]   = v_bc_samples;
-		v_sim["delta"]	   = v_bc_delta;
+	portEXIT_CRITICAL(&_simMutex);
 
+	// ---- (B) 락 밖에서 dirty 통지 (payload는 CT10 WS 송신 경로가 스냅샷으로 직렬화) ----
+	if (v_needBroadcast && !_headless) {
 		CT10_markDirtyFromSim("chart");
 		// 차트 갱신 시 metrics도 같이 갱신되는 정책이면 함께 dirty 권장
 		CT10_markDirtyFromSim("metrics");
-		
-		// A00_broadcastChart(v_doc, true);
-		// A00_markDirty("chart");
 	}
 }
 
 // ==================================================
 // 해석 결과 적용: resolveWindParams → 여기 호출
 // ==================================================
+/**
+ * @brief step 간격의 목표 주기 대비 편차(지터)를 집계합니다. (_simMutex 보유 상태)
+ * - 정지 후 재개 등 목표 주기 4배 초과 간격은 제외
+ * - G_S10_STEP_STAT_WINDOW_MS 마다 결과(_stepStats) 갱신
+ */
+void CL_S10_Simulation::_recordStepJitter(uint32_t p_periodMs) {
+	const uint32_t v_nowUs	  = _clock->nowUs();
+	const uint32_t v_targetUs = p_periodMs * 1000u;
+
+	if (_stepLastUs != 0u) {
+		const uint32_t v_intervalUs = v_nowUs - _stepLastUs;
+		if (v_intervalUs <= v_targetUs * 4u) {
+			const uint32_t v_jitUs = (v_intervalUs > v_targetUs) ? (v_intervalUs - v_targetUs) : (v_targetUs - v_intervalUs);
+			_stepJitSumUs += v_jitUs;
+			if (v_jitUs > _stepJitMaxUs) {
+				_stepJitMaxUs = v_jitUs;
+			}
+			_stepJitCount++;
+		}
+	}
+	_stepLastUs = v_nowUs;
+
+	if (_tickNowMs - _stepWinStartMs >= G_S10_STEP_STAT_WINDOW_MS) {
+		_stepStats.count	   = _stepJitCount;
+		_stepStats.periodMs	   = p_periodMs;
+		_stepStats.jitterAvgUs = (_stepJitCount > 0u) ? (uint32_t)(_stepJitSumUs / _stepJitCount) : 0u;
+		_stepStats.jitterMaxUs = _stepJitMaxUs;
+		_stepStats.fixedStep   = _fixedStep;
+
+		_stepJitSumUs		   = 0;
+		_stepJitMaxUs		   = 0;
+		_stepJitCount		   = 0;
+		_stepWinStartMs		   = _tickNowMs;
+	}
+}
+
 /**
  * @brief WindParam 해석 결과(ST_A20_ResolvedWind_t)를 시뮬레이션 파라미터에 적용합니다.
  */
@@ -303,20 +418,17 @@ void CL_S10_Simulation::applyResolvedWind(const ST_A20_ResolvedWind_t& p_resolve
 	portENTER_CRITICAL(&_simMutex);
 
 	// 시간 캡처(Phase 초기화 시 사용하는 _tickNowSec 일관성 보장)
-	_tickNowMs	= millis();
-	_tickNowSec = (float)_tickNowMs / 1000.0f;
+	_captureTickTime();
 
 	// fanConfig 스냅샷(락 내 1회 캡처)
-	_fanCfgSnap = nullptr;
-	if (g_A20_config_root.system != nullptr) {
-		_fanCfgSnap = &g_A20_config_root.system->hw.fanConfig;
-	}
+	_captureFanConfig();
 
 	// preset/style 코드
 	memset(presetCode, 0, sizeof(presetCode));
 	memset(styleCode, 0, sizeof(styleCode));
 	strlcpy(presetCode, p_resolved.presetCode, sizeof(presetCode));
 	strlcpy(styleCode, p_resolved.styleCode, sizeof(styleCode));
+	_chartPresetIdx = A20_getPresetIndexByCode(presetCode);
 
 	// 사용자 파라미터
 	userIntensity	= constrain(p_resolved.windIntensity, 0.0f, 100.0f);
@@ -337,6 +449,7 @@ void CL_S10_Simulation::applyResolvedWind(const ST_A20_ResolvedWind_t& p_resolve
 	turbSigma		= max(0.0f, p_resolved.turbulenceIntensitySigma);
 	thermalStrength = max(1.0f, p_resolved.thermalBubbleStrength);
 	thermalRadius	= max(0.0f, p_resolved.thermalBubbleRadius);
+	_turbCacheValid = false;	// 난류 band 계수 재계산
 
 	baseMinWind     = p_resolved.baseMinWind;
 	baseMaxWind     = p_resolved.baseMaxWind;
@@ -344,8 +457,10 @@ void CL_S10_Simulation::applyResolvedWind(const ST_A20_ResolvedWind_t& p_resolve
 	gustStrengthMax = p_resolved.gustStrengthMax;
 	thermalFreqBase = p_resolved.thermalFreqBase;
 
-	// Preset 코어 파라미터 재적용
-	applyPresetCore(presetCode);
+	// Preset 코어 파라미터: S20 해석 결과(valid)는 dict preset base를 이미 포함 → dict 재검색 생략
+	if (!p_resolved.valid) {
+		applyPresetCore(presetCode);
+	}
 
 	// variability -> windChangeRate
 	const float v_varNorm = userVariability / 100.0f;
@@ -364,6 +479,8 @@ void CL_S10_Simulation::applyResolvedWind(const ST_A20_ResolvedWind_t& p_resolve
 	// 새 목표 생성
 	generateTarget();
 
+	_publishSnapshot();
+
 	portEXIT_CRITICAL(&_simMutex);
 }
 
@@ -402,9 +519,87 @@ void CL_S10_Simulation::applyFan(float p_pct) {
 	}
 
 	// 6) 커브 적용: 논리 duty(0~1) -> 실제 PWM duty(0~1)
-	const ST_A20_FanConfig_t* v_fc	  = _fanCfgSnap;
+	const ST_A20_FanConfig_t* v_fc	  = _fanCfgValid ? &_fanCfgVal : nullptr;
 	const float				  v_phy01 = _pwm->applyFanConfigCurve(v_fc, v_req01, v_min01, v_max01);
 
 	// 7) 최종 %로 전달
 	_pwm->P10_setDutyPercent(v_phy01 * 100.0f);
 }
+
+// --------------------------------------------------
+// 최근 풍속 이력 관리 (순환 버퍼 기반)
+// --------------------------------------------------
+/**
+ * @brief 현재 풍속을 순환 버퍼(history)에 저장하고 평균 풍속 캐시를 갱신합니다.
+ * - 누적합 가감으로 O(1) 갱신, 버퍼 1회전마다 재합산(부동소수 누적 오차 제거)
+ * - tick 샘플을 1Hz 평균으로 묶어 이동 통계(10s/60s/10min)에 입력
+ */
+void CL_S10_Simulation::_updateWindHistory(float p_speed) {
+	// 1) history 누적합 갱신
+	if (historyCount >= HISTORY_SIZE) {
+		_historySum -= history[historyIndex];
+	} else {
+		historyCount++;
+	}
+	history[historyIndex] = p_speed;
+	_historySum += p_speed;
+	historyIndex = (uint8_t)((historyIndex + 1u) % HISTORY_SIZE);
+
+	if (historyIndex == 0u) {
+		float v_sum = 0.0f;
+		for (uint8_t v_i = 0; v_i < historyCount; v_i++) {
+			v_sum += history[v_i];
+		}
+		_historySum = v_sum;
+	}
+
+	avgWindCached = (historyCount > 0) ? (_historySum / (float)historyCount) : p_speed;
+
+	// 2) 1Hz 평균 샘플 → 이동 통계
+	_statAccSum += p_speed;
+	_statAccCount++;
+
+	if (_tickNowMs - _statLastMs >= (unsigned long)G_S10_STAT_SAMPLE_MS) {
+		const float v_sample = _statAccSum / (float)_statAccCount;
+		_statAccSum			 = 0.0f;
+		_statAccCount		 = 0;
+		_statLastMs			 = _tickNowMs;
+
+		_stat10s.push(v_sample);
+		_stat60s.push(v_sample);
+		_stat10m.push(v_sample);
+
+		_stat10s.summarize(_statRes[0]);
+		_stat60s.summarize(_statRes[1]);
+		_stat10m.summarize(_statRes[2]);
+	}
+}
+
+/**
+ * @brief history/이동 통계 상태 초기화
+ */
+void CL_S10_Simulation::_resetWindStats() {
+	memset(history, 0, sizeof(history));
+	historyIndex  = 0;
+	historyCount  = 0;
+	avgWindCached = 0.0f;
+	_historySum	  = 0.0f;
+
+	_stat10s.reset();
+	_stat60s.reset();
+	_stat10m.reset();
+	memset(_statRes, 0, sizeof(_statRes));
+	_statAccSum	  = 0.0f;
+	_statAccCount = 0;
+	_statLastMs	  = _tickNowMs;
+}
+
+// --------------------------------------------------
+// 캐시된 평균 풍속 반환 (O(1))
+// --------------------------------------------------
+/**
+ * @brief 캐시된 평균 풍속을 반환합니다. (O(1) 접근)
+ */
+float CL_S10_Simulation::_getAvgWindFast() const {
+	return (historyCount > 0) ? avgWindCached : currentWindSpeed;
+}
@@ -5,14 +5,18 @@
  * 모듈명 : Smart Nature Wind 풍속 시뮬레이션 Manager (v022, Full)
  * ------------------------------------------------------
  * 기능 요약:
- * - CL_S10_Simulation 클래스의 IO/직렬화/패치 구현부
+ * - CL_S10_Simulation 클래스의 JsonDocument 기반 IO/직렬화/패치 구현부
+ *   (스냅샷 seqlock/스트리밍 writer/binary frame은 S10_Simul_Stream_040.cpp)
  * - 현재 시뮬레이션 상태(toJson) 및 차트 버퍼(toChartJson) JSON 직렬화
  * - patchFromJson()로 시뮬레이션 파라미터 부분 업데이트(패치) 지원
  * - v022 정책 반영:
  *    - Header(S10_Simul_040.h) 사용
  *    - 차트 전송 간격: G_S10_CHART_FULL_MIN_MS 정책 상수 사용
- *    - 시간 기준: _tickNowMs 우선(0이면 millis() 1회 fallback)
+ *    - 시간 기준: _tickNowMs 우선(0이면 CL_S10_Clock 1회 fallback)
  *    - JSON Key: camelCase 로 통일
+ *    - toJson/차트 meta: seqlock 스냅샷 복사(readSnapshot, "sim" 누락 없음)
+ *    - toChartJsonFrom: seq 범위 직렬화 (client별 delta sync / resync, 범위 결정은 chartRangeFrom)
+ *    - field list: S10_emit* 템플릿 + CL_A20_JsonDocSink (스트리밍 writeJson/writeChartJson과 단일 정의)
  * ------------------------------------------------------
  * [구현 규칙]
  * - 항상 소스 시작 주석 체계 유지 및 내용 업데이트
@@ -46,24 +50,15 @@
 using namespace std;
 
 
-#include <vector>
-
-
 // 외부 종속성 헤더 포함 (외부에서 제공되어야 함: 시스템 상수, 설정, 로그, PWM 제어)
 #include "A20_Const_041.h"
 #include "C10_Config_041.h"
 #include "D10_Logger_040.h"
 #include "P10_PWM_ctrl_040.h"
 #include "S10_Simul_040.h"
+#include "A20_JsonDocSink_041.h"
 
 
-// ------------------------------------------------------
-// 정적 멤버 정의 (클래스 인스턴스와 무관하게 유지되는 공유 데이터)
-// ------------------------------------------------------
-std::deque<CL_S10_Simulation::ST_ChartEntry> CL_S10_Simulation::s_chartBuffer;
-unsigned long								 CL_S10_Simulation::s_lastChartLogMs	= 0;
-unsigned long								 CL_S10_Simulation::s_lastChartSampleMs = 0;
-
 // ==================================================
 // JSON Export (현재 시뮬레이션 상태)
 // ==================================================
@@ -92,58 +87,30 @@ unsigned long								 CL_S10_Simulation::s_lastChartSampleMs = 0;
  *     "turbSigma": 0.5,
  *     "turbLenScale": 40,
  *     "thermalStrength": 2.0,
- *     "thermalRadius": 18
+ *     "thermalRadius": 18,
+ *     "seed": 12345
  *   }
  * }
  */
 void CL_S10_Simulation::toJson(JsonDocument& p_doc) {
-	// 상태 읽기 중 변수 변경 방지
-	portENTER_CRITICAL(&_simMutex);
-
-	JsonObject v_objSim			= p_doc["sim"].to<JsonObject>();
-
-	v_objSim["active"]			= active;
-	v_objSim["fanPowerEnabled"] = fanPowerEnabled;
-
-	v_objSim["phase"]			= g_A20_WEATHER_PHASE_NAMES_Arr[(uint8_t)phase];
-	v_objSim["windSpeed"]		= currentWindSpeed;
-	v_objSim["targetWind"]		= targetWindSpeed;
-
-	v_objSim["gustActive"]		= gustActive;
-	v_objSim["thermalActive"]	= thermalActive;
-
-	v_objSim["pwmDuty"]			= _pwm ? _pwm->P10_getDutyPercent() : 0.0f;
-
-	v_objSim["presetCode"]		= presetCode;
-	v_objSim["styleCode"]		= styleCode;
-
-	v_objSim["intensity"]		= userIntensity;
-	v_objSim["variability"]		= userVariability;
-	v_objSim["gustFreq"]		= userGustFreq;
-
-	v_objSim["fanLimit"]		= fanLimitPct;
-	v_objSim["minFan"]			= minFanPct;
-
-	v_objSim["turbSigma"]		= turbSigma;
-	v_objSim["turbLenScale"]	= turbLenScale;
-
-	v_objSim["thermalStrength"] = thermalStrength;
-	v_objSim["thermalRadius"]	= thermalRadius;
-
-	v_objSim["baseMinWind"]     = baseMinWind;
-	v_objSim["baseMaxWind"]     = baseMaxWind;
-	v_objSim["gustProbBase"]    = gustProbBase;
-	v_objSim["gustStrengthMax"] = gustStrengthMax;
-	v_objSim["thermalFreqBase"] = thermalFreqBase;
-
-	portEXIT_CRITICAL(&_simMutex);
+	// 발행 스냅샷 무잠금 복사 (tick/physics 비차단)
+	ST_S10_SimSnapshot_t v_s;
+	(void)readSnapshot(v_s);	 // 항상 성공 (충돌 지속 시 잠금 복사)
+
+	// field list: S10_emitSimState (writeJson과 공용)
+	CL_A20_JsonDocSink v_sink(A20_docRootObject(p_doc));
+	v_sink.beginObject();
+	v_sink.beginObject("sim");
+	S10_emitSimState(v_sink, v_s);
+	v_sink.endObject();
+	v_sink.endObject();
 }
 
 // ==================================================
 // 차트 데이터 JSON Export (/api/sim/chart)
 // ==================================================
 /**
- * @brief 차트 버퍼(s_chartBuffer)의 내용을 JSON Array로 직렬화합니다.
+ * @brief 차트 버퍼(s_chartBuffer, 순환 버퍼)의 window 범위를 JSON Array로 직렬화합니다.
  * @param p_doc JSON 문서
  * @param p_diffOnly true인 경우, 마지막 1개 샘플만 전송 (WebSocket/REST diff 전송)
  *
@@ -166,96 +133,116 @@ void CL_S10_Simulation::toJson(JsonDocument& p_doc) {
  * }
  */
 void CL_S10_Simulation::toChartJson(JsonDocument& p_doc, bool p_diffOnly) {
-	// 시간 기준: _tickNowMs 우선, 0이면 millis() 1회 fallback
+	// 시간 기준: _tickNowMs 우선, 0이면 시계 1회 fallback
 	unsigned long v_nowMs = _tickNowMs;
 	if (v_nowMs == 0UL) {
-		v_nowMs = millis();
+		v_nowMs = _clock->nowMs();
 	}
 
-	// ---- (A) 메타/샘플 스냅샷(락 안에서 값만 캡처) ----
-	T_A20_WindPhase_t		   v_phase = EN_A20_WEATHER_PHASE_NORMAL;
-	float					   v_avg   = 0.0f;
-	bool					   v_gust  = false;
-	bool					   v_therm = false;
-	uint8_t					   v_samp  = 0;
-
-	// chart entries 스냅샷
-	std::vector<ST_ChartEntry> v_entries;
-	v_entries.clear();
-
-	portENTER_CRITICAL(&_simMutex);
-
-	v_phase = phase;
-	v_avg	= _getAvgWindFast();
-	v_gust	= gustActive;
-	v_therm = thermalActive;
-	v_samp	= historyCount;
+	// ---- (A) 메타: 발행 스냅샷 무잠금 복사 ----
+	ST_S10_SimSnapshot_t v_s;
+	(void)readSnapshot(v_s);	 // 항상 성공 (충돌 지속 시 잠금 복사)
 
-	// Full Dump 전송 간격 제한: diffOnly는 제한하지 않음
+	// Full Dump 전송 간격 제한: diffOnly는 제한하지 않음 (reader 전용 상태)
 	if (!p_diffOnly) {
 		const unsigned long v_elapsedMs = (v_nowMs >= s_lastChartSampleMs) ? (v_nowMs - s_lastChartSampleMs) : 0UL;
 		if (v_elapsedMs < G_S10_CHART_FULL_MIN_MS) {
-			portEXIT_CRITICAL(&_simMutex);
 			return;
 		}
 		s_lastChartSampleMs = v_nowMs;
 	}
 
 	if (s_chartBuffer.empty()) {
-		portEXIT_CRITICAL(&_simMutex);
 		return;
 	}
 
-	if (p_diffOnly) {
-		v_entries.reserve(1);
-		v_entries.push_back(s_chartBuffer.back());
-	} else {
-		v_entries.reserve((size_t)s_chartBuffer.size());
-		for (const auto& v_e : s_chartBuffer) {
-			v_entries.push_back(v_e);
+	// ---- (B) JSON 생성 (차트 버퍼는 seq cursor 무잠금 순회, 중간 복사본 없음, field list는 writeChartJson과 공용) ----
+	CL_A20_JsonDocSink v_sink(A20_docRootObject(p_doc));
+	v_sink.beginObject();
+	v_sink.beginObject("sim");
+
+	v_sink.beginObject("meta");
+	S10_emitChartMeta(v_sink, v_s);
+	v_sink.endObject();
+
+	v_sink.beginArray("chart");
+
+	// diffOnly: 마지막 1개만 전송 / Full Dump: window 전체 전송
+	const uint32_t v_head	= s_chartBuffer.headSeq();
+	const uint32_t v_from	= p_diffOnly ? (v_head - 1u) : s_chartBuffer.tailSeq();
+	int			   v_count	= 0;
+
+	ST_ChartEntry  v_e;
+	for (uint32_t v_seq = v_from; v_seq < v_head; v_seq++) {
+		// writer가 덮어쓴 slot은 건너뜀
+		if (!s_chartBuffer.readAt(v_seq, v_e)) {
+			continue;
 		}
+		S10_emitChartEntry(v_sink, v_seq, v_e);
+		v_count++;
 	}
+	v_sink.endArray();
 
-	portEXIT_CRITICAL(&_simMutex);
+	v_sink.kv("chartCount", v_count);
+	v_sink.endObject();
+	v_sink.endObject();
+}
 
-	// ---- (B) 락 밖에서 JSON 생성 ----
-	JsonObject v_objSim		= p_doc["sim"].to<JsonObject>();
-
-	JsonObject v_meta		= v_objSim["meta"].to<JsonObject>();
-	v_meta["phase"]			= g_A20_WEATHER_PHASE_NAMES_Arr[(uint8_t)v_phase];
-	v_meta["avgWind"]		= v_avg;
-	v_meta["gustActive"]	= v_gust;
-	v_meta["thermalActive"] = v_therm;
-	v_meta["samples"]		= v_samp;
-
-	JsonArray v_arr			= v_objSim["chart"].to<JsonArray>();
-
-	// diffOnly: 마지막 1개만 전송
-	if (p_diffOnly) {
-		const ST_ChartEntry& v_e  = v_entries[0];
-		JsonObject			 v_jo = v_arr.add<JsonObject>();
-		v_jo["ts"]				  = (uint32_t)(v_e.timestamp / 1000UL);
-		v_jo["wind"]			  = v_e.wind_speed;
-		v_jo["pwm"]				  = v_e.pwm_duty;
-		v_jo["gustActive"]		  = v_e.gust_active;
-		v_jo["thermalActive"]	  = v_e.thermal_active;
-
-		v_objSim["chartCount"]	  = 1;
-		return;
+/**
+ * @brief 차트 seq 범위 JSON 직렬화 (client별 delta sync)
+ * 출력: { "sim": { "meta":{...}, "chart":[{seq,ts,wind,pwm,gustActive,thermalActive}...],
+ *                  "chartCount":N, "seqFrom":S, "seqNext":S+N, "resync":bool } }
+ */
+uint16_t CL_S10_Simulation::toChartJsonFrom(JsonDocument& p_doc, uint32_t p_fromSeq, uint16_t p_maxCount, uint32_t& p_nextSeq) {
+	p_nextSeq = p_fromSeq;
+	if (s_chartBuffer.empty()) {
+		return 0;
 	}
 
-	// Full Dump: 전체 전송
-	for (size_t v_i = 0; v_i < v_entries.size(); v_i++) {
-		const ST_ChartEntry& v_e  = v_entries[v_i];
-		JsonObject			 v_jo = v_arr.add<JsonObject>();
-		v_jo["ts"]				  = (uint32_t)(v_e.timestamp / 1000UL);
-		v_jo["wind"]			  = v_e.wind_speed;
-		v_jo["pwm"]				  = v_e.pwm_duty;
-		v_jo["gustActive"]		  = v_e.gust_active;
-		v_jo["thermalActive"]	  = v_e.thermal_active;
+	uint32_t v_start  = 0;
+	uint32_t v_head	  = 0;
+	bool	 v_resync = chartRangeFrom(p_fromSeq, p_maxCount, v_start, v_head);
+	if (v_start >= v_head) {
+		return 0;  // 새 샘플 없음
 	}
 
-	v_objSim["chartCount"] = (int)v_entries.size();
+	ST_S10_SimSnapshot_t v_s;
+	(void)readSnapshot(v_s);	 // 항상 성공 (충돌 지속 시 잠금 복사)
+
+	CL_A20_JsonDocSink v_sink(A20_docRootObject(p_doc));
+	v_sink.beginObject();
+	v_sink.beginObject("sim");
+
+	v_sink.beginObject("meta");
+	S10_emitChartMeta(v_sink, v_s);
+	v_sink.endObject();
+
+	v_sink.beginArray("chart");
+	uint16_t	  v_count	= 0;
+	uint32_t	  v_first	= 0;
+	ST_ChartEntry v_e;
+
+	for (uint32_t v_seq = v_start; v_seq < v_head; v_seq++) {
+		if (!s_chartBuffer.readAt(v_seq, v_e)) {
+			// 앞쪽 덮어쓰기는 건너뜀, 이후 실패는 중단(다음 전송에서 이어짐 → seq 연속 보장)
+			if (v_count == 0) continue;
+			break;
+		}
+		if (v_count == 0) v_first = v_seq;
+
+		S10_emitChartEntry(v_sink, v_seq, v_e);
+		v_count++;
+		p_nextSeq = v_seq + 1u;
+	}
+	v_sink.endArray();
+
+	v_sink.kv("chartCount", v_count);
+	v_sink.kv("seqFrom", v_first);
+	v_sink.kv("seqNext", p_nextSeq);
+	v_sink.kv("resync", v_resync);
+	v_sink.endObject();
+	v_sink.endObject();
+	return v_count;
 }
 
 // ==================================================
@@ -281,7 +268,8 @@ void CL_S10_Simulation::toChartJson(JsonDocument& p_doc, bool p_diffOnly) {
  *     "turbLenScale":40,
  *     "turbSigma":0.5,
  *     "thermalStrength":2.0,
- *     "thermalRadius":18
+ *     "thermalRadius":18,
+ *     "seed":12345            (PRNG 재시드, 0 => HW 엔트로피)
  *   }
  * }
  */
@@ -299,12 +287,20 @@ bool CL_S10_Simulation::patchFromJson(const JsonDocument& p_doc) {
 		return false;
 	}
 
+	// seed 형식 검증 (음수/소수/문자열/32bit 초과 → 패치 전체 거부, 부분 적용 없음)
+	if (!v_sim["seed"].isNull() && !v_sim["seed"].is<uint32_t>()) {
+		portEXIT_CRITICAL(&_simMutex);
+		CL_D10_Logger::log(EN_L10_LOG_WARN, "[S10] patchFromJson rejected: 'seed' must be uint32");
+		return false;
+	}
+
 	// presetCode
 	if (!v_sim["presetCode"].isNull() && v_sim["presetCode"].is<const char*>()) {
 		const char* v_new = v_sim["presetCode"].as<const char*>();
 		if (v_new && v_new[0] && strcasecmp(v_new, presetCode) != 0) {
 			memset(presetCode, 0, sizeof(presetCode));
 			strlcpy(presetCode, v_new, sizeof(presetCode));
+			_chartPresetIdx		= A20_getPresetIndexByCode(presetCode);
 			v_changed			= true;
 			v_needPresetReapply = true;
 			v_needPhaseReset	= true;
@@ -428,6 +424,16 @@ bool CL_S10_Simulation::patchFromJson(const JsonDocument& p_doc) {
 		}
 	}
 
+	// seed (동일 seed => 동일 난수열, 난류/관성 상태 리셋 + phase 재설정)
+	if (!v_sim["seed"].isNull()) {
+		A20_prngSeed(_prng, v_sim["seed"].as<uint32_t>());
+		spectralEnergyBuf = 0.0f;
+		spectralPhaseAcc  = 0.0f;
+		windMomentum	  = 0.0f;
+		v_needPhaseReset  = true;
+		v_changed		  = true;
+	}
+
 	// preset 변경 시 core 재적용 + phase 재설정
 	if (v_needPresetReapply) {
 		applyPresetCore(presetCode);
@@ -435,12 +441,15 @@ bool CL_S10_Simulation::patchFromJson(const JsonDocument& p_doc) {
 	if (v_needPhaseReset) {
 		// tick 스냅샷 시간 확보 (patch가 tick 외부에서 호출될 수 있음)
 		if (_tickNowMs == 0UL) {
-			_tickNowMs	= millis();
-			_tickNowSec = (float)_tickNowMs / 1000.0f;
+			_captureTickTime();
 		}
 		initPhaseFromBase();
 	}
 
+	if (v_changed) {
+		_publishSnapshot();
+	}
+
 	// 변경 시 로그
 	if (v_changed) {
 		CL_D10_Logger::log(EN_L10_LOG_INFO, "[S10] patchFromJson applied. preset=%s style=%s intensity=%.1f var=%.1f gust=%.1f fanLimit=%.1f minFan=%.1f turbSigma=%.2f", presetCode, styleCode, userIntensity, userVariability, userGustFreq, fanLimitPct, minFanPct, turbSigma);
@@ -449,33 +458,3 @@ bool CL_S10_Simulation::patchFromJson(const JsonDocument& p_doc) {
 	portEXIT_CRITICAL(&_simMutex);
 	return v_changed;
 }
-
-// --------------------------------------------------
-// 최근 풍속 이력 관리 (순환 버퍼 기반)
-// --------------------------------------------------
-/**
- * @brief 현재 풍속을 순환 버퍼(history)에 저장하고 평균 풍속 캐시를 갱신합니다.
- */
-void CL_S10_Simulation::_updateWindHistory(float p_speed) {
-	history[historyIndex] = p_speed;
-	historyIndex		  = (uint8_t)((historyIndex + 1u) % HISTORY_SIZE);
-	if (historyCount < HISTORY_SIZE) {
-		historyCount++;
-	}
-
-	float v_sum = 0.0f;
-	for (uint8_t v_i = 0; v_i < historyCount; v_i++) {
-		v_sum += history[v_i];
-	}
-	avgWindCached = (historyCount > 0) ? (v_sum / (float)historyCount) : p_speed;
-}
-
-// --------------------------------------------------
-// 캐시된 평균 풍속 반환 (O(1))
-// --------------------------------------------------
-/**
- * @brief 캐시된 평균 풍속을 반환합니다. (O(1) 접근)
- */
-float CL_S10_Simulation::_getAvgWindFast() const {
-	return (historyCount > 0) ? avgWindCached : currentWindSpeed;
-}
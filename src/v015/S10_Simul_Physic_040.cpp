@@ -6,7 +6,7 @@
  * ------------------------------------------------------
  * 기능 요약:
  * - CL_S10_Simulation 클래스의 물리/확률 모델 구현부
- * - Von Kármán 난류(12-band 근사), 관성/목표 풍속 생성
+ * - Von Kármán 난류(12-band 근사, band 계수 캐시), 관성/목표 풍속 생성
  * - Phase( CALM/NORMAL/STRONG ) 확률 전환 + 지속시간 정책
  * - 돌풍(Gust) / 열기포(Thermal Bubble) 확률(초당 rate) 모델 + dt 자동 보정
  * - tick()에서 캡처한 _tickNowMs/_tickNowSec 기반으로 millis() 일관성 유지
@@ -82,10 +82,11 @@ static inline float S10_probFromRatePerSec(float p_ratePerSec, float p_dtSec) {
  */
 void CL_S10_Simulation::applyPresetCore(const char* p_code) {
 	// (기존) 하드코딩 방식에서 WindDict 참조 방식으로 전환
-	if (g_A20_config_root.windDict != nullptr) {
-		int16_t v_idx = A20_findPresetIndexByCode(*g_A20_config_root.windDict, p_code);
+	const ST_A20_WindProfileDict_t* v_dict = C10_rcuRead(g_A20_config_root.windDict);
+	if (v_dict != nullptr) {
+		int16_t v_idx = A20_findPresetIndexByCode(*v_dict, p_code);
 		if (v_idx >= 0) {
-			const ST_A20_WindBase_t& v_base = g_A20_config_root.windDict->presets[v_idx].base;
+			const ST_A20_WindBase_t& v_base = v_dict->presets[v_idx].base;
 			baseMinWind     = v_base.baseMinWind;
 			baseMaxWind     = v_base.baseMaxWind;
 			gustProbBase    = v_base.gustProbBase;
@@ -123,7 +124,7 @@ void CL_S10_Simulation::initPhaseFromBase() {
 	phaseMaxWind	  = baseMinWind + v_span * 0.85f;
 
 	// 지속시간(초) 정책 상수는 헤더(S10_Simul_040.h)에서 공유
-	phaseDurationSec  = A20_randRange(G_S10_PHASE_NORM_DUR_MIN_S, G_S10_PHASE_NORM_DUR_MAX_S);
+	phaseDurationSec  = A20_randRange(_prng, G_S10_PHASE_NORM_DUR_MIN_S, G_S10_PHASE_NORM_DUR_MAX_S);
 
 	// 초기 풍속/목표
 	const float v_mid = (baseMinWind + baseMaxWind) * 0.5f;
@@ -166,7 +167,7 @@ void CL_S10_Simulation::updatePhase() {
 	}
 
 	const T_A20_WindPhase_t v_old = phase;
-	const float				v_r	  = A20_getRandom01();	// 0..1
+	const float				v_r	  = A20_getRandom01(_prng);	// 0..1
 
 	if (v_old == EN_A20_WEATHER_PHASE_CALM) {
 		phase = (v_r < 0.7f) ? EN_A20_WEATHER_PHASE_NORMAL : EN_A20_WEATHER_PHASE_STRONG;
@@ -191,15 +192,15 @@ void CL_S10_Simulation::updatePhase() {
 
 	// Phase별 지속시간/범위 (정책 상수는 헤더 공유)
 	if (phase == EN_A20_WEATHER_PHASE_CALM) {
-		phaseDurationSec = A20_randRange(G_S10_PHASE_CALM_DUR_MIN_S, G_S10_PHASE_CALM_DUR_MAX_S);
+		phaseDurationSec = A20_randRange(_prng, G_S10_PHASE_CALM_DUR_MIN_S, G_S10_PHASE_CALM_DUR_MAX_S);
 		phaseMinWind	 = baseMinWind;
 		phaseMaxWind	 = baseMinWind + v_span * 0.6f;
 	} else if (phase == EN_A20_WEATHER_PHASE_NORMAL) {
-		phaseDurationSec = A20_randRange(G_S10_PHASE_NORM_DUR_MIN_S, G_S10_PHASE_NORM_DUR_MAX_S);
+		phaseDurationSec = A20_randRange(_prng, G_S10_PHASE_NORM_DUR_MIN_S, G_S10_PHASE_NORM_DUR_MAX_S);
 		phaseMinWind	 = baseMinWind + v_span * 0.15f;
 		phaseMaxWind	 = baseMinWind + v_span * 0.85f;
 	} else {  // STRONG
-		phaseDurationSec = A20_randRange(G_S10_PHASE_STRONG_DUR_MIN_S, G_S10_PHASE_STRONG_DUR_MAX_S);
+		phaseDurationSec = A20_randRange(_prng, G_S10_PHASE_STRONG_DUR_MIN_S, G_S10_PHASE_STRONG_DUR_MAX_S);
 		phaseMinWind	 = baseMinWind + v_span * 0.4f;
 		phaseMaxWind	 = baseMaxWind;
 	}
@@ -221,6 +222,8 @@ void CL_S10_Simulation::updatePhase() {
 
 /**
  * @brief Von Kármán 난류 모델을 12개 주파수 밴드 합으로 근사하여 난류 성분을 계산합니다.
+ * - band 이득은 L/σ 변경 시에만 재계산, 풍속은 현재값 그대로 사용 (램프 구간에도 재계산 없음)
+ * - band 합성은 S10_turbSynth (sinf/cosf 1쌍 + 점화식)
  * @param p_dt Delta Time [sec]
  */
 void CL_S10_Simulation::calcTurb(float p_dt) {
@@ -235,28 +238,18 @@ void CL_S10_Simulation::calcTurb(float p_dt) {
 	const float v_sigma = max(0.0f, turbSigma);
 	const float v_U		= max(0.1f, currentWindSpeed);
 
-	float		v_sum	= 0.0f;
-
-	for (int v_i = 1; v_i <= 12; v_i++) {
-		const float v_n			= (float)v_i * 0.1f;
-		const float v_f			= v_n * v_U / v_L;
-		const float v_fLU		= v_f * v_L / v_U;
-
-		const float v_term		= 70.8f * v_fLU * v_fLU;
-		const float v_numer		= 4.0f * v_sigma * v_sigma * (v_L / v_U) * (1.0f + v_term);
-		const float v_denom		= powf(1.0f + v_term, 5.0f / 6.0f);
-		const float v_S			= (v_denom > 0.0f) ? (v_numer / v_denom) : 0.0f;
-
-		const float v_phaseRate = 2.0f * (float)M_PI * v_f;
-		const float v_phaseInc	= v_phaseRate * p_dt;
-
-		const float v_phase		= spectralPhaseAcc * (float)v_i + v_phaseInc + A20_randRange(-0.1f, 0.1f);
+	// 1) 입력(L/σ) 변경 시에만 band 이득 재계산
+	if (!_turbCacheValid || v_L != _turbCacheLen || v_sigma != _turbCacheSigma) {
+		_rebuildTurbCoeffs(v_L, v_sigma);
+	}
 
-		const float v_bandWidth = 0.083f;
-		const float v_amp		= sqrtf(max(0.0f, 2.0f * v_S * v_bandWidth));
+	// 2) band별 위상 지터 일괄 생성
+	float v_jitter[G_S10_TURB_BAND_COUNT];
+	A20_randFillRange(_prng, v_jitter, G_S10_TURB_BAND_COUNT, -0.1f, 0.1f);
 
-		v_sum += v_amp * sinf(v_phase);
-	}
+	// 3) band 합성: 기본 위상 φ = phaseAcc + 2π·n_step·U·dt/L
+	const float v_phi = spectralPhaseAcc + 2.0f * (float)M_PI * G_S10_TURB_BAND_N_STEP * v_U * p_dt / v_L;
+	const float v_sum = S10_turbSynth(_turbBandGain, v_U, v_phi, v_jitter);
 
 	spectralPhaseAcc += p_dt * 0.5f;
 	if (spectralPhaseAcc > 2.0f * (float)M_PI) {
@@ -269,6 +262,17 @@ void CL_S10_Simulation::calcTurb(float p_dt) {
 	spectralEnergyBuf	 = spectralEnergyBuf * v_corr + v_sum * (1.0f - v_corr);
 }
 
+/**
+ * @brief Von Kármán band 이득(U 무관 항)을 재계산하여 캐시에 저장합니다.
+ */
+void CL_S10_Simulation::_rebuildTurbCoeffs(float p_L, float p_sigma) {
+	S10_turbBandGain(p_L, p_sigma, _turbBandGain);
+
+	_turbCacheLen	= p_L;
+	_turbCacheSigma = p_sigma;
+	_turbCacheValid = true;
+}
+
 /**
  * @brief 열기포 활성 시 시간 경과에 따른 가산 기여도(Envelope)를 계산합니다.
  */
@@ -371,9 +375,10 @@ void CL_S10_Simulation::updateGust() {
 	const unsigned long v_nowMs		= _tickNowMs;
 	const unsigned long v_elapsedMs = (v_nowMs >= lastGustCheckMs) ? (v_nowMs - lastGustCheckMs) : 0UL;
 
-	uint32_t v_minGustEvalMs = G_S10_GUST_EVAL_MIN_MS;
-	if (g_A20_config_root.motion != nullptr) {
-		v_minGustEvalMs = (uint32_t)g_A20_config_root.motion->timing.gustIntervalMs;
+	uint32_t					 v_minGustEvalMs = G_S10_GUST_EVAL_MIN_MS;
+	const ST_A20_MotionConfig_t* v_motion = C10_rcuRead(g_A20_config_root.motion);
+	if (v_motion != nullptr) {
+		v_minGustEvalMs = (uint32_t)v_motion->timing.gustIntervalMs;
 	}
 
 	if (v_elapsedMs < v_minGustEvalMs) {
@@ -404,21 +409,21 @@ void CL_S10_Simulation::updateGust() {
 
 	const float v_p			 = S10_probFromRatePerSec(v_ratePerSec, v_dtSec);
 
-	if (A20_getRandom01() < v_p) {
+	if (A20_getRandom01(_prng) < v_p) {
 		gustActive			 = true;
 		gustStartSec		 = v_nowSec;
 
 		const float v_speedF = currentWindSpeed / 6.7f;
 
 		if (phase == EN_A20_WEATHER_PHASE_CALM) {
-			gustDuration  = A20_randRange(3.0f, 8.0f);
-			gustIntensity = A20_randRange(1.08f, 1.33f);
+			gustDuration  = A20_randRange(_prng, 3.0f, 8.0f);
+			gustIntensity = A20_randRange(_prng, 1.08f, 1.33f);
 		} else if (phase == EN_A20_WEATHER_PHASE_STRONG) {
-			gustDuration  = A20_randRange(0.8f, 3.3f);
-			gustIntensity = A20_randRange(1.3f, 1.3f + 0.9f * (1.0f + v_speedF * 0.3f));
+			gustDuration  = A20_randRange(_prng, 0.8f, 3.3f);
+			gustIntensity = A20_randRange(_prng, 1.3f, 1.3f + 0.9f * (1.0f + v_speedF * 0.3f));
 		} else {
-			gustDuration  = A20_randRange(1.8f, 5.8f);
-			gustIntensity = A20_randRange(1.15f, 1.15f + 0.5f * (1.0f + v_speedF * 0.2f));
+			gustDuration  = A20_randRange(_prng, 1.8f, 5.8f);
+			gustIntensity = A20_randRange(_prng, 1.15f, 1.15f + 0.5f * (1.0f + v_speedF * 0.2f));
 		}
 
 		const float v_maxMul = max(1.0f, gustStrengthMax);
@@ -443,9 +448,10 @@ void CL_S10_Simulation::updateThermal() {
 	const unsigned long v_nowMs		= _tickNowMs;
 	const unsigned long v_elapsedMs = (v_nowMs >= lastThermalCheckMs) ? (v_nowMs - lastThermalCheckMs) : 0UL;
 
-	uint32_t v_minThermEvalMs = G_S10_THERM_EVAL_MIN_MS;
-	if (g_A20_config_root.motion != nullptr) {
-		v_minThermEvalMs = (uint32_t)g_A20_config_root.motion->timing.thermalIntervalMs;
+	uint32_t					 v_minThermEvalMs = G_S10_THERM_EVAL_MIN_MS;
+	const ST_A20_MotionConfig_t* v_motion = C10_rcuRead(g_A20_config_root.motion);
+	if (v_motion != nullptr) {
+		v_minThermEvalMs = (uint32_t)v_motion->timing.thermalIntervalMs;
 	}
 
 	if (v_elapsedMs < v_minThermEvalMs) {
@@ -472,12 +478,12 @@ void CL_S10_Simulation::updateThermal() {
 
 	const float v_p			  = S10_probFromRatePerSec(v_ratePerSec, v_dtSec);
 
-	if (A20_getRandom01() < v_p) {
+	if (A20_getRandom01(_prng) < v_p) {
 		thermalActive	= true;
 		thermalStartSec = _tickNowSec;
 
 		// 지속 시간 정책 상수(헤더 공유) + phase 보정 배율
-		float v_d		= A20_randRange(G_S10_THERM_DUR_MIN_S, G_S10_THERM_DUR_MAX_S);
+		float v_d		= A20_randRange(_prng, G_S10_THERM_DUR_MIN_S, G_S10_THERM_DUR_MAX_S);
 		if (phase == EN_A20_WEATHER_PHASE_CALM) {
 			v_d *= G_S10_THERM_DUR_MUL_CALM;
 		} else if (phase == EN_A20_WEATHER_PHASE_STRONG) {
@@ -506,9 +512,9 @@ void CL_S10_Simulation::generateTarget() {
 		v_range = 0.2f;
 	}
 
-	float v_w		   = phaseMinWind + A20_getRandom01() * v_range;
+	float v_w		   = phaseMinWind + A20_getRandom01(_prng) * v_range;
 	float v_mid		   = (phaseMinWind + phaseMaxWind) * 0.5f;
-	float v_bias	   = A20_randRange(0.0f, 1.0f);
+	float v_bias	   = A20_randRange(_prng, 0.0f, 1.0f);
 
 	// 중앙값 바이어스
 	v_w				   = (v_w + v_mid * v_bias) / (1.0f + v_bias);
@@ -531,5 +537,5 @@ void CL_S10_Simulation::generateTarget() {
 	const float v_tscale = turbLenScale / v_U;
 	v_base *= (1.0f + v_tscale * 0.1f);
 
-	windChangeRate = constrain(v_base * A20_randRange(0.7f, 1.7f), 0.04f, 0.5f);
+	windChangeRate = constrain(v_base * A20_randRange(_prng, 0.7f, 1.7f), 0.04f, 0.5f);
 }
@@ -0,0 +1,332 @@
+/*
+ * ------------------------------------------------------
+ * 소스명 : S10_Simul_Stream_040.cpp
+ * 모듈약어 : S10
+ * 모듈명 : Smart Nature Wind 풍속 시뮬레이션 Manager (Snapshot / Stream IO)
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - CL_S10_Simulation 중 JsonDocument 미사용 IO 구현부 (host 빌드 대상)
+ *   - 공유 차트 버퍼 정적 멤버 정의
+ *   - 상태 스냅샷 seqlock 발행/복사(_publishSnapshot/readSnapshot)
+ *   - WS hot path 스트리밍 직렬화(writeJson/writeChartJson, CL_A20_JsonWriter)
+ *     field list는 S10_Simul_040.h S10_emit* 템플릿 (JsonDocument 경로와 공용)
+ *   - 차트 seq 범위 결정(chartRangeFrom) + binary frame(toChartBinFrom)
+ * - JsonDocument 기반 export/patch는 S10_Simul_IO_040.cpp
+ * ------------------------------------------------------
+ */
+
+#include "S10_Simul_040.h"
+
+#include <cstdio>
+#include <cstring>
+
+// ------------------------------------------------------
+// 정적 멤버 정의 (클래스 인스턴스와 무관하게 유지되는 공유 데이터)
+// ------------------------------------------------------
+CL_S10_RingBuffer<CL_S10_Simulation::ST_ChartEntry, G_S10_CHART_CAPACITY> CL_S10_Simulation::s_chartBuffer;
+unsigned long															  CL_S10_Simulation::s_lastChartLogMs	 = 0;
+unsigned long															  CL_S10_Simulation::s_lastChartSampleMs = 0;
+
+
+// ==================================================
+// 상태 스냅샷 발행/복사 (seqlock)
+// ==================================================
+/**
+ * @brief 현재 상태를 스냅샷 버퍼에 발행합니다.
+ * - 반드시 _simMutex 보유 상태에서 호출 (writer 직렬화)
+ * - seq 홀수 구간 = 갱신 중, 짝수 = 안정
+ */
+void CL_S10_Simulation::_publishSnapshot() {
+	const uint32_t v_seq = _snapSeq.load(std::memory_order_relaxed);
+	_snapSeq.store(v_seq + 1u, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	_snap.tickMs		  = _tickNowMs;
+
+	_snap.active		  = active;
+	_snap.fanPowerEnabled = fanPowerEnabled;
+	_snap.phase			  = phase;
+
+	_snap.windSpeed		  = currentWindSpeed;
+	_snap.targetWind	  = targetWindSpeed;
+	_snap.avgWind		  = _getAvgWindFast();
+	_snap.samples		  = historyCount;
+
+	_snap.gustActive	  = gustActive;
+	_snap.thermalActive	  = thermalActive;
+	_snap.pwmDuty		  = _pwm ? _pwm->P10_getDutyPercent() : 0.0f;
+
+	memcpy(_snap.presetCode, presetCode, sizeof(_snap.presetCode));
+	memcpy(_snap.styleCode, styleCode, sizeof(_snap.styleCode));
+
+	_snap.intensity		  = userIntensity;
+	_snap.variability	  = userVariability;
+	_snap.gustFreq		  = userGustFreq;
+	_snap.fanLimit		  = fanLimitPct;
+	_snap.minFan		  = minFanPct;
+
+	_snap.turbSigma		  = turbSigma;
+	_snap.turbLenScale	  = turbLenScale;
+	_snap.thermalStrength = thermalStrength;
+	_snap.thermalRadius	  = thermalRadius;
+
+	_snap.baseMinWind	  = baseMinWind;
+	_snap.baseMaxWind	  = baseMaxWind;
+	_snap.gustProbBase	  = gustProbBase;
+	_snap.gustStrengthMax = gustStrengthMax;
+	_snap.thermalFreqBase = thermalFreqBase;
+
+	_snap.seed			  = _prng.seed;
+
+	_snap.stat10s		  = _statRes[0];
+	_snap.stat60s		  = _statRes[1];
+	_snap.stat10m		  = _statRes[2];
+
+	_snap.stepStats		  = _stepStats;
+
+	std::atomic_thread_fence(std::memory_order_release);
+	_snapSeq.store(v_seq + 2u, std::memory_order_release);
+}
+
+/**
+ * @brief 최신 스냅샷을 잠금 없이 복사합니다.
+ * - seq가 홀수이거나 복사 전/후 seq가 다르면 재시도 (torn read 방지)
+ * - G_S10_SNAP_READ_RETRY_MAX 회 연속 충돌 시 _simMutex 잠금 복사로 대체
+ *   (writer는 _simMutex 보유 중에만 발행하므로 잠금 구간의 _snap은 항상 일관)
+ * @return 항상 true (호출부 호환용, 스냅샷 누락 없음)
+ */
+bool CL_S10_Simulation::readSnapshot(ST_S10_SimSnapshot_t& p_out) const {
+	for (uint8_t v_try = 0; v_try < G_S10_SNAP_READ_RETRY_MAX; v_try++) {
+		const uint32_t v_seq1 = _snapSeq.load(std::memory_order_acquire);
+		if (v_seq1 & 1u) {
+			continue;
+		}
+
+		memcpy(&p_out, &_snap, sizeof(p_out));
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		const uint32_t v_seq2 = _snapSeq.load(std::memory_order_relaxed);
+		if (v_seq1 == v_seq2) {
+			return true;
+		}
+	}
+
+	portENTER_CRITICAL(&_simMutex);
+	memcpy(&p_out, &_snap, sizeof(p_out));
+	portEXIT_CRITICAL(&_simMutex);
+	_snapLockedReads.fetch_add(1u, std::memory_order_relaxed);
+	return true;
+}
+
+// ==================================================
+// 스트리밍 직렬화 (WS hot path)
+// ==================================================
+/**
+ * @brief "sim" object를 고정 버퍼에 직접 기록합니다. (field list: S10_emitSimState, toJson과 공용)
+ */
+bool CL_S10_Simulation::writeJson(CL_A20_JsonWriter& p_w) {
+	ST_S10_SimSnapshot_t v_s;
+	(void)readSnapshot(v_s);	 // 항상 성공 (충돌 지속 시 잠금 복사)
+
+	p_w.beginObject("sim");
+	S10_emitSimState(p_w, v_s);
+	p_w.endObject();
+	return true;
+}
+
+/**
+ * @brief toChartJson(diffOnly=true)와 동일 구조(meta + 마지막 1개)를 고정 버퍼에 직접 기록합니다.
+ */
+bool CL_S10_Simulation::writeChartJson(CL_A20_JsonWriter& p_w, T_S10_chartMetaFn_t p_metaFn, void* p_ctx) {
+	ST_S10_SimSnapshot_t v_s;
+	(void)readSnapshot(v_s);	 // 항상 성공 (충돌 지속 시 잠금 복사)
+	if (s_chartBuffer.empty()) {
+		return false;
+	}
+
+	p_w.beginObject("sim");
+
+	p_w.beginObject("meta");
+	S10_emitChartMeta(p_w, v_s);
+	if (p_metaFn) p_metaFn(p_w, p_ctx);
+	p_w.endObject();
+
+	p_w.beginArray("chart");
+	const uint32_t v_seq   = s_chartBuffer.headSeq() - 1u;
+	int			   v_count = 0;
+	ST_ChartEntry  v_e;
+	if (s_chartBuffer.readAt(v_seq, v_e)) {
+		S10_emitChartEntry(p_w, v_seq, v_e);
+		v_count++;
+	}
+	p_w.endArray();
+
+	p_w.kv("chartCount", v_count);
+	p_w.endObject();
+	return true;
+}
+
+// ==================================================
+// Chart Binary Frame
+// ==================================================
+// 양자화 (int16 포화)
+static int16_t S10_quantI16(float p_v, float p_scale) {
+	float v_q = p_v * p_scale;
+	if (v_q > 32767.0f) return 32767;
+	if (v_q < -32768.0f) return -32768;
+	return (int16_t)lroundf(v_q);
+}
+
+// LEB128 varint 기록 → 기록 바이트 수
+static size_t S10_putVarint(uint8_t* p_dst, uint32_t p_v) {
+	size_t v_n = 0;
+	while (p_v >= 0x80u) {
+		p_dst[v_n++] = (uint8_t)(p_v | 0x80u);
+		p_v >>= 7;
+	}
+	p_dst[v_n++] = (uint8_t)p_v;
+	return v_n;
+}
+
+size_t CL_S10_Simulation::chartBinMaxBytes(uint16_t p_count) {
+	uint32_t v_n = (uint32_t)p_count;
+	// 헤더 + wind/pwm(2+2) + flag bit 2열 + varint(최대 5B)
+	return sizeof(ST_S10_ChartBinHdr_t) + (size_t)v_n * 4u + (size_t)((v_n + 7u) / 8u) * 2u + (size_t)v_n * 5u;
+}
+
+size_t CL_S10_Simulation::chartBinCapFrom(uint32_t p_fromSeq, uint16_t p_maxCount) {
+	uint32_t v_start = 0;
+	uint32_t v_head	 = 0;
+	(void)chartRangeFrom(p_fromSeq, p_maxCount, v_start, v_head);
+	// 계산 이후 writer가 추가한 샘플은 v_head 기준으로 잘리지 않으므로 여유 1개
+	uint32_t v_n = (v_head > v_start) ? (v_head - v_start + 1u) : 1u;
+	if (v_n > 0xFFFFu) v_n = 0xFFFFu;
+	return chartBinMaxBytes((uint16_t)v_n);
+}
+
+bool CL_S10_Simulation::chartRangeFrom(uint32_t p_fromSeq, uint16_t p_maxCount, uint32_t& p_start, uint32_t& p_head) {
+	const uint32_t v_head = s_chartBuffer.headSeq();
+	const uint32_t v_tail = s_chartBuffer.tailSeq();
+	const uint32_t v_max  = (p_maxCount > 0) ? (uint32_t)p_maxCount : 1u;
+
+	// 신규(0) / window 밖으로 밀려남 / 버퍼 재시작 / 최대 개수 초과 → resync
+	bool v_resync = (p_fromSeq == 0u) || (p_fromSeq < v_tail) || (p_fromSeq > v_head) || (v_head - p_fromSeq > v_max);
+
+	if (v_resync) {
+		uint32_t v_start = (v_head > v_max) ? (v_head - v_max) : 0u;
+		p_start			 = (v_start > v_tail) ? v_start : v_tail;
+	} else {
+		p_start = p_fromSeq;
+	}
+	p_head = v_head;
+	return v_resync;
+}
+
+/**
+ * @brief 차트 seq 범위를 binary frame으로 직렬화합니다. (포맷: S10_Simul_040.h G_S10_CHART_BIN_* 주석)
+ * - record 영역은 최대 개수(N) 기준 열 배치로 1회 순회 기록 후,
+ *   덮어쓰기로 건너뛴 record가 있으면(k < N) 열을 앞으로 압축
+ */
+size_t CL_S10_Simulation::toChartBinFrom(uint8_t* p_buf, size_t p_cap, uint32_t p_fromSeq, uint16_t p_maxCount, uint32_t& p_nextSeq) const {
+	p_nextSeq = p_fromSeq;
+	if (!p_buf || s_chartBuffer.empty()) {
+		return 0;
+	}
+
+	uint32_t v_start  = 0;
+	uint32_t v_head	  = 0;
+	bool	 v_resync = chartRangeFrom(p_fromSeq, p_maxCount, v_start, v_head);
+	if (v_start >= v_head) {
+		return 0;  // 새 샘플 없음
+	}
+
+	ST_S10_SimSnapshot_t v_s;
+	(void)readSnapshot(v_s);	 // 항상 성공 (충돌 지속 시 잠금 복사)
+
+	const uint32_t v_max = v_head - v_start;
+	if (v_max > 0xFFFFu || p_cap < chartBinMaxBytes((uint16_t)v_max)) {
+		return 0;
+	}
+
+	const size_t v_hdrSz   = sizeof(ST_S10_ChartBinHdr_t);
+	const size_t v_bitsMax = (size_t)((v_max + 7u) / 8u);
+
+	// N 기준 열 위치
+	uint8_t* v_wind		   = p_buf + v_hdrSz;
+	uint8_t* v_pwm		   = v_wind + (size_t)v_max * 2u;
+	uint8_t* v_gust		   = v_pwm + (size_t)v_max * 2u;
+	uint8_t* v_therm	   = v_gust + v_bitsMax;
+	uint8_t* v_dt		   = v_therm + v_bitsMax;
+	memset(v_gust, 0, v_bitsMax * 2u);
+
+	ST_ChartEntry v_e;
+	uint32_t	  v_k	   = 0;
+	uint32_t	  v_seq0   = 0;
+	uint32_t	  v_t0	   = 0;
+	uint32_t	  v_prevTs = 0;
+	size_t		  v_dtLen  = 0;
+
+	for (uint32_t v_seq = v_start; v_seq < v_head; v_seq++) {
+		if (!s_chartBuffer.readAt(v_seq, v_e)) {
+			// 앞쪽 덮어쓰기는 건너뜀, 이후 실패는 중단(다음 전송에서 이어짐 → seq 연속 보장)
+			if (v_k == 0u) continue;
+			break;
+		}
+
+		int16_t v_wq = S10_quantI16(v_e.wind_speed, G_S10_CHART_BIN_WIND_SCALE);
+		int16_t v_pq = S10_quantI16(v_e.pwm_duty, G_S10_CHART_BIN_PWM_SCALE);
+		memcpy(v_wind + v_k * 2u, &v_wq, 2);
+		memcpy(v_pwm + v_k * 2u, &v_pq, 2);
+
+		if (v_e.gust_active) v_gust[v_k >> 3] |= (uint8_t)(1u << (v_k & 7u));
+		if (v_e.thermal_active) v_therm[v_k >> 3] |= (uint8_t)(1u << (v_k & 7u));
+
+		uint32_t v_ts = (uint32_t)v_e.timestamp;
+		if (v_k == 0u) {
+			v_seq0 = v_seq;
+			v_t0   = v_ts;
+		} else {
+			v_dtLen += S10_putVarint(v_dt + v_dtLen, v_ts - v_prevTs);
+		}
+		v_prevTs  = v_ts;
+		p_nextSeq = v_seq + 1u;
+		v_k++;
+	}
+
+	if (v_k == 0u) {
+		return 0;
+	}
+
+	// k < N: 열 압축 (앞쪽으로만 이동 → memmove 안전)
+	const size_t v_bits = (size_t)((v_k + 7u) / 8u);
+	uint8_t*	 v_w	= p_buf + v_hdrSz + (size_t)v_k * 2u;
+	if (v_k < v_max) {
+		memmove(v_w, v_pwm, (size_t)v_k * 2u);
+	}
+	v_w += (size_t)v_k * 2u;
+	memmove(v_w, v_gust, v_bits);
+	v_w += v_bits;
+	memmove(v_w, v_therm, v_bits);
+	v_w += v_bits;
+	memmove(v_w, v_dt, v_dtLen);
+	v_w += v_dtLen;
+
+	uint8_t v_phase = (uint8_t)v_s.phase;
+	if (v_phase >= (uint8_t)EN_A20_WEATHER_PHASE_COUNT) v_phase = 0;
+
+	ST_S10_ChartBinHdr_t v_hdr;
+	memset(&v_hdr, 0, sizeof(v_hdr));
+	v_hdr.magic		= G_S10_CHART_BIN_MAGIC;
+	v_hdr.version	= G_S10_CHART_BIN_VERSION;
+	v_hdr.flags		= v_resync ? G_S10_CHART_BIN_FLAG_FULL : 0u;
+	v_hdr.count		= (uint16_t)v_k;
+	v_hdr.phase		= v_phase;
+	v_hdr.metaFlags = (uint8_t)((v_s.gustActive ? 0x01u : 0u) | (v_s.thermalActive ? 0x02u : 0u));
+	v_hdr.t0Ms		= v_t0;
+	v_hdr.avgWindQ	= S10_quantI16(v_s.avgWind, G_S10_CHART_BIN_WIND_SCALE);
+	v_hdr.samples	= v_s.samples;
+	v_hdr.seq0		= v_seq0;
+	memcpy(p_buf, &v_hdr, v_hdrSz);
+
+	return (size_t)(v_w - p_buf);
+}
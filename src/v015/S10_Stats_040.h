@@ -0,0 +1,174 @@
+#pragma once
+/*
+ * ------------------------------------------------------
+ * 소스명 : S10_Stats_040.h
+ * 모듈약어 : S10
+ * 모듈명 : Smart Nature Wind 풍속 이동 통계(Rolling Statistics)
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - 고정 window(sample) 이동 통계: 평균/표준편차/최소/최대/EWMA/난류강도(TI)
+ * - 샘플당 O(1): 누적합/제곱합 + 단조(monotonic) deque 기반 min/max
+ * - 저장 공간은 컴파일 타임 고정 배열 (heap 할당 없음)
+ * - 결과는 POD(ST_S10_WindStat_t)로 요약하여 스냅샷/JSON 전송에 사용
+ * ------------------------------------------------------
+ * [구현 규칙]
+ * - 항상 소스 시작 주석 부분 체계 유지 및 내용 업데이트
+ * - 소스 시작 주석 부분 구현규칙, 코드네이밍규칙 내용 그대로 유지, 수정금지
+ * - ArduinoJson v7.x.x 사용 (v6 이하 사용 금지)
+ * - JsonDocument 단일 타입만 사용
+ * - createNestedArray/Object/containsKey 사용 금지
+ * - memset + strlcpy 기반 안전 초기화
+ * - 주석/필드명은 JSON 구조와 동일하게 유지
+ * ------------------------------------------------------
+ * [코드 네이밍 규칙]
+ * - 전역 상수,매크로      : G_모듈약어_ 접두사
+ * - 전역 변수             : g_모듈약어_ 접두사
+ * - 전역 함수             : 모듈약어_ 접두사
+ * - type                  : T_모듈약어_ 접두사
+ * - typedef               : _t  접미사
+ * - enum 상수             : EN_모듈약어_ 접두사
+ * - 구조체                : ST_모듈약어_ 접미사
+ * - 클래스명              : CL_모듈약어_ 접미사
+ * - 클래스 private 멤버   : _ 접두사
+ * - 클래스 멤버(함수/변수) : 모듈약어 접두사 미사용
+ * - 클래스 정적 멤버      : s_ 접두사
+ * - 함수 로컬 변수        : v_ 접두사
+ * - 함수 인자             : p_ 접두사
+ * ------------------------------------------------------
+ */
+
+#include <Arduino.h>
+#include <string.h>
+
+#include <cmath>
+
+// ======================================================
+// 이동 통계 결과 (POD)
+// ======================================================
+typedef struct {
+	uint16_t count;	  // [sample] window 내 유효 샘플 수
+	float	 mean;	  // [m/s]
+	float	 stddev;  // [m/s]
+	float	 min;	  // [m/s]
+	float	 max;	  // [m/s]
+	float	 ewma;	  // [m/s] 시정수 = window 길이
+	float	 ti;	  // [-] 난류강도 = stddev / mean
+} ST_S10_WindStat_t;
+
+// ======================================================
+// CL_S10_RollingStat<W>
+// - W : window 크기(sample)
+// - push()당 O(1) (min/max deque는 분할상환 O(1))
+// ======================================================
+template <uint16_t W>
+class CL_S10_RollingStat {
+  public:
+	CL_S10_RollingStat() {
+		reset();
+	}
+
+	void reset() {
+		memset(_vals, 0, sizeof(_vals));
+		_seq	   = 0;
+		_sum	   = 0.0;
+		_sumSq	   = 0.0;
+		_ewma	   = 0.0f;
+		_minHead   = 0;
+		_minCount  = 0;
+		_maxHead   = 0;
+		_maxCount  = 0;
+		// EWMA 계수: 1 sample 간격 기준 시정수 W
+		_ewmaAlpha = 1.0f - expf(-1.0f / (float)W);
+	}
+
+	/**
+	 * @brief 샘플 1개 추가
+	 */
+	void push(float p_v) {
+		// 1) window 이탈 샘플 제거(누적합/제곱합)
+		if (_seq >= W) {
+			const float v_old = _vals[_seq % W];
+			_sum -= (double)v_old;
+			_sumSq -= (double)v_old * (double)v_old;
+		}
+
+		_vals[_seq % W] = p_v;
+		_sum += (double)p_v;
+		_sumSq += (double)p_v * (double)p_v;
+
+		// 2) 단조 deque 갱신 (만료 seq 제거 후 뒤쪽 우세하지 않은 값 제거)
+		const uint32_t v_expire = (_seq >= W) ? (_seq - W + 1u) : 0u;
+
+		while (_minCount > 0 && _dqAt(_minDq, _minHead, 0) < v_expire) _dqPopFront(_minHead, _minCount);
+		while (_minCount > 0 && _vals[_dqAt(_minDq, _minHead, _minCount - 1u) % W] >= p_v) _minCount--;
+		_dqPushBack(_minDq, _minHead, _minCount, _seq);
+
+		while (_maxCount > 0 && _dqAt(_maxDq, _maxHead, 0) < v_expire) _dqPopFront(_maxHead, _maxCount);
+		while (_maxCount > 0 && _vals[_dqAt(_maxDq, _maxHead, _maxCount - 1u) % W] <= p_v) _maxCount--;
+		_dqPushBack(_maxDq, _maxHead, _maxCount, _seq);
+
+		// 3) EWMA
+		_ewma = (_seq == 0u) ? p_v : (_ewma + _ewmaAlpha * (p_v - _ewma));
+
+		_seq++;
+	}
+
+	uint16_t count() const {
+		return (uint16_t)((_seq >= W) ? W : _seq);
+	}
+
+	/**
+	 * @brief 현재 window 요약 결과 산출
+	 */
+	void summarize(ST_S10_WindStat_t& p_out) const {
+		memset(&p_out, 0, sizeof(p_out));
+
+		const uint16_t v_n = count();
+		p_out.count		   = v_n;
+		if (v_n == 0) {
+			return;
+		}
+
+		const double v_mean = _sum / (double)v_n;
+		double		 v_var	= (_sumSq / (double)v_n) - (v_mean * v_mean);
+		if (v_var < 0.0) v_var = 0.0;  // 부동소수 오차 방어
+
+		p_out.mean	 = (float)v_mean;
+		p_out.stddev = (float)sqrt(v_var);
+		p_out.min	 = _vals[_dqAt(_minDq, _minHead, 0) % W];
+		p_out.max	 = _vals[_dqAt(_maxDq, _maxHead, 0) % W];
+		p_out.ewma	 = _ewma;
+		p_out.ti	 = (p_out.mean > 0.01f) ? (p_out.stddev / p_out.mean) : 0.0f;
+	}
+
+  private:
+	float	 _vals[W];
+	uint32_t _seq;
+
+	// 누적합은 장기 가감 오차 최소화를 위해 double 사용 (1Hz 갱신 기준 비용 무시 가능)
+	double	 _sum;
+	double	 _sumSq;
+
+	float	 _ewma;
+	float	 _ewmaAlpha;
+
+	// 단조 deque (seq 저장, 원형 배열)
+	uint32_t _minDq[W];
+	uint16_t _minHead;
+	uint16_t _minCount;
+	uint32_t _maxDq[W];
+	uint16_t _maxHead;
+	uint16_t _maxCount;
+
+	static uint32_t _dqAt(const uint32_t* p_dq, uint16_t p_head, uint16_t p_i) {
+		return p_dq[(p_head + p_i) % W];
+	}
+	static void _dqPopFront(uint16_t& p_head, uint16_t& p_count) {
+		p_head = (uint16_t)((p_head + 1u) % W);
+		p_count--;
+	}
+	static void _dqPushBack(uint32_t* p_dq, uint16_t p_head, uint16_t& p_count, uint32_t p_seq) {
+		p_dq[(p_head + p_count) % W] = p_seq;
+		p_count++;
+	}
+};
@@ -9,6 +9,11 @@
  *  - WindProfileDict 기반 프리셋/스타일/보정값을 조합하여
  *    최종 제어용 바람 파라미터(ResolvedWind) 계산
  *  - ControlManager(CT10), Simulation(S10) 등에서 공용 사용
+ *  - 코드 intern: dict 세대별 preset/style 코드 해시 테이블 → 인덱스 (선형 strcasecmp 검색 대체)
+ *  - ResolvedWind memo 캐시: (dict 세대, presetIdx, styleIdx, adjust 해시) 키, LRU 교체
+ *      . 캐시/intern 테이블은 호출자 소유 (CT10), S20은 순수 연산만 수행
+ *      . 키 구성(S20_windCacheKey) / 조회(Lookup) / 해석 / 등록(Insert) 분리
+ *        → 공유 캐시 호출자는 Lookup/Insert만 잠금 구간에서 수행
  * ------------------------------------------------------
  * [구현 규칙]
  *  - ArduinoJson 의존 없음 (ConfigManager에서 역직렬화 완료된 구조체만 사용)
@@ -30,19 +35,16 @@
 // Wind Profile 해석 함수
 // ------------------------------------------------------
 
-inline bool S20_resolveWindParams(const ST_A20_WindProfileDict_t& p_dict, const char* p_presetCode, const char* p_styleCode, const ST_A20_AdjustDelta_t* p_adj, ST_A20_ResolvedWind_t& p_out) {
+inline bool S20_resolveWindByIndex(const ST_A20_WindProfileDict_t& p_dict, int16_t p_presetIdx, int16_t p_styleIdx, const ST_A20_AdjustDelta_t* p_adj, ST_A20_ResolvedWind_t& p_out) {
 	// 0) 출력 안전 초기화 (실패해도 안전)
 	memset(&p_out, 0, sizeof(p_out));
 	p_out.valid	 = false;
 
-	// 1) preset 찾기
-	int16_t v_pi = A20_findPresetIndexByCode(p_dict, p_presetCode);
-	if (v_pi < 0) {
-		// presetCode/styleCode는 호출자가 확인 가능하도록 최소 복사
-		strlcpy(p_out.presetCode, p_presetCode ? p_presetCode : "", sizeof(p_out.presetCode));
-		strlcpy(p_out.styleCode, p_styleCode ? p_styleCode : "", sizeof(p_out.styleCode));
+	// 1) preset 인덱스 확인
+	if (p_presetIdx < 0 || p_presetIdx >= p_dict.presetCount) {
 		return false;
 	}
+	const int16_t v_pi = p_presetIdx;
 
 	const ST_A20_PresetEntry_t& v_p	   = p_dict.presets[v_pi];
 
@@ -59,16 +61,14 @@ inline bool S20_resolveWindParams(const ST_A20_WindProfileDict_t& p_dict, const
 	float						v_thR  = v_p.base.thermalBubbleRadius;
 
 	// 3) style factor 적용(스타일 없으면 스킵)
-	if (p_styleCode && p_styleCode[0]) {
-		int16_t v_si = A20_findStyleIndexByCode(p_dict, p_styleCode);
-		if (v_si >= 0) {
-			const ST_A20_StyleEntry_t& v_s = p_dict.styles[v_si];
-			v_int *= v_s.factors.intensityFactor;
-			v_var *= v_s.factors.variabilityFactor;
-			v_gust *= v_s.factors.gustFactor;
-			v_thB *= v_s.factors.thermalFactor;
-			// (정책 선택) fanLimit/minFan/turb도 스타일 영향 줄지 여부는 여기서 결정
-		}
+	const bool v_hasStyle = (p_styleIdx >= 0 && p_styleIdx < p_dict.styleCount);
+	if (v_hasStyle) {
+		const ST_A20_StyleEntry_t& v_s = p_dict.styles[p_styleIdx];
+		v_int *= v_s.factors.intensityFactor;
+		v_var *= v_s.factors.variabilityFactor;
+		v_gust *= v_s.factors.gustFactor;
+		v_thB *= v_s.factors.thermalFactor;
+		// (정책 선택) fanLimit/minFan/turb도 스타일 영향 줄지 여부는 여기서 결정
 	}
 
 	// 4) adjust 적용(널이면 0으로)
@@ -109,9 +109,9 @@ inline bool S20_resolveWindParams(const ST_A20_WindProfileDict_t& p_dict, const
 	p_out.gustStrengthMax = v_p.base.gustStrengthMax;
 	p_out.thermalFreqBase = v_p.base.thermalFreqBase;
 
-	// 7) 코드 복사
-	strlcpy(p_out.presetCode, p_presetCode ? p_presetCode : "", sizeof(p_out.presetCode));
-	strlcpy(p_out.styleCode, p_styleCode ? p_styleCode : "", sizeof(p_out.styleCode));
+	// 7) 코드 복사 (dict 등록 코드)
+	strlcpy(p_out.presetCode, v_p.code, sizeof(p_out.presetCode));
+	if (v_hasStyle) strlcpy(p_out.styleCode, p_dict.styles[p_styleIdx].code, sizeof(p_out.styleCode));
 
 	// 8) 기본 플래그
 	p_out.fixedMode	 = false;
@@ -119,3 +119,198 @@ inline bool S20_resolveWindParams(const ST_A20_WindProfileDict_t& p_dict, const
 	p_out.valid		 = true;
 	return true;
 }
+
+// 코드 기반 해석 (S10 headless 등 1회성 호출용)
+inline bool S20_resolveWindParams(const ST_A20_WindProfileDict_t& p_dict, const char* p_presetCode, const char* p_styleCode, const ST_A20_AdjustDelta_t* p_adj, ST_A20_ResolvedWind_t& p_out) {
+	int16_t v_pi = A20_findPresetIndexByCode(p_dict, p_presetCode);
+	int16_t v_si = (p_styleCode && p_styleCode[0]) ? A20_findStyleIndexByCode(p_dict, p_styleCode) : (int16_t)-1;
+
+	bool v_ok = S20_resolveWindByIndex(p_dict, v_pi, v_si, p_adj, p_out);
+
+	// presetCode/styleCode는 호출자가 확인 가능하도록 입력값 복사 (실패 포함)
+	strlcpy(p_out.presetCode, p_presetCode ? p_presetCode : "", sizeof(p_out.presetCode));
+	strlcpy(p_out.styleCode, p_styleCode ? p_styleCode : "", sizeof(p_out.styleCode));
+	return v_ok;
+}
+
+// ------------------------------------------------------
+// 코드 intern (dict 세대별 1회 구성)
+//  - 코드 해시: ASCII 대소문자 무시 FNV-1a (A20_find*ByCode의 strcasecmp 규칙과 동일)
+//  - 조회: 해시 비교 후 일치 항목만 strcasecmp 1회 확인 (해시 충돌 대비)
+// ------------------------------------------------------
+inline uint32_t S20_codeHash(const char* p_code) {
+	uint32_t v_h = 2166136261u;
+	if (!p_code) return v_h;
+	for (const char* v_c = p_code; *v_c; v_c++) {
+		char v_ch = *v_c;
+		if (v_ch >= 'A' && v_ch <= 'Z') v_ch = (char)(v_ch - 'A' + 'a');
+		v_h ^= (uint8_t)v_ch;
+		v_h *= 16777619u;
+	}
+	return v_h;
+}
+
+typedef struct {
+	const ST_A20_WindProfileDict_t* dict;	 // intern 기준 dict (nullptr: 미구성)
+	uint32_t						dictGen;  // intern 기준 dict 세대 (C10 windDictGen)
+	uint32_t						presetHash[A20_Const::WIND_PRESETS_MAX];
+	uint32_t						styleHash[A20_Const::WIND_STYLES_MAX];
+} ST_S20_WindCodeIndex_t;
+
+// dict/세대 변경 시에만 재구성 → 반환: 재구성 여부
+inline bool S20_internWindCodes(ST_S20_WindCodeIndex_t& p_idx, const ST_A20_WindProfileDict_t& p_dict, uint32_t p_dictGen) {
+	if (p_idx.dict == &p_dict && p_idx.dictGen == p_dictGen) return false;
+
+	for (uint8_t v_i = 0; v_i < p_dict.presetCount && v_i < A20_Const::WIND_PRESETS_MAX; v_i++) {
+		p_idx.presetHash[v_i] = S20_codeHash(p_dict.presets[v_i].code);
+	}
+	for (uint8_t v_i = 0; v_i < p_dict.styleCount && v_i < A20_Const::WIND_STYLES_MAX; v_i++) {
+		p_idx.styleHash[v_i] = S20_codeHash(p_dict.styles[v_i].code);
+	}
+	p_idx.dict	  = &p_dict;
+	p_idx.dictGen = p_dictGen;
+	return true;
+}
+
+inline int16_t S20_findPresetIdx(const ST_S20_WindCodeIndex_t& p_idx, const char* p_code) {
+	if (!p_idx.dict || !p_code || !p_code[0]) return -1;
+	const uint32_t v_h = S20_codeHash(p_code);
+	for (uint8_t v_i = 0; v_i < p_idx.dict->presetCount; v_i++) {
+		if (p_idx.presetHash[v_i] == v_h && strcasecmp(p_idx.dict->presets[v_i].code, p_code) == 0) return (int16_t)v_i;
+	}
+	return -1;
+}
+
+inline int16_t S20_findStyleIdx(const ST_S20_WindCodeIndex_t& p_idx, const char* p_code) {
+	if (!p_idx.dict || !p_code || !p_code[0]) return -1;
+	const uint32_t v_h = S20_codeHash(p_code);
+	for (uint8_t v_i = 0; v_i < p_idx.dict->styleCount; v_i++) {
+		if (p_idx.styleHash[v_i] == v_h && strcasecmp(p_idx.dict->styles[v_i].code, p_code) == 0) return (int16_t)v_i;
+	}
+	return -1;
+}
+
+// ------------------------------------------------------
+// ResolvedWind memo 캐시
+//  - 키: dict 포인터 + dictGen + presetIdx + styleIdx + adjust(해시 + 원본 비교)
+//  - dict 세대가 바뀌면 이전 세대 항목은 자연 miss (인덱스 재사용 오적중 방지)
+// ------------------------------------------------------
+#define G_S20_WIND_CACHE_SIZE 8
+
+typedef struct {
+	const ST_A20_WindProfileDict_t* dict;
+	bool							valid;
+	int8_t							presetIdx;
+	int8_t							styleIdx;
+	uint32_t						dictGen;
+	uint32_t						adjHash;
+	uint32_t						lastUse;  // LRU 순번
+	ST_A20_AdjustDelta_t			adj;
+	ST_A20_ResolvedWind_t			wind;
+} ST_S20_WindCacheEntry_t;
+
+typedef struct {
+	ST_S20_WindCacheEntry_t entry[G_S20_WIND_CACHE_SIZE];
+	uint32_t				useSeq;
+	uint32_t				hits;
+	uint32_t				misses;
+	uint32_t				evictions;
+} ST_S20_WindCache_t;
+
+inline uint32_t S20_adjustHash(const ST_A20_AdjustDelta_t& p_adj) {
+	const uint8_t* v_b = (const uint8_t*)&p_adj;
+	uint32_t	   v_h = 2166136261u;
+	for (size_t v_i = 0; v_i < sizeof(p_adj); v_i++) {
+		v_h ^= v_b[v_i];
+		v_h *= 16777619u;
+	}
+	return v_h;
+}
+
+// 캐시 키 (호출자 스택에서 구성 → 잠금 구간에서는 키 비교/결과 복사만 수행)
+typedef struct {
+	const ST_A20_WindProfileDict_t* dict;
+	uint32_t						dictGen;
+	int8_t							presetIdx;
+	int8_t							styleIdx;
+	uint32_t						adjHash;
+	ST_A20_AdjustDelta_t			adj;
+} ST_S20_WindCacheKey_t;
+
+// 키 구성 (preset 인덱스 범위 밖이면 false)
+inline bool S20_windCacheKey(const ST_A20_WindProfileDict_t& p_dict, uint32_t p_dictGen, int16_t p_presetIdx, int16_t p_styleIdx, const ST_A20_AdjustDelta_t* p_adj, ST_S20_WindCacheKey_t& p_key) {
+	if (p_presetIdx < 0 || p_presetIdx >= p_dict.presetCount) return false;
+	if (p_styleIdx >= p_dict.styleCount) p_styleIdx = -1;
+
+	// adjust 널 = 전체 0 (S20_resolveWindByIndex와 동일 의미)
+	ST_A20_AdjustDelta_t v_adj;
+	if (p_adj) v_adj = *p_adj;
+
+	p_key.dict		= &p_dict;
+	p_key.dictGen	= p_dictGen;
+	p_key.presetIdx = (int8_t)p_presetIdx;
+	p_key.styleIdx	= (int8_t)p_styleIdx;
+	p_key.adj		= v_adj;
+	p_key.adjHash	= S20_adjustHash(v_adj);
+	return true;
+}
+
+inline bool S20_windCacheMatch(const ST_S20_WindCacheEntry_t& p_e, const ST_S20_WindCacheKey_t& p_key) {
+	return p_e.valid && p_e.dict == p_key.dict && p_e.dictGen == p_key.dictGen && p_e.presetIdx == p_key.presetIdx && p_e.styleIdx == p_key.styleIdx &&
+		   p_e.adjHash == p_key.adjHash && memcmp(&p_e.adj, &p_key.adj, sizeof(p_key.adj)) == 0;
+}
+
+// 조회: 적중 시 결과 복사 (hits/misses 집계)
+inline bool S20_windCacheLookup(ST_S20_WindCache_t& p_cache, const ST_S20_WindCacheKey_t& p_key, ST_A20_ResolvedWind_t& p_out) {
+	for (uint8_t v_i = 0; v_i < G_S20_WIND_CACHE_SIZE; v_i++) {
+		ST_S20_WindCacheEntry_t& v_e = p_cache.entry[v_i];
+		if (S20_windCacheMatch(v_e, p_key)) {
+			v_e.lastUse = ++p_cache.useSeq;
+			p_cache.hits++;
+			p_out = v_e.wind;
+			return true;
+		}
+	}
+	p_cache.misses++;
+	return false;
+}
+
+// 등록: 동일 키 선등록(다른 호출자 경합) 시 갱신만, 아니면 빈 슬롯 → LRU 교체
+inline void S20_windCacheInsert(ST_S20_WindCache_t& p_cache, const ST_S20_WindCacheKey_t& p_key, const ST_A20_ResolvedWind_t& p_wind) {
+	uint8_t v_victim = 0;
+	for (uint8_t v_i = 0; v_i < G_S20_WIND_CACHE_SIZE; v_i++) {
+		ST_S20_WindCacheEntry_t& v_e = p_cache.entry[v_i];
+		if (S20_windCacheMatch(v_e, p_key)) {
+			v_e.lastUse = ++p_cache.useSeq;
+			return;
+		}
+		const ST_S20_WindCacheEntry_t& v_vic = p_cache.entry[v_victim];
+		if (v_vic.valid && (!v_e.valid || v_e.lastUse < v_vic.lastUse)) v_victim = v_i;
+	}
+
+	ST_S20_WindCacheEntry_t& v_e = p_cache.entry[v_victim];
+	if (v_e.valid) p_cache.evictions++;
+	v_e.dict	  = p_key.dict;
+	v_e.valid	  = true;
+	v_e.presetIdx = p_key.presetIdx;
+	v_e.styleIdx  = p_key.styleIdx;
+	v_e.dictGen	  = p_key.dictGen;
+	v_e.adjHash	  = p_key.adjHash;
+	v_e.lastUse	  = ++p_cache.useSeq;
+	v_e.adj		  = p_key.adj;
+	v_e.wind	  = p_wind;
+}
+
+// 단일 호출자용 조회 → miss 시 해석 → 등록 (동시 호출자는 Lookup/Insert를 잠금 구간으로 분리 사용)
+inline bool S20_resolveWindCached(ST_S20_WindCache_t& p_cache, const ST_A20_WindProfileDict_t& p_dict, uint32_t p_dictGen, int16_t p_presetIdx, int16_t p_styleIdx, const ST_A20_AdjustDelta_t* p_adj, ST_A20_ResolvedWind_t& p_out) {
+	ST_S20_WindCacheKey_t v_key;
+	if (!S20_windCacheKey(p_dict, p_dictGen, p_presetIdx, p_styleIdx, p_adj, v_key)) {
+		memset(&p_out, 0, sizeof(p_out));
+		p_out.valid = false;
+		return false;
+	}
+	if (S20_windCacheLookup(p_cache, v_key, p_out)) return true;
+	if (!S20_resolveWindByIndex(p_dict, v_key.presetIdx, v_key.styleIdx, &v_key.adj, p_out)) return false;
+	S20_windCacheInsert(p_cache, v_key, p_out);
+	return true;
+}
@@ -8,6 +8,7 @@
  * 기능 요약:
  * - REST API 엔드포인트 선언 및 유틸리티 함수 포함.
  * - WebSocket 정적 멤버 포인터 포함.
+ * - 대용량 설정 GET chunked 응답(sendConfigChunked): 항목 단위 직렬화, 전체 문서/String 미생성
  * - ArduinoJson v7.4.x 사용
  * ------------------------------------------------------
  * [구현 규칙]
@@ -50,6 +51,16 @@
 #include "W10_Web_Const_050.h"
 #include "WF10_WiFiManager_040.h"
 
+// ------------------------------------------------------
+// 대용량 설정 GET chunked 응답 대상 (W10_Web_Chunk_051.cpp)
+// ------------------------------------------------------
+typedef enum : uint8_t {
+	EN_W10_CFG_STREAM_ALL			= 0,  // GET /api/config (toJson_All 동일 구조)
+	EN_W10_CFG_STREAM_SCHEDULES		= 1,  // GET /api/schedules
+	EN_W10_CFG_STREAM_USER_PROFILES = 2,  // GET /api/user_profiles
+	EN_W10_CFG_STREAM_WIND_DICT		= 3	  // GET /api/windProfile
+} EN_W10_cfg_stream_t;
+
 // ------------------------------------------------------
 // WebAPI Manager
 // ------------------------------------------------------
@@ -65,8 +76,21 @@ class CL_W10_WebAPI {
   // --------------------------------------------------
   static void setWsIntervals(const uint16_t p_itvMs[4]);
 
-  // cleanupClients 주기 tick (권장)
+  // cleanupClients 주기 tick (권장) + 적응형 간격 정책 재적용 / 끊긴 client slot 정리
   static void wsCleanupTick();
+  // /ws logs topic queue 전송 (loop task 매 회, broadcastLogMux 적재분)
+  static void wsLogTick();
+
+  // WS 브로드캐스트 누적 통계(+ client별 적응형 간격) / 공유 버퍼 벤치마크 (GET /api/diag 연동)
+  static void wsStatsToJson(JsonObject p_obj);
+  static void wsBenchToJson(JsonArray p_arr);
+  // WS payload 직렬화 벤치마크: JsonDocument 경로 vs 스트리밍 writer (GET /api/diag?jsonbench)
+  static void jsonBenchToJson(JsonArray p_arr);
+  // 정적 자산 전송 통계 (gzip / 304 / 전송 바이트 + 라우트 테이블, GET /api/diag 연동)
+  // p_bench: 라우트 조회 시간 측정 (이진 탐색 vs 선형, ?routebench=1)
+  static void staticStatsToJson(JsonObject p_obj, bool p_bench = false);
+  // 설정 GET chunked 응답 통계 (응답/chunk 수, 최대 항목 직렬화 크기, GET /api/diag 연동)
+  static void cfgStreamStatsToJson(JsonObject p_obj);
 
 	// --------------------------------------------------
 	// 브로드캐스트 (WebSockets.cpp)
@@ -75,6 +99,10 @@ class CL_W10_WebAPI {
 	static void broadcastMetrics(JsonDocument& p_doc, bool p_diffOnly = true);
 	static void broadcastChart(JsonDocument& p_doc, bool p_diffOnly = true);
 	static void broadcastSummary(JsonDocument& p_doc, bool p_diffOnly = true);
+	// 스트리밍 직렬화 완료 payload (CT10 raw broker, p_ch = G_A20_WS_CH_*, p_len 0: 내용 없음)
+	static void broadcastRaw(uint8_t p_ch, const char* p_buf, size_t p_len);
+	// D10 로그 sink (임의 task): 직렬화 완료 로그 JSON → /ws "logs" queue 적재 (전송은 wsLogTick)
+	static void broadcastLogMux(const char* p_json, size_t p_len);
 
 
 
@@ -95,6 +123,7 @@ class CL_W10_WebAPI {
 	static AsyncWebSocket*		   s_wsServerChart;
 	static AsyncWebSocket*		   s_wsServerMetrics;
 	static AsyncWebSocket*		   s_wsServerSummary;
+	static AsyncWebSocket*		   s_wsServerMux;	// /ws (topic 다중화)
 
 	// --------------------------------------------------
 	// Static Assets & Menu (W10_Web_Static_032.cpp)
@@ -126,10 +155,16 @@ class CL_W10_WebAPI {
 	static ST_W10_MenuState_t s_menu_state;
 
 	// 헬퍼 함수 (Static.cpp 내부에서만 사용)
-	static char* W10_allocCString(const char* p_src);
 	static const char* W10_guessMime(const char* p_path);
 	static bool W10_loadPagesJson(JsonDocument& p_doc, uint16_t& p_page_count, uint16_t& p_asset_count);
-	static void W10_registerStaticRoute(const char* p_uri, const char* p_file, const char* p_mime);
+
+	// 라우트 테이블 (pages/assets/reDirect → URI 정렬 배열, catch-all handler 1개)
+	// p_manifest: /html_v2/asset_manifest.json "files" (null: gzip/ETag 미적용, 기존 동작)
+	class CL_W10_RouteHandler;
+	static void W10_buildRouteTable(JsonObjectConst p_root, JsonObjectConst p_manifest, bool& p_rootRedirect);
+	static void W10_serveRoute(AsyncWebServerRequest* p_r, uint16_t p_idx);
+	static bool W10_loadAssetManifest(JsonDocument& p_doc);
+	static void W10_invalidateStaticAsset(const char* p_file);
 	static void W10_getMenuJson(AsyncWebServerRequest* r);
 
 	static String getUploadPath(const String& p_filename);
@@ -192,7 +227,12 @@ class CL_W10_WebAPI {
 	// --------------------------------------------------
 	// 유틸리티 함수
 	// --------------------------------------------------
-	static void _broadcast(AsyncWebSocket* p_ws, JsonDocument& p_doc, bool p_diffOnly);
+	// p_ch: WS 채널 인덱스(G_A20_WS_CH_*) - client별 적응형 전송 간격 테이블 선택
+	static void _broadcast(AsyncWebSocket* p_ws, uint8_t p_ch, JsonDocument& p_doc, bool p_diffOnly);
+	static void _broadcastShared(AsyncWebSocket* p_ws, uint8_t p_ch, const AsyncWebSocketSharedBuffer& p_buf);
+	static void _broadcastChartShared(const AsyncWebSocketSharedBuffer& p_diff);
+	// 채널 수신자 존재 여부 (개별 endpoint client 또는 /ws 구독 client)
+	static bool _hasListeners(AsyncWebSocket* p_ws, uint8_t p_ch);
 
 	// 공통 헤더 적용
 	static inline void _applyHeaders(AsyncWebServerResponse* p_response, bool p_nocache) {
@@ -216,6 +256,11 @@ class CL_W10_WebAPI {
 		p_request->send(v_resp);
 	}
 
+	// 대용량 설정 GET: 항목(schedule/profile/preset) 단위 직렬화 → chunk 버퍼 직접 기록
+	// - 전체 JsonDocument / String 미생성 (peak heap = 항목 1개 문서, 목록 길이와 무관)
+	// - WIND_DICT: 파일에서 항목 단위 직접 스트리밍 (파일 형식 오류 → loadWindProfileDict 사본, 실패 시 500)
+	static void sendConfigChunked(AsyncWebServerRequest* p_request, EN_W10_cfg_stream_t p_kind);
+
 	// W10_Web_051.h 안에서 기존 sendText 교체
 	static inline void sendText(AsyncWebServerRequest* p_request, const String& p_msg, int p_code = 200, const char* p_mime = "text/plain; charset=utf-8") {
 		auto* v_resp = p_request->beginResponse(p_code, p_mime, p_msg);
@@ -225,9 +270,10 @@ class CL_W10_WebAPI {
 
 	// API Key 검사
 	static inline bool checkApiKey(AsyncWebServerRequest* p_request) {
-		const char* v_key = nullptr;
-		if (g_A20_config_root.system && g_A20_config_root.system->security.apiKey[0] != '\0') {
-			v_key = g_A20_config_root.system->security.apiKey;
+		const char*					 v_key = nullptr;
+		const ST_A20_SystemConfig_t* v_sys = C10_rcuRead(g_A20_config_root.system);
+		if (v_sys && v_sys->security.apiKey[0] != '\0') {
+			v_key = v_sys->security.apiKey;
 		}
 		if (!v_key || v_key[0] == '\0') {
 			return true;  // API 키 비활성화 상태
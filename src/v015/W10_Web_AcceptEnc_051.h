@@ -0,0 +1,110 @@
+#pragma once
+/*
+ * ------------------------------------------------------
+ * 소스명 : W10_Web_AcceptEnc_051.h
+ * 모듈 약어 : W10
+ * 모듈명 : Smart Nature Wind Web API - Accept-Encoding 협상 (gzip 자산 선택)
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - Accept-Encoding 헤더 값 → gzip 표현 허용 여부 (RFC 7231 5.3.4)
+ *   - 항목 = coding *( ";" param ), "q=" weight는 0~1 (소수 3자리) → 천분율 정수 비교
+ *   - "gzip"/"x-gzip" 명시 항목 우선: q > 0 이면 허용, q=0 이면 거부 ("*" 보다 우선)
+ *   - 명시 항목 없음 → "*" 의 q > 0 이면 허용, 그 외 거부
+ *   - coding 이름은 대소문자 무시 + 정확히 일치 ("gzipx" 등 부분 문자열은 불일치)
+ *   - q 값 형식 오류 → 0 (해당 항목 거부, 원본 전송은 항상 가능)
+ * - heap/String 미사용 (host 테스트: test/host T10_TestAcceptEnc_040.cpp)
+ * ------------------------------------------------------
+ * [구현 규칙]
+ * - 항상 소스 시작 주석 부분 체계 유지 및 내용 업데이트
+ * - 소스 시작 주석 부분 구현규칙, 코드네이밍규칙 내용 그대로 유지, 수정금지
+ * - ArduinoJson v7.x.x 사용 (v6 이하 사용 금지)
+ * - JsonDocument 단일 타입만 사용
+ * - createNestedArray/Object/containsKey 사용 금지
+ * - memset + strlcpy 기반 안전 초기화
+ * - 주석/필드명은 JSON 구조와 동일하게 유지
+ * ------------------------------------------------------
+ * [코드 네이밍 규칙]
+ * - 전역 상수,매크로      : G_모듈약어_ 접두사
+ * - 전역 변수             : g_모듈약어_ 접두사
+ * - 전역 함수             : 모듈약어_ 접두사
+ * - type                  : T_모듈약어_ 접두사
+ * - typedef               : _t  접미사
+ * - enum 상수             : EN_모듈약어_ 접두사
+ * - 구조체                : ST_모듈약어_ 접두사
+ * - 클래스명              : CL_모듈약어_ 접두사
+ * - 클래스 private 멤버   : _ 접두사
+ * - 클래스 멤버(함수/변수) : 모듈약어 접두사 미사용
+ * - 클래스 정적 멤버      : s_ 접두사
+ * ------------------------------------------------------
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <strings.h>
+
+#define G_W10_AE_Q_MAX 1000	 // q=1 (천분율)
+
+static inline bool W10_aeIsWs(char p_c) {
+	return p_c == ' ' || p_c == '\t';
+}
+
+// "q=" 이후 weight → 천분율 (형식 오류: -1)
+static inline int16_t W10_aeParseQ(const char*& p_p) {
+	if (*p_p != '0' && *p_p != '1') return -1;
+	int16_t v_q = (int16_t)((*p_p++ - '0') * G_W10_AE_Q_MAX);
+	if (*p_p == '.') {
+		p_p++;
+		int16_t v_scale = G_W10_AE_Q_MAX / 10;
+		for (uint8_t v_i = 0; v_i < 3 && *p_p >= '0' && *p_p <= '9'; v_i++, p_p++) {
+			v_q += (int16_t)((*p_p - '0') * v_scale);
+			v_scale /= 10;
+		}
+	}
+	if (v_q > G_W10_AE_Q_MAX) return -1;
+	return v_q;
+}
+
+// Accept-Encoding 값 → gzip 허용 여부 (nullptr/빈 값: false)
+static inline bool W10_acceptEncodingGzip(const char* p_hdr) {
+	if (!p_hdr) return false;
+
+	int16_t		v_gzipQ = -1;  // 명시 gzip/x-gzip 최대 q (-1: 미지정)
+	int16_t		v_starQ = -1;  // "*" q
+	const char* v_p		= p_hdr;
+
+	while (*v_p) {
+		while (*v_p == ',' || W10_aeIsWs(*v_p)) v_p++;
+		if (!*v_p) break;
+
+		const char* v_tok = v_p;
+		while (*v_p && *v_p != ',' && *v_p != ';' && !W10_aeIsWs(*v_p)) v_p++;
+		const size_t v_len = (size_t)(v_p - v_tok);
+
+		// 파라미터: q 만 해석, 그 외 건너뜀
+		int16_t v_q = G_W10_AE_Q_MAX;
+		while (*v_p && *v_p != ',') {
+			while (W10_aeIsWs(*v_p)) v_p++;
+			if (*v_p != ';') {
+				if (*v_p && *v_p != ',') v_p++;	 // 형식 밖 문자 건너뜀
+				continue;
+			}
+			v_p++;
+			while (W10_aeIsWs(*v_p)) v_p++;
+			if ((*v_p == 'q' || *v_p == 'Q') && v_p[1] == '=') {
+				v_p += 2;
+				v_q = W10_aeParseQ(v_p);
+				if (v_q < 0) v_q = 0;
+			}
+			while (*v_p && *v_p != ';' && *v_p != ',') v_p++;
+		}
+
+		if ((v_len == 4 && strncasecmp(v_tok, "gzip", 4) == 0) || (v_len == 6 && strncasecmp(v_tok, "x-gzip", 6) == 0)) {
+			if (v_q > v_gzipQ) v_gzipQ = v_q;
+		} else if (v_len == 1 && v_tok[0] == '*') {
+			v_starQ = v_q;
+		}
+	}
+
+	if (v_gzipQ >= 0) return v_gzipQ > 0;
+	return v_starQ > 0;
+}
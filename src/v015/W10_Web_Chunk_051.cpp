@@ -0,0 +1,609 @@
+/*
+ * ------------------------------------------------------
+ * 소스명 : W10_Web_Chunk_051.cpp
+ * 모듈 약어 : W10
+ * 모듈명 : Smart Nature Wind Web API (v030) - Chunked Config Response
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - 대용량 설정 GET(/api/config, /api/schedules, /api/user_profiles, /api/windProfile) chunked 응답
+ * - 항목(schedule / userProfile / preset / style) 1개씩 JsonDocument에 export → chunk 버퍼로 직접 직렬화
+ *   (전체 문서 + String 복사 없음: peak heap = 항목 1개 문서, 목록 길이와 무관)
+ * - 소형 섹션(system / wifi / motion / nvsSpec / webPage)은 섹션 단위 문서의 top-level member 병합
+ * - JSON 구조/key 순서/빈 값은 기존 toJson_* + sendJson 경로와 동일
+ *   (항목 0개 목록은 key 생략, windDict는 presets/styles 모두 0개일 때 생략, 출력 member 없음 → null)
+ * - GET /api/windProfile: 파일에서 preset/style 1개씩 읽어 loader 정규화 후 export (dict 사본 없음)
+ *   - 파일 구조 검사 실패(없음/형식 오류) → loadWindProfileDict(.bak 복구 포함) 사본 응답
+ * - chunk 경계는 문서 중간에 올 수 있음: 현재 part를 offset부터 재직렬화하여 이어 씀
+ * ------------------------------------------------------
+ * [구현 규칙]
+ * - 항상 소스 시작 주석 부분 체계 유지 및 내용 업데이트
+ * - 소스 시작 주석 부분 구현규칙, 코드네이밍규칙 내용 그대로 유지, 수정금지
+ * - ArduinoJson v7.x.x 사용 (v6 이하 사용 금지)
+ * - JsonDocument 단일 타입만 사용
+ * - createNestedArray/Object/containsKey 사용 금지
+ * - memset + strlcpy 기반 안전 초기화
+ * - 주석/필드명은 JSON 구조와 동일하게 유지
+ * ------------------------------------------------------
+ * [코드 네이밍 규칙]
+ * - 전역 상수,매크로      : G_모듈약어_ 접두사
+ * - 전역 변수             : g_모듈약어_ 접두사
+ * - 전역 함수             : 모듈약어_ 접두사
+ * - type                  : T_모듈약어_ 접두사
+ * - typedef               : _t  접미사
+ * - enum 상수             : EN_모듈약어_ 접두사
+ * - 구조체                : ST_모듈약어_ 접두사
+ * - 클래스명              : CL_모듈약어_ 접두사
+ * - 클래스 private 멤버   : _ 접두사
+ * - 클래스 멤버(함수/변수) : 모듈약어 접두사 미사용
+ * - 클래스 정적 멤버      : s_ 접두사
+ * ------------------------------------------------------
+ */
+
+#include <memory>
+
+#include "C10_Config_JsonSeek_041.h"
+#include "W10_Web_051.h"
+
+// literal part 최대 길이 ("\"userProfiles\":{\"profiles\":[" 등)
+static const uint8_t G_W10_CHUNK_LIT_MAX = 40;
+
+// ------------------------------------------------------
+// 진행 op: kind별 program (배열 순서 = 출력 순서 = toJson_All 순서)
+// ------------------------------------------------------
+typedef enum : uint8_t {
+	EN_W10_CHUNK_OP_END = 0,
+	EN_W10_CHUNK_OP_OPEN,
+	EN_W10_CHUNK_OP_CLOSE,
+	EN_W10_CHUNK_OP_SYSTEM,
+	EN_W10_CHUNK_OP_WIFI,
+	EN_W10_CHUNK_OP_MOTION,
+	EN_W10_CHUNK_OP_NVS_SPEC,
+	EN_W10_CHUNK_OP_SCHEDULES,
+	EN_W10_CHUNK_OP_USER_PROFILES,
+	EN_W10_CHUNK_OP_PRESETS,
+	EN_W10_CHUNK_OP_STYLES,
+	EN_W10_CHUNK_OP_WEB_PAGE
+} EN_W10_chunk_op_t;
+
+static const uint8_t G_W10_CHUNK_PROG_ALL[] = {
+	EN_W10_CHUNK_OP_OPEN,
+	EN_W10_CHUNK_OP_SYSTEM,
+	EN_W10_CHUNK_OP_WIFI,
+	EN_W10_CHUNK_OP_MOTION,
+	EN_W10_CHUNK_OP_NVS_SPEC,
+	EN_W10_CHUNK_OP_SCHEDULES,
+	EN_W10_CHUNK_OP_USER_PROFILES,
+	EN_W10_CHUNK_OP_PRESETS,
+	EN_W10_CHUNK_OP_STYLES,
+	EN_W10_CHUNK_OP_WEB_PAGE,
+	EN_W10_CHUNK_OP_CLOSE,
+	EN_W10_CHUNK_OP_END};
+static const uint8_t G_W10_CHUNK_PROG_SCHEDULES[]	 = {EN_W10_CHUNK_OP_OPEN, EN_W10_CHUNK_OP_SCHEDULES, EN_W10_CHUNK_OP_CLOSE, EN_W10_CHUNK_OP_END};
+static const uint8_t G_W10_CHUNK_PROG_USER_PROFILES[] = {EN_W10_CHUNK_OP_OPEN, EN_W10_CHUNK_OP_USER_PROFILES, EN_W10_CHUNK_OP_CLOSE, EN_W10_CHUNK_OP_END};
+static const uint8_t G_W10_CHUNK_PROG_WIND_DICT[]	 = {EN_W10_CHUNK_OP_OPEN, EN_W10_CHUNK_OP_PRESETS, EN_W10_CHUNK_OP_STYLES, EN_W10_CHUNK_OP_CLOSE, EN_W10_CHUNK_OP_END};
+
+// chunked 응답 누적 통계
+typedef struct {
+	uint32_t responses;		// 시작된 응답 수
+	uint32_t active;		// 진행 중 응답 수
+	uint32_t chunks;		// chunk callback 호출 수
+	uint32_t parts;			// 직렬화한 part(항목/섹션 문서) 수
+	uint32_t bytes;			// 누적 본문 바이트
+	uint32_t lastBytes;		// 마지막 완료 응답 본문 바이트
+	uint32_t maxPartBytes;	// 최대 part 직렬화 크기 (응답 중 추가 heap 상한 기준)
+	uint32_t fileItems;		// windDict 파일에서 직접 읽은 항목 수
+	uint32_t fileErrors;	// windDict 파일 스트리밍 중 형식 오류/열기 실패 (배열 조기 종료)
+	uint32_t fileFallback;	// 파일 구조 검사 실패 → 사본(loadWindProfileDict) 응답 수
+} ST_W10_CfgStreamStat_t;
+
+// windDict 배열 key 경로 (C10 loader 동일)
+static const char* const G_W10_KEYS_WIND_PRESETS[] = {"windDict", "presets"};
+static const char* const G_W10_KEYS_WIND_STYLES[]  = {"windDict", "styles"};
+
+static ST_W10_CfgStreamStat_t s_cfgStreamStat = {};
+
+// ------------------------------------------------------
+// Print 구현: 직렬화 결과 중 [skip, skip+cap) 구간만 대상 버퍼에 기록
+// ------------------------------------------------------
+class CL_W10_SlicePrint : public Print {
+  public:
+	CL_W10_SlicePrint(uint8_t* p_dst, size_t p_skip, size_t p_cap) : _dst(p_dst), _skip(p_skip), _cap(p_cap) {}
+
+	size_t write(uint8_t p_c) override {
+		if (_skip > 0) {
+			_skip--;
+		} else if (_len < _cap) {
+			_dst[_len++] = p_c;
+		}
+		return 1;
+	}
+
+	size_t write(const uint8_t* p_buf, size_t p_n) override {
+		size_t v_i = 0;
+		if (_skip > 0) {
+			v_i = (_skip < p_n) ? _skip : p_n;
+			_skip -= v_i;
+		}
+		size_t v_take = p_n - v_i;
+		if (v_take > _cap - _len)
+			v_take = _cap - _len;
+		if (v_take > 0) {
+			memcpy(_dst + _len, p_buf + v_i, v_take);
+			_len += v_take;
+		}
+		return p_n;	 // 범위 밖 바이트도 소비한 것으로 처리 (직렬화 중단 없음)
+	}
+
+  private:
+	uint8_t* _dst;
+	size_t	 _skip;
+	size_t	 _cap;
+	size_t	 _len = 0;
+};
+
+// ------------------------------------------------------
+// chunk 생성기: op program을 순서대로 part(literal / 문서)로 변환
+// - 설정 포인터는 part 생성 시점마다 g_A20_config_root에서 재조회 (섹션 reload 대응)
+//   (RCU: part 사이 포인터 보유 금지 → 이전 세대는 grace 경과 후 해제됨)
+// - HTTP 핸들러는 모두 async_tcp task에서 실행 → 항목 1개 export 도중 CRUD 변경 없음
+// - 배열은 항목을 먼저 만든 뒤 open literal 출력 (항목 0개 → key 생략, 기존 출력 유지)
+// ------------------------------------------------------
+class CL_W10_CfgChunker {
+  public:
+	CL_W10_CfgChunker(EN_W10_cfg_stream_t p_kind, ST_A20_WindProfileDict_t* p_dict) : _ownDict(p_dict) {
+		switch (p_kind) {
+			case EN_W10_CFG_STREAM_SCHEDULES:
+				_prog = G_W10_CHUNK_PROG_SCHEDULES;
+				break;
+			case EN_W10_CFG_STREAM_USER_PROFILES:
+				_prog = G_W10_CHUNK_PROG_USER_PROFILES;
+				break;
+			case EN_W10_CFG_STREAM_WIND_DICT:
+				_prog	  = G_W10_CHUNK_PROG_WIND_DICT;
+				_fromFile = (p_dict == nullptr);
+				break;
+			default:
+				_prog = G_W10_CHUNK_PROG_ALL;
+				break;
+		}
+		memset(_lit, 0, sizeof(_lit));
+		s_cfgStreamStat.responses++;
+		s_cfgStreamStat.active++;
+	}
+
+	~CL_W10_CfgChunker() {
+		if (_file)
+			_file.close();
+		delete _ownDict;
+		if (s_cfgStreamStat.active > 0)
+			s_cfgStreamStat.active--;
+		s_cfgStreamStat.lastBytes = _bytes;
+	}
+
+	// AwsResponseFiller: 최대 p_max 바이트 기록, 0 반환 = 응답 종료
+	size_t fill(uint8_t* p_buf, size_t p_max) {
+		size_t v_n = 0;
+		while (v_n < p_max) {
+			if (!_active && !_next())
+				break;
+
+			if (_pre) {
+				p_buf[v_n++] = (uint8_t)_pre;
+				_pre		 = 0;
+				continue;
+			}
+
+			size_t v_take = _len - _off;
+			if (v_take > p_max - v_n)
+				v_take = p_max - v_n;
+
+			if (_isDoc) {
+				CL_W10_SlicePrint v_print(p_buf + v_n, _docStart + _off, v_take);
+				serializeJson(_doc, v_print);
+			} else {
+				memcpy(p_buf + v_n, _lit + _off, v_take);
+			}
+			_off += v_take;
+			v_n += v_take;
+			if (_off >= _len)
+				_active = false;
+		}
+
+		s_cfgStreamStat.chunks++;
+		s_cfgStreamStat.bytes += v_n;
+		_bytes += v_n;
+		return v_n;
+	}
+
+  private:
+	const ST_A20_WindProfileDict_t* _dict() const {
+		return _ownDict ? _ownDict : C10_rcuRead(g_A20_config_root.windDict);
+	}
+
+	void _setLit(char p_pre, const char* p_text) {
+		strlcpy(_lit, p_text, sizeof(_lit));
+		_isDoc	= false;
+		_pre	= p_pre;
+		_len	= strlen(_lit);
+		_off	= 0;
+		_active = true;
+	}
+
+	// p_inner: 바깥 "{}" 제외 (top-level member 병합)
+	void _setDoc(char p_pre, bool p_inner) {
+		const size_t v_len = measureJson(_doc);
+		_isDoc			   = true;
+		_pre			   = p_pre;
+		_docStart		   = p_inner ? 1 : 0;
+		_len			   = p_inner ? v_len - 2 : v_len;
+		_off			   = 0;
+		_active			   = true;
+
+		s_cfgStreamStat.parts++;
+		if (v_len > s_cfgStreamStat.maxPartBytes)
+			s_cfgStreamStat.maxPartBytes = (uint32_t)v_len;
+	}
+
+	// top-level member 앞 구분자: 첫 member는 여는 '{' (member 없이 끝나면 "null")
+	char _memberPre() {
+		const char v_pre = _first ? '{' : ',';
+		_first			 = false;
+		return v_pre;
+	}
+
+	bool _next() {
+		while (true) {
+			const uint8_t v_op = _prog[_pc];
+			switch (v_op) {
+				case EN_W10_CHUNK_OP_END:
+					_doc.clear();
+					return false;
+				case EN_W10_CHUNK_OP_OPEN:
+					_first = true;
+					_pc++;
+					break;
+				case EN_W10_CHUNK_OP_CLOSE:
+					// 빈 문서: 기존 sendJson(빈 JsonDocument) 출력과 동일
+					_setLit(0, _first ? "null" : "}");
+					_pc++;
+					return true;
+				case EN_W10_CHUNK_OP_SCHEDULES:
+				case EN_W10_CHUNK_OP_USER_PROFILES:
+				case EN_W10_CHUNK_OP_PRESETS:
+				case EN_W10_CHUNK_OP_STYLES:
+					if (_array(v_op))
+						return true;
+					break;
+				default:
+					_pc++;
+					if (_section(v_op))
+						return true;
+					break;
+			}
+		}
+	}
+
+	// 소형 섹션: 기존 toJson_* 그대로 → top-level member만 병합 (없음/빈 섹션은 생략)
+	bool _section(uint8_t p_op) {
+		const ST_A20_ConfigRoot_t& v_root = g_A20_config_root;
+		_doc.clear();
+		switch (p_op) {
+			case EN_W10_CHUNK_OP_SYSTEM:
+				if (!v_root.system)
+					return false;
+				CL_C10_ConfigManager::toJson_System(*v_root.system, _doc);
+				break;
+			case EN_W10_CHUNK_OP_WIFI:
+				if (!v_root.wifi)
+					return false;
+				CL_C10_ConfigManager::toJson_Wifi(*v_root.wifi, _doc);
+				break;
+			case EN_W10_CHUNK_OP_MOTION:
+				if (!v_root.motion)
+					return false;
+				CL_C10_ConfigManager::toJson_Motion(*v_root.motion, _doc);
+				break;
+			case EN_W10_CHUNK_OP_NVS_SPEC:
+				if (!v_root.nvsSpec)
+					return false;
+				CL_C10_ConfigManager::toJson_NvsSpec(*v_root.nvsSpec, _doc);
+				break;
+			case EN_W10_CHUNK_OP_WEB_PAGE:
+				if (!v_root.webPage)
+					return false;
+				CL_C10_ConfigManager::toJson_WebPage(*v_root.webPage, _doc);
+				break;
+			default:
+				return false;
+		}
+		if (!_doc.is<JsonObject>() || _doc.size() == 0)
+			return false;
+
+		_setDoc(_memberPre(), true);
+		return true;
+	}
+
+	// 현재 항목 수 (-1: 섹션 없음)
+	int16_t _arrCount(uint8_t p_op) const {
+		const ST_A20_ConfigRoot_t& v_root = g_A20_config_root;
+		switch (p_op) {
+			case EN_W10_CHUNK_OP_SCHEDULES:
+				return v_root.schedules ? v_root.schedules->count : -1;
+			case EN_W10_CHUNK_OP_USER_PROFILES:
+				return v_root.userProfiles ? v_root.userProfiles->count : -1;
+			case EN_W10_CHUNK_OP_PRESETS:
+				return _dict() ? _dict()->presetCount : -1;
+			case EN_W10_CHUNK_OP_STYLES:
+				return _dict() ? _dict()->styleCount : -1;
+			default:
+				return -1;
+		}
+	}
+
+	void _arrItem(uint8_t p_op, uint16_t p_idx) {
+		const ST_A20_ConfigRoot_t& v_root = g_A20_config_root;
+		JsonObject				   v_obj  = _doc.to<JsonObject>();
+		switch (p_op) {
+			case EN_W10_CHUNK_OP_SCHEDULES:
+				CL_C10_ConfigManager::toJson_ScheduleItem(v_root.schedules->items[p_idx], v_obj);
+				break;
+			case EN_W10_CHUNK_OP_USER_PROFILES:
+				CL_C10_ConfigManager::toJson_UserProfileItem(v_root.userProfiles->items[p_idx], v_obj);
+				break;
+			case EN_W10_CHUNK_OP_PRESETS:
+				CL_C10_ConfigManager::toJson_WindPreset(_dict()->presets[p_idx], v_obj);
+				break;
+			case EN_W10_CHUNK_OP_STYLES:
+				CL_C10_ConfigManager::toJson_WindStyle(_dict()->styles[p_idx], v_obj);
+				break;
+			default:
+				break;
+		}
+	}
+
+	// windDict 파일: 배열 시작까지 seek (op당 1회 열기, 응답 중 파일 유지)
+	bool _fileOpenArray(const char* const* p_keys) {
+		_file = LittleFS.open(CL_C10_ConfigManager::getCfgJsonFileMap().windDict, "r");
+		if (!_file) {
+			s_cfgStreamStat.fileErrors++;
+			return false;
+		}
+		_file.setTimeout(0);  // 잘린 파일 EOF에서 timedRead 대기 방지
+
+		const int8_t v_r = C10_ioSeekArray(_file, p_keys, 2);
+		if (v_r == 1)
+			return true;
+		if (v_r < 0)
+			s_cfgStreamStat.fileErrors++;
+		_file.close();
+		return false;
+	}
+
+	// windDict 파일 항목 1개 → loader 정규화(기본값/길이 제한) → _doc export
+	//  - 응답 중 파일 교체/형식 오류 → 해당 배열 조기 종료 (닫는 literal은 출력, JSON 구조 유지)
+	bool _nextFileItem(uint8_t p_op) {
+		const bool	   v_presets = (p_op == EN_W10_CHUNK_OP_PRESETS);
+		const uint16_t v_max	 = v_presets ? A20_Const::WIND_PRESETS_MAX : A20_Const::WIND_STYLES_MAX;
+
+		if (_item == 0 && !_file && !_fileOpenArray(v_presets ? G_W10_KEYS_WIND_PRESETS : G_W10_KEYS_WIND_STYLES))
+			return false;
+		if (!_file)
+			return false;
+		if (_item >= v_max) {  // loader 동일 상한 (초과 항목 무시)
+			_file.close();
+			return false;
+		}
+
+		int8_t v_r = C10_ioNextItem(_file, _item);
+		if (v_r == 1) {
+			_doc.clear();
+			DeserializationError v_e = deserializeJson(_doc, _file, DeserializationOption::NestingLimit(G_C10_JSON_NEST_ITEM));
+			if (!v_e) {
+				if (v_presets) {
+					ST_A20_PresetEntry_t v_p;
+					memset(&v_p, 0, sizeof(v_p));
+					CL_C10_ConfigManager::fromJson_WindPreset(_doc.as<JsonObjectConst>(), v_p);
+					_doc.clear();
+					CL_C10_ConfigManager::toJson_WindPreset(v_p, _doc.to<JsonObject>());
+				} else {
+					ST_A20_StyleEntry_t v_s;
+					memset(&v_s, 0, sizeof(v_s));
+					CL_C10_ConfigManager::fromJson_WindStyle(_doc.as<JsonObjectConst>(), v_s);
+					_doc.clear();
+					CL_C10_ConfigManager::toJson_WindStyle(v_s, _doc.to<JsonObject>());
+				}
+				_item++;
+				s_cfgStreamStat.fileItems++;
+				return true;
+			}
+			v_r = -1;
+		}
+		if (v_r < 0) {
+			s_cfgStreamStat.fileErrors++;
+			CL_D10_Logger::log(EN_L10_LOG_WARN, "[W10] windDict stream: %s item #%u invalid, array truncated", v_presets ? "presets" : "styles", (unsigned)_item);
+		}
+		_file.close();
+		return false;
+	}
+
+	// 다음 항목 → _doc (없음/끝: false)
+	bool _nextItem(uint8_t p_op) {
+		if (_fromFile)
+			return _nextFileItem(p_op);
+
+		const int16_t v_count = _arrCount(p_op);
+		if (v_count <= 0 || _item >= (uint16_t)v_count)
+			return false;
+		_doc.clear();
+		_arrItem(p_op, _item);
+		_item++;
+		return true;
+	}
+
+	// 배열 섹션: 첫 항목 생성 → open literal → 항목 문서 N개 → close literal
+	// - 항목 0개 / 섹션 없음: key 생략 (기존 toJson_* 동일)
+	// - windDict: presets/styles 중 먼저 항목이 나온 쪽이 "windDict":{ 를 열고, styles 처리 끝에 닫음
+	// - open 이후 섹션이 사라져도(reload/파일 오류) close는 반드시 출력 (JSON 구조 유지)
+	bool _array(uint8_t p_op) {
+		if (_itemReady) {  // open literal 출력 완료 → 미리 만든 첫 항목
+			_itemReady = false;
+			_setDoc(0, false);
+			return true;
+		}
+
+		if (_nextItem(p_op)) {
+			if (_arrOpen) {
+				_setDoc(',', false);
+				return true;
+			}
+
+			char		v_pre  = 0;
+			const char* v_open = "";
+			switch (p_op) {
+				case EN_W10_CHUNK_OP_SCHEDULES:
+					v_pre  = _memberPre();
+					v_open = "\"schedules\":[";
+					break;
+				case EN_W10_CHUNK_OP_USER_PROFILES:
+					v_pre  = _memberPre();
+					v_open = "\"userProfiles\":{\"profiles\":[";
+					break;
+				case EN_W10_CHUNK_OP_PRESETS:
+					v_pre	  = _memberPre();
+					v_open	  = "\"windDict\":{\"presets\":[";
+					_dictOpen = true;
+					break;
+				case EN_W10_CHUNK_OP_STYLES:
+					if (_dictOpen) {
+						v_pre  = ',';
+						v_open = "\"styles\":[";
+					} else {
+						v_pre	  = _memberPre();
+						v_open	  = "\"windDict\":{\"styles\":[";
+						_dictOpen = true;
+					}
+					break;
+				default:
+					break;
+			}
+			_setLit(v_pre, v_open);
+			_arrOpen   = true;
+			_itemReady = true;
+			return true;
+		}
+
+		// 항목 끝: 열린 배열/object 닫기
+		const char* v_close = nullptr;
+		if (_arrOpen) {
+			v_close = (p_op == EN_W10_CHUNK_OP_USER_PROFILES || p_op == EN_W10_CHUNK_OP_STYLES) ? "]}" : "]";
+		} else if (p_op == EN_W10_CHUNK_OP_STYLES && _dictOpen) {
+			v_close = "}";	// presets만 있는 windDict
+		}
+		if (p_op == EN_W10_CHUNK_OP_STYLES)
+			_dictOpen = false;
+		_arrOpen = false;
+		_item	 = 0;
+		_pc++;
+
+		if (!v_close)
+			return false;
+		_setLit(0, v_close);
+		return true;
+	}
+
+  private:
+	const uint8_t*			  _prog		 = G_W10_CHUNK_PROG_ALL;
+	uint8_t					  _pc		 = 0;
+	uint16_t				  _item		 = 0;
+	bool					  _first	 = true;   // top-level 첫 member ('{' 출력 전)
+	bool					  _arrOpen	 = false;  // 현재 배열 open literal 출력됨
+	bool					  _itemReady = false;  // open literal 뒤 출력할 첫 항목이 _doc에 있음
+	bool					  _dictOpen	 = false;  // "windDict":{ 출력됨 (styles 처리 끝에 닫음)
+	bool					  _fromFile	 = false;  // windDict 항목을 파일에서 직접 읽음
+	ST_A20_WindProfileDict_t* _ownDict	 = nullptr;
+	File					  _file;			   // windDict 파일 (배열 순회 중에만 열림)
+
+	// 현재 part
+	JsonDocument _doc;
+	char		 _lit[G_W10_CHUNK_LIT_MAX];
+	bool		 _active   = false;
+	bool		 _isDoc	   = false;
+	char		 _pre	   = 0;	 // part 앞 구분자 (',' / '{' 또는 0)
+	size_t		 _docStart = 0;
+	size_t		 _len	   = 0;
+	size_t		 _off	   = 0;
+	uint32_t	 _bytes	   = 0;
+};
+
+// windDict 파일 구조 검사: presets/styles 배열을 항목 skip으로 끝까지 순회 (heap 미사용)
+//  - false: 파일 없음 / 형식 오류 → 사본 경로(loadWindProfileDict, .bak 복구) 사용
+static bool W10_windDictFileValid(const char* p_path) {
+	if (!p_path || !p_path[0] || !LittleFS.exists(p_path))
+		return false;
+
+	const char* const* v_paths[] = {G_W10_KEYS_WIND_PRESETS, G_W10_KEYS_WIND_STYLES};
+	for (const char* const* v_keys : v_paths) {
+		File v_f = LittleFS.open(p_path, "r");
+		if (!v_f)
+			return false;
+		v_f.setTimeout(0);
+
+		int8_t	 v_r = C10_ioSeekArray(v_f, v_keys, 2);
+		uint16_t v_n = 0;
+		while (v_r == 1) {
+			v_r = C10_ioNextItem(v_f, v_n);
+			if (v_r == 1) {
+				if (!C10_ioSkipValue(v_f))
+					v_r = -1;
+				v_n++;
+			}
+		}
+		v_f.close();
+		if (v_r < 0)
+			return false;
+	}
+	return true;
+}
+
+// ------------------------------------------------------
+// 응답 전송 (생성기 수명 = 응답 객체 수명, callback 캡처로 유지)
+// ------------------------------------------------------
+void CL_W10_WebAPI::sendConfigChunked(AsyncWebServerRequest* p_request, EN_W10_cfg_stream_t p_kind) {
+	// windDict: 파일 직접 스트리밍, 구조 검사 실패 시에만 파일 기준 사본 (응답 종료 시 생성기가 해제)
+	ST_A20_WindProfileDict_t* v_dict = nullptr;
+	if (p_kind == EN_W10_CFG_STREAM_WIND_DICT && !W10_windDictFileValid(CL_C10_ConfigManager::getCfgJsonFileMap().windDict)) {
+		s_cfgStreamStat.fileFallback++;
+		v_dict = new ST_A20_WindProfileDict_t();
+		memset(v_dict, 0, sizeof(ST_A20_WindProfileDict_t));
+		if (!CL_C10_ConfigManager::loadWindProfileDict(*v_dict)) {
+			delete v_dict;
+			p_request->send(500, "application/json", "{\"error\":\"load failed\"}");
+			return;
+		}
+	}
+
+	std::shared_ptr<CL_W10_CfgChunker> v_src = std::make_shared<CL_W10_CfgChunker>(p_kind, v_dict);
+
+	AsyncWebServerResponse* v_resp = p_request->beginChunkedResponse(
+		"application/json; charset=utf-8",
+		[v_src](uint8_t* p_buf, size_t p_max, size_t p_index) -> size_t {
+			(void)p_index;
+			return v_src->fill(p_buf, p_max);
+		});
+
+	_applyHeaders(v_resp, true);
+	p_request->send(v_resp);
+}
+
+void CL_W10_WebAPI::cfgStreamStatsToJson(JsonObject p_obj) {
+	p_obj["responses"]	  = s_cfgStreamStat.responses;
+	p_obj["active"]		  = s_cfgStreamStat.active;
+	p_obj["chunks"]		  = s_cfgStreamStat.chunks;
+	p_obj["parts"]		  = s_cfgStreamStat.parts;
+	p_obj["bytes"]		  = s_cfgStreamStat.bytes;
+	p_obj["lastBytes"]	  = s_cfgStreamStat.lastBytes;
+	p_obj["maxPartBytes"] = s_cfgStreamStat.maxPartBytes;
+	p_obj["fileItems"]	  = s_cfgStreamStat.fileItems;
+	p_obj["fileErrors"]	  = s_cfgStreamStat.fileErrors;
+	p_obj["fileFallback"] = s_cfgStreamStat.fileFallback;
+}
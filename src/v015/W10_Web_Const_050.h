@@ -104,12 +104,37 @@ constexpr const char* WS_API_STATE				   = WS_API_BASE "/state";
 constexpr const char* WS_API_CHART				   = WS_API_BASE "/chart";
 constexpr const char* WS_API_METRICS			   = WS_API_BASE "/metrics";
 constexpr const char* WS_API_SUMMARY			   = WS_API_BASE "/summary";
+// topic 다중화 단일 endpoint (구독 제어 메시지 + topic 태그 frame). 개별 endpoint는 호환용 유지
+constexpr const char* WS_API_MUX				   = WS_API_BASE;
+
+// /chart client 추적 최대 수 (binary 협상 + seq delta sync, 초과 client는 JSON diff fallback)
+constexpr uint8_t	  WS_CHART_CLIENT_MAX		   = 8;
+
+// 채널별 적응형 전송 간격 추적 client 최대 수 (초과 client는 채널 기본 간격으로 전송)
+constexpr uint8_t	  WS_PACE_CLIENT_MAX		   = 8;
+
+// /ws (다중화) 구독 client 최대 수 (초과 연결은 거절)
+constexpr uint8_t	  WS_MUX_CLIENT_MAX			   = 8;
+
+// /ws "logs" topic 전달 queue (임의 task 로그 → loop task 전송). 가득 참/초과 길이는 drop 집계
+constexpr uint8_t	  WS_MUX_LOG_QUEUE			   = 8;
+constexpr uint16_t	  WS_MUX_LOG_LINE_MAX		   = 384;  // 로그 JSON 1건 최대 [byte]
 
 // --------------------------------------------------
 // 10. 파일 시스템 경로 (LittleFS Path)
 // --------------------------------------------------
 constexpr const char* PATH_STATIC_HTML			   = "/html_v2";
 constexpr const char* PATH_STATIC_JSON			   = "/json";
+// 빌드 시 생성 (scripts/web_gzip_assets.py): 자산별 content hash / gzip 크기
+constexpr const char* FILE_ASSET_MANIFEST		   = "/html_v2/asset_manifest.json";
+
+// 정적 자산 캐시 정책
+// - versioned URI(?v=<hash 8자> 일치): 장기 immutable 캐시
+// - 그 외: no-cache (매 요청 ETag 재검증 → 변경 없으면 304)
+constexpr const char* STATIC_CACHE_IMMUTABLE	   = "public, max-age=31536000, immutable";
+constexpr const char* STATIC_CACHE_REVALIDATE	   = "no-cache";
+constexpr uint8_t	  STATIC_VER_LEN			   = 8;
+constexpr uint8_t	  STATIC_ETAG_LEN			   = 24;  // 따옴표 2 + hash 16 + ".gz" 3 + NUL
 
 // constexpr const char* FILE_PAGES_JSON         = "/json/cfg_pages_032.json";
 
@@ -6,6 +6,9 @@
  * ------------------------------------------------------
  * 기능 요약:
  * - Web UI / REST API 엔드포인트 라우팅 로직 구현 (Full CRUD 및 제어 기능 포함)
+ * - 대용량 설정 GET(config / schedules / user_profiles / windProfile): 항목 단위 chunked 응답 (sendConfigChunked)
+ * - 설정 PATCH: C10 apply*Patch (복제본 patch → RCU publish), GET은 C10_rcuRead 1회 load
+ * - CRUD/PATCH 저장은 C10 write-behind 예약(requestSave, coalesce), /api/config/save·Wi-Fi 적용은 즉시 저장
  * ------------------------------------------------------
  * [구현 규칙]
  * - 항상 소스 시작 주석 부분 체계 유지 및 내용 업데이트
@@ -49,6 +52,7 @@ AsyncWebSocket			s_wsState(W10_Const::WS_API_STATE);
 AsyncWebSocket			s_wsChart(W10_Const::WS_API_CHART);
 AsyncWebSocket			s_wsMetrics(W10_Const::WS_API_METRICS);
 AsyncWebSocket			s_wsSummary(W10_Const::WS_API_SUMMARY);
+AsyncWebSocket			s_wsMux(W10_Const::WS_API_MUX);
 
 /*
 AsyncWebSocket          s_wsLogs("/ws/log");
@@ -62,6 +66,7 @@ AsyncWebSocket*			CL_W10_WebAPI::s_wsServerLogs	 = &s_wsLogs;
 AsyncWebSocket*			CL_W10_WebAPI::s_wsServerChart	 = &s_wsChart;
 AsyncWebSocket*			CL_W10_WebAPI::s_wsServerMetrics = &s_wsMetrics;
 AsyncWebSocket*			CL_W10_WebAPI::s_wsServerSummary = &s_wsSummary;
+AsyncWebSocket*			CL_W10_WebAPI::s_wsServerMux	 = &s_wsMux;
 
 // --------------------------------------------------
 // 초기화
@@ -178,8 +183,9 @@ void CL_W10_WebAPI::routeSystem() {
 			return;
 		}
 		JsonDocument v_doc;
-		if (g_A20_config_root.system) {
-			CL_C10_ConfigManager::toJson_System(*g_A20_config_root.system, v_doc);
+		const auto* v_cfg = C10_rcuRead(g_A20_config_root.system);
+		if (v_cfg) {
+			CL_C10_ConfigManager::toJson_System(*v_cfg, v_doc);
 		}
 		sendJson(p_request, v_doc);
 	});
@@ -200,10 +206,8 @@ void CL_W10_WebAPI::routeSystem() {
                 return;
             }
 
-            bool v_changed = false;
-            if (g_A20_config_root.system) {
-                v_changed = CL_C10_ConfigManager::patchSystemFromJson(*g_A20_config_root.system, v_doc);
-            }
+            // RCU: 복제본 patch → publish (S10/CT10 reader는 lock 없이 이전/새 세대 중 하나만 관찰)
+            bool v_changed = CL_C10_ConfigManager::applySystemPatch(v_doc);
 
             JsonDocument v_res;
             v_res["updated"] = v_changed;
@@ -221,8 +225,9 @@ void CL_W10_WebAPI::routeMotion() {
 			return;
 		}
 		JsonDocument v_doc;
-		if (g_A20_config_root.motion) {
-			CL_C10_ConfigManager::toJson_Motion(*g_A20_config_root.motion, v_doc);
+		const auto* v_cfg = C10_rcuRead(g_A20_config_root.motion);
+		if (v_cfg) {
+			CL_C10_ConfigManager::toJson_Motion(*v_cfg, v_doc);
 		}
 		sendJson(p_request, v_doc);
 	});
@@ -243,10 +248,8 @@ void CL_W10_WebAPI::routeMotion() {
                 return;
             }
 
-            bool v_changed = false;
-            if (g_A20_config_root.motion) {
-                v_changed = CL_C10_ConfigManager::patchMotionFromJson(*g_A20_config_root.motion, v_doc);
-            }
+            // RCU: 복제본 patch → publish (S10/CT10 reader는 lock 없이 이전/새 세대 중 하나만 관찰)
+            bool v_changed = CL_C10_ConfigManager::applyMotionPatch(v_doc);
 
             JsonDocument v_res;
             v_res["updated"] = v_changed;
@@ -264,16 +267,8 @@ void CL_W10_WebAPI::routeWindProfile() {
 			return;
 		}
 
-		JsonDocument			 v_doc;
-		ST_A20_WindProfileDict_t v_dict;
-		memset(&v_dict, 0, sizeof(v_dict));
-
-		if (CL_C10_ConfigManager::loadWindProfileDict(v_dict)) {
-			CL_C10_ConfigManager::toJson_WindProfileDict(v_dict, v_doc);
-			sendJson(p_request, v_doc);
-		} else {
-			p_request->send(500, "application/json", "{\"error\":\"load failed\"}");
-		}
+		// 파일 기준 응답: preset/style 1개씩 파일에서 읽어 직렬화 (dict 사본 없음)
+		sendConfigChunked(p_request, EN_W10_CFG_STREAM_WIND_DICT);
 	});
 
 	// POST: 신규 생성
@@ -299,7 +294,7 @@ void CL_W10_WebAPI::routeWindProfile() {
                 v_res["result"] = "created";
                 v_res["id"]     = v_new_id;
 
-                CL_C10_ConfigManager::saveDirtyConfigs();
+                CL_C10_ConfigManager::requestSave();
                 sendJson(p_request, v_res, 201);
             } else {
                 v_res["error"] = "creation failed or validation error";
@@ -337,7 +332,7 @@ void CL_W10_WebAPI::routeWindProfileID() {
 			JsonDocument v_res;
 			v_res["updated"] = v_updated;
 			if (v_updated) {
-				CL_C10_ConfigManager::saveDirtyConfigs();
+				CL_C10_ConfigManager::requestSave();
 			}
 			sendJson(p_request, v_res, v_updated ? 200 : 404);
 		});
@@ -354,7 +349,7 @@ void CL_W10_WebAPI::routeWindProfileID() {
 		JsonDocument v_res;
 		v_res["deleted"] = v_deleted;
 		if (v_deleted) {
-			CL_C10_ConfigManager::saveDirtyConfigs();
+			CL_C10_ConfigManager::requestSave();
 		}
 		sendJson(p_request, v_res, v_deleted ? 200 : 404);
 	});
@@ -370,11 +365,8 @@ void CL_W10_WebAPI::routeSchedules() {
 			p_request->send(401, "application/json", "{\"error\":\"unauthorized\"}");
 			return;
 		}
-		JsonDocument v_doc;
-		if (g_A20_config_root.schedules) {
-			CL_C10_ConfigManager::toJson_Schedules(*g_A20_config_root.schedules, v_doc);
-		}
-		sendJson(p_request, v_doc);
+		// 항목 단위 chunked 직렬화 (schedule 수와 무관한 peak heap)
+		sendConfigChunked(p_request, EN_W10_CFG_STREAM_SCHEDULES);
 	});
 
 	// POST: 신규 생성
@@ -399,7 +391,7 @@ void CL_W10_WebAPI::routeSchedules() {
             if (v_new_id > 0) {
                 v_res["result"] = "created";
                 v_res["id"]     = v_new_id;
-                CL_C10_ConfigManager::saveDirtyConfigs();
+                CL_C10_ConfigManager::requestSave();
                 sendJson(p_request, v_res, 201);
             } else {
                 v_res["error"] = "creation failed or validation error";
@@ -433,7 +425,7 @@ void CL_W10_WebAPI::routeSchedulesID() {
             JsonDocument v_res;
             v_res["updated"] = v_updated;
             if (v_updated) {
-                CL_C10_ConfigManager::saveDirtyConfigs();
+                CL_C10_ConfigManager::requestSave();
             }
             sendJson(p_request, v_res, v_updated ? 200 : 404); });
 
@@ -449,7 +441,7 @@ void CL_W10_WebAPI::routeSchedulesID() {
 		JsonDocument v_res;
 		v_res["deleted"] = v_deleted;
 		if (v_deleted) {
-			CL_C10_ConfigManager::saveDirtyConfigs();
+			CL_C10_ConfigManager::requestSave();
 		}
 		sendJson(p_request, v_res, v_deleted ? 200 : 404);
 	});
@@ -465,11 +457,8 @@ void CL_W10_WebAPI::routeUserProfiles() {
 			p_request->send(401, "application/json", "{\"error\":\"unauthorized\"}");
 			return;
 		}
-		JsonDocument v_doc;
-		if (g_A20_config_root.userProfiles) {
-			CL_C10_ConfigManager::toJson_UserProfiles(*g_A20_config_root.userProfiles, v_doc);
-		}
-		sendJson(p_request, v_doc);
+		// 항목 단위 chunked 직렬화 (profile 수와 무관한 peak heap)
+		sendConfigChunked(p_request, EN_W10_CFG_STREAM_USER_PROFILES);
 	});
 
 	// POST: 신규 생성
@@ -496,7 +485,7 @@ void CL_W10_WebAPI::routeUserProfiles() {
             if (v_new_id > 0) {
                 v_res["result"] = "created";
                 v_res["id"]     = v_new_id;
-                CL_C10_ConfigManager::saveDirtyConfigs();
+                CL_C10_ConfigManager::requestSave();
                 sendJson(p_request, v_res, 201);
             } else {
                 v_res["error"] = "creation failed or validation error";
@@ -531,7 +520,7 @@ void CL_W10_WebAPI::routeUserProfilesID() {
             JsonDocument v_res;
             v_res["updated"] = v_updated;
             if (v_updated) {
-                CL_C10_ConfigManager::saveDirtyConfigs();
+                CL_C10_ConfigManager::requestSave();
             }
             sendJson(p_request, v_res, v_updated ? 200 : 404); });
 
@@ -547,7 +536,7 @@ void CL_W10_WebAPI::routeUserProfilesID() {
 		JsonDocument v_res;
 		v_res["deleted"] = v_deleted;
 		if (v_deleted) {
-			CL_C10_ConfigManager::saveDirtyConfigs();
+			CL_C10_ConfigManager::requestSave();
 		}
 		sendJson(p_request, v_res, v_deleted ? 200 : 404);
 	});
@@ -572,13 +561,11 @@ void CL_W10_WebAPI::routeUserProfilesPatch() {
                 return;
             }
 
-            bool v_changed = false;
-            if (g_A20_config_root.userProfiles) {
-                v_changed = CL_C10_ConfigManager::patchUserProfilesFromJson(*g_A20_config_root.userProfiles, v_doc);
-            }
+            // RCU: 복제본 patch → publish (S10/CT10 reader는 lock 없이 이전/새 세대 중 하나만 관찰)
+            bool v_changed = CL_C10_ConfigManager::applyUserProfilesPatch(v_doc);
 
             if (v_changed) {
-                CL_C10_ConfigManager::saveDirtyConfigs();
+                CL_C10_ConfigManager::requestSave();
             }
 
             JsonDocument v_res;
@@ -624,6 +611,8 @@ void CL_W10_WebAPI::routeControl() {
 			p_request->send(401, "application/json", "{\"error\":\"unauthorized\"}");
 			return;
 		}
+		// write-behind 예약분 저장 후 재부팅
+		CL_C10_ConfigManager::flushPendingSave();
 		p_request->send(200, "application/json", "{\"result\":\"rebooting\"}");
 		delay(500);
 		ESP.restart();
@@ -850,13 +839,11 @@ void CL_W10_WebAPI::routeReload() {
 			p_request->send(401, "application/json", "{\"error\":\"unauthorized\"}");
 			return;
 		}
-		ST_A20_ConfigRoot_t v_root;
-		bool				v_ok = CL_C10_ConfigManager::loadAll(v_root);
-		if (!v_ok) {
+		// 새 세대 로드 → publish (이전 섹션은 grace 기간 후 해제)
+		if (!CL_C10_ConfigManager::reloadAll()) {
 			p_request->send(500, "application/json", "{\"error\":\"reload failed\"}");
 			return;
 		}
-		g_A20_config_root = v_root;
 		p_request->send(200, "application/json", "{\"result\":\"ok\"}");
 	});
 }
@@ -874,6 +861,36 @@ void CL_W10_WebAPI::routeDiag() {
 		v_doc["heap"]	  = ESP.getFreeHeap();
 		v_doc["fs_used"]  = LittleFS.usedBytes();
 		v_doc["fs_total"] = LittleFS.totalBytes();
+
+		// WS 브로드캐스트 통계 (+ ?wsbench=1: 1/4/8 client 기준 heap 할당 벤치마크)
+		wsStatsToJson(v_doc["wsBcast"].to<JsonObject>());
+		if (p_request->hasParam("wsbench")) {
+			wsBenchToJson(v_doc["wsBench"].to<JsonArray>());
+		}
+
+		// WS payload 스트리밍 직렬화 통계 (+ ?jsonbench=1: JsonDocument 경로 대비 할당/시간)
+		CT10_WS_streamStatsToJson(v_doc["wsStream"].to<JsonObject>());
+		if (p_request->hasParam("jsonbench")) {
+			jsonBenchToJson(v_doc["jsonBench"].to<JsonArray>());
+		}
+
+		// 정적 자산 전송 통계 (gzip / 304) + 라우트 테이블 (?routebench=1: 조회 시간)
+		staticStatsToJson(v_doc["static"].to<JsonObject>(), p_request->hasParam("routebench"));
+
+		// 설정 GET chunked 응답 (최대 part 크기 = 응답 중 추가 heap 상한 기준)
+		cfgStreamStatsToJson(v_doc["cfgStream"].to<JsonObject>());
+
+		// 설정 이진 스냅샷 (boot→ready / loadAll 소요, 스냅샷 복원 vs JSON 파싱 섹션 수)
+		CL_C10_ConfigManager::snapshotStatsToJson(v_doc["cfgSnap"].to<JsonObject>());
+
+		// 설정 RCU 세대 (publish 세대 / retire 대기·해제 수)
+		CL_C10_ConfigManager::rcuStatsToJson(v_doc["cfgRcu"].to<JsonObject>());
+
+		// loadAll JSON 파싱 (loader 문서 peak / 최소 free heap / 섹션별 스트리밍 항목 수)
+		CL_C10_ConfigManager::parseStatsToJson(v_doc["cfgParse"].to<JsonObject>());
+
+		// ResolvedWind memo 캐시 (hit/miss, segment 코드 intern 재구성 수)
+		CL_CT10_ControlManager::instance().windCacheStatsToJson(v_doc["windCache"].to<JsonObject>());
 		sendJson(p_request, v_doc);
 	});
 }
@@ -1000,9 +1017,8 @@ void CL_W10_WebAPI::routeConfigDirtySave() {
 			p_request->send(401, "application/json", "{\"error\":\"unauthorized\"}");
 			return;
 		}
-		JsonDocument v_doc;
-		CL_C10_ConfigManager::toJson_All(g_A20_config_root, v_doc);
-		sendJson(p_request, v_doc);
+		// toJson_All 동일 구조, 섹션/항목 단위 chunked 직렬화
+		sendConfigChunked(p_request, EN_W10_CFG_STREAM_ALL);
 	});
 
 	s_server->on(W10_Const::HTTP_API_CONFIG_SAVE, HTTP_POST, [](AsyncWebServerRequest* p_request) {
@@ -1036,8 +1052,9 @@ void CL_W10_WebAPI::routeWifiConfig() {
 			return;
 		}
 		JsonDocument v_doc;
-		if (g_A20_config_root.wifi) {
-			CL_C10_ConfigManager::toJson_Wifi(*g_A20_config_root.wifi, v_doc);
+		const auto* v_cfg = C10_rcuRead(g_A20_config_root.wifi);
+		if (v_cfg) {
+			CL_C10_ConfigManager::toJson_Wifi(*v_cfg, v_doc);
 		}
 		sendJson(p_request, v_doc);
 	});
@@ -1058,10 +1075,8 @@ void CL_W10_WebAPI::routeWifiConfig() {
                 return;
             }
 
-            bool v_changed = false;
-            if (g_A20_config_root.wifi) {
-                v_changed = CL_C10_ConfigManager::patchWifiFromJson(*g_A20_config_root.wifi, v_doc);
-            }
+            // RCU: 복제본 patch → publish (S10/CT10 reader는 lock 없이 이전/새 세대 중 하나만 관찰)
+            bool v_changed = CL_C10_ConfigManager::applyWifiPatch(v_doc);
 
             JsonDocument v_res;
             v_res["updated"] = v_changed;
@@ -1070,7 +1085,9 @@ void CL_W10_WebAPI::routeWifiConfig() {
                 // 1. 변경된 설정을 비휘발성 메모리에 마킹(Save)
                 CL_C10_ConfigManager::saveDirtyConfigs();
                 // 2. WiFiManager 모듈에 실제 설정 즉시 투입
-                CL_WF10_WiFiManager::applyConfig(*g_A20_config_root.wifi);
+                if (const auto* v_wifi = C10_rcuRead(g_A20_config_root.wifi)) {
+                    CL_WF10_WiFiManager::applyConfig(*v_wifi);
+                }
 
                 v_res["status"]      = "applied";
                 v_res["need_reboot"] = true;
@@ -1106,12 +1123,7 @@ void CL_W10_WebAPI::routeWifiConfig() {
 						 return;
 					 }
 
-					 bool v_changed = false;
-					 if (g_A20_config_root.wifi) {
-						 v_changed = CL_C10_ConfigManager::patchWifiFromJson(
-							 *g_A20_config_root.wifi,
-							 v_doc);
-					 }
+					 bool v_changed = CL_C10_ConfigManager::applyWifiPatch(v_doc);
 
 					 JsonDocument v_res;
 					 v_res["updated"] = v_changed;
@@ -1119,7 +1131,7 @@ void CL_W10_WebAPI::routeWifiConfig() {
 					 if (v_changed) {
 						 CL_C10_ConfigManager::saveDirtyConfigs();
 						 // WiFiManager에 실제 설정 적용
-						 CL_WF10_WiFiManager::applyConfig(*g_A20_config_root.wifi);
+						 CL_WF10_WiFiManager::applyConfig(*C10_rcuRead(g_A20_config_root.wifi));
 						 v_res["status"]	  = "applied";
 						 v_res["need_reboot"] = true;
 						 CL_D10_Logger::log(EN_L10_LOG_INFO,
@@ -1152,18 +1164,17 @@ void CL_W10_WebAPI::routeTimeSet() {
                 return;
             }
 
-            bool v_changed = false;
-            if (g_A20_config_root.system) {
-                v_changed = CL_C10_ConfigManager::patchSystemFromJson(*g_A20_config_root.system, v_doc);
-            }
+            // RCU: 복제본 patch → publish (S10/CT10 reader는 lock 없이 이전/새 세대 중 하나만 관찰)
+            bool v_changed = CL_C10_ConfigManager::applySystemPatch(v_doc);
 
             JsonDocument v_res;
             v_res["updated"] = v_changed;
 
-            if (v_changed && g_A20_config_root.system) {
-                CL_C10_ConfigManager::saveDirtyConfigs();
+            const auto* v_sys = C10_rcuRead(g_A20_config_root.system);
+            if (v_changed && v_sys) {
+                CL_C10_ConfigManager::requestSave();
 
-                WF10_applyTimeConfigFromSystem(*g_A20_config_root.system);
+                WF10_applyTimeConfigFromSystem(*v_sys);
                 v_res["status"] = "applied";
                 CL_D10_Logger::log(EN_L10_LOG_INFO, "[W10] Time config updated and applied via TimeManager.");
             } else {
@@ -7,11 +7,18 @@
  * 기능 요약:
  * - LittleFS 기반 JSON 파일(`/json/cfg_pages_032.json`)에서
  *   웹 페이지(`pages`), 정적 자산(`assets`), 리다이렉트(`reDirect`) 정보 로드.
- * - `pages` 배열은 `order` 필드를 기준으로 정렬한 뷰를 생성하여
- *   메뉴(`/api/v1/menu`) 및 라우팅 등록에 사용.
- * - 각 페이지의 `pageAssets` 배열을 사용해 HTML별 전용 CSS/JS 라우팅을 등록.
- * - `assets` 배열을 통해 공통 정적 자산(CSS/JS 등)의 라우팅 초기화 및 등록.
+ * - `pages` 배열은 `order` 필드를 기준으로 정렬한 뷰를 생성하여 메뉴(`/api/v1/menu`)에 사용.
+ * - 라우트 테이블: pages(uri) / pageAssets / assets / reDirect → URI 정렬 배열 1개 + 문자열 arena 1개
+ *   (route별 handler/heap 문자열 없음), catch-all handler 1개가 이진 탐색으로 조회
+ *   - 자산 존재/크기/MIME은 첫 요청 시 1회 확인 후 캐시 (매 요청 LittleFS.exists() 없음)
+ *   - 테이블 heap / 조회 시간(이진 탐색 vs 선형) 진단: staticStatsToJson (?routebench=1)
+ *   - ?routebench=1: 구 방식(route별 handler + 문자열 복사) 동일 entry로 임시 구성 → heap 증가 측정 후 해제
  * - Web UI 메뉴 정보를 JSON으로 반환하는 API (`/api/v1/menu`) 구현.
+ * - 빌드 시 생성된 gzip 자산(<파일>.gz) + content hash manifest(`/html_v2/asset_manifest.json`) 사용:
+ *   - Accept-Encoding gzip 허용(q > 0) client → .gz 전송 (Content-Encoding: gzip, Vary: Accept-Encoding)
+ *   - strong ETag(표현별 hash) + If-None-Match 일치 시 304 (본문 없음)
+ *   - versioned URI(?v=<hash 8자>) → Cache-Control immutable(1년), 그 외 no-cache(재검증)
+ *   - manifest 없음(구 LittleFS 이미지) → 기존 동작(원본 그대로, validator 없음)
  * ------------------------------------------------------
  * [구현 규칙]
  * - 항상 소스 시작 주석 부분 체계 유지 및 내용 업데이트
@@ -39,11 +46,15 @@
 
 #include <ArduinoJson.h>
 #include <LittleFS.h>
+#include <esp_heap_caps.h>
 #include <string.h>
 
 #include <algorithm>
+#include <list>
+#include <memory>
 
 #include "W10_Web_051.h"
+#include "W10_Web_AcceptEnc_051.h"
 
 // ------------------------------------------------------
 // CL_W10_WebAPI 정적 멤버 정의 (Static Assets)
@@ -56,37 +67,165 @@
 // 메뉴 상태
 CL_W10_WebAPI::ST_W10_MenuState_t CL_W10_WebAPI::s_menu_state;
 
+// 정적 자산 전송 통계
+typedef struct {
+	uint32_t requests;		// route 요청 수
+	uint32_t gzip;			// gzip 표현 전송 수
+	uint32_t notModified;	// 304 응답 수
+	uint32_t immutable;		// versioned URI 요청 수
+	uint32_t bytes;			// 본문 전송 바이트 (캐시된 파일 크기 기준)
+	uint32_t savedBytes;	// 원본 대비 절감 바이트 (gzip 차이 + 304 본문)
+} ST_W10_StaticStat_t;
+
+static ST_W10_StaticStat_t s_staticStat = {};
+
+// ------------------------------------------------------
+// 라우트 테이블 (cfg_pages 기반, 부팅 시 1회 구성)
+// - entry: URI 정렬 배열 (이진 탐색), 문자열은 arena 오프셋
+// - arena: URI / 대상 경로 NUL 종료 문자열 연속 저장 (할당 1회)
+// ------------------------------------------------------
+static const uint8_t G_W10_RT_KIND_REDIRECT = 0x01;	// 대상 = redirect URI
+static const uint8_t G_W10_RT_HAS_HASH		= 0x02;	// manifest hash 있음 (ETag/versioned URI)
+static const uint8_t G_W10_RT_HAS_GZ		= 0x04;	// manifest gzip 있음
+static const uint8_t G_W10_RT_CHECKED		= 0x08;	// 존재/크기 확인 완료
+static const uint8_t G_W10_RT_EXISTS		= 0x10;	// 원본 존재
+static const uint8_t G_W10_RT_GZ_EXISTS		= 0x20;	// .gz 존재
+
+static const uint8_t G_W10_RT_BENCH_REPEAT	= 32;	// 조회 벤치마크 반복 (전체 entry × 반복)
+
+static const char* const G_W10_MIME_Arr[] = {
+	"text/html; charset=utf-8",
+	"text/css; charset=utf-8",
+	"application/javascript; charset=utf-8",
+	"application/octet-stream",
+};
+
+typedef struct {
+	uint64_t h;		   // 원본 content hash (manifest 앞 16 hex)
+	uint64_t gzH;	   // gzip 표현 hash
+	uint32_t size;	   // 원본 크기 (첫 요청 시 확인)
+	uint32_t gzSize;   // .gz 크기 (첫 요청 시 확인)
+	uint16_t uriOff;   // arena 오프셋: 요청 URI ("/P040_dashboard_003.js")
+	uint16_t fileOff;  // arena 오프셋: 파일 경로 / redirect URI
+	uint8_t	 mime;	   // G_W10_MIME_Arr index
+	uint8_t	 flags;	   // G_W10_RT_*
+} ST_W10_RouteEntry_t;
+
+typedef struct {
+	ST_W10_RouteEntry_t* entries;
+	char*				 arena;
+	uint16_t			 count;
+	uint16_t			 arenaBytes;
+	uint32_t			 heapBytes;		 // 구성 전후 heap 할당 증가량 (측정)
+	uint32_t			 legacyBytes;	 // 구 방식 임시 구성 heap 증가량 (측정, 최소값 / 0: 미측정)
+} ST_W10_RouteTable_t;
+
+static ST_W10_RouteTable_t s_routeTbl = {};
+
+// 구 방식 route 정보 (v050 ST_W10_StaticRoute_t 동일 배치, legacy heap 측정용)
+typedef struct {
+	char*	 file;
+	char*	 fileGz;
+	char*	 mime;
+	char	 etag[W10_Const::STATIC_ETAG_LEN];
+	char	 etagGz[W10_Const::STATIC_ETAG_LEN];
+	char	 ver[W10_Const::STATIC_VER_LEN + 1];
+	uint32_t size;
+	uint32_t gzSize;
+} ST_W10_LegacyRoute_t;
+
+// 구성용 임시 entry (JsonDocument 문자열 참조, 구성 종료 후 폐기)
+typedef struct {
+	const char* uri;
+	const char* target;
+	uint8_t		mime;
+	uint8_t		kind;
+} ST_W10_RouteSrc_t;
+
 // ------------------------------------------------------
 // 헬퍼 함수 구현
 // ------------------------------------------------------
 
-// 안전한 C 문자열 복사 (new[] + memset + strlcpy)
-char* CL_W10_WebAPI::W10_allocCString(const char* p_src) {
-	if (!p_src)
-		return nullptr;
+static uint8_t W10_mimeIndex(const char* p_path) {
+	if (!p_path)
+		return 3;
+	if (strstr(p_path, ".html"))
+		return 0;
+	if (strstr(p_path, ".css"))
+		return 1;
+	if (strstr(p_path, ".js"))
+		return 2;
+	return 3;
+}
 
-	size_t v_len = strlen(p_src) + 1;
-	char*  v_buf = new char[v_len];
-	if (!v_buf)
-		return nullptr;
+const char* CL_W10_WebAPI::W10_guessMime(const char* p_path) {
+	return G_W10_MIME_Arr[W10_mimeIndex(p_path)];
+}
 
-	memset(v_buf, 0, v_len);
-	strlcpy(v_buf, p_src, v_len);
-	return v_buf;
+// 8bit heap 할당 바이트 (테이블 구성 전후 비교)
+static uint32_t W10_heapAllocated() {
+	multi_heap_info_t v_info;
+	heap_caps_get_info(&v_info, MALLOC_CAP_8BIT);
+	return (uint32_t)v_info.total_allocated_bytes;
 }
 
-const char* CL_W10_WebAPI::W10_guessMime(const char* p_path) {
-	if (!p_path)
-		return "application/octet-stream";
+static inline const char* W10_rtUri(const ST_W10_RouteEntry_t& p_e) {
+	return s_routeTbl.arena + p_e.uriOff;
+}
+static inline const char* W10_rtFile(const ST_W10_RouteEntry_t& p_e) {
+	return s_routeTbl.arena + p_e.fileOff;
+}
 
-	if (strstr(p_path, ".html"))
-		return "text/html; charset=utf-8";
-	if (strstr(p_path, ".css"))
-		return "text/css; charset=utf-8";
-	if (strstr(p_path, ".js"))
-		return "application/javascript; charset=utf-8";
+// URI 이진 탐색 (반환: entry index, -1: 없음)
+static int W10_findRoute(const char* p_uri) {
+	int v_lo = 0;
+	int v_hi = (int)s_routeTbl.count - 1;
+	while (v_lo <= v_hi) {
+		int v_mid = (v_lo + v_hi) >> 1;
+		int v_cmp = strcmp(p_uri, W10_rtUri(s_routeTbl.entries[v_mid]));
+		if (v_cmp == 0)
+			return v_mid;
+		if (v_cmp < 0)
+			v_hi = v_mid - 1;
+		else
+			v_lo = v_mid + 1;
+	}
+	return -1;
+}
+
+// 비교용: 구 방식(handler 목록 순차 비교)과 같은 선형 탐색
+static int W10_findRouteLinear(const char* p_uri) {
+	for (uint16_t i = 0; i < s_routeTbl.count; i++) {
+		if (strcmp(p_uri, W10_rtUri(s_routeTbl.entries[i])) == 0)
+			return i;
+	}
+	return -1;
+}
 
-	return "application/octet-stream";
+// 파일 크기 (없으면 false)
+static bool W10_fileSize(const char* p_path, uint32_t& p_size) {
+	File v_f = LittleFS.open(p_path, "r");
+	if (!v_f)
+		return false;
+	p_size = (uint32_t)v_f.size();
+	v_f.close();
+	return true;
+}
+
+// 첫 요청 시 1회: 원본/.gz 존재 + 크기 캐시
+static void W10_routeCheck(ST_W10_RouteEntry_t& p_e) {
+	const char* v_file = W10_rtFile(p_e);
+	uint8_t		v_flags = p_e.flags & (G_W10_RT_KIND_REDIRECT | G_W10_RT_HAS_HASH | G_W10_RT_HAS_GZ);
+
+	if (W10_fileSize(v_file, p_e.size))
+		v_flags |= G_W10_RT_EXISTS;
+
+	if (v_flags & G_W10_RT_HAS_GZ) {
+		String v_gzPath = String(v_file) + ".gz";
+		if (W10_fileSize(v_gzPath.c_str(), p_e.gzSize))
+			v_flags |= G_W10_RT_GZ_EXISTS;
+	}
+	p_e.flags = v_flags | G_W10_RT_CHECKED;
 }
 
 // JSON 로딩 (로컬 JsonDocument 사용)
@@ -133,45 +272,390 @@ bool CL_W10_WebAPI::W10_loadPagesJson(JsonDocument& p_doc, uint16_t& p_page_coun
 	return true;
 }
 
-// 정적 파일 라우트 등록 (등록 시점에 URI/FILE/MIME 문자열을 복사해서 평생 유지)
-// - "/html_v2/..." 실제 경로는 serveStatic("/html_v2", ...)에 위임
-// - 여기서는 short URI("/P0xx_...") 등 별칭만 등록하는 것을 기본으로 함
-void CL_W10_WebAPI::W10_registerStaticRoute(const char* p_uri, const char* p_file, const char* p_mime) {
-	if (!p_uri || !p_file || !p_mime)
+// 자산 manifest 로드 (scripts/web_gzip_assets.py 생성, 없으면 false)
+bool CL_W10_WebAPI::W10_loadAssetManifest(JsonDocument& p_doc) {
+	File v_file = LittleFS.open(W10_Const::FILE_ASSET_MANIFEST, "r");
+	if (!v_file) {
+		CL_D10_Logger::log(EN_L10_LOG_WARN, "[W10] Asset manifest missing (%s): gzip/ETag disabled", W10_Const::FILE_ASSET_MANIFEST);
+		return false;
+	}
+
+	DeserializationError v_err = deserializeJson(p_doc, v_file);
+	v_file.close();
+	if (v_err || !p_doc["files"].is<JsonObjectConst>()) {
+		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[W10] Asset manifest invalid: %s", v_err ? v_err.c_str() : "files");
+		p_doc.clear();
+		return false;
+	}
+	return true;
+}
+
+// If-None-Match 목록에 p_etag 포함 여부 ("*" 포함)
+static bool W10_etagMatch(AsyncWebServerRequest* p_r, const char* p_etag) {
+	if (!p_etag[0] || !p_r->hasHeader("If-None-Match")) return false;
+	const String& v_inm = p_r->header("If-None-Match");
+	return v_inm.indexOf(p_etag) >= 0 || v_inm == "*";
+}
+
+// Accept-Encoding q 값 해석 ("gzip;q=0" / "*;q=0" 거부, W10_Web_AcceptEnc_051.h)
+static bool W10_acceptsGzip(AsyncWebServerRequest* p_r) {
+	return p_r->hasHeader("Accept-Encoding") && W10_acceptEncodingGzip(p_r->header("Accept-Encoding").c_str());
+}
+
+void CL_W10_WebAPI::W10_serveRoute(AsyncWebServerRequest* p_r, uint16_t p_idx) {
+	ST_W10_RouteEntry_t& v_e = s_routeTbl.entries[p_idx];
+
+	// 단축 URI 리다이렉트 (예: "/chart_t1" → "/P020_chart_t1_008.html")
+	if (v_e.flags & G_W10_RT_KIND_REDIRECT) {
+		p_r->redirect(W10_rtFile(v_e));
 		return;
+	}
+
+	s_staticStat.requests++;
+	if (!(v_e.flags & G_W10_RT_CHECKED))
+		W10_routeCheck(v_e);
 
-	if (strlen(p_uri) == 0 || strlen(p_file) == 0)
+	const char* v_file = W10_rtFile(v_e);
+	const char* v_mime = G_W10_MIME_Arr[v_e.mime];
+
+	// 1) 파일 없음 → 기존과 동일한 placeholder
+	if (!(v_e.flags & G_W10_RT_EXISTS)) {
+		String v_msg  = "/* missing:" + String(v_file) + " */";
+		auto*  v_resp = p_r->beginResponse(200, v_mime, v_msg);
+		_applyHeaders(v_resp, true);
+		p_r->send(v_resp);
 		return;
+	}
 
-	char* v_uri	 = W10_allocCString(p_uri);
-	char* v_file = W10_allocCString(p_file);
-	char* v_mime = W10_allocCString(p_mime);
+	// 2) manifest 없음 → 원본 그대로 (validator 없음)
+	if (!(v_e.flags & G_W10_RT_HAS_HASH)) {
+		s_staticStat.bytes += v_e.size;
+		auto* v_resp = p_r->beginResponse(LittleFS, v_file, v_mime);
+		_applyHeaders(v_resp, false);
+		p_r->send(v_resp);
+		return;
+	}
 
-	if (!v_uri || !v_file || !v_mime) {
-		if (v_uri)
-			delete[] v_uri;
-		if (v_file)
-			delete[] v_file;
-		if (v_mime)
-			delete[] v_mime;
+	// 3) 표현 선택 (gzip 가능 + .gz 존재) / 캐시 정책
+	const bool v_gz	   = (v_e.flags & G_W10_RT_GZ_EXISTS) && W10_acceptsGzip(p_r);
+	bool	   v_immut = false;
+	if (p_r->hasParam("v")) {
+		const String& v_ver = p_r->getParam("v")->value();
+		v_immut				= v_ver.length() == W10_Const::STATIC_VER_LEN && strtoul(v_ver.c_str(), nullptr, 16) == (uint32_t)(v_e.h >> 32);
+	}
+	const char* v_cache = v_immut ? W10_Const::STATIC_CACHE_IMMUTABLE : W10_Const::STATIC_CACHE_REVALIDATE;
+	if (v_immut)
+		s_staticStat.immutable++;
+
+	char v_etag[W10_Const::STATIC_ETAG_LEN];
+	if (v_gz) {
+		snprintf(v_etag, sizeof(v_etag), "\"%016llx.gz\"", (unsigned long long)v_e.gzH);
+	} else {
+		snprintf(v_etag, sizeof(v_etag), "\"%016llx\"", (unsigned long long)v_e.h);
+	}
 
-		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[W10] Route alloc failed (uri:%s, file:%s)", p_uri, p_file);
+	// 4) 조건부 요청: 변경 없음 → 304 (본문 없음)
+	if (W10_etagMatch(p_r, v_etag)) {
+		s_staticStat.notModified++;
+		s_staticStat.savedBytes += v_gz ? v_e.gzSize : v_e.size;
+
+		auto* v_resp = p_r->beginResponse(304);
+		v_resp->addHeader("ETag", v_etag);
+		v_resp->addHeader("Cache-Control", v_cache);
+		v_resp->addHeader("Vary", "Accept-Encoding");
+		_applyHeaders(v_resp, false);
+		p_r->send(v_resp);
 		return;
 	}
 
-	s_server->on(v_uri, HTTP_GET, [v_file, v_mime](AsyncWebServerRequest* r) {
-		if (LittleFS.exists(v_file)) {
-			auto* v_resp = r->beginResponse(LittleFS, v_file, v_mime);
-			CL_W10_WebAPI::_applyHeaders(v_resp, false);
-			r->send(v_resp);
+	AsyncWebServerResponse* v_resp = nullptr;
+	if (v_gz) {
+		String v_gzPath = String(v_file) + ".gz";
+		v_resp			= p_r->beginResponse(LittleFS, v_gzPath, v_mime);
+		v_resp->addHeader("Content-Encoding", "gzip");
+		s_staticStat.gzip++;
+		s_staticStat.bytes += v_e.gzSize;
+		s_staticStat.savedBytes += (v_e.size > v_e.gzSize) ? (v_e.size - v_e.gzSize) : 0;
+	} else {
+		v_resp = p_r->beginResponse(LittleFS, v_file, v_mime);
+		s_staticStat.bytes += v_e.size;
+	}
+	v_resp->addHeader("ETag", v_etag);
+	v_resp->addHeader("Cache-Control", v_cache);
+	v_resp->addHeader("Vary", "Accept-Encoding");
+	_applyHeaders(v_resp, false);
+	p_r->send(v_resp);
+}
+
+// ------------------------------------------------------
+// catch-all handler: 테이블에 있는 GET URI만 처리 (그 외는 다음 handler로)
+// ------------------------------------------------------
+class CL_W10_WebAPI::CL_W10_RouteHandler : public AsyncWebHandler {
+  public:
+	bool canHandle(AsyncWebServerRequest* p_r) const override {
+		return p_r->method() == HTTP_GET && W10_findRoute(p_r->url().c_str()) >= 0;
+	}
+
+	void handleRequest(AsyncWebServerRequest* p_r) override {
+		int v_idx = W10_findRoute(p_r->url().c_str());
+		if (v_idx < 0) {
+			p_r->send(404);
 			return;
 		}
+		W10_serveRoute(p_r, (uint16_t)v_idx);
+	}
+};
 
-		String v_msg  = "/* missing:" + String(v_file) + " */";
-		auto*  v_resp = r->beginResponse(200, v_mime, v_msg);
-		CL_W10_WebAPI::_applyHeaders(v_resp, true);
-		r->send(v_resp);
-	});
+// /upload로 자산이 교체되면 manifest hash가 더 이상 맞지 않음
+// → 해당 파일 entry의 hash/gzip 해제 (원본 직접 전송) + 존재/크기 재확인 + stale .gz 삭제
+void CL_W10_WebAPI::W10_invalidateStaticAsset(const char* p_file) {
+	if (!p_file)
+		return;
+
+	for (uint16_t i = 0; i < s_routeTbl.count; i++) {
+		ST_W10_RouteEntry_t& v_e = s_routeTbl.entries[i];
+		if ((v_e.flags & G_W10_RT_KIND_REDIRECT) || strcmp(W10_rtFile(v_e), p_file) != 0)
+			continue;
+		v_e.flags &= (uint8_t)~(G_W10_RT_HAS_HASH | G_W10_RT_HAS_GZ | G_W10_RT_CHECKED | G_W10_RT_EXISTS | G_W10_RT_GZ_EXISTS);
+	}
+
+	String v_gzPath = String(p_file) + ".gz";
+	if (LittleFS.exists(v_gzPath)) {
+		LittleFS.remove(v_gzPath);
+		CL_D10_Logger::log(EN_L10_LOG_INFO, "[W10] Stale gzip asset removed: %s", v_gzPath.c_str());
+	}
+}
+
+/**
+ * 라우트 테이블 구성 (cfg_pages root + asset manifest)
+ * - 수집 → URI 정렬(stable: 중복 URI는 먼저 정의된 항목 유지) → arena/entry 배열 1회 할당
+ * - p_rootRedirect: reDirect에 "/" 정의 여부 (없으면 호출 측이 isMain fallback 등록)
+ */
+void CL_W10_WebAPI::W10_buildRouteTable(JsonObjectConst p_root, JsonObjectConst p_manifest, bool& p_rootRedirect) {
+	p_rootRedirect = false;
+
+	const uint32_t v_heap0 = W10_heapAllocated();
+
+	std::vector<ST_W10_RouteSrc_t> v_src;
+	v_src.reserve(64);
+
+	auto v_add = [&v_src](const char* p_uri, const char* p_target, uint8_t p_kind) {
+		if (!p_uri || !p_target || !p_uri[0] || !p_target[0])
+			return;
+		v_src.push_back({p_uri, p_target, W10_mimeIndex(p_target), p_kind});
+	};
+
+	// 1) pages: HTML short URI + 페이지 전용 자산 (short URI만, 실제 경로는 serveStatic 처리)
+	for (JsonObjectConst v_page : p_root["pages"].as<JsonArrayConst>()) {
+		v_add(v_page["uri"].as<const char*>(), v_page["path"].as<const char*>(), 0);
+
+		for (JsonObjectConst v_asset : v_page["pageAssets"].as<JsonArrayConst>()) {
+			const char* v_a_uri	 = v_asset["uri"].as<const char*>();
+			const char* v_a_path = v_asset["path"].as<const char*>();
+			if (v_a_uri && v_a_path && strcmp(v_a_uri, v_a_path) != 0)
+				v_add(v_a_uri, v_a_path, 0);
+		}
+	}
+
+	// 2) assets: 공통 자산 (short URI만)
+	for (JsonObjectConst v_asset : p_root["assets"].as<JsonArrayConst>()) {
+		const char* v_uri  = v_asset["uri"].as<const char*>();
+		const char* v_path = v_asset["path"].as<const char*>();
+		if (v_uri && v_path && strcmp(v_uri, v_path) != 0)
+			v_add(v_uri, v_path, 0);
+	}
+
+	// 3) reDirect: 단축 URI (camelCase only)
+	for (JsonObjectConst v_redir : p_root["reDirect"].as<JsonArrayConst>()) {
+		const char* v_from = v_redir["uriFrom"].as<const char*>();
+		const char* v_to   = v_redir["uriTo"].as<const char*>();
+		if (v_from && v_to && v_from[0] && v_to[0] && strcmp(v_from, "/") == 0)
+			p_rootRedirect = true;
+		v_add(v_from, v_to, G_W10_RT_KIND_REDIRECT);
+	}
+
+	std::stable_sort(v_src.begin(), v_src.end(), [](const ST_W10_RouteSrc_t& a, const ST_W10_RouteSrc_t& b) { return strcmp(a.uri, b.uri) < 0; });
+
+	// 중복 URI 제거 + arena 크기 산출
+	size_t v_n	   = 0;
+	size_t v_arena = 0;
+	for (size_t i = 0; i < v_src.size(); i++) {
+		if (v_n > 0 && strcmp(v_src[v_n - 1].uri, v_src[i].uri) == 0)
+			continue;
+		v_src[v_n++] = v_src[i];
+
+		const ST_W10_RouteSrc_t& v_s = v_src[v_n - 1];
+		const size_t v_uLen = strlen(v_s.uri) + 1;
+		const size_t v_tLen = strlen(v_s.target) + 1;
+		v_arena += v_uLen + v_tLen;
+	}
+
+	if (v_n == 0 || v_arena > UINT16_MAX) {
+		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[W10] Route table empty or too large (n=%u, arena=%u)", (unsigned)v_n, (unsigned)v_arena);
+		return;
+	}
+
+	// 4) arena + entry 배열 (각 1회 할당, 서버 생애 동안 유지)
+	char*				 v_arenaBuf = (char*)malloc(v_arena);
+	ST_W10_RouteEntry_t* v_entries	= (ST_W10_RouteEntry_t*)calloc(v_n, sizeof(ST_W10_RouteEntry_t));
+	if (!v_arenaBuf || !v_entries) {
+		free(v_arenaBuf);
+		free(v_entries);
+		CL_D10_Logger::log(EN_L10_LOG_ERROR, "[W10] Route table alloc failed (n=%u, arena=%u)", (unsigned)v_n, (unsigned)v_arena);
+		return;
+	}
+
+	size_t v_off = 0;
+	for (size_t i = 0; i < v_n; i++) {
+		const ST_W10_RouteSrc_t& v_s = v_src[i];
+		ST_W10_RouteEntry_t&	 v_e = v_entries[i];
+
+		v_e.uriOff = (uint16_t)v_off;
+		strcpy(v_arenaBuf + v_off, v_s.uri);
+		v_off += strlen(v_s.uri) + 1;
+
+		v_e.fileOff = (uint16_t)v_off;
+		strcpy(v_arenaBuf + v_off, v_s.target);
+		v_off += strlen(v_s.target) + 1;
+
+		v_e.mime  = v_s.mime;
+		v_e.flags = v_s.kind;
+		if (v_s.kind & G_W10_RT_KIND_REDIRECT)
+			continue;
+
+		// manifest hash (없으면 원본 직접 전송)
+		JsonObjectConst v_meta = p_manifest.isNull() ? JsonObjectConst() : p_manifest[v_s.target].as<JsonObjectConst>();
+		const char*		v_h	   = v_meta["h"] | "";
+		const char*		v_gzH  = v_meta["gzH"] | "";
+		if (v_h[0]) {
+			v_e.h = strtoull(v_h, nullptr, 16);
+			v_e.flags |= G_W10_RT_HAS_HASH;
+			if (v_gzH[0] && (v_meta["gz"] | 0) > 0) {
+				v_e.gzH = strtoull(v_gzH, nullptr, 16);
+				v_e.flags |= G_W10_RT_HAS_GZ;
+			}
+		}
+	}
+
+	s_routeTbl.entries	   = v_entries;
+	s_routeTbl.arena	   = v_arenaBuf;
+	s_routeTbl.count	   = (uint16_t)v_n;
+	s_routeTbl.arenaBytes  = (uint16_t)v_arena;
+	s_routeTbl.legacyBytes = 0;
+
+	// 임시 수집 vector 해제 후 측정 (handler 객체 포함)
+	std::vector<ST_W10_RouteSrc_t>().swap(v_src);
+	s_server->addHandler(new CL_W10_RouteHandler());
+
+	const uint32_t v_heap1 = W10_heapAllocated();
+	s_routeTbl.heapBytes   = (v_heap1 > v_heap0) ? (v_heap1 - v_heap0) : 0;
+}
+
+// 구 방식 문자열 복사 (v050 W10_allocCString 동일: new[] + strlcpy)
+static char* W10_legacyCopy(const char* p_src) {
+	const size_t v_len = strlen(p_src) + 1;
+	char*		 v_buf = new char[v_len];
+	strlcpy(v_buf, p_src, v_len);
+	return v_buf;
+}
+
+// 구 방식 라우팅 heap 측정: 현재 테이블 entry 그대로 route별 구성 → 할당 증가량 → 전부 해제
+//  - 자산: uri/file/mime 복사 + route 정보 + (.gz 경로) + route 목록 vector
+//  - redirect: from/to 복사
+//  - 공통: AsyncCallbackWebHandler(setUri/setMethod/onRequest) + server handler 목록 node
+//  - 서버에는 등록하지 않음 (라우팅 영향 없음), 다른 task 할당이 섞일 수 있어 측정값 중 최소값 유지
+static uint32_t W10_measureLegacyRoutes() {
+	std::list<std::unique_ptr<AsyncWebHandler>> v_handlers;
+	std::vector<ST_W10_LegacyRoute_t*>			v_routes;
+	std::vector<char*>							v_strs;
+	v_strs.reserve((size_t)s_routeTbl.count * 2u);	// 해제용 목록 (구 방식에 없음 → 측정 전 확보)
+
+	const uint32_t v_heap0 = W10_heapAllocated();
+
+	for (uint16_t i = 0; i < s_routeTbl.count; i++) {
+		const ST_W10_RouteEntry_t& v_e	 = s_routeTbl.entries[i];
+		char*					   v_uri = W10_legacyCopy(W10_rtUri(v_e));
+		v_strs.push_back(v_uri);
+
+		auto* v_h = new AsyncCallbackWebHandler();
+		v_h->setUri(String(v_uri));
+		v_h->setMethod(HTTP_GET);
+
+		if (v_e.flags & G_W10_RT_KIND_REDIRECT) {
+			char* v_to = W10_legacyCopy(W10_rtFile(v_e));
+			v_strs.push_back(v_to);
+			v_h->onRequest([v_to](AsyncWebServerRequest* r) { r->redirect(v_to); });
+		} else {
+			auto* v_rt = new ST_W10_LegacyRoute_t();
+			v_rt->file = W10_legacyCopy(W10_rtFile(v_e));
+			v_rt->mime = W10_legacyCopy(G_W10_MIME_Arr[v_e.mime]);
+			if (v_e.flags & G_W10_RT_HAS_GZ) {
+				String v_gzPath = String(W10_rtFile(v_e)) + ".gz";
+				v_rt->fileGz	= W10_legacyCopy(v_gzPath.c_str());
+			}
+			v_routes.push_back(v_rt);
+			v_h->onRequest([v_rt](AsyncWebServerRequest* r) { (void)r; (void)v_rt; });  // 구: W10_serveStatic(r, v_rt)
+		}
+		v_handlers.emplace_back(v_h);
+	}
+
+	const uint32_t v_heap1 = W10_heapAllocated();
+
+	for (ST_W10_LegacyRoute_t* v_rt : v_routes) {
+		delete[] v_rt->file;
+		delete[] v_rt->fileGz;
+		delete[] v_rt->mime;
+		delete v_rt;
+	}
+	for (char* v_str : v_strs) delete[] v_str;
+
+	return (v_heap1 > v_heap0) ? (v_heap1 - v_heap0) : 0;
+}
+
+void CL_W10_WebAPI::staticStatsToJson(JsonObject p_obj, bool p_bench) {
+	p_obj["requests"]	 = s_staticStat.requests;
+	p_obj["gzip"]		 = s_staticStat.gzip;
+	p_obj["notModified"] = s_staticStat.notModified;
+	p_obj["immutable"]	 = s_staticStat.immutable;
+	p_obj["bytes"]		 = s_staticStat.bytes;
+	p_obj["savedBytes"]	 = s_staticStat.savedBytes;
+
+	// 라우트 테이블: entry 수 / 구성 heap(측정) / 구 방식 heap(?routebench=1 측정, 0: 미측정)
+	JsonObject v_rt		 = p_obj["routes"].to<JsonObject>();
+	v_rt["count"]		 = s_routeTbl.count;
+	v_rt["entryBytes"]	 = (uint32_t)(s_routeTbl.count * sizeof(ST_W10_RouteEntry_t));
+	v_rt["arenaBytes"]	 = s_routeTbl.arenaBytes;
+	v_rt["heapBytes"]	 = s_routeTbl.heapBytes;
+	v_rt["legacyBytes"]	 = s_routeTbl.legacyBytes;
+
+	if (!p_bench || s_routeTbl.count == 0)
+		return;
+
+	const uint32_t v_legacy = W10_measureLegacyRoutes();
+	if (v_legacy > 0 && (s_routeTbl.legacyBytes == 0 || v_legacy < s_routeTbl.legacyBytes))
+		s_routeTbl.legacyBytes = v_legacy;
+	v_rt["legacyBytes"]		= s_routeTbl.legacyBytes;
+	v_rt["legacyLastBytes"] = v_legacy;
+
+	// 조회 시간: 전체 entry URI × 반복, 이진 탐색 vs 선형(구 handler 순차 비교 모사)
+	volatile int v_sink	 = 0;
+	uint32_t	 v_t0	 = micros();
+	for (uint8_t r = 0; r < G_W10_RT_BENCH_REPEAT; r++) {
+		for (uint16_t i = 0; i < s_routeTbl.count; i++) v_sink += W10_findRoute(W10_rtUri(s_routeTbl.entries[i]));
+	}
+	uint32_t v_binUs = micros() - v_t0;
+
+	v_t0 = micros();
+	for (uint8_t r = 0; r < G_W10_RT_BENCH_REPEAT; r++) {
+		for (uint16_t i = 0; i < s_routeTbl.count; i++) v_sink += W10_findRouteLinear(W10_rtUri(s_routeTbl.entries[i]));
+	}
+	uint32_t v_linUs = micros() - v_t0;
+	(void)v_sink;
+
+	const uint32_t v_lookups = (uint32_t)G_W10_RT_BENCH_REPEAT * s_routeTbl.count;
+	v_rt["lookups"]			 = v_lookups;
+	v_rt["binaryNs"]		 = (uint32_t)((uint64_t)v_binUs * 1000u / v_lookups);
+	v_rt["linearNs"]		 = (uint32_t)((uint64_t)v_linUs * 1000u / v_lookups);
 }
 
 // ------------------------------------------------------
@@ -198,11 +682,11 @@ void CL_W10_WebAPI::W10_getMenuJson(AsyncWebServerRequest* r) {
 
 // ------------------------------------------------------
 // 정적 자산 라우팅 등록
-//  - pages[].path        → HTML 라우트 (short URI 기준으로 등록)
 //  - pages[].uri         → HTML 라우트 (short html path)
 //  - pages[].pageAssets[]→ 페이지 전용 CSS/JS 라우트
 //  - assets[]            → 공통 CSS/JS 라우트
 //  - reDirect[]          → 단축 URI 리다이렉트
+//  → 모두 라우트 테이블 1개 + catch-all handler 1개 (W10_buildRouteTable)
 //  - 메뉴 데이터는 s_menu_state에 정렬/보관
 //  - JsonDocument는 이 함수 내부 로컬 변수로만 사용
 // ------------------------------------------------------
@@ -227,150 +711,79 @@ void CL_W10_WebAPI::routeStaticAssets() {
 		return;
 	}
 
-	JsonArrayConst v_pages_array	   = j_root["pages"].as<JsonArrayConst>();
-	JsonArrayConst v_assets_array	   = j_root["assets"].as<JsonArrayConst>();
-	JsonArrayConst v_redirect_array   = j_root["reDirect"].as<JsonArrayConst>();  // camelCase only
-
-	// 1) pages 기반 HTML + 페이지별 전용 자산(pageAssets) 라우트 등록
-	if (!v_pages_array.isNull()) {
-		for (JsonObjectConst v_page : v_pages_array) {
-			ST_W10_PageEntry_t v_entry{};
-
-			v_entry.order  = v_page["order"].as<int>();
-			v_entry.uri	   = v_page["uri"].as<String>();
-			v_entry.path   = v_page["path"].as<String>();
-			v_entry.label  = v_page["label"].as<String>();
-			v_entry.isMain = v_page["isMain"] | false;
-
-			// enable 필드 (기본값 true)
-			bool v_enable  = true;
-			if (!v_page["enable"].isNull()) {
-				v_enable = v_page["enable"].as<bool>();
-			}
-			v_entry.enable = v_enable;
-
-			// 메뉴용 엔트리 누적
-			s_menu_state.pages_sorted.push_back(v_entry);
-
-			// isMain == true 인 첫 번째 페이지 path를 main_path로 보관 (root fallback용)
-			if (v_entry.isMain && s_menu_state.main_path.isEmpty()) {
-				if (!v_entry.path.isEmpty()) {
-					s_menu_state.main_path = v_entry.path;
-				}
-			}
-
-			// 라우팅 등록
-			const char* v_uri_key  = v_entry.uri.c_str();	// "/P010_main_021.html"
-			const char* v_path_key = v_entry.path.c_str();	// "/html_v2/P010_main_021.html"
-
-			if (!v_uri_key || !v_path_key || strlen(v_path_key) == 0)
-				continue;
+	// 1) pages → 메뉴 엔트리
+	for (JsonObjectConst v_page : j_root["pages"].as<JsonArrayConst>()) {
+		ST_W10_PageEntry_t v_entry{};
 
-			// ✅ charset 포함 (기존 동작 영향 최소)
-			const char* v_mime_html = "text/html; charset=utf-8";
+		v_entry.order  = v_page["order"].as<int>();
+		v_entry.uri	   = v_page["uri"].as<String>();
+		v_entry.path   = v_page["path"].as<String>();
+		v_entry.label  = v_page["label"].as<String>();
+		v_entry.isMain = v_page["isMain"] | false;
 
-			// HTML 페이지는 short URI만 등록, 실제 경로("/html_v2/...")는 serveStatic에 위임
-			if (strlen(v_uri_key) > 0) {
-				W10_registerStaticRoute(v_uri_key, v_path_key, v_mime_html);
-			}
-
-			// 각 페이지의 pageAssets 처리 (CSS/JS 등)
-			JsonArrayConst v_page_assets = v_page["pageAssets"].as<JsonArrayConst>();  // camelCase only
-			if (!v_page_assets.isNull()) {
-				for (JsonObjectConst v_asset : v_page_assets) {
-					const char* v_a_uri	 = v_asset["uri"].as<const char*>();
-					const char* v_a_path = v_asset["path"].as<const char*>();
-
-					if (!v_a_uri || !v_a_path || strlen(v_a_uri) == 0 || strlen(v_a_path) == 0)
-						continue;
+		// enable 필드 (기본값 true)
+		bool v_enable  = true;
+		if (!v_page["enable"].isNull()) {
+			v_enable = v_page["enable"].as<bool>();
+		}
+		v_entry.enable = v_enable;
 
-					const char* v_mime = W10_guessMime(v_a_path);
+		// 메뉴용 엔트리 누적
+		s_menu_state.pages_sorted.push_back(v_entry);
 
-					// short URI만 route에 등록, 실제 경로("/html_v2/...")는 serveStatic 처리
-					if (strcmp(v_a_uri, v_a_path) != 0) {
-						W10_registerStaticRoute(v_a_uri, v_a_path, v_mime);
-					}
-				}
+		// isMain == true 인 첫 번째 페이지 path를 main_path로 보관 (root fallback용)
+		if (v_entry.isMain && s_menu_state.main_path.isEmpty()) {
+			if (!v_entry.path.isEmpty()) {
+				s_menu_state.main_path = v_entry.path;
 			}
 		}
-
-		// 메뉴 표시용 pages_sorted를 order 기준으로 정렬
-		std::sort(s_menu_state.pages_sorted.begin(), s_menu_state.pages_sorted.end(),
-		          [](const ST_W10_PageEntry_t& a, const ST_W10_PageEntry_t& b) { return a.order < b.order; });
 	}
 
-	// 2) assets 기반 공통 자산 라우트 (공통 CSS/JS 등)
-	if (!v_assets_array.isNull()) {
-		for (JsonObjectConst v_asset : v_assets_array) {
-			const char* v_uri_key  = v_asset["uri"].as<const char*>();
-			const char* v_path_key = v_asset["path"].as<const char*>();
-
-			if (!v_uri_key || !v_path_key || strlen(v_uri_key) == 0 || strlen(v_path_key) == 0)
-				continue;
-
-			const char* v_mime = W10_guessMime(v_path_key);
+	// 메뉴 표시용 pages_sorted를 order 기준으로 정렬
+	std::sort(s_menu_state.pages_sorted.begin(), s_menu_state.pages_sorted.end(),
+			  [](const ST_W10_PageEntry_t& a, const ST_W10_PageEntry_t& b) { return a.order < b.order; });
 
-			// 공통 자산도 short URI만 등록 (예: "/P000_common_001.css")
-			if (strcmp(v_uri_key, v_path_key) != 0) {
-				W10_registerStaticRoute(v_uri_key, v_path_key, v_mime);
-			}
+	// 2) 라우트 테이블 (pages/pageAssets/assets/reDirect + gzip/content hash manifest)
+	{
+		JsonDocument	v_manifest_doc;
+		JsonObjectConst v_manifest;
+		if (W10_loadAssetManifest(v_manifest_doc)) {
+			v_manifest = v_manifest_doc["files"].as<JsonObjectConst>();
 		}
-	}
 
-	// 3) 루트 및 단축 URI 리다이렉트 (reDirect 배열, camelCase only)
-	bool v_root_redirect_defined = false;
-	if (!v_redirect_array.isNull()) {
-		for (JsonObjectConst v_redir : v_redirect_array) {
-			const char* v_from = v_redir["uriFrom"].as<const char*>();
-			const char* v_to   = v_redir["uriTo"].as<const char*>();
+		bool v_root_redirect_defined = false;
+		W10_buildRouteTable(j_root, v_manifest, v_root_redirect_defined);
 
-			if (!v_from || !v_to || strlen(v_from) == 0 || strlen(v_to) == 0)
-				continue;
+		// 2-1) reDirect에 "/"가 정의되지 않은 경우, isMain 기반 root fallback
+		if (!v_root_redirect_defined) {
+			// main_path를 캡처해서 사용 (String 복사본)
+			String v_root_path = s_menu_state.main_path;
 
-			if (strcmp(v_from, "/") == 0) {
-				v_root_redirect_defined = true;
-			}
-
-			// 복사본 생성 (서버 생애 동안 유지)
-			char* v_from_copy = W10_allocCString(v_from);
-			char* v_to_copy	  = W10_allocCString(v_to);
+			s_server->on("/", HTTP_GET, [v_root_path](AsyncWebServerRequest* r) {
+				// 기본값
+				const char* v_default_html = "/html_v2/P010_main_021.html";
 
-			if (!v_from_copy || !v_to_copy) {
-				CL_D10_Logger::log(EN_L10_LOG_ERROR, "[W10] Redirect alloc failed (from:%s, to:%s)", v_from, v_to);
-				continue;
-			}
+				if (!v_root_path.isEmpty()) {
+					v_default_html = v_root_path.c_str();
+				}
 
-			// 예: "/chart_t1" → "/P020_chart_t1_008.html"
-			s_server->on(v_from_copy, HTTP_GET, [v_to_copy](AsyncWebServerRequest* r) { r->redirect(v_to_copy); });
+				// 파일 존재 여부 확인 후 리다이렉트
+				if (LittleFS.exists(v_default_html))
+					r->redirect(v_default_html);
+				else
+					r->redirect("/");  // 최악의 경우 루프지만, JSON/FS 구성이 잘못된 상황
+			});
 		}
-	}
-
-	// 3-1) reDirect에 "/"가 정의되지 않은 경우, isMain 기반 root fallback
-	if (!v_root_redirect_defined) {
-		// main_path를 캡처해서 사용 (String 복사본)
-		String v_root_path = s_menu_state.main_path;
-
-		s_server->on("/", HTTP_GET, [v_root_path](AsyncWebServerRequest* r) {
-			// 기본값
-			const char* v_default_html = "/html_v2/P010_main_021.html";
-
-			if (!v_root_path.isEmpty()) {
-				v_default_html = v_root_path.c_str();
-			}
 
-			// 파일 존재 여부 확인 후 리다이렉트
-			if (LittleFS.exists(v_default_html))
-				r->redirect(v_default_html);
-			else
-				r->redirect("/");  // 최악의 경우 루프지만, JSON/FS 구성이 잘못된 상황
-		});
+		CL_D10_Logger::log(EN_L10_LOG_INFO, "[W10] Route table: %u entries, heap %u B, gzip manifest: %d",
+						   (unsigned)s_routeTbl.count, (unsigned)s_routeTbl.heapBytes, v_manifest.isNull() ? 0 : 1);
 	}
 
-	// 4) 정적 폴더 매핑
+	// 3) 정적 폴더 매핑
 	// - "/html_v2/..." 경로는 모두 LittleFS의 "/html_v2" 폴더에서 정적 서빙
 	s_server->serveStatic(W10_Const::PATH_STATIC_HTML, LittleFS, W10_Const::PATH_STATIC_HTML);
 
-	// 5) 메뉴 API
+	// 4) 메뉴 API
 	s_server->on(W10_Const::HTTP_API_MENU, HTTP_GET, W10_getMenuJson);
 
 	CL_D10_Logger::log(EN_L10_LOG_INFO, "[W10] Web routing initialized (Pages: %u, Assets: %u)", v_page_count, v_asset_count);
@@ -6,6 +6,7 @@
  * ------------------------------------------------------
  * 기능 요약:
  * - LittleFS 파일 업로드 및 OTA 펌웨어 업데이트 라우팅 구현
+ * - 설정 JSON 업로드 시 C10 이진 스냅샷 무효화
  * ------------------------------------------------------
  * [구현 규칙]
  * - 항상 소스 시작 주석 부분 체계 유지 및 내용 업데이트
@@ -103,6 +104,14 @@ void CL_W10_WebAPI::routeUpload() {
 					LittleFS.remove(v_finalPath);
 					CL_D10_Logger::log(EN_L10_LOG_INFO, "[W10] Removing existing file: %s", v_finalPath.c_str());
 				}
+				// 웹 자산 교체 → 빌드 시 hash/gzip 무효 (원본 직접 전송으로 전환)
+				if (v_finalPath.startsWith(W10_Const::PATH_STATIC_HTML)) {
+					W10_invalidateStaticAsset(v_finalPath.c_str());
+				}
+				// 설정 JSON 교체 → C10 이진 스냅샷 무효 (다음 부팅 시 JSON 재파싱)
+				if (v_finalPath.startsWith(W10_Const::PATH_STATIC_JSON)) {
+					CL_C10_ConfigManager::invalidateSnapshot(v_finalPath.c_str());
+				}
 				s_upFile = LittleFS.open(v_finalPath, "w");
 				CL_D10_Logger::log(EN_L10_LOG_INFO, "[W10] Starting file upload: %s (to %s)", p_filename.c_str(), v_finalPath.c_str());
 			}
@@ -140,6 +149,7 @@ void CL_W10_WebAPI::routeUpdate() {
 				CL_W10_WebAPI::sendText(p_request, v_errMsg, 500);
 			} else {
 				CL_W10_WebAPI::sendText(p_request, "{\"ota\":\"ok\"}");
+				CL_C10_ConfigManager::flushPendingSave();
 				delay(300);
 				ESP.restart();
 			}
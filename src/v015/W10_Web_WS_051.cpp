@@ -8,7 +8,23 @@
  * - WebSocket 엔드포인트(/logs, /state, /chart, /metrics) 설정 및 이벤트 핸들링 구현.
  * - WebSocket 연결 시 초기 상태 및 메트릭스 데이터 전송 기능 구현.
  * - WebSocket을 통한 상태, 메트릭, 차트 데이터 브로드캐스팅 유틸리티(_broadcast) 구현.
- * - 로거 모듈(CL_D10_Logger)과 WebSocket 연결.
+ *   - 1회 직렬화 → 참조계수 공유 버퍼(AsyncWebSocketSharedBuffer)를 모든 client queue가 공유
+ *   - 누적 통계(wsStatsToJson) / 연결 client 대상 실제 text() 호출 heap 할당 벤치마크(wsBenchToJson)
+ * - 스트리밍 payload(broadcastRaw): CT10 고정 버퍼 직렬화 결과를 채널별 재사용 공유 버퍼로 전송
+ *   (직전 payload를 모든 queue가 반환했으면 재할당 없이 덮어씀)
+ *   - JsonDocument 경로 vs 스트리밍 writer 직렬화 비용 벤치마크(jsonBenchToJson)
+ * - client별 적응형 전송 간격: queue 길이 / canSend() 실패 / payload 크기로 간격을 늘리고 줄임
+ *   (하한 = 채널 wsIntervalMs, 상한 = × wsAdaptMaxMul) → 약전계 client만 느려지고 정상 client는 기본 주기 유지
+ * - /chart binary frame opt-in: client가 {"chartFmt":"bin","ver":N} 전송 → 버전 일치 시 binary,
+ *   불일치/미요청 client는 JSON fallback (client별 협상)
+ * - /chart seq delta sync: client별 nextSeq 추적 → 누락 구간만 전송, window 초과/신규/포맷 변경 시 resync
+ *   (canSend() false로 건너뛴 client도 다음 전송에서 누락분 포함 → 무손실)
+ * - /ws topic 다중화: 단일 socket에서 {"sub":[...]}/{"unsub":[...]} 제어 메시지로 topic 구독
+ *   (state/metrics/chart/summary/logs), text = {"t":topic,"d":payload}, binary = [topic id][frame]
+ *   - topic envelope는 브로드캐스트당 1회 생성 후 구독 client 공유, 개별 endpoint는 호환용으로 유지
+ *   - socket 1개당 heap 추정(wsStatsToJson "heap"): 개별 endpoint / /ws 비교, dashboard 구성은 실측값만 보고
+ *   - logs topic: 로그 sink(임의 task)는 고정 ring queue 적재만, loop task(wsLogTick)가 구독 client에 전송
+ * - 로거 모듈(CL_D10_Logger)과 WebSocket 연결 (/logs 직접 + /ws logs topic sink).
  * ------------------------------------------------------
  * [구현 규칙]
  * - 항상 소스 시작 주석 부분 체계 유지 및 내용 업데이트
@@ -36,36 +52,844 @@
 
 #include "W10_Web_051.h"
 
+#include <esp_heap_caps.h>
+
+// --------------------------------------------------
+// 브로드캐스트 누적 통계
+// --------------------------------------------------
+typedef struct {
+    uint32_t broadcasts;   // 직렬화 수행 횟수
+    uint32_t sends;        // client queue 적재 횟수
+    uint32_t skipped;      // canSend() false 로 생략한 client 수
+    uint32_t bytes;        // 직렬화 누적 바이트 (payload 1회분 기준)
+    uint32_t lastBytes;    // 마지막 payload 크기
+    uint16_t lastClients;  // 마지막 브로드캐스트 대상 client 수
+} ST_W10_WsBcastStat_t;
+
+static ST_W10_WsBcastStat_t s_wsBcastStat = {};
+
+static const uint8_t G_W10_WS_BENCH_REPEAT    = 4;  // 타 task 할당 노이즈 → 최소값 채택
+static const uint8_t G_W10_JSON_BENCH_REPEAT  = 8;  // 채널별 반복 (할당: 최소값, 시간: 평균)
+
+// 적응형 간격 판정 기준 (전송 직후 client queue 기준)
+static const uint8_t  G_W10_WS_ADAPT_QUEUE_LOW     = 1;     // 이하: 정상 소진 → 간격 축소
+static const uint8_t  G_W10_WS_ADAPT_QUEUE_HIGH    = 4;     // 이상: 적체 → 간격 ×1.5
+static const uint32_t G_W10_WS_ADAPT_BACKLOG_BYTES = 8192;  // queue 수 × payload 이상: 적체 → 간격 ×1.5
+
+// 1회 직렬화 → 공유 버퍼 (payload 크기 그대로, NUL 미포함)
+static AsyncWebSocketSharedBuffer W10_makeSharedJson(JsonDocument& p_doc) {
+    size_t v_len = measureJson(p_doc);
+    AsyncWebSocketSharedBuffer v_buf = std::make_shared<std::vector<uint8_t>>(v_len + 1);
+    serializeJson(p_doc, (char*)v_buf->data(), v_len + 1);
+    v_buf->resize(v_len);  // 축소: 재할당 없음
+    return v_buf;
+}
+
+// 스트리밍 payload → 채널별 재사용 공유 버퍼
+// - 직전 버퍼를 모든 client queue가 반환했으면(use_count==1) 용량 그대로 덮어씀 (재할당 없음)
+// - 아직 전송 중인 queue가 참조하면 새 버퍼 할당 (전송 중 payload 불변 보장)
+static AsyncWebSocketSharedBuffer s_rawBuf[G_A20_WS_CH_COUNT];
+
+static AsyncWebSocketSharedBuffer W10_rawShared(uint8_t p_ch, const char* p_buf, size_t p_len) {
+    AsyncWebSocketSharedBuffer& v_slot = s_rawBuf[p_ch];
+    if (!v_slot || v_slot.use_count() > 1) {
+        v_slot = std::make_shared<std::vector<uint8_t>>();
+    }
+    v_slot->assign((const uint8_t*)p_buf, (const uint8_t*)p_buf + p_len);
+    return v_slot;
+}
+
+// --------------------------------------------------
+// client별 적응형 전송 간격 (backpressure 기반)
+// - 채널마다 client slot: 현재 간격 / 마지막 전송 시각 / 누적 통계
+// - 간격 미도래 client는 이번 broadcast 생략(paced)
+//   (state/metrics/summary는 다음 전송이 최신 스냅샷, chart 추적 client는 nextSeq 유지로 무손실)
+// - 늘림: canSend() false 또는 전송 실패 → ×2, 전송 후 queue 적재(수/바이트) 고수위 → ×1.5
+// - 줄임: 전송 후 queue 소진 상태 → 기본 간격의 1/4씩 (빠른 후퇴, 완만한 회복)
+// - slot 접근은 loop task 전용 (broadcast / wsCleanupTick), 통계 조회는 읽기 전용
+// --------------------------------------------------
+typedef struct {
+    uint32_t id;          // 0: 빈 slot
+    uint16_t itvMs;       // 현재 client 전송 간격
+    uint8_t  lastQueue;   // 마지막 전송 직후 queue 길이
+    uint32_t lastSendMs;  // 마지막 전송(또는 실패) 시각
+    uint32_t sends;       // 전송 횟수
+    uint32_t drops;       // canSend() false / 전송 실패 횟수
+    uint32_t paced;       // 간격 미도래로 생략한 횟수
+} ST_W10_WsPace_t;
+
+// 개별 endpoint / /ws(다중화) 별도 테이블 (client id는 AsyncWebSocket 서버마다 독립 발급)
+static ST_W10_WsPace_t s_wsPace[G_A20_WS_CH_COUNT][W10_Const::WS_PACE_CLIENT_MAX]    = {};
+static ST_W10_WsPace_t s_wsPaceMux[G_A20_WS_CH_COUNT][W10_Const::WS_PACE_CLIENT_MAX] = {};
+
+static uint16_t s_wsItvMs[4]     = { 800, 1500, 1200, 1500 };
+static bool     s_wsAdaptEnabled = G_A20_WS_DEFAULT_ADAPT_ENABLED;
+static uint8_t  s_wsAdaptMaxMul  = G_A20_WS_DEFAULT_ADAPT_MAX_MUL;
+
+static uint16_t W10_paceMaxMs(uint8_t p_ch) {
+    uint32_t v_max = (uint32_t)s_wsItvMs[p_ch] * s_wsAdaptMaxMul;
+    return (uint16_t)(v_max > 60000u ? 60000u : v_max);
+}
+
+// client slot 확보 (없으면 빈 slot / 끊긴 client slot 재사용). nullptr: 비활성 또는 slot 부족
+// - p_tbl: 서버별 pace 테이블 (s_wsPace / s_wsPaceMux)
+static ST_W10_WsPace_t* W10_paceSlot(ST_W10_WsPace_t (*p_tbl)[W10_Const::WS_PACE_CLIENT_MAX], AsyncWebSocket* p_ws, uint8_t p_ch, uint32_t p_id, uint32_t p_nowMs) {
+    if (!s_wsAdaptEnabled || p_ch >= G_A20_WS_CH_COUNT || p_id == 0) return nullptr;
+
+    ST_W10_WsPace_t* v_tbl  = p_tbl[p_ch];
+    ST_W10_WsPace_t* v_free = nullptr;
+    for (uint8_t i = 0; i < W10_Const::WS_PACE_CLIENT_MAX; i++) {
+        if (v_tbl[i].id == p_id) return &v_tbl[i];
+        if (!v_free && (v_tbl[i].id == 0 || !p_ws->client(v_tbl[i].id))) v_free = &v_tbl[i];
+    }
+    if (!v_free) return nullptr;
+
+    memset(v_free, 0, sizeof(ST_W10_WsPace_t));
+    v_free->id         = p_id;
+    v_free->itvMs      = s_wsItvMs[p_ch];
+    v_free->lastSendMs = p_nowMs - v_free->itvMs;  // 신규 client는 즉시 due
+    return v_free;
+}
+
+// 반환: 이번 broadcast 전송 대상 여부 (slot 없으면 항상 대상)
+// - CT10 전송 주기 지터로 기본 간격 client가 한 주기씩 밀리지 않도록 기본 간격의 1/4 여유
+static bool W10_paceDue(ST_W10_WsPace_t* p_pace, uint8_t p_ch, uint32_t p_nowMs) {
+    if (!p_pace) return true;
+    if (p_nowMs - p_pace->lastSendMs + (s_wsItvMs[p_ch] / 4u) < p_pace->itvMs) {
+        p_pace->paced++;
+        return false;
+    }
+    return true;
+}
+
+// 전송 결과 → 간격 조정
+static void W10_paceUpdate(ST_W10_WsPace_t* p_pace, uint8_t p_ch, AsyncWebSocketClient* p_client, bool p_sent, uint32_t p_bytes, uint32_t p_nowMs) {
+    if (!p_pace) return;
+
+    const uint32_t v_min = s_wsItvMs[p_ch];
+    const uint32_t v_max = W10_paceMaxMs(p_ch);
+    uint32_t       v_itv = p_pace->itvMs;
+
+    p_pace->lastSendMs = p_nowMs;
+
+    if (!p_sent) {
+        p_pace->drops++;
+        v_itv *= 2u;
+    } else {
+        p_pace->sends++;
+        size_t v_q        = p_client->queueLen();
+        p_pace->lastQueue = (uint8_t)(v_q > 255u ? 255u : v_q);
+
+        if (v_q >= G_W10_WS_ADAPT_QUEUE_HIGH || (uint32_t)v_q * p_bytes >= G_W10_WS_ADAPT_BACKLOG_BYTES) {
+            v_itv += v_itv / 2u;
+        } else if (v_q <= G_W10_WS_ADAPT_QUEUE_LOW && v_itv > v_min) {
+            uint32_t v_step = (v_min / 4u) ? (v_min / 4u) : 1u;
+            v_itv = (v_itv > v_min + v_step) ? (v_itv - v_step) : v_min;
+        }
+    }
+
+    if (v_itv < v_min) v_itv = v_min;
+    if (v_itv > v_max) v_itv = v_max;
+    p_pace->itvMs = (uint16_t)v_itv;
+}
+
+// 정책 재적용 (system.webSocket) + 끊긴 client slot 해제 - wsCleanupTick(loop task)에서 호출
+static void W10_paceMaintain(AsyncWebSocket* const p_ws[G_A20_WS_CH_COUNT], AsyncWebSocket* p_muxWs) {
+    const ST_A20_SystemConfig_t* v_sys = C10_rcuRead(g_A20_config_root.system);
+    if (v_sys) {
+        const ST_A20_WebSocketConfig_t& v_cfg = v_sys->system.webSocket;
+        s_wsAdaptEnabled = v_cfg.wsAdaptEnabled;
+        if (v_cfg.wsAdaptMaxMul > 0) s_wsAdaptMaxMul = v_cfg.wsAdaptMaxMul;
+    }
+
+    for (uint8_t v_ch = 0; v_ch < G_A20_WS_CH_COUNT; v_ch++) {
+        for (uint8_t i = 0; i < W10_Const::WS_PACE_CLIENT_MAX; i++) {
+            ST_W10_WsPace_t& v_p = s_wsPace[v_ch][i];
+            if (v_p.id != 0 && (!s_wsAdaptEnabled || !p_ws[v_ch] || !p_ws[v_ch]->client(v_p.id))) {
+                memset(&v_p, 0, sizeof(ST_W10_WsPace_t));
+            }
+
+            ST_W10_WsPace_t& v_m = s_wsPaceMux[v_ch][i];
+            if (v_m.id != 0 && (!s_wsAdaptEnabled || !p_muxWs || !p_muxWs->client(v_m.id))) {
+                memset(&v_m, 0, sizeof(ST_W10_WsPace_t));
+            }
+        }
+    }
+}
+
+static void W10_paceToJson(JsonObject p_obj, ST_W10_WsPace_t (*p_tbl)[W10_Const::WS_PACE_CLIENT_MAX]) {
+    for (uint8_t v_ch = 0; v_ch < G_A20_WS_CH_COUNT; v_ch++) {
+        JsonArray v_arr = p_obj[G_A20_WS_CH_NAMES_Arr[v_ch]].to<JsonArray>();
+        for (uint8_t i = 0; i < W10_Const::WS_PACE_CLIENT_MAX; i++) {
+            const ST_W10_WsPace_t& v_p = p_tbl[v_ch][i];
+            if (v_p.id == 0) continue;
+            JsonObject v_o = v_arr.add<JsonObject>();
+            v_o["id"]     = v_p.id;
+            v_o["itvMs"]  = v_p.itvMs;
+            v_o["queue"]  = v_p.lastQueue;
+            v_o["sends"]  = v_p.sends;
+            v_o["drops"]  = v_p.drops;
+            v_o["paced"]  = v_p.paced;
+        }
+    }
+}
+
+// --------------------------------------------------
+// /ws topic 다중화 (단일 socket + 구독)
+// - topic id: 0~3 = WS 채널(G_A20_WS_CH_*), 4 = logs
+// - client → server (text): {"sub":["state","logs"]} / {"unsub":["chart"]} (+ chart 협상 "chartFmt","ver")
+//   server ack: {"t":"ctl","subs":[...],"chartFmt":"json"|"bin","ver":N}
+// - server → client: text {"t":"<topic>","d":<payload>} / binary [topic id u8][payload] (chart binary frame)
+// - 구독 slot: 등록/해제/구독 변경 = async_tcp task, 전송 = loop task → s_muxLock 임계구역
+// - 로그(임의 task)는 queue 적재만, loop task(wsLogTick)에서 전송
+// --------------------------------------------------
+static const uint8_t     G_W10_WS_TOPIC_LOGS  = G_A20_WS_CH_COUNT;
+static const uint8_t     G_W10_WS_TOPIC_COUNT = G_A20_WS_CH_COUNT + 1;
+static const char* const G_W10_WS_TOPIC_NAMES[G_W10_WS_TOPIC_COUNT] = { "state", "metrics", "chart", "summary", "logs" };
+
+typedef struct {
+    uint32_t id;    // 0: 빈 slot
+    uint8_t  mask;  // 구독 topic bit (1 << topic id)
+} ST_W10_MuxClient_t;
+
+static ST_W10_MuxClient_t s_muxClients[W10_Const::WS_MUX_CLIENT_MAX] = {};
+static portMUX_TYPE       s_muxLock     = portMUX_INITIALIZER_UNLOCKED;
+static volatile uint8_t   s_muxTopicAny = 0;  // 전체 client 구독 OR (미구독 topic 빠른 생략)
+
+static int8_t W10_muxTopicId(const char* p_name) {
+    if (!p_name) return -1;
+    for (uint8_t i = 0; i < G_W10_WS_TOPIC_COUNT; i++) {
+        if (strcmp(p_name, G_W10_WS_TOPIC_NAMES[i]) == 0) return (int8_t)i;
+    }
+    return -1;
+}
+
+static int8_t W10_muxFind(const ST_W10_MuxClient_t* p_tbl, uint32_t p_id) {
+    if (p_id == 0) return -1;
+    for (uint8_t i = 0; i < W10_Const::WS_MUX_CLIENT_MAX; i++) {
+        if (p_tbl[i].id == p_id) return (int8_t)i;
+    }
+    return -1;
+}
+
+// s_muxLock 보유 상태에서 호출
+static void W10_muxRecalcAny() {
+    uint8_t v_any = 0;
+    for (uint8_t i = 0; i < W10_Const::WS_MUX_CLIENT_MAX; i++) v_any |= s_muxClients[i].mask;
+    s_muxTopicAny = v_any;
+}
+
+static bool W10_muxAttach(uint32_t p_id) {
+    bool v_ok = false;
+    portENTER_CRITICAL(&s_muxLock);
+    if (W10_muxFind(s_muxClients, p_id) >= 0) {
+        v_ok = true;
+    } else {
+        for (uint8_t i = 0; i < W10_Const::WS_MUX_CLIENT_MAX; i++) {
+            if (s_muxClients[i].id == 0) {
+                s_muxClients[i].id   = p_id;
+                s_muxClients[i].mask = 0;
+                v_ok = true;
+                break;
+            }
+        }
+    }
+    portEXIT_CRITICAL(&s_muxLock);
+    return v_ok;
+}
+
+static void W10_muxDetach(uint32_t p_id) {
+    portENTER_CRITICAL(&s_muxLock);
+    int8_t v_slot = W10_muxFind(s_muxClients, p_id);
+    if (v_slot >= 0) {
+        memset(&s_muxClients[v_slot], 0, sizeof(ST_W10_MuxClient_t));
+        W10_muxRecalcAny();
+    }
+    portEXIT_CRITICAL(&s_muxLock);
+}
+
+// 구독 변경. 반환: 변경 전 mask (미등록 client: 0, p_ok=false)
+static uint8_t W10_muxUpdate(uint32_t p_id, uint8_t p_add, uint8_t p_remove, uint8_t& p_newMask, bool& p_ok) {
+    uint8_t v_old = 0;
+    p_ok      = false;
+    p_newMask = 0;
+    portENTER_CRITICAL(&s_muxLock);
+    int8_t v_slot = W10_muxFind(s_muxClients, p_id);
+    if (v_slot >= 0) {
+        v_old = s_muxClients[v_slot].mask;
+        s_muxClients[v_slot].mask = (uint8_t)((v_old | p_add) & ~p_remove);
+        p_newMask = s_muxClients[v_slot].mask;
+        p_ok      = true;
+        W10_muxRecalcAny();
+    }
+    portEXIT_CRITICAL(&s_muxLock);
+    return v_old;
+}
+
+static void W10_muxSnapshot(ST_W10_MuxClient_t p_out[W10_Const::WS_MUX_CLIENT_MAX]) {
+    portENTER_CRITICAL(&s_muxLock);
+    memcpy(p_out, s_muxClients, sizeof(ST_W10_MuxClient_t) * W10_Const::WS_MUX_CLIENT_MAX);
+    portEXIT_CRITICAL(&s_muxLock);
+}
+
+// text payload → {"t":"<topic>","d":<payload>} 공유 버퍼 (topic당 1회, 구독 client 공유)
+static AsyncWebSocketSharedBuffer W10_muxWrapText(uint8_t p_topic, const uint8_t* p_data, size_t p_len) {
+    static const char s_head[] = "{\"t\":\"";
+    static const char s_mid[]  = "\",\"d\":";
+    const char*       v_name   = G_W10_WS_TOPIC_NAMES[p_topic];
+    const size_t      v_nLen   = strlen(v_name);
+
+    AsyncWebSocketSharedBuffer v_buf = std::make_shared<std::vector<uint8_t>>();
+    v_buf->reserve(sizeof(s_head) - 1 + v_nLen + sizeof(s_mid) - 1 + p_len + 1);
+    v_buf->insert(v_buf->end(), (const uint8_t*)s_head, (const uint8_t*)s_head + sizeof(s_head) - 1);
+    v_buf->insert(v_buf->end(), (const uint8_t*)v_name, (const uint8_t*)v_name + v_nLen);
+    v_buf->insert(v_buf->end(), (const uint8_t*)s_mid, (const uint8_t*)s_mid + sizeof(s_mid) - 1);
+    v_buf->insert(v_buf->end(), p_data, p_data + p_len);
+    v_buf->push_back('}');
+    return v_buf;
+}
+
+// binary payload → [topic id][payload]
+static AsyncWebSocketSharedBuffer W10_muxWrapBin(uint8_t p_topic, const AsyncWebSocketSharedBuffer& p_buf) {
+    AsyncWebSocketSharedBuffer v_out = std::make_shared<std::vector<uint8_t>>();
+    v_out->reserve(p_buf->size() + 1);
+    v_out->push_back(p_topic);
+    v_out->insert(v_out->end(), p_buf->begin(), p_buf->end());
+    return v_out;
+}
+
+/**
+ * /ws 구독 client 대상 text topic 전송 (state/metrics/summary/logs)
+ * - 구독 client가 있을 때만 envelope 1회 생성
+ * - loop task 전용 (client 목록/구독 slot 순회)
+ * - p_paced: true = 채널 브로드캐스트 (적응형 간격 + 브로드캐스트 통계 갱신), 로그 queue 전송은 false
+ */
+static void W10_muxFanout(AsyncWebSocket* p_ws, uint8_t p_topic, const uint8_t* p_data, size_t p_len, bool p_paced) {
+    if (!p_ws || !p_ws->count() || !p_data || p_len == 0) return;
+    if (!(s_muxTopicAny & (1u << p_topic))) return;
+
+    ST_W10_MuxClient_t v_tbl[W10_Const::WS_MUX_CLIENT_MAX];
+    W10_muxSnapshot(v_tbl);
+
+    AsyncWebSocketSharedBuffer v_env;
+    const uint32_t             v_nowMs = millis();
+
+    // client()는 id 조회 (id는 1부터, 재연결 후 index와 불일치) → 목록 직접 순회
+    for (AsyncWebSocketClient& v_client : p_ws->getClients()) {
+        AsyncWebSocketClient* c = &v_client;
+        if (c->status() != WS_CONNECTED) continue;
+
+        int8_t v_slot = W10_muxFind(v_tbl, c->id());
+        if (v_slot < 0 || !(v_tbl[v_slot].mask & (1u << p_topic))) continue;
+
+        ST_W10_WsPace_t* v_pace = (p_paced && p_topic < G_A20_WS_CH_COUNT) ? W10_paceSlot(s_wsPaceMux, p_ws, p_topic, c->id(), v_nowMs) : nullptr;
+        if (!W10_paceDue(v_pace, p_topic, v_nowMs)) continue;
+
+        if (!v_env) v_env = W10_muxWrapText(p_topic, p_data, p_len);
+
+        bool v_sent = c->canSend() && c->text(v_env);
+        W10_paceUpdate(v_pace, p_topic, c, v_sent, (uint32_t)v_env->size(), v_nowMs);
+
+        if (!p_paced) continue;
+        if (v_sent) {
+            s_wsBcastStat.sends++;
+            s_wsBcastStat.lastClients++;
+        } else {
+            s_wsBcastStat.skipped++;
+        }
+    }
+}
+
+// --------------------------------------------------
+// WS heap 사용량 추정 (연결 socket 1개당)
+// - WS client 0개 시점 free heap을 기준점으로 보관
+// - 한 종류(개별 endpoint / /ws)만 연결된 시점의 (기준 - 현재) / socket 수 = socket 1개당 비용
+// - dashboard(P040) 비용: 해당 구성으로 연결된 시점의 (기준 - 현재) 실측값만 보고 (배수 환산 없음)
+//   . 개별 endpoint: /ws/state + /ws/logs = socket 2개, /ws: socket 1개
+// --------------------------------------------------
+static const uint16_t G_W10_DASH_LEGACY_SOCKETS = 2;
+static const uint16_t G_W10_DASH_MUX_SOCKETS    = 1;
+
+typedef struct {
+    uint32_t idleFree;        // WS client 0개일 때 free heap (최근)
+    uint32_t legacyPerSocket; // 개별 endpoint socket 1개당 [byte] (최근 측정)
+    uint32_t muxPerSocket;    // /ws socket 1개당 [byte] (최근 측정)
+    uint16_t legacySockets;   // 측정 시 socket 수
+    uint16_t muxSockets;
+    uint32_t dashLegacy;      // 개별 endpoint socket 2개만 연결된 시점 실측 [byte] (0: 미측정)
+    uint32_t dashMux;         // /ws socket 1개만 연결된 시점 실측 [byte] (0: 미측정)
+} ST_W10_WsHeapEst_t;
+
+static ST_W10_WsHeapEst_t s_wsHeapEst = {};
+
+static void W10_heapEstSample(uint32_t p_legacy, uint32_t p_mux) {
+    uint32_t v_free = ESP.getFreeHeap();
+    if (p_legacy == 0 && p_mux == 0) {
+        s_wsHeapEst.idleFree = v_free;
+        return;
+    }
+    if (s_wsHeapEst.idleFree == 0 || v_free >= s_wsHeapEst.idleFree) return;
+
+    uint32_t v_used = s_wsHeapEst.idleFree - v_free;
+    if (p_mux == 0) {
+        s_wsHeapEst.legacyPerSocket = v_used / p_legacy;
+        s_wsHeapEst.legacySockets   = (uint16_t)p_legacy;
+        if (p_legacy == G_W10_DASH_LEGACY_SOCKETS) s_wsHeapEst.dashLegacy = v_used;
+    } else if (p_legacy == 0) {
+        s_wsHeapEst.muxPerSocket = v_used / p_mux;
+        s_wsHeapEst.muxSockets   = (uint16_t)p_mux;
+        if (p_mux == G_W10_DASH_MUX_SOCKETS) s_wsHeapEst.dashMux = v_used;
+    }
+}
+
+// --------------------------------------------------
+// /chart client 상태 (binary 협상 + seq delta sync)
+// - 등록/해제/협상: async_tcp task(WS 이벤트) / 전송·nextSeq 갱신: loop task(broadcast)
+// - slot 접근은 s_chartMux 임계구역 (직렬화/전송은 임계구역 밖)
+// - slot 부족 client는 seq 추적 없이 기존 JSON diff(마지막 1개) 수신
+// --------------------------------------------------
+typedef struct {
+    uint32_t id;       // 0: 빈 slot
+    bool     bin;      // binary frame 협상 완료
+    uint32_t nextSeq;  // 다음 전송 시작 seq (0: resync 필요)
+} ST_W10_ChartClient_t;
+
+static ST_W10_ChartClient_t s_chartClients[W10_Const::WS_CHART_CLIENT_MAX] = {};
+static portMUX_TYPE         s_chartMux = portMUX_INITIALIZER_UNLOCKED;
+
+// /ws(다중화) chart 구독 client (client id 공간이 달라 별도 테이블)
+static ST_W10_ChartClient_t s_muxChartClients[W10_Const::WS_CHART_CLIENT_MAX] = {};
+static portMUX_TYPE         s_muxChartMux = portMUX_INITIALIZER_UNLOCKED;
+
+static int8_t W10_chartFind(const ST_W10_ChartClient_t* p_tbl, uint32_t p_id) {
+    if (p_id == 0) return -1;
+    for (uint8_t i = 0; i < W10_Const::WS_CHART_CLIENT_MAX; i++) {
+        if (p_tbl[i].id == p_id) return (int8_t)i;
+    }
+    return -1;
+}
+
+// 반환: 추적 slot 확보 여부 (p_tbl/p_lock: /ws/chart 또는 /ws 테이블)
+static bool W10_chartAttach(ST_W10_ChartClient_t* p_tbl, portMUX_TYPE* p_lock, uint32_t p_id) {
+    bool v_ok = false;
+    portENTER_CRITICAL(p_lock);
+    if (W10_chartFind(p_tbl, p_id) >= 0) {
+        v_ok = true;
+    } else {
+        for (uint8_t i = 0; i < W10_Const::WS_CHART_CLIENT_MAX; i++) {
+            if (p_tbl[i].id == 0) {
+                p_tbl[i].id      = p_id;
+                p_tbl[i].bin     = false;
+                p_tbl[i].nextSeq = 0;
+                v_ok = true;
+                break;
+            }
+        }
+    }
+    portEXIT_CRITICAL(p_lock);
+    return v_ok;
+}
+
+static void W10_chartDetach(ST_W10_ChartClient_t* p_tbl, portMUX_TYPE* p_lock, uint32_t p_id) {
+    portENTER_CRITICAL(p_lock);
+    int8_t v_slot = W10_chartFind(p_tbl, p_id);
+    if (v_slot >= 0) {
+        memset(&p_tbl[v_slot], 0, sizeof(ST_W10_ChartClient_t));
+    }
+    portEXIT_CRITICAL(p_lock);
+}
+
+// 포맷 지정 + resync 예약. 반환: false = 미추적 client (JSON diff 유지)
+static bool W10_chartSetFormat(ST_W10_ChartClient_t* p_tbl, portMUX_TYPE* p_lock, uint32_t p_id, bool p_bin) {
+    bool v_ok = false;
+    portENTER_CRITICAL(p_lock);
+    int8_t v_slot = W10_chartFind(p_tbl, p_id);
+    if (v_slot >= 0) {
+        p_tbl[v_slot].bin     = p_bin;
+        p_tbl[v_slot].nextSeq = 0;
+        v_ok = true;
+    }
+    portEXIT_CRITICAL(p_lock);
+    return v_ok;
+}
+
+// 차트 seq 범위 binary frame → 공유 버퍼 (nullptr: 새 샘플 없음, JSON과 같은 record 수 상한)
+static AsyncWebSocketSharedBuffer W10_makeChartBin(const CL_S10_Simulation& p_sim, uint32_t p_fromSeq, uint32_t& p_nextSeq) {
+    size_t v_cap = CL_S10_Simulation::chartBinCapFrom(p_fromSeq, G_S10_CHART_RANGE_MAX);
+    AsyncWebSocketSharedBuffer v_buf = std::make_shared<std::vector<uint8_t>>(v_cap);
+    size_t v_len = p_sim.toChartBinFrom(v_buf->data(), v_cap, p_fromSeq, G_S10_CHART_RANGE_MAX, p_nextSeq);
+    if (v_len == 0) return nullptr;
+    v_buf->resize(v_len);
+    return v_buf;
+}
+
+// 차트 seq 범위 JSON → 공유 버퍼 (nullptr: 새 샘플 없음)
+static AsyncWebSocketSharedBuffer W10_makeChartJson(CL_CT10_ControlManager& p_ctrl, uint32_t p_fromSeq, uint32_t& p_nextSeq) {
+    JsonDocument v_doc;
+    if (p_ctrl.exportChartJsonFrom(v_doc, p_fromSeq, G_S10_CHART_RANGE_MAX, p_nextSeq) == 0) return nullptr;
+    return W10_makeSharedJson(v_doc);
+}
+
+// /ws 구독 시작 시 현재 snapshot 1회 (topic envelope, state/metrics/summary)
+static void W10_muxSendSnapshot(AsyncWebSocketClient* p_client, uint8_t p_ch) {
+    JsonDocument v_doc;
+    if (p_ch == G_A20_WS_CH_STATE) {
+        CL_CT10_ControlManager::toJson(v_doc);
+    } else if (p_ch == G_A20_WS_CH_METRICS) {
+        CL_CT10_ControlManager::toMetricsJson(v_doc);
+    } else if (p_ch == G_A20_WS_CH_SUMMARY) {
+        CL_CT10_ControlManager::toSummaryJson(v_doc);
+    } else {
+        return;
+    }
+    AsyncWebSocketSharedBuffer v_buf = W10_makeSharedJson(v_doc);
+    p_client->text(W10_muxWrapText(p_ch, v_buf->data(), v_buf->size()));
+}
+
 // --------------------------------------------------
 // 브로드캐스트 유틸리티
 // --------------------------------------------------
-void CL_W10_WebAPI::_broadcast(AsyncWebSocket* p_ws, JsonDocument& p_doc, bool p_diffOnly) {
-    if (!p_ws || !p_ws->count()) return;
+// 개별 endpoint client 또는 해당 topic을 구독한 /ws client 존재 여부
+bool CL_W10_WebAPI::_hasListeners(AsyncWebSocket* p_ws, uint8_t p_ch) {
+    if (p_ws && p_ws->count()) return true;
+    return s_wsServerMux && s_wsServerMux->count() && (s_muxTopicAny & (1u << p_ch));
+}
+
+void CL_W10_WebAPI::_broadcast(AsyncWebSocket* p_ws, uint8_t p_ch, JsonDocument& p_doc, bool p_diffOnly) {
+    if (!_hasListeners(p_ws, p_ch)) return;
+
+    // diff가 비어 있으면("{}"/"null" 수준) 직렬화 생략
+    if (p_diffOnly && measureJson(p_doc) <= 5) return;
+
+    // 1회 직렬화 → 참조계수 공유 버퍼 (client별 payload 복사 없음)
+    _broadcastShared(p_ws, p_ch, W10_makeSharedJson(p_doc));
+}
 
-    String v_json;
-    serializeJson(p_doc, v_json);
+void CL_W10_WebAPI::_broadcastShared(AsyncWebSocket* p_ws, uint8_t p_ch, const AsyncWebSocketSharedBuffer& p_buf) {
+    if (!p_buf || !_hasListeners(p_ws, p_ch)) return;
 
-    if (p_diffOnly && v_json.length() <= 5) return;
+    const uint32_t v_nowMs = millis();
+    const uint32_t v_bytes = (uint32_t)p_buf->size();
 
-    // ✅ textAll() 대신 client별 전송 (queue 폭주 방지)
-    /*
-    getClients()가 사용 불가한 버전이면, 라이브러리 버전에 맞게:
-    for (AsyncWebSocketClient* c = p_ws->client(i); ... ) 형태로 교체해야 합니다.
-    (현재 ESPAsyncWebServer 버전에 따라 API가 조금씩 다릅니다)
+    s_wsBcastStat.broadcasts++;
+    s_wsBcastStat.bytes       += v_bytes;
+    s_wsBcastStat.lastBytes    = v_bytes;
+    s_wsBcastStat.lastClients  = 0;
 
-    */
+    // ✅ textAll() 대신 client별 전송 (queue 폭주 방지: canSend() 확인 + client별 적응형 간격)
+    //    client()는 id 조회라 index 순회 불가 → 목록 직접 순회
+    if (p_ws) {
+        for (AsyncWebSocketClient& v_client : p_ws->getClients()) {
+            AsyncWebSocketClient* c = &v_client;
+            if (c->status() != WS_CONNECTED) continue;
 
-	// 포인터를 직접 다루는 가장 안전한 방법
-    for (uint32_t i = 0; i < p_ws->count(); i++) {
-        AsyncWebSocketClient* c = p_ws->client(i);
+            ST_W10_WsPace_t* v_pace = W10_paceSlot(s_wsPace, p_ws, p_ch, c->id(), v_nowMs);
+            if (!W10_paceDue(v_pace, p_ch, v_nowMs)) continue;
 
-        if (c && c->status() == WS_CONNECTED) {
-            if (c->canSend()) {
-                c->text(v_json);
+            bool v_sent = c->canSend() && c->text(p_buf);
+            W10_paceUpdate(v_pace, p_ch, c, v_sent, v_bytes, v_nowMs);
+
+            if (v_sent) {
+                s_wsBcastStat.sends++;
+                s_wsBcastStat.lastClients++;
+            } else {
+                s_wsBcastStat.skipped++;
             }
         }
     }
 
+    // /ws 구독 client: 같은 payload를 topic envelope로 1회 감싸 공유
+    W10_muxFanout(s_wsServerMux, p_ch, p_buf->data(), p_buf->size(), true);
+}
+
+// --------------------------------------------------
+// /ws 로그 topic queue
+// - D10 로거 sink는 임의 task에서 호출 → client 목록/구독 slot 순회 없이 고정 ring에 복사만 (s_muxLock)
+// - loop task(wsLogTick)가 꺼내 W10_muxFanout 전송 (브로드캐스트와 같은 task, 간격/통계 미적용)
+// --------------------------------------------------
+typedef struct {
+    uint16_t len;
+    char     json[W10_Const::WS_MUX_LOG_LINE_MAX];
+} ST_W10_MuxLogLine_t;
+
+static ST_W10_MuxLogLine_t s_muxLogQ[W10_Const::WS_MUX_LOG_QUEUE];
+static uint8_t             s_muxLogHead  = 0;
+static uint8_t             s_muxLogCount = 0;
+static uint32_t            s_muxLogSent  = 0;  // queue 경유 전송 건수 (loop task)
+static uint32_t            s_muxLogDrops = 0;  // queue 가득 참/길이 초과
+
+// D10 로그 sink (임의 task): 구독 client가 있을 때만 queue 적재
+void CL_W10_WebAPI::broadcastLogMux(const char* p_json, size_t p_len) {
+    if (!p_json || p_len == 0) return;
+    if (!(s_muxTopicAny & (1u << G_W10_WS_TOPIC_LOGS))) return;
+
+    portENTER_CRITICAL(&s_muxLock);
+    if (p_len > W10_Const::WS_MUX_LOG_LINE_MAX || s_muxLogCount >= W10_Const::WS_MUX_LOG_QUEUE) {
+        s_muxLogDrops++;
+    } else {
+        ST_W10_MuxLogLine_t& v_line = s_muxLogQ[(s_muxLogHead + s_muxLogCount) % W10_Const::WS_MUX_LOG_QUEUE];
+        memcpy(v_line.json, p_json, p_len);
+        v_line.len = (uint16_t)p_len;
+        s_muxLogCount++;
+    }
+    portEXIT_CRITICAL(&s_muxLock);
+}
+
+// loop task: queue 적재분 전송 (1건씩 꺼내 임계구역 밖에서 전송)
+void CL_W10_WebAPI::wsLogTick() {
+    ST_W10_MuxLogLine_t v_line;
+    for (;;) {
+        bool v_have = false;
+        portENTER_CRITICAL(&s_muxLock);
+        if (s_muxLogCount > 0) {
+            const ST_W10_MuxLogLine_t& v_q = s_muxLogQ[s_muxLogHead];
+            memcpy(v_line.json, v_q.json, v_q.len);
+            v_line.len    = v_q.len;
+            s_muxLogHead  = (uint8_t)((s_muxLogHead + 1) % W10_Const::WS_MUX_LOG_QUEUE);
+            s_muxLogCount--;
+            v_have = true;
+        }
+        portEXIT_CRITICAL(&s_muxLock);
+        if (!v_have) return;
+
+        W10_muxFanout(s_wsServerMux, G_W10_WS_TOPIC_LOGS, (const uint8_t*)v_line.json, v_line.len, false);
+        s_muxLogSent++;
+    }
+}
+
+// --------------------------------------------------
+// 브로드캐스트 통계 / 벤치마크
+// --------------------------------------------------
+void CL_W10_WebAPI::wsStatsToJson(JsonObject p_obj) {
+    p_obj["broadcasts"]  = s_wsBcastStat.broadcasts;
+    p_obj["sends"]       = s_wsBcastStat.sends;
+    p_obj["skipped"]     = s_wsBcastStat.skipped;
+    p_obj["bytes"]       = s_wsBcastStat.bytes;
+    p_obj["lastBytes"]   = s_wsBcastStat.lastBytes;
+    p_obj["lastClients"] = s_wsBcastStat.lastClients;
+
+    // client별 적응형 간격 (채널 → client 목록)
+    JsonObject v_pace = p_obj["pace"].to<JsonObject>();
+    v_pace["enabled"] = s_wsAdaptEnabled;
+    v_pace["maxMul"]  = s_wsAdaptMaxMul;
+    W10_paceToJson(v_pace, s_wsPace);
+
+    // /ws topic 다중화: 연결 수 / topic별 구독 client 수 / 적응형 간격
+    ST_W10_MuxClient_t v_tbl[W10_Const::WS_MUX_CLIENT_MAX];
+    W10_muxSnapshot(v_tbl);
+
+    JsonObject v_mux    = p_obj["mux"].to<JsonObject>();
+    v_mux["clients"]    = s_wsServerMux ? s_wsServerMux->count() : 0;
+    JsonObject v_topics = v_mux["topics"].to<JsonObject>();
+    for (uint8_t v_t = 0; v_t < G_W10_WS_TOPIC_COUNT; v_t++) {
+        uint8_t v_n = 0;
+        for (uint8_t i = 0; i < W10_Const::WS_MUX_CLIENT_MAX; i++) {
+            if (v_tbl[i].id != 0 && (v_tbl[i].mask & (1u << v_t))) v_n++;
+        }
+        v_topics[G_W10_WS_TOPIC_NAMES[v_t]] = v_n;
+    }
+    W10_paceToJson(v_mux["pace"].to<JsonObject>(), s_wsPaceMux);
+
+    JsonObject v_logQ = v_mux["logQueue"].to<JsonObject>();
+    portENTER_CRITICAL(&s_muxLock);
+    const uint8_t  v_qPending = s_muxLogCount;
+    const uint32_t v_qDrops   = s_muxLogDrops;
+    portEXIT_CRITICAL(&s_muxLock);
+    v_logQ["pending"]  = v_qPending;
+    v_logQ["capacity"] = W10_Const::WS_MUX_LOG_QUEUE;
+    v_logQ["sent"]     = s_muxLogSent;
+    v_logQ["drops"]    = v_qDrops;
+
+    // socket 1개당 heap 추정 (wsCleanupTick 샘플) + dashboard(P040) 1개 구성 실측 (0: 해당 구성 미관측)
+    // - 개별 endpoint: /ws/state + /ws/logs = socket 2개, /ws: socket 1개
+    JsonObject v_heap         = p_obj["heap"].to<JsonObject>();
+    v_heap["free"]            = ESP.getFreeHeap();
+    v_heap["idleFree"]        = s_wsHeapEst.idleFree;
+    v_heap["legacyPerSocket"] = s_wsHeapEst.legacyPerSocket;
+    v_heap["legacySockets"]   = s_wsHeapEst.legacySockets;
+    v_heap["muxPerSocket"]    = s_wsHeapEst.muxPerSocket;
+    v_heap["muxSockets"]      = s_wsHeapEst.muxSockets;
+    v_heap["dashLegacy"]      = s_wsHeapEst.dashLegacy;
+    v_heap["dashMux"]         = s_wsHeapEst.dashMux;
+}
+
+// heap 할당 블록/바이트 스냅샷 (8bit capable 전체)
+static void W10_heapSnap(uint32_t& p_blocks, uint32_t& p_bytes) {
+    multi_heap_info_t v_info;
+    heap_caps_get_info(&v_info, MALLOC_CAP_8BIT);
+    p_blocks = (uint32_t)v_info.allocated_blocks;
+    p_bytes  = (uint32_t)v_info.total_allocated_bytes;
+}
+
+/**
+ * 브로드캐스트 1회당 heap 할당 실측 (현재 /state 연결 client 대상 실제 라이브러리 호출)
+ * - legacy : serializeJson(String) + client별 c->text(String)   (변경 전 _broadcast 코드 그대로)
+ * - shared : W10_makeSharedJson 1회 + client별 c->text(공유 버퍼) (현재 _broadcastShared 경로)
+ * - 값: 호출 직후 heap 증가분 (client queue node / 라이브러리 내부 복사 / 즉시 송신 pbuf 포함)
+ *   async_tcp가 측정 중 송신 완료분을 해제할 수 있으므로 반복 중 최소/최대 모두 보고
+ * - 실제 전송: client는 현재 state payload를 반복당 경로별 1회 추가 수신 (state 전체 갱신이므로 무해)
+ * - canSend() false client는 제외 (경로별 실제 전송 client 수 legacySends/sharedSends)
+ */
+void CL_W10_WebAPI::wsBenchToJson(JsonArray p_arr) {
+    if (!s_control) return;
+
+    JsonDocument v_doc;
+    s_control->toJson(v_doc);
+
+    uint32_t v_legMin[2] = {UINT32_MAX, UINT32_MAX};  // blocks, bytes
+    uint32_t v_legMax[2] = {0, 0};
+    uint32_t v_shrMin[2] = {UINT32_MAX, UINT32_MAX};
+    uint32_t v_shrMax[2] = {0, 0};
+    uint32_t v_legSends  = 0;
+    uint32_t v_shrSends  = 0;
+    uint32_t v_payload   = 0;
+    uint8_t  v_runs      = 0;
+
+    AsyncWebSocket* v_ws = s_wsServerState;
+
+    for (uint8_t v_r = 0; v_ws && v_r < G_W10_WS_BENCH_REPEAT; v_r++) {
+        uint32_t v_b0, v_y0, v_b1, v_y1;
+        uint16_t v_nLeg = 0, v_nShr = 0;
+
+        // legacy: String 직렬화 → client별 text(String) (client()는 id 조회 → 목록 직접 순회)
+        W10_heapSnap(v_b0, v_y0);
+        {
+            String v_json;
+            serializeJson(v_doc, v_json);
+            for (AsyncWebSocketClient& v_client : v_ws->getClients()) {
+                AsyncWebSocketClient* c = &v_client;
+                if (c->status() != WS_CONNECTED || !c->canSend()) continue;
+                if (c->text(v_json)) v_nLeg++;
+            }
+            v_payload = v_json.length();
+            W10_heapSnap(v_b1, v_y1);
+        }
+        const uint32_t v_legB = v_b1 - v_b0, v_legY = v_y1 - v_y0;
+
+        // shared: 1회 직렬화 → client별 text(공유 버퍼)
+        W10_heapSnap(v_b0, v_y0);
+        {
+            AsyncWebSocketSharedBuffer v_buf = W10_makeSharedJson(v_doc);
+            for (AsyncWebSocketClient& v_client : v_ws->getClients()) {
+                AsyncWebSocketClient* c = &v_client;
+                if (c->status() != WS_CONNECTED || !c->canSend()) continue;
+                if (c->text(v_buf)) v_nShr++;
+            }
+            W10_heapSnap(v_b1, v_y1);
+        }
+        const uint32_t v_shrB = v_b1 - v_b0, v_shrY = v_y1 - v_y0;
+
+        if (v_nLeg == 0 && v_nShr == 0) break;  // 연결 client 없음 → 측정 불가
+
+        v_legSends += v_nLeg;
+        v_shrSends += v_nShr;
+        v_runs++;
+        if (v_legB < v_legMin[0]) v_legMin[0] = v_legB;
+        if (v_legY < v_legMin[1]) v_legMin[1] = v_legY;
+        if (v_legB > v_legMax[0]) v_legMax[0] = v_legB;
+        if (v_legY > v_legMax[1]) v_legMax[1] = v_legY;
+        if (v_shrB < v_shrMin[0]) v_shrMin[0] = v_shrB;
+        if (v_shrY < v_shrMin[1]) v_shrMin[1] = v_shrY;
+        if (v_shrB > v_shrMax[0]) v_shrMax[0] = v_shrB;
+        if (v_shrY > v_shrMax[1]) v_shrMax[1] = v_shrY;
+    }
+
+    JsonObject v_o = p_arr.add<JsonObject>();
+    v_o["clients"] = v_ws ? v_ws->count() : 0;
+    v_o["runs"]    = v_runs;
+    v_o["payload"] = v_payload;
+    if (v_runs == 0) return;  // 측정값 없음 (state socket 미연결)
+
+    v_o["legacySends"]     = v_legSends;
+    v_o["legacyAllocs"]    = v_legMin[0];
+    v_o["legacyAllocsMax"] = v_legMax[0];
+    v_o["legacyBytes"]     = v_legMin[1];
+    v_o["legacyBytesMax"]  = v_legMax[1];
+    v_o["sharedSends"]     = v_shrSends;
+    v_o["sharedAllocs"]    = v_shrMin[0];
+    v_o["sharedAllocsMax"] = v_shrMax[0];
+    v_o["sharedBytes"]     = v_shrMin[1];
+    v_o["sharedBytesMax"]  = v_shrMax[1];
+}
+
+/**
+ * WS 채널 payload 1회 직렬화 비용 비교 (state/metrics/chart/summary)
+ * - doc    : JsonDocument 채움(CT10 export*) + serializeJson(String) → 현재 JsonDocument 경로
+ * - stream : CL_A20_JsonWriter → 고정 버퍼 직접 기록 (버퍼는 측정 구간 밖에서 확보)
+ * - 할당(blocks/bytes)은 반복 중 최소값, 시간(us)은 반복 평균
+ */
+void CL_W10_WebAPI::jsonBenchToJson(JsonArray p_arr) {
+    if (!s_control) return;
+
+    const size_t v_cap = G_CT10_WS_TXBUF_STATE_BYTES > G_CT10_WS_TXBUF_METRICS_BYTES ? G_CT10_WS_TXBUF_STATE_BYTES : G_CT10_WS_TXBUF_METRICS_BYTES;
+    char*        v_buf = (char*)malloc(v_cap);
+    if (!v_buf) return;
+
+    for (uint8_t v_ch = 0; v_ch < G_A20_WS_CH_COUNT; v_ch++) {
+        uint32_t v_docBlocks  = UINT32_MAX;
+        uint32_t v_docBytes   = UINT32_MAX;
+        uint32_t v_strBlocks  = UINT32_MAX;
+        uint32_t v_strBytes   = UINT32_MAX;
+        uint32_t v_docUs      = 0;
+        uint32_t v_strUs      = 0;
+        uint32_t v_docLen     = 0;
+        uint32_t v_strLen     = 0;
+        bool     v_overflow   = false;
+
+        for (uint8_t v_r = 0; v_r < G_W10_JSON_BENCH_REPEAT; v_r++) {
+            uint32_t v_b0, v_y0, v_b1, v_y1;
+
+            // JsonDocument 경로
+            W10_heapSnap(v_b0, v_y0);
+            uint32_t v_t0 = micros();
+            {
+                JsonDocument v_doc;
+                if (v_ch == G_A20_WS_CH_STATE) {
+                    CL_CT10_ControlManager::toJson(v_doc);
+                } else if (v_ch == G_A20_WS_CH_METRICS) {
+                    CL_CT10_ControlManager::toMetricsJson(v_doc);
+                } else if (v_ch == G_A20_WS_CH_CHART) {
+                    CL_CT10_ControlManager::toChartJson(v_doc, true);
+                } else {
+                    CL_CT10_ControlManager::toSummaryJson(v_doc);
+                }
+                String v_json;
+                serializeJson(v_doc, v_json);
+                v_docLen = v_json.length();
+                W10_heapSnap(v_b1, v_y1);
+            }
+            v_docUs += micros() - v_t0;
+            if (v_b1 - v_b0 < v_docBlocks) v_docBlocks = v_b1 - v_b0;
+            if (v_y1 - v_y0 < v_docBytes)  v_docBytes  = v_y1 - v_y0;
+
+            // 스트리밍 경로
+            W10_heapSnap(v_b0, v_y0);
+            v_t0 = micros();
+            {
+                CL_A20_JsonWriter v_w(v_buf, v_cap);
+                v_strLen   = (uint32_t)s_control->writeChannelJson(v_ch, v_w);
+                v_overflow = v_w.overflow();
+                W10_heapSnap(v_b1, v_y1);
+            }
+            v_strUs += micros() - v_t0;
+            if (v_b1 - v_b0 < v_strBlocks) v_strBlocks = v_b1 - v_b0;
+            if (v_y1 - v_y0 < v_strBytes)  v_strBytes  = v_y1 - v_y0;
+        }
+
+        JsonObject v_o       = p_arr.add<JsonObject>();
+        v_o["channel"]       = G_A20_WS_CH_NAMES_Arr[v_ch];
+        v_o["docBytesOut"]   = v_docLen;
+        v_o["docAllocs"]     = v_docBlocks;
+        v_o["docAllocBytes"] = v_docBytes;
+        v_o["docUs"]         = v_docUs / G_W10_JSON_BENCH_REPEAT;
+        v_o["strBytesOut"]   = v_strLen;
+        v_o["strAllocs"]     = v_strBlocks;
+        v_o["strAllocBytes"] = v_strBytes;
+        v_o["strUs"]         = v_strUs / G_W10_JSON_BENCH_REPEAT;
+        v_o["strOverflow"]   = v_overflow;
+    }
+
+    free(v_buf);
 }
 
 /*
@@ -92,9 +916,19 @@ void CL_W10_WebAPI::wsCleanupTick() {
     if (s_wsServerChart)   s_wsServerChart->cleanupClients();
     if (s_wsServerSummary) s_wsServerSummary->cleanupClients();
     if (s_wsServerLogs)    s_wsServerLogs->cleanupClients();
-}
+    if (s_wsServerMux)     s_wsServerMux->cleanupClients();
 
-static uint16_t s_wsItvMs[4] = { 800, 1500, 1200, 1500 };
+    // 적응형 간격: 정책 재적용 + 끊긴 client slot 해제 (채널 인덱스 순서)
+    AsyncWebSocket* const v_ws[G_A20_WS_CH_COUNT] = { s_wsServerState, s_wsServerMetrics, s_wsServerChart, s_wsServerSummary };
+    W10_paceMaintain(v_ws, s_wsServerMux);
+
+    // socket당 heap 추정 샘플 (개별 endpoint 합계 / /ws)
+    uint32_t v_legacy = (s_wsServerLogs ? s_wsServerLogs->count() : 0);
+    for (uint8_t i = 0; i < G_A20_WS_CH_COUNT; i++) {
+        if (v_ws[i]) v_legacy += v_ws[i]->count();
+    }
+    W10_heapEstSample(v_legacy, s_wsServerMux ? s_wsServerMux->count() : 0);
+}
 
 void CL_W10_WebAPI::setWsIntervals(const uint16_t p_itvMs[4]) {
     if (!p_itvMs) return;
@@ -134,10 +968,42 @@ void CL_W10_WebAPI::routeWebSocket() {
 	});
 	s_server->addHandler(s_wsServerState);
 
-	// 차트 WS
-	s_wsServerChart->onEvent([](AsyncWebSocket*, AsyncWebSocketClient* client, AwsEventType type, void*, uint8_t*, size_t) {
+	// 차트 WS (+ binary frame 협상 / seq delta sync)
+	s_wsServerChart->onEvent([](AsyncWebSocket*, AsyncWebSocketClient* client, AwsEventType type, void* arg, uint8_t* data, size_t len) {
 		if (type == WS_EVT_CONNECT) {
-			CL_D10_Logger::log(EN_L10_LOG_INFO, "[W10] WS /chart connected (id=%u)", client->id());
+			bool v_tracked = W10_chartAttach(s_chartClients, &s_chartMux, client->id());
+			CL_D10_Logger::log(EN_L10_LOG_INFO, "[W10] WS /chart connected (id=%u, seqSync=%d)", client->id(), v_tracked ? 1 : 0);
+			// 다음 chart 주기에 resync(window 전체) 전송
+			if (s_control) s_control->markDirty("chart");
+		} else if (type == WS_EVT_DISCONNECT) {
+			W10_chartDetach(s_chartClients, &s_chartMux, client->id());
+		} else if (type == WS_EVT_DATA) {
+			// 단일 text frame만 처리: {"chartFmt":"bin"|"json","ver":N}
+			AwsFrameInfo* v_info = (AwsFrameInfo*)arg;
+			if (!v_info || !v_info->final || v_info->index != 0 || v_info->len != len || v_info->opcode != WS_TEXT) return;
+
+			JsonDocument v_req;
+			if (deserializeJson(v_req, (const char*)data, len)) return;
+
+			const char* v_fmt = v_req["chartFmt"] | "json";
+			uint8_t     v_ver = v_req["ver"] | 0;
+
+			bool v_bin     = (strcmp(v_fmt, "bin") == 0 && v_ver == G_S10_CHART_BIN_VERSION);
+			bool v_tracked = W10_chartSetFormat(s_chartClients, &s_chartMux, client->id(), v_bin);
+			if (!v_tracked) v_bin = false;
+
+			// ack: 실제 적용 포맷 + 서버 지원 버전 (불일치 시 client는 JSON 유지)
+			JsonDocument v_ack;
+			v_ack["chartFmt"] = v_bin ? "bin" : "json";
+			v_ack["ver"]      = G_S10_CHART_BIN_VERSION;
+			String v_json;
+			serializeJson(v_ack, v_json);
+			client->text(v_json);
+
+			// 포맷 변경 → nextSeq 초기화됨, 다음 chart 주기에 새 포맷으로 resync
+			if (s_control) s_control->markDirty("chart");
+
+			CL_D10_Logger::log(EN_L10_LOG_INFO, "[W10] WS /chart format=%s (id=%u, ver=%u)", v_bin ? "bin" : "json", client->id(), (unsigned)v_ver);
 		}
 	});
 	s_server->addHandler(s_wsServerChart);
@@ -172,8 +1038,94 @@ void CL_W10_WebAPI::routeWebSocket() {
 	});
 	s_server->addHandler(s_wsServerMetrics);
 
-	// Logger에 WebSocket 연결
+	// 다중화 WS (/ws): 단일 socket + topic 구독 (개별 endpoint는 호환용으로 유지)
+	s_wsServerMux->onEvent([](AsyncWebSocket*, AsyncWebSocketClient* client, AwsEventType type, void* arg, uint8_t* data, size_t len) {
+		if (type == WS_EVT_CONNECT) {
+			if (!W10_muxAttach(client->id())) {
+				// 구독 slot 부족 → 거절 (개별 endpoint 사용 가능)
+				client->text("{\"t\":\"ctl\",\"err\":\"full\"}");
+				client->close();
+				CL_D10_Logger::log(EN_L10_LOG_WARN, "[W10] WS /ws rejected (id=%u, slots full)", client->id());
+				return;
+			}
+			CL_D10_Logger::log(EN_L10_LOG_INFO, "[W10] WS /ws connected (id=%u)", client->id());
+		} else if (type == WS_EVT_DISCONNECT) {
+			W10_muxDetach(client->id());
+			W10_chartDetach(s_muxChartClients, &s_muxChartMux, client->id());
+		} else if (type == WS_EVT_DATA) {
+			// 단일 text frame만 처리: {"sub":[...],"unsub":[...],"chartFmt":"bin"|"json","ver":N}
+			AwsFrameInfo* v_info = (AwsFrameInfo*)arg;
+			if (!v_info || !v_info->final || v_info->index != 0 || v_info->len != len || v_info->opcode != WS_TEXT) return;
+
+			JsonDocument v_req;
+			if (deserializeJson(v_req, (const char*)data, len)) return;
+
+			uint8_t v_add = 0;
+			uint8_t v_rm  = 0;
+			for (JsonVariantConst v_t : v_req["sub"].as<JsonArrayConst>()) {
+				int8_t v_id = W10_muxTopicId(v_t.as<const char*>());
+				if (v_id >= 0) v_add |= (uint8_t)(1u << v_id);
+			}
+			for (JsonVariantConst v_t : v_req["unsub"].as<JsonArrayConst>()) {
+				int8_t v_id = W10_muxTopicId(v_t.as<const char*>());
+				if (v_id >= 0) v_rm |= (uint8_t)(1u << v_id);
+			}
+
+			uint8_t v_new = 0;
+			bool    v_ok  = false;
+			uint8_t v_old = W10_muxUpdate(client->id(), v_add, v_rm, v_new, v_ok);
+			if (!v_ok) return;
+
+			// chart: 구독 시작 = seq 추적 등록(resync), 해제 = 추적 해제
+			const uint8_t v_chartBit = (uint8_t)(1u << G_A20_WS_CH_CHART);
+			const bool    v_chartOn  = (v_new & v_chartBit) != 0;
+			bool          v_resync   = false;
+			if (v_chartOn && !(v_old & v_chartBit)) {
+				(void)W10_chartAttach(s_muxChartClients, &s_muxChartMux, client->id());
+				v_resync = true;
+			} else if (!v_chartOn && (v_old & v_chartBit)) {
+				W10_chartDetach(s_muxChartClients, &s_muxChartMux, client->id());
+			}
+
+			// ack: 현재 구독 목록 (+ chart 포맷 협상 결과)
+			JsonDocument v_ack;
+			v_ack["t"]       = "ctl";
+			JsonArray v_subs = v_ack["subs"].to<JsonArray>();
+			for (uint8_t v_t = 0; v_t < G_W10_WS_TOPIC_COUNT; v_t++) {
+				if (v_new & (1u << v_t)) v_subs.add(G_W10_WS_TOPIC_NAMES[v_t]);
+			}
+
+			const char* v_fmt = v_req["chartFmt"].as<const char*>();
+			if (v_chartOn && v_fmt) {
+				uint8_t v_ver = v_req["ver"] | 0;
+				bool    v_bin = (strcmp(v_fmt, "bin") == 0 && v_ver == G_S10_CHART_BIN_VERSION);
+				if (!W10_chartSetFormat(s_muxChartClients, &s_muxChartMux, client->id(), v_bin)) v_bin = false;
+				v_ack["chartFmt"] = v_bin ? "bin" : "json";
+				v_resync          = true;
+			}
+			v_ack["ver"] = G_S10_CHART_BIN_VERSION;
+
+			String v_json;
+			serializeJson(v_ack, v_json);
+			client->text(v_json);
+
+			// 새로 구독한 state/metrics/summary: 현재 snapshot 즉시 전송 (개별 endpoint 연결 시와 동일)
+			if (s_control) {
+				for (uint8_t v_ch = 0; v_ch < G_A20_WS_CH_COUNT; v_ch++) {
+					if (v_ch == G_A20_WS_CH_CHART || !(v_new & ~v_old & (1u << v_ch))) continue;
+					W10_muxSendSnapshot(client, v_ch);
+				}
+				if (v_resync) s_control->markDirty("chart");
+			}
+
+			CL_D10_Logger::log(EN_L10_LOG_DEBUG, "[W10] WS /ws subs=0x%02X (id=%u)", (unsigned)v_new, client->id());
+		}
+	});
+	s_server->addHandler(s_wsServerMux);
+
+	// Logger에 WebSocket 연결 (/logs 직접 + /ws logs topic sink)
 	CL_D10_Logger::attachWebSocket(s_wsServerLogs);
+	CL_D10_Logger::attachLogSink(CL_W10_WebAPI::broadcastLogMux);
 	CL_D10_Logger::log(EN_L10_LOG_INFO, "[W10] WebSocket routes initialized (v029)");
 }
 
@@ -181,26 +1133,204 @@ void CL_W10_WebAPI::routeWebSocket() {
 // 상태 브로드캐스트
 // --------------------------------------------------
 void CL_W10_WebAPI::broadcastState(JsonDocument& p_doc, bool p_diffOnly) {
-	_broadcast(s_wsServerState, p_doc, p_diffOnly);
+	_broadcast(s_wsServerState, G_A20_WS_CH_STATE, p_doc, p_diffOnly);
 }
 
 // --------------------------------------------------
 // 메트릭 브로드캐스트
 // --------------------------------------------------
 void CL_W10_WebAPI::broadcastMetrics(JsonDocument& p_doc, bool p_diffOnly) {
-	_broadcast(s_wsServerMetrics, p_doc, p_diffOnly);
+	_broadcast(s_wsServerMetrics, G_A20_WS_CH_METRICS, p_doc, p_diffOnly);
 }
 
 // --------------------------------------------------
 // 차트 브로드캐스트
 // --------------------------------------------------
 void CL_W10_WebAPI::broadcastChart(JsonDocument& p_doc, bool p_diffOnly) {
-	_broadcast(s_wsServerChart, p_doc, p_diffOnly);
+	AsyncWebSocket* v_ws = s_wsServerChart;
+	if (!_hasListeners(v_ws, G_A20_WS_CH_CHART)) return;
+
+	if (!s_control) {
+		_broadcast(v_ws, G_A20_WS_CH_CHART, p_doc, p_diffOnly);
+		return;
+	}
+
+	// 미추적 client용 diff JSON (비어 있으면 nullptr)
+	AsyncWebSocketSharedBuffer v_diff;
+	if (!(p_diffOnly && measureJson(p_doc) <= 5)) v_diff = W10_makeSharedJson(p_doc);
+
+	_broadcastChartShared(v_diff);
+}
+
+/**
+ * 차트 fanout (서버 1개분) - 반환: 이번 pass 직렬화 바이트
+ * - p_tbl/p_lock/p_pace: 해당 서버의 seq 추적 / 적응형 간격 테이블
+ * - p_mux: /ws 서버 → chart 구독 client만 대상, payload는 topic envelope로 감쌈
+ *   (text: {"t":"chart","d":...}, binary: [topic id][chart frame])
+ */
+static uint32_t W10_chartFanout(AsyncWebSocket* p_ws, ST_W10_ChartClient_t* p_tbl, portMUX_TYPE* p_lock, ST_W10_WsPace_t (*p_pace)[W10_Const::WS_PACE_CLIENT_MAX],
+                                CL_CT10_ControlManager& p_ctrl, const AsyncWebSocketSharedBuffer& p_diff, bool p_mux, bool& p_any) {
+	// client 상태 snapshot (전송/직렬화는 임계구역 밖)
+	ST_W10_ChartClient_t v_tbl[W10_Const::WS_CHART_CLIENT_MAX];
+	portENTER_CRITICAL(p_lock);
+	memcpy(v_tbl, p_tbl, sizeof(v_tbl));
+	portEXIT_CRITICAL(p_lock);
+
+	ST_W10_MuxClient_t v_subs[W10_Const::WS_MUX_CLIENT_MAX];
+	if (p_mux) W10_muxSnapshot(v_subs);
+
+	uint32_t v_head = CL_S10_Simulation::chartHeadSeq();
+
+	// 추적 client용 payload cache: 같은 (fromSeq, 포맷)이면 공유 버퍼 재사용
+	// (정상 상태에서는 모든 client의 nextSeq가 같아 포맷별 1회 직렬화)
+	uint32_t                   v_cacheFrom[2] = { UINT32_MAX, UINT32_MAX };
+	uint32_t                   v_cacheNext[2] = { 0, 0 };
+	AsyncWebSocketSharedBuffer v_cacheBuf[2];
+
+	// 미추적 client용 diff (/ws: envelope 1회 생성)
+	AsyncWebSocketSharedBuffer v_diff = p_diff;
+	if (p_mux && p_diff) v_diff = W10_muxWrapText(G_A20_WS_CH_CHART, p_diff->data(), p_diff->size());
+
+	uint32_t v_bytes    = 0;
+	bool     v_diffSent = false;
+	uint32_t v_nowMs    = millis();
+
+	for (AsyncWebSocketClient& v_client : p_ws->getClients()) {
+		AsyncWebSocketClient* c = &v_client;
+		if (c->status() != WS_CONNECTED) continue;
+
+		if (p_mux) {
+			int8_t v_sub = W10_muxFind(v_subs, c->id());
+			if (v_sub < 0 || !(v_subs[v_sub].mask & (1u << G_A20_WS_CH_CHART))) continue;
+		}
+
+		int8_t v_slot = W10_chartFind(v_tbl, c->id());
+
+		// 1) 미추적 client: 기존 diff JSON
+		if (v_slot < 0) {
+			if (!v_diff) continue;
+
+			ST_W10_WsPace_t* v_pace = W10_paceSlot(p_pace, p_ws, G_A20_WS_CH_CHART, c->id(), v_nowMs);
+			if (!W10_paceDue(v_pace, G_A20_WS_CH_CHART, v_nowMs)) continue;
+
+			bool v_sent = c->canSend() && c->text(v_diff);
+			W10_paceUpdate(v_pace, G_A20_WS_CH_CHART, c, v_sent, (uint32_t)v_diff->size(), v_nowMs);
+			if (!v_sent) {
+				s_wsBcastStat.skipped++;
+				continue;
+			}
+			if (!v_diffSent) {
+				v_diffSent = true;
+				v_bytes   += (uint32_t)v_diff->size();
+			}
+			s_wsBcastStat.sends++;
+			p_any = true;
+			continue;
+		}
+
+		// 2) 추적 client: nextSeq 이후 누락 구간 (최신이면 생략)
+		const ST_W10_ChartClient_t& v_cl   = v_tbl[v_slot];
+		uint32_t                    v_from = v_cl.nextSeq;
+		if (v_head != 0 && v_from == v_head) continue;
+
+		// 간격 미도래 / queue 포화 → nextSeq 유지 (다음 전송에서 누락분 포함)
+		ST_W10_WsPace_t* v_pace = W10_paceSlot(p_pace, p_ws, G_A20_WS_CH_CHART, c->id(), v_nowMs);
+		if (!W10_paceDue(v_pace, G_A20_WS_CH_CHART, v_nowMs)) continue;
+
+		if (!c->canSend()) {
+			W10_paceUpdate(v_pace, G_A20_WS_CH_CHART, c, false, 0, v_nowMs);
+			s_wsBcastStat.skipped++;
+			continue;
+		}
+
+		uint8_t v_fmt = v_cl.bin ? 1 : 0;
+		if (v_cacheFrom[v_fmt] != v_from) {
+			v_cacheFrom[v_fmt] = v_from;
+			v_cacheBuf[v_fmt]  = v_cl.bin ? W10_makeChartBin(p_ctrl.sim, v_from, v_cacheNext[v_fmt])
+			                              : W10_makeChartJson(p_ctrl, v_from, v_cacheNext[v_fmt]);
+			if (v_cacheBuf[v_fmt] && p_mux) {
+				v_cacheBuf[v_fmt] = v_cl.bin ? W10_muxWrapBin(G_A20_WS_CH_CHART, v_cacheBuf[v_fmt])
+				                             : W10_muxWrapText(G_A20_WS_CH_CHART, v_cacheBuf[v_fmt]->data(), v_cacheBuf[v_fmt]->size());
+			}
+			if (v_cacheBuf[v_fmt]) v_bytes += (uint32_t)v_cacheBuf[v_fmt]->size();
+		}
+
+		AsyncWebSocketSharedBuffer& v_buf = v_cacheBuf[v_fmt];
+		if (!v_buf) continue;
+
+		bool v_sent = v_cl.bin ? c->binary(v_buf) : c->text(v_buf);
+		W10_paceUpdate(v_pace, G_A20_WS_CH_CHART, c, v_sent, (uint32_t)v_buf->size(), v_nowMs);
+		if (!v_sent) {
+			s_wsBcastStat.skipped++;
+			continue;
+		}
+		s_wsBcastStat.sends++;
+		p_any = true;
+
+		// 전송 성공 → nextSeq 확정 (그 사이 포맷 변경/재연결이 없었던 경우만)
+		portENTER_CRITICAL(p_lock);
+		ST_W10_ChartClient_t& v_live = p_tbl[v_slot];
+		if (v_live.id == v_cl.id && v_live.bin == v_cl.bin && v_live.nextSeq == v_from) {
+			v_live.nextSeq = v_cacheNext[v_fmt];
+		}
+		portEXIT_CRITICAL(p_lock);
+	}
+
+	return v_bytes;
+}
+
+void CL_W10_WebAPI::_broadcastChartShared(const AsyncWebSocketSharedBuffer& p_diff) {
+	if (!s_control || !_hasListeners(s_wsServerChart, G_A20_WS_CH_CHART)) return;
+
+	uint32_t v_bytes = 0;
+	bool     v_any   = false;
+
+	// /ws/chart (개별 endpoint)
+	if (s_wsServerChart && s_wsServerChart->count()) {
+		v_bytes += W10_chartFanout(s_wsServerChart, s_chartClients, &s_chartMux, s_wsPace, *s_control, p_diff, false, v_any);
+	}
+
+	// /ws chart topic 구독 client
+	if (s_wsServerMux && s_wsServerMux->count() && (s_muxTopicAny & (1u << G_A20_WS_CH_CHART))) {
+		v_bytes += W10_chartFanout(s_wsServerMux, s_muxChartClients, &s_muxChartMux, s_wsPaceMux, *s_control, p_diff, true, v_any);
+	}
+
+	if (v_any) {
+		s_wsBcastStat.broadcasts++;
+		s_wsBcastStat.bytes     += v_bytes;
+		s_wsBcastStat.lastBytes  = v_bytes;
+	}
+}
+
+// --------------------------------------------------
+// 스트리밍 payload 브로드캐스트 (CT10 raw broker)
+// --------------------------------------------------
+void CL_W10_WebAPI::broadcastRaw(uint8_t p_ch, const char* p_buf, size_t p_len) {
+	if (p_ch >= G_A20_WS_CH_COUNT) return;
+
+	// chart: diff가 비어도 seq 추적 client 전송은 수행
+	if (p_ch == G_A20_WS_CH_CHART) {
+		if (!_hasListeners(s_wsServerChart, G_A20_WS_CH_CHART)) return;
+		_broadcastChartShared((p_buf && p_len > 0) ? W10_rawShared(p_ch, p_buf, p_len) : nullptr);
+		return;
+	}
+
+	AsyncWebSocket* v_ws = nullptr;
+	if (p_ch == G_A20_WS_CH_STATE) {
+		v_ws = s_wsServerState;
+	} else if (p_ch == G_A20_WS_CH_METRICS) {
+		v_ws = s_wsServerMetrics;
+	} else {
+		v_ws = s_wsServerSummary;
+	}
+	if (!p_buf || p_len == 0 || !_hasListeners(v_ws, p_ch)) return;
+
+	_broadcastShared(v_ws, p_ch, W10_rawShared(p_ch, p_buf, p_len));
 }
 
 // --------------------------------------------------
 // 요약 브로드캐스트
 // --------------------------------------------------
 void CL_W10_WebAPI::broadcastSummary(JsonDocument& p_doc, bool p_diffOnly) {
-	_broadcast(s_wsServerSummary, p_doc, p_diffOnly);
+	_broadcast(s_wsServerSummary, G_A20_WS_CH_SUMMARY, p_doc, p_diffOnly);
 }
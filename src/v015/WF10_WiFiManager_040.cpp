@@ -369,7 +369,9 @@ bool CL_WF10_WiFiManager::applyConfig(const ST_A20_WifiConfig_t& p_cfg) {
 	WiFiMulti v_multi;
 
 	// 3. system config 존재 여부 확인
-	if (!g_A20_config_root.system) {
+	//  - init()은 STA 재시도/NTP 대기로 RCU grace 이상 걸릴 수 있음 → 섹션 포인터 대신 값 복사 사용
+	const ST_A20_SystemConfig_t* v_sysPtr = C10_rcuRead(g_A20_config_root.system);
+	if (!v_sysPtr) {
 		CL_D10_Logger::log(EN_L10_LOG_ERROR,
 			"[WiFi] applyConfig: system config is null. "
 			"Using default time interval (6h) without full system integration.");
@@ -383,7 +385,8 @@ bool CL_WF10_WiFiManager::applyConfig(const ST_A20_WifiConfig_t& p_cfg) {
 	}
 
 	// 4. 기존 init() 로직 재사용 (AP/STA + NTP 동기화까지 포함)
-	bool v_ok = init(p_cfg, *g_A20_config_root.system, v_multi, 1, 15, true);
+	const ST_A20_SystemConfig_t v_sys = *v_sysPtr;
+	bool						v_ok  = init(p_cfg, v_sys, v_multi, 1, 15, true);
 
 	CL_D10_Logger::log(EN_L10_LOG_INFO, "[WiFi] Configuration applied (ok=%d, mode=%d)", (int)v_ok, (int)p_cfg.wifiMode);
 	return v_ok;
@@ -422,12 +425,15 @@ void WF10_applyTimeConfigFromSystem(const ST_A20_SystemConfig_t& p_cfg) {
 	}
 
 	// 4. Wi-Fi가 존재하면, 새 sync_interval 기준으로 정규 동기화 루프도 갱신
-	if (g_A20_config_root.wifi) {
-		uint32_t v_interval_ms = (uint32_t)p_cfg.time.syncIntervalMin * 60000UL;
+	//  - 동기화 대기 동안 섹션 포인터를 보유하지 않도록 값 복사 후 호출
+	const ST_A20_WifiConfig_t* v_wifiPtr = C10_rcuRead(g_A20_config_root.wifi);
+	if (v_wifiPtr) {
+		const ST_A20_WifiConfig_t v_wifi		  = *v_wifiPtr;
+		uint32_t				  v_interval_ms = (uint32_t)p_cfg.time.syncIntervalMin * 60000UL;
 		if (v_interval_ms == 0) {
 			v_interval_ms = 21600000UL;	 // 6시간 기본값
 		}
 
-		CL_WF10_WiFiManager::syncTimeIfNeeded(*g_A20_config_root.wifi, p_cfg, v_interval_ms);
+		CL_WF10_WiFiManager::syncTimeIfNeeded(v_wifi, p_cfg, v_interval_ms);
 	}
 }
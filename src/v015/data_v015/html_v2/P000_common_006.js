@@ -13,6 +13,10 @@
  * 6. OFFLINE 모드는 path의 파일명을 기준으로 상대 경로를 구성
  * 7. 현재 페이지 active 자동 적용
  * 8. window.currentMode 노출
+ * 9. /ws/chart binary frame 디코더 (window.decodeChartBin, 포맷 v2)
+ * 10. /ws/chart seq delta 누적 (window.mergeChartSeq: 중복 제거 / resync 시 교체)
+ * 11. /ws topic 다중화 client (window.openMuxSocket: 구독 / topic별 분배 / 자동 재연결)
+ * 12. 페이지 로드 시간 계측 (window.pageLoadStats: Navigation/Resource Timing, gzip·캐시 효과 확인)
  * ------------------------------------------------------
  */
 
@@ -242,6 +246,281 @@ async function loadMenuAndSetMode() {
     renderMenu(pagesData);
 }
 
+/**
+ * ------------------------------------------------------
+ * /ws/chart binary frame 디코더 (S10_Simul_040.h G_S10_CHART_BIN_* 와 동일 포맷)
+ * - header 20B (LE) + int16 wind[n] + int16 pwm[n] + gust bits + thermal bits + varint dtMs[n-1]
+ * - 반환: { version, full, phase, gust, thermal, avgWind, samples, seq0, recs:[{seq,ts,t,wind,pwm,gust,thermal}] }
+ *   (ts/t: 장치 millis 기준 [ms], seq: seq0부터 연속, full: resync → 누적 데이터 교체)
+ * - 형식 불일치 시 null
+ * ------------------------------------------------------
+ */
+const G_CHART_BIN_MAGIC = 0x4353;      // "SC"
+const G_CHART_BIN_VERSION = 2;
+const G_CHART_BIN_HDR_SIZE = 20;
+const G_CHART_BIN_WIND_SCALE = 100;
+const G_CHART_BIN_PWM_SCALE = 100;
+
+function decodeChartBin(buf) {
+    if (!(buf instanceof ArrayBuffer) || buf.byteLength < G_CHART_BIN_HDR_SIZE) return null;
+
+    const dv = new DataView(buf);
+    if (dv.getUint16(0, true) !== G_CHART_BIN_MAGIC) return null;
+
+    const version = dv.getUint8(2);
+    if (version !== G_CHART_BIN_VERSION) return null;
+
+    const flags = dv.getUint8(3);
+    const n = dv.getUint16(4, true);
+    const metaFlags = dv.getUint8(7);
+    const t0 = dv.getUint32(8, true);
+    const seq0 = dv.getUint32(16, true);
+
+    const out = {
+        version,
+        full: (flags & 0x01) !== 0,
+        phase: dv.getUint8(6),
+        gust: (metaFlags & 0x01) !== 0,
+        thermal: (metaFlags & 0x02) !== 0,
+        avgWind: dv.getInt16(12, true) / G_CHART_BIN_WIND_SCALE,
+        samples: dv.getUint8(14),
+        seq0,
+        recs: []
+    };
+
+    const nBits = (n + 7) >> 3;
+    let offWind = G_CHART_BIN_HDR_SIZE;
+    let offPwm = offWind + n * 2;
+    let offGust = offPwm + n * 2;
+    let offTherm = offGust + nBits;
+    let off = offTherm + nBits;
+    if (off > buf.byteLength) return null;
+
+    let ts = t0;
+    for (let i = 0; i < n; i++) {
+        if (i > 0) {
+            // LEB128 varint
+            let dt = 0, shift = 0, b = 0;
+            do {
+                if (off >= buf.byteLength) return null;
+                b = dv.getUint8(off++);
+                dt += (b & 0x7f) * Math.pow(2, shift);
+                shift += 7;
+            } while (b & 0x80);
+            ts += dt;
+        }
+        out.recs.push({
+            seq: seq0 + i,
+            ts,
+            t: ts,
+            wind: dv.getInt16(offWind + i * 2, true) / G_CHART_BIN_WIND_SCALE,
+            pwm: dv.getInt16(offPwm + i * 2, true) / G_CHART_BIN_PWM_SCALE,
+            gust: (dv.getUint8(offGust + (i >> 3)) >> (i & 7)) & 1,
+            thermal: (dv.getUint8(offTherm + (i >> 3)) >> (i & 7)) & 1
+        });
+    }
+    return out;
+}
+window.decodeChartBin = decodeChartBin;
+window.G_CHART_BIN_VERSION = G_CHART_BIN_VERSION;
+
+/**
+ * ------------------------------------------------------
+ * /ws/chart seq delta 누적
+ * - 서버는 client별 누락 구간만 전송 → 수신 측에서 seq 순서로 이어 붙임
+ * - p_resync(binary full / JSON sim.resync) 시 누적 데이터 교체
+ * - 이미 받은 seq 이하는 무시, 최대 G_CHART_SEQ_KEEP_MAX개 유지
+ * - store: { recs:[], lastSeq:-1 } (호출 측 보관), 반환: 변경 여부
+ * ------------------------------------------------------
+ */
+const G_CHART_SEQ_KEEP_MAX = 3600;
+
+function mergeChartSeq(store, recs, resync) {
+    if (!store || !Array.isArray(recs)) return false;
+    if (!Array.isArray(store.recs) || resync) {
+        store.recs = [];
+        store.lastSeq = -1;
+    }
+
+    let changed = !!resync;
+    for (const r of recs) {
+        // seq 없는 구버전 payload: 그대로 추가
+        if (typeof r.seq !== "number") {
+            store.recs.push(r);
+            changed = true;
+            continue;
+        }
+        if (r.seq <= store.lastSeq) continue;
+        store.recs.push(r);
+        store.lastSeq = r.seq;
+        changed = true;
+    }
+
+    if (store.recs.length > G_CHART_SEQ_KEEP_MAX) {
+        store.recs.splice(0, store.recs.length - G_CHART_SEQ_KEEP_MAX);
+    }
+    return changed;
+}
+window.mergeChartSeq = mergeChartSeq;
+
+/**
+ * ------------------------------------------------------
+ * /ws topic 다중화 client (W10 /ws)
+ * - 연결 시 {"sub":[topics]} 전송 (chart + opts.chartBin → chartFmt/ver 협상 포함)
+ * - text {"t":topic,"d":payload} → handlers[topic](payload), {"t":"ctl"} → handlers.ctl(msg)
+ * - binary [topic id u8][frame] → handlers[topic](ArrayBuffer)
+ * - 끊기면 opts.retryMs(기본 5000) 후 재연결, handlers.open/close 선택
+ * - 반환: { sub(list), unsub(list), close() }
+ * ------------------------------------------------------
+ */
+const G_WS_MUX_TOPICS = ["state", "metrics", "chart", "summary", "logs"];
+
+function openMuxSocket(url, topics, handlers = {}, opts = {}) {
+    const subs = new Set(topics || []);
+    const retryMs = opts.retryMs || 5000;
+    let ws = null;
+    let closed = false;
+
+    const send = (msg) => {
+        if (ws && ws.readyState === WebSocket.OPEN) ws.send(JSON.stringify(msg));
+    };
+
+    const subMsg = (list) => {
+        const msg = { sub: list };
+        if (opts.chartBin && list.includes("chart")) {
+            msg.chartFmt = "bin";
+            msg.ver = G_CHART_BIN_VERSION;
+        }
+        return msg;
+    };
+
+    const connect = () => {
+        try {
+            ws = new WebSocket(url);
+        } catch (e) {
+            if (handlers.error) handlers.error(e);
+            if (!closed) setTimeout(connect, retryMs);
+            return;
+        }
+        ws.binaryType = "arraybuffer";
+
+        ws.onopen = () => {
+            if (subs.size) send(subMsg([...subs]));
+            if (handlers.open) handlers.open();
+        };
+
+        ws.onmessage = (event) => {
+            if (event.data instanceof ArrayBuffer) {
+                if (event.data.byteLength < 1) return;
+                const topic = G_WS_MUX_TOPICS[new Uint8Array(event.data)[0]];
+                if (topic && handlers[topic]) handlers[topic](event.data.slice(1));
+                return;
+            }
+            let msg;
+            try {
+                msg = JSON.parse(event.data);
+            } catch (e) {
+                return;
+            }
+            if (!msg || typeof msg.t !== "string") return;
+            if (msg.t === "ctl") {
+                if (handlers.ctl) handlers.ctl(msg);
+                return;
+            }
+            if (handlers[msg.t]) handlers[msg.t](msg.d);
+        };
+
+        ws.onclose = () => {
+            if (handlers.close) handlers.close();
+            if (!closed) setTimeout(connect, retryMs);
+        };
+
+        ws.onerror = (e) => {
+            if (handlers.error) handlers.error(e);
+        };
+    };
+
+    connect();
+
+    return {
+        sub(list) {
+            list.forEach((t) => subs.add(t));
+            send(subMsg(list));
+        },
+        unsub(list) {
+            list.forEach((t) => subs.delete(t));
+            send({ unsub: list });
+        },
+        close() {
+            closed = true;
+            if (ws) ws.close();
+        }
+    };
+}
+window.openMuxSocket = openMuxSocket;
+
+/**
+ * ------------------------------------------------------
+ * 페이지 로드 시간 계측 (Navigation / Resource Timing)
+ * - load 완료 후 1회: 시작 기준 ttfb / DOMContentLoaded / load [ms]
+ * - html + 정적 자산(css/js) 전송 byte(transferSize, header 포함) / 압축 본문(encodedBodySize) / 원본(decodedBodySize)
+ * - cached: transferSize 0 (브라우저 캐시, 요청 없음), revalidated: 본문 없이 header만 (304)
+ * - window.pageLoadStats 노출 + console 출력 (gzip / ETag / immutable 적용 전후 비교용)
+ * ------------------------------------------------------
+ */
+function collectPageLoadStats() {
+    const perf = window.performance;
+    if (!perf || !perf.getEntriesByType) return null;
+    const nav = perf.getEntriesByType("navigation")[0];
+    if (!nav) return null;
+
+    const stats = {
+        ttfbMs: Math.round(nav.responseStart - nav.startTime),
+        domReadyMs: Math.round(nav.domContentLoadedEventEnd - nav.startTime),
+        loadMs: Math.round(nav.loadEventEnd - nav.startTime),
+        htmlTransfer: nav.transferSize || 0,
+        htmlEncoded: nav.encodedBodySize || 0,
+        htmlDecoded: nav.decodedBodySize || 0,
+        assets: 0,
+        assetTransfer: 0,
+        assetEncoded: 0,
+        assetDecoded: 0,
+        cached: 0,
+        revalidated: 0
+    };
+
+    perf.getEntriesByType("resource").forEach((r) => {
+        let path;
+        try {
+            path = new URL(r.name).pathname;
+        } catch (e) {
+            return;
+        }
+        if (!/\.(css|js)$/.test(path)) return;
+        stats.assets++;
+        stats.assetTransfer += r.transferSize || 0;
+        stats.assetEncoded += r.encodedBodySize || 0;
+        stats.assetDecoded += r.decodedBodySize || 0;
+        if (r.transferSize === 0) stats.cached++;
+        else if (r.encodedBodySize === 0 || r.transferSize < r.encodedBodySize) stats.revalidated++;
+    });
+    return stats;
+}
+
+window.addEventListener("load", () => {
+    // loadEventEnd는 load handler 종료 후 기록 → 다음 task에서 수집
+    setTimeout(() => {
+        const stats = collectPageLoadStats();
+        if (!stats) return;
+        window.pageLoadStats = stats;
+        console.log(
+            `[PageLoad] ttfb=${stats.ttfbMs}ms domReady=${stats.domReadyMs}ms load=${stats.loadMs}ms ` +
+            `html=${stats.htmlTransfer}B assets=${stats.assets} transfer=${stats.assetTransfer}B ` +
+            `(encoded ${stats.assetEncoded}B / decoded ${stats.assetDecoded}B) cached=${stats.cached} revalidated=${stats.revalidated}`
+        );
+    }, 0);
+});
+
 // DOM 로드 후 실행
 document.addEventListener("DOMContentLoaded", loadMenuAndSetMode);
 
@@ -5,6 +5,7 @@
  * ------------------------------------------------------
  * 기능 요약:
  * - /ws/chart WebSocket을 통한 실시간 차트 데이터 모니터링
+ *   (연결 시 binary frame 협상 → 미지원/버전 불일치 시 JSON fallback)
  * - /api/config 기반 초기 설정/프리셋 로딩 (Main 페이지와 동일 구조)
  * - /api/config/motion, /api/config/timing 메모리 패치
  * - /api/config/save 전체 저장 (Flash Flush) + Dirty 상태 버튼 표시
@@ -613,12 +614,25 @@
 
 	function initChartWebSocket() {
 		let ws = null;
+		// seq delta 누적 (연결마다 서버가 resync 전송)
+		const store = { recs: [], lastSeq: -1 };
+
+		function accumulate(recs, resync) {
+			if (typeof window.mergeChartSeq !== "function") return recs;
+			window.mergeChartSeq(store, recs, resync);
+			return store.recs;
+		}
 
 		function connect() {
 			const url = buildWsUrl();
 			ws = new WebSocket(url);
+			ws.binaryType = "arraybuffer";
 
 			ws.onopen = () => {
+				// binary frame 협상 (디코더 없으면 JSON 유지)
+				if (typeof window.decodeChartBin === "function") {
+					ws.send(JSON.stringify({ chartFmt: "bin", ver: window.G_CHART_BIN_VERSION }));
+				}
 				showLocalToast("WebSocket /ws/chart 연결 성공", "ok");
 				if (refreshLabel) {
 					refreshLabel.textContent = "✅ 실시간 차트 데이터 수신 중...";
@@ -626,12 +640,27 @@
 			};
 
 			ws.onmessage = (event) => {
-				if (paused) return;
 				try {
+					// binary frame (일시정지 중에도 누적은 유지 → seq 연속성 보장)
+					if (event.data instanceof ArrayBuffer) {
+						const frame = window.decodeChartBin(event.data);
+						if (!frame) return;
+						const all = accumulate(frame.recs, frame.full);
+						if (!paused) processChartData(all);
+						return;
+					}
+
 					const data = JSON.parse(event.data);
-					// 백엔드에서 { chart: [...] } 구조로 보낸다고 가정
-					if (data.chart && Array.isArray(data.chart)) {
-						processChartData(data.chart);
+					// 협상 ack
+					if (data.chartFmt) {
+						console.log(`[ChartT1] chart format=${data.chartFmt} (ver=${data.ver})`);
+						return;
+					}
+					// 백엔드 { sim: { chart: [...] } } (구버전 { chart: [...] } 호환)
+					const recs = (data.sim && data.sim.chart) || data.chart;
+					if (recs && Array.isArray(recs)) {
+						const all = accumulate(recs, !!(data.sim && data.sim.resync));
+						if (!paused) processChartData(all);
 					}
 				} catch (e) {
 					console.warn("[ChartT1] WS 데이터 파싱 오류:", e);
@@ -4,8 +4,8 @@
  * 모듈명 : Smart Nature Wind Dashboard UI Controller (v001, Backend v029 기준)
  * ------------------------------------------------------
  * 기능 요약:
- * - /ws/state WebSocket을 통한 실시간 풍속/PWM/상태 업데이트
- * - /ws/log WebSocket을 통한 실시간 로그 메시지 출력
+ * - /ws 다중화 socket 1개(state + logs topic 구독)로 실시간 풍속/PWM/상태 및 로그 출력
+ *   (P000_common_006.js openMuxSocket, 기존 /ws/state + /ws/log 2개 socket 대체)
  * - /api/control/profile/select 및 /api/control/profile/stop 으로 시뮬레이션 제어
  * - /api/state를 이용한 초기 상태 로드
  * - P000_common_006.js 의 showToast / 메뉴 로직과 공존
@@ -203,111 +203,56 @@
     }
   }
 
-  // ======================= 5. WebSocket (state / log) =======================
+  // ======================= 5. WebSocket (/ws: state + logs) =======================
 
-  function initWsState() {
-    const url = buildWsUrl("/ws/state");
-    let ws;
+  // D10 로거 레벨 번호 → 표시 이름
+  const LOG_LEVEL_NAMES = ["NONE", "ERROR", "WARN", "INFO", "DEBUG"];
 
-    try {
-      ws = new WebSocket(url);
-    } catch (e) {
-      appendLog({
-        t: Date.now(),
-        level: "ERROR",
-        message: `WS State 연결 실패: ${e.message}`
-      });
-      return;
-    }
-
-    ws.onopen = () => {
-      appendLog({
-        t: Date.now(),
-        level: "INFO",
-        message: "WS State 연결 성공."
-      });
-    };
-
-    ws.onmessage = (event) => {
-      try {
-        const data = JSON.parse(event.data);
-        applyStateJson(data);
-      } catch (e) {
+  function initWsMux() {
+    window.openMuxSocket(buildWsUrl("/ws"), ["state", "logs"], {
+      open: () => {
+        appendLog({
+          t: Date.now(),
+          level: "INFO",
+          message: "WS 연결 성공 (state + logs)."
+        });
+      },
+      state: (data) => {
+        if (data) applyStateJson(data);
+      },
+      logs: (data) => {
+        // 백엔드 로그 형식: {ts, lv, msg}
+        if (!data || !data.msg) return;
+        appendLog({
+          t: Date.now(),
+          level: LOG_LEVEL_NAMES[data.lv] || "INFO",
+          message: data.msg
+        });
+      },
+      ctl: (msg) => {
+        if (msg.err) {
+          appendLog({
+            t: Date.now(),
+            level: "ERROR",
+            message: `WS 연결 거절: ${msg.err}`
+          });
+        }
+      },
+      close: () => {
+        appendLog({
+          t: Date.now(),
+          level: "WARN",
+          message: "WS 연결 끊김. 5초 후 재시도."
+        });
+      },
+      error: (e) => {
         appendLog({
           t: Date.now(),
           level: "ERROR",
-          message: `WS State 파싱 오류: ${e.message}`
+          message: `WS 오류: ${e.message || e}`
         });
       }
-    };
-
-    ws.onclose = () => {
-      appendLog({
-        t: Date.now(),
-        level: "WARN",
-        message: "WS State 연결 끊김. 5초 후 재시도."
-      });
-      setTimeout(initWsState, 5000);
-    };
-
-    ws.onerror = (e) => {
-      appendLog({
-        t: Date.now(),
-        level: "ERROR",
-        message: `WS State 오류: ${e.message || e}`
-      });
-    };
-  }
-
-  function initWsLog() {
-    const url = buildWsUrl("/ws/log");
-    let ws;
-
-    try {
-      ws = new WebSocket(url);
-    } catch (e) {
-      appendLog({
-        t: Date.now(),
-        level: "ERROR",
-        message: `WS Log 연결 실패: ${e.message}`
-      });
-      return;
-    }
-
-    ws.onopen = () => {
-      appendLog({
-        t: Date.now(),
-        level: "INFO",
-        message: "WS Log 연결 성공."
-      });
-    };
-
-    ws.onmessage = (event) => {
-      try {
-        // 백엔드에서 {t, level, message} JSON으로 보내준다고 가정
-        const data = JSON.parse(event.data);
-        appendLog(data);
-      } catch (e) {
-        // 로그 파싱 오류는 조용히 무시 (문자열 로그일 수도 있음)
-      }
-    };
-
-    ws.onclose = () => {
-      appendLog({
-        t: Date.now(),
-        level: "WARN",
-        message: "WS Log 연결 끊김."
-      });
-      // 복잡도 줄이기 위해 자동 재연결은 생략
-    };
-
-    ws.onerror = (e) => {
-      appendLog({
-        t: Date.now(),
-        level: "ERROR",
-        message: `WS Log 오류: ${e.message || e}`
-      });
-    };
+    });
   }
 
   // ======================= 6. 버튼 이벤트 (시뮬 제어 / 진단 / 로그) =======================
@@ -361,7 +306,6 @@
   document.addEventListener("DOMContentLoaded", () => {
     bindEvents();
     refreshInitialState();
-    initWsState();
-    initWsLog();
+    initWsMux();
   });
 })();
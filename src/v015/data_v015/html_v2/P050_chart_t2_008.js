@@ -5,6 +5,7 @@
  * ------------------------------------------------------
  * 기능 요약:
  * - 🎯 /ws/chart WebSocket을 통한 실시간 차트 데이터 모니터링 (T1과 동일 스키마)
+ *   (연결 시 binary frame 협상 → 미지원/버전 불일치 시 JSON fallback)
  * - 6개 Chart.js 차트에 풍속/파라미터/난류/이벤트/프리셋/타이밍 실시간 반영
  * - 일시정지/재개/줌 초기화 + 차트 접기 토글
  * - ⚠️ 설정 변경/저장 기능은 전혀 없음 (순수 모니터 페이지)
@@ -312,21 +313,49 @@
 
   // ======================= WebSocket 초기화 =======================
 
+  // seq delta 누적 (연결마다 서버가 resync 전송)
+  const chartStore = { recs: [], lastSeq: -1 };
+
+  function accumulate(recs, resync) {
+    if (typeof window.mergeChartSeq !== "function") return recs;
+    window.mergeChartSeq(chartStore, recs, resync);
+    return chartStore.recs;
+  }
+
   function initWebSocket() {
     const ws = new WebSocket(getWSUrl());
+    ws.binaryType = "arraybuffer";
 
     ws.onopen = () => {
+      // binary frame 협상 (디코더 없으면 JSON 유지)
+      if (typeof window.decodeChartBin === "function") {
+        ws.send(JSON.stringify({ chartFmt: "bin", ver: window.G_CHART_BIN_VERSION }));
+      }
       if (refreshLabel) refreshLabel.textContent = "✅ 실시간 차트 데이터 수신 중...";
       if (window.showToast) window.showToast("/ws/chart 연결 성공", "ok");
     };
 
     ws.onmessage = (event) => {
-      if (isPaused) return;
       try {
+        // binary frame (일시정지 중에도 누적은 유지 → seq 연속성 보장)
+        if (event.data instanceof ArrayBuffer) {
+          const frame = window.decodeChartBin(event.data);
+          if (!frame) return;
+          const all = accumulate(frame.recs, frame.full);
+          if (!isPaused) processChartRecords(all);
+          return;
+        }
+
         const data = JSON.parse(event.data);
-        if (Array.isArray(data.sim.chart)) {
+        // 협상 ack
+        if (data.chartFmt) {
+          console.log(`[ChartT2] chart format=${data.chartFmt} (ver=${data.ver})`);
+          return;
+        }
+        if (data.sim && Array.isArray(data.sim.chart)) {
         //if (Array.isArray(data.chart)) {
-          processChartRecords(data.sim.chart);
+          const all = accumulate(data.sim.chart, !!data.sim.resync);
+          if (!isPaused) processChartRecords(all);
         }
       } catch (e) {
         console.error("[ChartT2] WS 데이터 파싱 오류:", e);
@@ -0,0 +1,152 @@
+/*
+ * ------------------------------------------------------
+ * 소스명 : T10_BenchTurb_040.cpp
+ * 모듈약어 : T10
+ * 모듈명 : S10 calcTurb band 합성 host 벤치/정확도 검사
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - 동일 풍속 램프 + 동일 지터 입력으로 3가지 band 합성 비교
+ *   - base   : 원본 (매 tick band별 powf + sinf 12회)
+ *   - bucket : 0.05 m/s 풍속 bucket 계수 캐시 + sinf 12회 (bucket 중심 U 사용)
+ *   - cur    : S10_turbBandGain(L/σ 캐시) + S10_turbSynth(정확 U, sinf/cosf 1쌍)
+ * - 정확도: cur vs base 최대 절대오차 (허용 1e-4 · 합 진폭 규모) → 초과 시 exit 1
+ * - 속도: ns/tick 출력 (판정 없음, 참고 수치)
+ * ------------------------------------------------------
+ */
+
+#include <math.h>
+#include <stdio.h>
+
+#include <chrono>
+#include <vector>
+
+#include "S10_Simul_040.h"
+
+static const uint32_t G_T10_TURB_TICKS = 200000u;
+static const float	  G_T10_TURB_DT	   = 0.5f;	  // [s]
+static const float	  G_T10_TURB_L	   = 40.0f;	  // [m]
+static const float	  G_T10_TURB_SIGMA = 0.5f;	  // [m/s]
+
+typedef struct {
+	float U;
+	float phaseAcc;
+	float jitter[G_S10_TURB_BAND_COUNT];
+} ST_T10_TurbIn_t;
+
+// --------------------------------------------------
+// base: 원본 calcTurb band 합 (지터는 입력으로 고정)
+// --------------------------------------------------
+static float T10_turbBase(const ST_T10_TurbIn_t& p_in) {
+	const float v_L = G_T10_TURB_L, v_sigma = G_T10_TURB_SIGMA, v_U = p_in.U;
+	float		v_sum = 0.0f;
+	for (int v_i = 1; v_i <= 12; v_i++) {
+		const float v_n		= (float)v_i * 0.1f;
+		const float v_f		= v_n * v_U / v_L;
+		const float v_fLU	= v_f * v_L / v_U;
+		const float v_term	= 70.8f * v_fLU * v_fLU;
+		const float v_numer = 4.0f * v_sigma * v_sigma * (v_L / v_U) * (1.0f + v_term);
+		const float v_denom = powf(1.0f + v_term, 5.0f / 6.0f);
+		const float v_S		= (v_denom > 0.0f) ? (v_numer / v_denom) : 0.0f;
+		const float v_phase = p_in.phaseAcc * (float)v_i + 2.0f * (float)M_PI * v_f * G_T10_TURB_DT + p_in.jitter[v_i - 1];
+		v_sum += sqrtf(fmaxf(0.0f, 2.0f * v_S * 0.083f)) * sinf(v_phase);
+	}
+	return v_sum;
+}
+
+// --------------------------------------------------
+// bucket: 풍속 bucket 키 계수 캐시 (bucket 변경 시 12 band 재계산)
+// --------------------------------------------------
+typedef struct {
+	float	amp[G_S10_TURB_BAND_COUNT];
+	float	rate[G_S10_TURB_BAND_COUNT];
+	int32_t bucket = -1;
+	uint32_t rebuilds = 0;
+} ST_T10_TurbBucket_t;
+
+static float T10_turbBucket(const ST_T10_TurbIn_t& p_in, ST_T10_TurbBucket_t& p_c) {
+	const int32_t v_b = (int32_t)(p_in.U / 0.05f);
+	if (v_b != p_c.bucket) {
+		const float v_U = fmaxf(0.1f, ((float)v_b + 0.5f) * 0.05f);
+		for (uint8_t v_i = 0; v_i < G_S10_TURB_BAND_COUNT; v_i++) {
+			const float v_n		= (float)(v_i + 1) * 0.1f;
+			const float v_term	= 70.8f * v_n * v_n;
+			const float v_numer = 4.0f * G_T10_TURB_SIGMA * G_T10_TURB_SIGMA * (G_T10_TURB_L / v_U) * (1.0f + v_term);
+			const float v_S		= v_numer / powf(1.0f + v_term, 5.0f / 6.0f);
+			p_c.amp[v_i]		= sqrtf(fmaxf(0.0f, 2.0f * v_S * 0.083f));
+			p_c.rate[v_i]		= 2.0f * (float)M_PI * v_n * v_U / G_T10_TURB_L;
+		}
+		p_c.bucket = v_b;
+		p_c.rebuilds++;
+	}
+	float v_sum = 0.0f;
+	for (uint8_t v_i = 0; v_i < G_S10_TURB_BAND_COUNT; v_i++) {
+		v_sum += p_c.amp[v_i] * sinf(p_in.phaseAcc * (float)(v_i + 1) + p_c.rate[v_i] * G_T10_TURB_DT + p_in.jitter[v_i]);
+	}
+	return v_sum;
+}
+
+// --------------------------------------------------
+// cur: calcTurb 현재 구현과 동일 경로
+// --------------------------------------------------
+static float T10_turbCur(const ST_T10_TurbIn_t& p_in, const float* p_gain) {
+	const float v_phi = p_in.phaseAcc + 2.0f * (float)M_PI * G_S10_TURB_BAND_N_STEP * p_in.U * G_T10_TURB_DT / G_T10_TURB_L;
+	return S10_turbSynth(p_gain, p_in.U, v_phi, p_in.jitter);
+}
+
+template <typename T_fn>
+static double T10_benchNs(const std::vector<ST_T10_TurbIn_t>& p_in, std::vector<float>& p_out, T_fn p_fn) {
+	const auto v_t0 = std::chrono::steady_clock::now();
+	for (size_t v_i = 0; v_i < p_in.size(); v_i++) p_out[v_i] = p_fn(p_in[v_i]);
+	const auto v_t1 = std::chrono::steady_clock::now();
+	return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(v_t1 - v_t0).count() / (double)p_in.size();
+}
+
+int main() {
+	// 입력: 0.3 ~ 11 m/s 왕복 램프 (관성 추종 구간 모사) + 균일 지터
+	ST_A20_PrngState_t v_prng;
+	A20_prngSeed(v_prng, 99u);
+
+	std::vector<ST_T10_TurbIn_t> v_in(G_T10_TURB_TICKS);
+	float						 v_acc = 0.0f;
+	for (uint32_t v_t = 0; v_t < G_T10_TURB_TICKS; v_t++) {
+		const float v_ph = (float)v_t * 0.0005f;
+		v_in[v_t].U		 = 0.3f + 10.7f * 0.5f * (1.0f - cosf(v_ph));
+		v_in[v_t].phaseAcc = v_acc;
+		A20_randFillRange(v_prng, v_in[v_t].jitter, G_S10_TURB_BAND_COUNT, -0.1f, 0.1f);
+		v_acc += G_T10_TURB_DT * 0.5f;
+		if (v_acc > 2.0f * (float)M_PI) v_acc -= 2.0f * (float)M_PI;
+	}
+
+	std::vector<float> v_base(G_T10_TURB_TICKS), v_bkt(G_T10_TURB_TICKS), v_cur(G_T10_TURB_TICKS);
+
+	float v_gain[G_S10_TURB_BAND_COUNT];
+	S10_turbBandGain(G_T10_TURB_L, G_T10_TURB_SIGMA, v_gain);
+	ST_T10_TurbBucket_t v_bc;
+
+	double v_nsBase = 1e30, v_nsBkt = 1e30, v_nsCur = 1e30;
+	for (int v_rep = 0; v_rep < 5; v_rep++) {
+		v_bc.bucket = -1;
+		v_bc.rebuilds = 0;
+		v_nsBase	  = fmin(v_nsBase, T10_benchNs(v_in, v_base, [](const ST_T10_TurbIn_t& p) { return T10_turbBase(p); }));
+		v_nsBkt		  = fmin(v_nsBkt, T10_benchNs(v_in, v_bkt, [&](const ST_T10_TurbIn_t& p) { return T10_turbBucket(p, v_bc); }));
+		v_nsCur		  = fmin(v_nsCur, T10_benchNs(v_in, v_cur, [&](const ST_T10_TurbIn_t& p) { return T10_turbCur(p, v_gain); }));
+	}
+
+	double v_errCur = 0.0, v_errBkt = 0.0, v_peak = 0.0;
+	for (uint32_t v_t = 0; v_t < G_T10_TURB_TICKS; v_t++) {
+		v_errCur = fmax(v_errCur, fabs((double)v_cur[v_t] - (double)v_base[v_t]));
+		v_errBkt = fmax(v_errBkt, fabs((double)v_bkt[v_t] - (double)v_base[v_t]));
+		v_peak	 = fmax(v_peak, fabs((double)v_base[v_t]));
+	}
+
+	printf("calcTurb band synth, %lu ticks, U ramp 0.3..11 m/s (best of 5)\n", (unsigned long)G_T10_TURB_TICKS);
+	printf("  base   : %7.1f ns/tick\n", v_nsBase);
+	printf("  bucket : %7.1f ns/tick  rebuilds=%lu  max|err|=%.3e\n", v_nsBkt, (unsigned long)v_bc.rebuilds, v_errBkt);
+	printf("  cur    : %7.1f ns/tick  rebuilds=0  max|err|=%.3e  (peak |sum| %.3f)\n", v_nsCur, v_errCur, v_peak);
+
+	if (v_errCur > 1e-4 * fmax(1.0, v_peak)) {
+		fprintf(stderr, "[FAIL] cur deviates from base: %.3e\n", v_errCur);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,207 @@
+/*
+ * ------------------------------------------------------
+ * 소스명 : T10_HeadlessMain_040.cpp
+ * 모듈약어 : T10
+ * 모듈명 : Smart Nature Wind Headless 구동기 host CLI
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - CL_S10_HeadlessRunner host 진입점 (Linux 빌드: test/host/CMakeLists.txt)
+ *   - run   : preset×style 1조합 구동 → CSV/binary 출력 (stdout 또는 --out 파일)
+ *   - suite : preset×style 전체 프로파일 → 기준값 CSV 대비 회귀 검사 (drift 조합 있으면 exit 1)
+ *             --write 지정 시 기준값 CSV 생성 (stepsPerSec 열은 0: 벽시계 값이라 기준값에서 제외)
+ * - 사용 예
+ *   s10_headless run --dict data_v015/json/cfg_windDict_030.json --preset OCEAN --style BALANCE --dur 3600 --seed 7
+ *   s10_headless suite --dict data_v015/json/cfg_windDict_030.json --baseline test/host/baseline/s10_suite_baseline.csv
+ * ------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "S10_Headless_040.h"
+#include "T10_Host_040.h"
+
+// --------------------------------------------------
+// CLI 인자
+// --------------------------------------------------
+typedef struct {
+	const char*			 cmd;
+	const char*			 dict;
+	const char*			 preset;
+	const char*			 style;
+	const char*			 out;
+	const char*			 baseline;
+	const char*			 write;
+	ST_S10_HeadlessOpt_t opt;
+} ST_T10_HeadlessArgs_t;
+
+static void T10_usage() {
+	fprintf(stderr,
+			"usage: s10_headless run --dict <path> --preset <code> [--style <code>]\n"
+			"                        [--dur <s>] [--step <ms>] [--sample <ms>] [--seed <u32>]\n"
+			"                        [--fmt csv|bin] [--out <path>]\n"
+			"       s10_headless suite --dict <path> (--baseline <csv> | --write <csv>)\n"
+			"                        [--dur <s>] [--step <ms>] [--seed <u32>] [--out <report>]\n");
+}
+
+static bool T10_parseArgs(int p_argc, char** p_argv, ST_T10_HeadlessArgs_t& p_args) {
+	memset(&p_args, 0, sizeof(p_args));
+	CL_S10_HeadlessRunner::defaultOpt(p_args.opt);
+	p_args.style = "";
+
+	if (p_argc < 2) return false;
+	p_args.cmd = p_argv[1];
+
+	for (int v_i = 2; v_i < p_argc; v_i++) {
+		const char* v_key = p_argv[v_i];
+		if (v_i + 1 >= p_argc) {
+			fprintf(stderr, "[T10] missing value: %s\n", v_key);
+			return false;
+		}
+		const char* v_val = p_argv[++v_i];
+
+		if (strcmp(v_key, "--dict") == 0) p_args.dict = v_val;
+		else if (strcmp(v_key, "--preset") == 0) p_args.preset = v_val;
+		else if (strcmp(v_key, "--style") == 0) p_args.style = v_val;
+		else if (strcmp(v_key, "--out") == 0) p_args.out = v_val;
+		else if (strcmp(v_key, "--baseline") == 0) p_args.baseline = v_val;
+		else if (strcmp(v_key, "--write") == 0) p_args.write = v_val;
+		else if (strcmp(v_key, "--dur") == 0) p_args.opt.durationSec = (uint32_t)strtoul(v_val, nullptr, 10);
+		else if (strcmp(v_key, "--step") == 0) p_args.opt.stepMs = (uint32_t)strtoul(v_val, nullptr, 10);
+		else if (strcmp(v_key, "--sample") == 0) p_args.opt.sampleMs = (uint32_t)strtoul(v_val, nullptr, 10);
+		else if (strcmp(v_key, "--seed") == 0) p_args.opt.seed = (uint32_t)strtoul(v_val, nullptr, 10);
+		else if (strcmp(v_key, "--fmt") == 0) {
+			if (strcmp(v_val, "csv") == 0) p_args.opt.format = EN_S10_HEADLESS_FMT_CSV;
+			else if (strcmp(v_val, "bin") == 0) p_args.opt.format = EN_S10_HEADLESS_FMT_BIN;
+			else {
+				fprintf(stderr, "[T10] unknown --fmt: %s\n", v_val);
+				return false;
+			}
+		} else {
+			fprintf(stderr, "[T10] unknown option: %s\n", v_key);
+			return false;
+		}
+	}
+	return p_args.dict != nullptr;
+}
+
+// --------------------------------------------------
+// run
+// --------------------------------------------------
+static int T10_cmdRun(const ST_T10_HeadlessArgs_t& p_args, const ST_A20_WindProfileDict_t& p_dict) {
+	if (!p_args.preset) {
+		fprintf(stderr, "[T10] run: --preset required\n");
+		return 2;
+	}
+
+	FILE* v_fp = stdout;
+	if (p_args.out) {
+		v_fp = fopen(p_args.out, "wb");
+		if (!v_fp) {
+			fprintf(stderr, "[T10] cannot open %s\n", p_args.out);
+			return 2;
+		}
+	}
+
+	HostFilePrint  v_out(v_fp);
+	const uint32_t v_n = CL_S10_HeadlessRunner::runPreset(p_dict, p_args.preset, p_args.style, p_args.opt, v_out);
+	if (v_fp != stdout) fclose(v_fp);
+
+	fprintf(stderr, "[T10] run %s/%s seed=%lu records=%lu\n", p_args.preset, p_args.style, (unsigned long)p_args.opt.seed, (unsigned long)v_n);
+	return v_n > 0 ? 0 : 1;
+}
+
+// --------------------------------------------------
+// suite
+// --------------------------------------------------
+static const uint16_t G_T10_SUITE_MAX = A20_Const::WIND_PRESETS_MAX * A20_Const::WIND_STYLES_MAX;
+
+static uint16_t T10_loadBaseline(const char* p_path, ST_S10_WindProfileStat_t* p_out, uint16_t p_cap) {
+	FILE* v_fp = fopen(p_path, "r");
+	if (!v_fp) return 0;
+	char	 v_line[512];
+	uint16_t v_n = 0;
+	while (v_n < p_cap && fgets(v_line, sizeof(v_line), v_fp)) {
+		if (CL_S10_HeadlessRunner::statFromCsv(v_line, p_out[v_n])) v_n++;
+	}
+	fclose(v_fp);
+	return v_n;
+}
+
+static int T10_cmdSuite(const ST_T10_HeadlessArgs_t& p_args, const ST_A20_WindProfileDict_t& p_dict) {
+	if (!p_args.baseline && !p_args.write) {
+		fprintf(stderr, "[T10] suite: --baseline or --write required\n");
+		return 2;
+	}
+
+	static ST_S10_WindProfileStat_t s_base[G_T10_SUITE_MAX];
+	static ST_S10_WindProfileStat_t s_cur[G_T10_SUITE_MAX];
+	uint16_t						v_baseCount = 0;
+	if (p_args.baseline) {
+		v_baseCount = T10_loadBaseline(p_args.baseline, s_base, G_T10_SUITE_MAX);
+		if (v_baseCount == 0u) {
+			fprintf(stderr, "[T10] suite: baseline empty or missing: %s\n", p_args.baseline);
+			return 2;
+		}
+	}
+
+	FILE* v_fp = stdout;
+	if (p_args.out) {
+		v_fp = fopen(p_args.out, "w");
+		if (!v_fp) {
+			fprintf(stderr, "[T10] cannot open %s\n", p_args.out);
+			return 2;
+		}
+	}
+
+	ST_S10_ProfileTol_t v_tol;
+	CL_S10_HeadlessRunner::defaultTol(v_tol);
+
+	HostFilePrint  v_report(v_fp);
+	const uint16_t v_fail  = CL_S10_HeadlessRunner::runSuite(p_dict, p_args.opt, p_args.baseline ? s_base : nullptr, v_baseCount, v_tol, v_report, s_cur, G_T10_SUITE_MAX);
+	const uint16_t v_total = (uint16_t)(p_dict.presetCount * p_dict.styleCount);
+	if (v_fp != stdout) fclose(v_fp);
+
+	if (p_args.write) {
+		FILE* v_wf = fopen(p_args.write, "w");
+		if (!v_wf) {
+			fprintf(stderr, "[T10] cannot open %s\n", p_args.write);
+			return 2;
+		}
+		HostFilePrint v_w(v_wf);
+		v_w.printf("# s10_headless suite baseline: dur=%lu step=%lu seed=%lu (regenerate with --write)\n",
+				   (unsigned long)p_args.opt.durationSec,
+				   (unsigned long)p_args.opt.stepMs,
+				   (unsigned long)p_args.opt.seed);
+		v_w.print(G_S10_PROFILE_CSV_HEADER);
+		for (uint16_t v_i = 0; v_i < v_total && v_i < G_T10_SUITE_MAX; v_i++) {
+			ST_S10_WindProfileStat_t v_st = s_cur[v_i];
+			v_st.stepsPerSec			  = 0.0f;
+			CL_S10_HeadlessRunner::statToCsv(v_st, EN_S10_DRIFT_NONE, v_w);
+		}
+		fclose(v_wf);
+		fprintf(stderr, "[T10] suite: baseline written (%u rows) -> %s\n", (unsigned)v_total, p_args.write);
+	}
+
+	if (!p_args.baseline) return 0;
+	fprintf(stderr, "[T10] suite: %u/%u combination(s) drifted\n", (unsigned)v_fail, (unsigned)v_total);
+	return v_fail == 0u ? 0 : 1;
+}
+
+int main(int p_argc, char** p_argv) {
+	ST_T10_HeadlessArgs_t v_args;
+	if (!T10_parseArgs(p_argc, p_argv, v_args)) {
+		T10_usage();
+		return 2;
+	}
+
+	static ST_A20_WindProfileDict_t s_dict;
+	if (!T10_loadWindDict(v_args.dict, s_dict)) return 2;
+
+	if (strcmp(v_args.cmd, "run") == 0) return T10_cmdRun(v_args, s_dict);
+	if (strcmp(v_args.cmd, "suite") == 0) return T10_cmdSuite(v_args, s_dict);
+
+	T10_usage();
+	return 2;
+}
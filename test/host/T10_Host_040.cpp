@@ -0,0 +1,288 @@
+/*
+ * ------------------------------------------------------
+ * 소스명 : T10_Host_040.cpp
+ * 모듈약어 : T10
+ * 모듈명 : Smart Nature Wind host 테스트/벤치 하네스 공용부
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - firmware 외부 심볼 host 정의
+ *   - g_A20_config_root : 전 섹션 nullptr (S10은 motion/system 미로드 시 기본 정책 사용)
+ *   - CT10_markDirtyFromSim : no-op (host에는 WS 송신 경로 없음)
+ *   - CL_D10_Logger::broadcastLog : no-op (실기 구현은 D10_Logger_040.cpp)
+ * - 최소 JSON 파서 / cfg_windDict 로더 구현
+ * ------------------------------------------------------
+ */
+
+#include "T10_Host_040.h"
+
+#include <ctype.h>
+#include <stdlib.h>
+
+#include "D10_Logger_040.h"
+
+// ======================================================
+// firmware 외부 심볼 (host 대체)
+// ======================================================
+ST_A20_ConfigRoot_t g_A20_config_root = {};
+uint32_t			g_T10_failCount	  = 0;
+
+void CT10_markDirtyFromSim(const char* p_key) {
+	(void)p_key;
+}
+
+void CL_D10_Logger::broadcastLog(EN_L10_LogLevel_t p_level, const char* p_msg) {
+	(void)p_level;
+	(void)p_msg;
+}
+
+// ======================================================
+// JSON DOM
+// ======================================================
+const ST_T10_JsonVal_t* ST_T10_JsonVal_t::get(const char* p_key) const {
+	if (type != EN_T10_JSON_OBJ) return nullptr;
+	for (const auto& v_kv : obj) {
+		if (v_kv.first == p_key) return &v_kv.second;
+	}
+	return nullptr;
+}
+
+float ST_T10_JsonVal_t::numOr(const char* p_key, float p_def) const {
+	const ST_T10_JsonVal_t* v_v = get(p_key);
+	return (v_v && v_v->type == EN_T10_JSON_NUM) ? (float)v_v->num : p_def;
+}
+
+const char* ST_T10_JsonVal_t::strOr(const char* p_key, const char* p_def) const {
+	const ST_T10_JsonVal_t* v_v = get(p_key);
+	return (v_v && v_v->type == EN_T10_JSON_STR) ? v_v->str.c_str() : p_def;
+}
+
+bool T10_readFile(const char* p_path, std::string& p_out) {
+	FILE* v_fp = fopen(p_path, "rb");
+	if (!v_fp) return false;
+	char   v_buf[4096];
+	size_t v_n = 0;
+	p_out.clear();
+	while ((v_n = fread(v_buf, 1, sizeof(v_buf), v_fp)) > 0) p_out.append(v_buf, v_n);
+	fclose(v_fp);
+	return true;
+}
+
+// --------------------------------------------------
+// 재귀 하강 파서 (UTF-8 통과, \\uXXXX는 BMP만 UTF-8 변환)
+// --------------------------------------------------
+namespace {
+struct ST_T10_JsonCursor_t {
+	const char* p;
+	const char* end;
+
+	void skipWs() {
+		while (p < end && isspace((unsigned char)*p)) p++;
+	}
+	bool lit(const char* p_word) {
+		const size_t v_n = strlen(p_word);
+		if ((size_t)(end - p) < v_n || strncmp(p, p_word, v_n) != 0) return false;
+		p += v_n;
+		return true;
+	}
+};
+
+bool T10_parseValue(ST_T10_JsonCursor_t& p_c, ST_T10_JsonVal_t& p_out, uint8_t p_depth);
+
+bool T10_parseString(ST_T10_JsonCursor_t& p_c, std::string& p_out) {
+	if (p_c.p >= p_c.end || *p_c.p != '"') return false;
+	p_c.p++;
+	p_out.clear();
+	while (p_c.p < p_c.end && *p_c.p != '"') {
+		char v_ch = *p_c.p++;
+		if (v_ch != '\\') {
+			p_out.push_back(v_ch);
+			continue;
+		}
+		if (p_c.p >= p_c.end) return false;
+		v_ch = *p_c.p++;
+		switch (v_ch) {
+			case 'n': p_out.push_back('\n'); break;
+			case 't': p_out.push_back('\t'); break;
+			case 'r': p_out.push_back('\r'); break;
+			case 'b': p_out.push_back('\b'); break;
+			case 'f': p_out.push_back('\f'); break;
+			case 'u': {
+				if (p_c.end - p_c.p < 4) return false;
+				char v_hex[5] = { p_c.p[0], p_c.p[1], p_c.p[2], p_c.p[3], 0 };
+				p_c.p += 4;
+				const unsigned v_cp = (unsigned)strtoul(v_hex, nullptr, 16);
+				if (v_cp < 0x80u) {
+					p_out.push_back((char)v_cp);
+				} else if (v_cp < 0x800u) {
+					p_out.push_back((char)(0xC0u | (v_cp >> 6)));
+					p_out.push_back((char)(0x80u | (v_cp & 0x3Fu)));
+				} else {
+					p_out.push_back((char)(0xE0u | (v_cp >> 12)));
+					p_out.push_back((char)(0x80u | ((v_cp >> 6) & 0x3Fu)));
+					p_out.push_back((char)(0x80u | (v_cp & 0x3Fu)));
+				}
+				break;
+			}
+			default: p_out.push_back(v_ch); break;
+		}
+	}
+	if (p_c.p >= p_c.end) return false;
+	p_c.p++;
+	return true;
+}
+
+bool T10_parseValue(ST_T10_JsonCursor_t& p_c, ST_T10_JsonVal_t& p_out, uint8_t p_depth) {
+	if (p_depth > ARDUINOJSON_DEFAULT_NESTING_LIMIT) return false;
+	p_c.skipWs();
+	if (p_c.p >= p_c.end) return false;
+
+	const char v_ch = *p_c.p;
+	if (v_ch == '{') {
+		p_out.type = ST_T10_JsonVal_t::EN_T10_JSON_OBJ;
+		p_c.p++;
+		p_c.skipWs();
+		if (p_c.p < p_c.end && *p_c.p == '}') {
+			p_c.p++;
+			return true;
+		}
+		for (;;) {
+			p_c.skipWs();
+			std::string v_key;
+			if (!T10_parseString(p_c, v_key)) return false;
+			p_c.skipWs();
+			if (p_c.p >= p_c.end || *p_c.p != ':') return false;
+			p_c.p++;
+			p_out.obj.emplace_back(v_key, ST_T10_JsonVal_t());
+			if (!T10_parseValue(p_c, p_out.obj.back().second, (uint8_t)(p_depth + 1))) return false;
+			p_c.skipWs();
+			if (p_c.p < p_c.end && *p_c.p == ',') {
+				p_c.p++;
+				continue;
+			}
+			if (p_c.p < p_c.end && *p_c.p == '}') {
+				p_c.p++;
+				return true;
+			}
+			return false;
+		}
+	}
+	if (v_ch == '[') {
+		p_out.type = ST_T10_JsonVal_t::EN_T10_JSON_ARR;
+		p_c.p++;
+		p_c.skipWs();
+		if (p_c.p < p_c.end && *p_c.p == ']') {
+			p_c.p++;
+			return true;
+		}
+		for (;;) {
+			p_out.arr.emplace_back();
+			if (!T10_parseValue(p_c, p_out.arr.back(), (uint8_t)(p_depth + 1))) return false;
+			p_c.skipWs();
+			if (p_c.p < p_c.end && *p_c.p == ',') {
+				p_c.p++;
+				continue;
+			}
+			if (p_c.p < p_c.end && *p_c.p == ']') {
+				p_c.p++;
+				return true;
+			}
+			return false;
+		}
+	}
+	if (v_ch == '"') {
+		p_out.type = ST_T10_JsonVal_t::EN_T10_JSON_STR;
+		return T10_parseString(p_c, p_out.str);
+	}
+	if (p_c.lit("true")) {
+		p_out.type = ST_T10_JsonVal_t::EN_T10_JSON_BOOL;
+		p_out.b	   = true;
+		return true;
+	}
+	if (p_c.lit("false")) {
+		p_out.type = ST_T10_JsonVal_t::EN_T10_JSON_BOOL;
+		return true;
+	}
+	if (p_c.lit("null")) {
+		return true;
+	}
+
+	char* v_endp = nullptr;
+	p_out.num	 = strtod(p_c.p, &v_endp);
+	if (v_endp == p_c.p) return false;
+	p_out.type = ST_T10_JsonVal_t::EN_T10_JSON_NUM;
+	p_c.p	   = v_endp;
+	return true;
+}
+}  // namespace
+
+bool T10_jsonParse(const std::string& p_text, ST_T10_JsonVal_t& p_out) {
+	ST_T10_JsonCursor_t v_c{ p_text.data(), p_text.data() + p_text.size() };
+	p_out = ST_T10_JsonVal_t();
+	if (!T10_parseValue(v_c, p_out, 0)) return false;
+	v_c.skipWs();
+	return v_c.p == v_c.end;
+}
+
+// ======================================================
+// cfg_windDict 로더 (C10 loadWindProfileDict / C10_fromJson_WindPreset 대응)
+// ======================================================
+bool T10_loadWindDict(const char* p_path, ST_A20_WindProfileDict_t& p_dict) {
+	std::string		 v_text;
+	ST_T10_JsonVal_t v_root;
+	if (!T10_readFile(p_path, v_text) || !T10_jsonParse(v_text, v_root)) {
+		fprintf(stderr, "[T10] windDict load failed: %s\n", p_path);
+		return false;
+	}
+
+	const ST_T10_JsonVal_t* v_wd = v_root.get("windDict");
+	if (!v_wd) return false;
+	const ST_T10_JsonVal_t* v_ps = v_wd->get("presets");
+	const ST_T10_JsonVal_t* v_ss = v_wd->get("styles");
+	if (!v_ps || !v_ss) return false;
+
+	memset(&p_dict, 0, sizeof(p_dict));
+
+	for (const ST_T10_JsonVal_t& v_js : v_ps->arr) {
+		if (p_dict.presetCount >= A20_Const::WIND_PRESETS_MAX) break;
+		ST_A20_PresetEntry_t& v_p = p_dict.presets[p_dict.presetCount++];
+		strlcpy(v_p.name, v_js.strOr("name", ""), sizeof(v_p.name));
+		strlcpy(v_p.code, v_js.strOr("code", ""), sizeof(v_p.code));
+
+		static const ST_T10_JsonVal_t s_empty;
+		const ST_T10_JsonVal_t*		  v_b = v_js.get("base");
+		if (!v_b) v_b = &s_empty;
+
+		v_p.base.windIntensity			  = v_b->numOr("windIntensity", 70.0f);
+		v_p.base.gustFrequency			  = v_b->numOr("gustFrequency", 40.0f);
+		v_p.base.windVariability		  = v_b->numOr("windVariability", 50.0f);
+		v_p.base.fanLimit				  = v_b->numOr("fanLimit", 95.0f);
+		v_p.base.minFan					  = v_b->numOr("minFan", 10.0f);
+		v_p.base.turbulenceLengthScale	  = v_b->numOr("turbulenceLengthScale", 40.0f);
+		v_p.base.turbulenceIntensitySigma = v_b->numOr("turbulenceIntensitySigma", 0.5f);
+		v_p.base.thermalBubbleStrength	  = v_b->numOr("thermalBubbleStrength", 2.0f);
+		v_p.base.thermalBubbleRadius	  = v_b->numOr("thermalBubbleRadius", 18.0f);
+
+		v_p.base.baseMinWind			  = v_b->numOr("baseMinWind", 1.8f);
+		v_p.base.baseMaxWind			  = v_b->numOr("baseMaxWind", 5.5f);
+		v_p.base.gustProbBase			  = v_b->numOr("gustProbBase", 0.040f);
+		v_p.base.gustStrengthMax		  = v_b->numOr("gustStrengthMax", 2.10f);
+		v_p.base.thermalFreqBase		  = v_b->numOr("thermalFreqBase", 0.022f);
+	}
+
+	for (const ST_T10_JsonVal_t& v_js : v_ss->arr) {
+		if (p_dict.styleCount >= A20_Const::WIND_STYLES_MAX) break;
+		ST_A20_StyleEntry_t& v_s = p_dict.styles[p_dict.styleCount++];
+		strlcpy(v_s.name, v_js.strOr("name", ""), sizeof(v_s.name));
+		strlcpy(v_s.code, v_js.strOr("code", ""), sizeof(v_s.code));
+
+		static const ST_T10_JsonVal_t s_empty;
+		const ST_T10_JsonVal_t*		  v_f = v_js.get("factors");
+		if (!v_f) v_f = &s_empty;
+
+		v_s.factors.intensityFactor	  = v_f->numOr("intensityFactor", 1.0f);
+		v_s.factors.variabilityFactor = v_f->numOr("variabilityFactor", 1.0f);
+		v_s.factors.gustFactor		  = v_f->numOr("gustFactor", 1.0f);
+		v_s.factors.thermalFactor	  = v_f->numOr("thermalFactor", 1.0f);
+	}
+	return true;
+}
@@ -0,0 +1,70 @@
+#pragma once
+/*
+ * ------------------------------------------------------
+ * 소스명 : T10_Host_040.h
+ * 모듈약어 : T10
+ * 모듈명 : Smart Nature Wind host 테스트/벤치 하네스 공용부
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - firmware 전역/외부 심볼의 host 대체 정의 (g_A20_config_root, CT10 dirty bridge, D10 WS 송출)
+ * - 최소 JSON DOM 파서 (host 전용: ArduinoJson 미포함 환경에서 cfg_windDict 로드)
+ * - cfg_windDict_xxx.json → ST_A20_WindProfileDict_t 로드 (C10_fromJson_WindPreset 기본값과 동일)
+ * - 테스트 결과 출력 helper (T10_CHECK)
+ * ------------------------------------------------------
+ * [코드 네이밍 규칙]
+ * - 전역 상수,매크로      : G_모듈약어_ 접두사
+ * - 전역 변수             : g_모듈약어_ 접두사
+ * - 전역 함수             : 모듈약어_ 접두사
+ * - 구조체                : ST_모듈약어_ 접미사
+ * - 함수 로컬 변수        : v_ 접두사
+ * - 함수 인자             : p_ 접두사
+ * ------------------------------------------------------
+ */
+
+#include <stdio.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "A20_Const_041.h"
+
+// ======================================================
+// 최소 JSON DOM (null/bool/number/string/array/object)
+// ======================================================
+typedef struct ST_T10_JsonVal_t {
+	enum EN_T10_jsonType_t : uint8_t { EN_T10_JSON_NULL = 0, EN_T10_JSON_BOOL, EN_T10_JSON_NUM, EN_T10_JSON_STR, EN_T10_JSON_ARR, EN_T10_JSON_OBJ };
+
+	EN_T10_jsonType_t										type = EN_T10_JSON_NULL;
+	bool													b	 = false;
+	double													num	 = 0.0;
+	std::string												str;
+	std::vector<ST_T10_JsonVal_t>							arr;
+	std::vector<std::pair<std::string, ST_T10_JsonVal_t>> obj;
+
+	// object member 검색 (없으면 nullptr)
+	const ST_T10_JsonVal_t* get(const char* p_key) const;
+	float					numOr(const char* p_key, float p_def) const;
+	const char*				strOr(const char* p_key, const char* p_def) const;
+} ST_T10_JsonVal_t;
+
+bool T10_readFile(const char* p_path, std::string& p_out);
+bool T10_jsonParse(const std::string& p_text, ST_T10_JsonVal_t& p_out);
+
+// cfg_windDict_xxx.json 로드 (presets/styles 최대 A20_Const::WIND_*_MAX)
+bool T10_loadWindDict(const char* p_path, ST_A20_WindProfileDict_t& p_dict);
+
+// ======================================================
+// 테스트 판정 helper
+// ======================================================
+extern uint32_t g_T10_failCount;
+
+#define T10_CHECK(p_cond, ...)                                  \
+	do {                                                        \
+		if (!(p_cond)) {                                        \
+			g_T10_failCount++;                                  \
+			fprintf(stderr, "[FAIL] %s:%d: ", __FILE__, __LINE__); \
+			fprintf(stderr, __VA_ARGS__);                       \
+			fputc('\n', stderr);                                \
+		}                                                       \
+	} while (0)
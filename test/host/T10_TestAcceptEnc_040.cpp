@@ -0,0 +1,66 @@
+/*
+ * ------------------------------------------------------
+ * 소스명 : T10_TestAcceptEnc_040.cpp
+ * 모듈약어 : T10
+ * 모듈명 : W10 Accept-Encoding gzip 협상 host 테스트
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - W10_acceptEncodingGzip: 헤더 값 표 → 기대 판정 (q=0 거부, "*" fallback, 명시 항목 우선,
+ *   부분 문자열/대소문자/공백/기타 파라미터/형식 오류)
+ * - 이전 판정(indexOf("gzip") >= 0)과 달라지는 케이스 수 보고
+ * ------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "T10_Host_040.h"
+#include "W10_Web_AcceptEnc_051.h"
+
+typedef struct {
+	const char* hdr;
+	bool		gzip;
+} ST_T10_AeCase_t;
+
+static const ST_T10_AeCase_t G_T10_AE_CASES[] = {
+	{ "gzip", true },
+	{ "gzip, deflate, br", true },
+	{ "br;q=1.0, gzip;q=0.8, *;q=0.1", true },
+	{ "GZIP;Q=1", true },
+	{ "x-gzip", true },
+	{ "gzip ; q=0.001", true },
+	{ "deflate;level=1;q=0.5, gzip;foo=bar", true },
+	{ "*", true },
+	{ "identity, *;q=0.5", true },
+	{ "gzip;q=0", false },
+	{ "gzip;q=0.000", false },
+	{ "gzip; q=0, deflate", false },
+	{ "br, gzip;q=0, *", false },
+	{ "*;q=0", false },
+	{ "gzip;q=abc", false },
+	{ "gzip;q=1.5", false },
+	{ "gzipx", false },
+	{ "br, x-gzipped", false },
+	{ "deflate, br", false },
+	{ "identity", false },
+	{ "", false },
+	{ nullptr, false },
+};
+
+int main() {
+	uint32_t v_changed = 0;
+
+	for (const ST_T10_AeCase_t& v_c : G_T10_AE_CASES) {
+		const bool v_got = W10_acceptEncodingGzip(v_c.hdr);
+		T10_CHECK(v_got == v_c.gzip, "\"%s\": gzip=%d expected %d", v_c.hdr ? v_c.hdr : "(null)", (int)v_got, (int)v_c.gzip);
+
+		const bool v_old = v_c.hdr && strstr(v_c.hdr, "gzip") != nullptr;
+		if (v_old != v_c.gzip) v_changed++;
+	}
+
+	fprintf(stderr, "[T10] accept-encoding: cases=%zu changedFromIndexOf=%lu fail=%lu\n",
+			sizeof(G_T10_AE_CASES) / sizeof(G_T10_AE_CASES[0]),
+			(unsigned long)v_changed,
+			(unsigned long)g_T10_failCount);
+	return g_T10_failCount == 0u ? 0 : 1;
+}
@@ -0,0 +1,199 @@
+/*
+ * ------------------------------------------------------
+ * 소스명 : T10_TestHeadless_040.cpp
+ * 모듈약어 : T10
+ * 모듈명 : CL_S10_HeadlessRunner host 테스트
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - 동일 seed 재현성 (CSV/binary byte 일치), seed 변경 시 계열 변화
+ * - record 수 / binary header 필드 / sampleMs 정렬
+ * - 인스턴스 전용 PRNG: 전역 g_A20_prng 상태 불변
+ * - 프로파일 CSV 왕복(statToCsv/statFromCsv) + 기준값 변조 시 checkDrift 검출
+ * - S20 ResolvedWind 캐시: Key/Lookup/Insert 분리 경로 == 직접 해석, 중복 Insert 시 슬롯 1개
+ * - 인자: argv[1] = cfg_windDict_xxx.json 경로
+ * ------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+
+#include "S10_Headless_040.h"
+#include "S20_WindSolver_040.h"
+#include "T10_Host_040.h"
+
+// std::string 누적 Print (메모리 내 비교용)
+class CL_T10_StrPrint : public Print {
+  public:
+	size_t write(uint8_t p_c) override {
+		buf.push_back((char)p_c);
+		return 1;
+	}
+	size_t write(const uint8_t* p_buf, size_t p_len) override {
+		buf.append((const char*)p_buf, p_len);
+		return p_len;
+	}
+
+	std::string buf;
+};
+
+static ST_A20_WindProfileDict_t s_dict;
+
+static void T10_testDeterminism() {
+	ST_S10_HeadlessOpt_t v_opt;
+	CL_S10_HeadlessRunner::defaultOpt(v_opt);
+	v_opt.durationSec = 900u;
+	v_opt.seed		  = 7u;
+
+	CL_T10_StrPrint v_a, v_b, v_c;
+	const uint32_t	v_na = CL_S10_HeadlessRunner::runPreset(s_dict, "OCEAN", "BALANCE", v_opt, v_a);
+	const uint32_t	v_nb = CL_S10_HeadlessRunner::runPreset(s_dict, "OCEAN", "BALANCE", v_opt, v_b);
+	v_opt.seed			 = 8u;
+	const uint32_t	v_nc = CL_S10_HeadlessRunner::runPreset(s_dict, "OCEAN", "BALANCE", v_opt, v_c);
+
+	T10_CHECK(v_na == 900u, "record count %lu != 900", (unsigned long)v_na);
+	T10_CHECK(v_na == v_nb && v_nb == v_nc, "record count mismatch");
+	T10_CHECK(v_a.buf == v_b.buf, "same seed produced different CSV");
+	T10_CHECK(v_a.buf != v_c.buf, "different seed produced identical CSV");
+}
+
+static void T10_testBinary() {
+	ST_S10_HeadlessOpt_t v_opt;
+	CL_S10_HeadlessRunner::defaultOpt(v_opt);
+	v_opt.durationSec = 60u;
+	v_opt.stepMs	  = 100u;
+	v_opt.sampleMs	  = 250u;  // stepMs 배수로 내림 정렬 → 200
+	v_opt.seed		  = 3u;
+	v_opt.format	  = EN_S10_HEADLESS_FMT_BIN;
+
+	CL_T10_StrPrint v_out;
+	const uint32_t	v_n = CL_S10_HeadlessRunner::runPreset(s_dict, "MOUNTAIN", "ACTIVE", v_opt, v_out);
+
+	T10_CHECK(v_n == 300u, "bin record count %lu != 300", (unsigned long)v_n);
+	T10_CHECK(v_out.buf.size() == sizeof(ST_S10_HeadlessBinHdr_t) + (size_t)v_n * sizeof(ST_S10_HeadlessRec_t), "bin size %zu", v_out.buf.size());
+	if (v_out.buf.size() < sizeof(ST_S10_HeadlessBinHdr_t)) return;
+
+	ST_S10_HeadlessBinHdr_t v_hdr;
+	memcpy(&v_hdr, v_out.buf.data(), sizeof(v_hdr));
+	T10_CHECK(v_hdr.magic == G_S10_HEADLESS_BIN_MAGIC, "bin magic");
+	T10_CHECK(v_hdr.recSize == sizeof(ST_S10_HeadlessRec_t), "bin recSize");
+	T10_CHECK(v_hdr.seed == 3u && v_hdr.stepMs == 100u && v_hdr.sampleMs == 200u, "bin hdr seed/step/sample");
+	T10_CHECK(v_hdr.count == v_n, "bin hdr count");
+
+	ST_S10_HeadlessRec_t v_last;
+	memcpy(&v_last, v_out.buf.data() + v_out.buf.size() - sizeof(v_last), sizeof(v_last));
+	T10_CHECK(v_last.tMs == 60000u, "last tMs %lu", (unsigned long)v_last.tMs);
+}
+
+static void T10_testGlobalPrngUntouched() {
+	A20_prngSeed(g_A20_prng, 12345u);
+	const ST_A20_PrngState_t v_before = g_A20_prng;
+
+	ST_S10_HeadlessOpt_t v_opt;
+	CL_S10_HeadlessRunner::defaultOpt(v_opt);
+	v_opt.durationSec = 120u;
+
+	CL_T10_StrPrint v_out;
+	CL_S10_HeadlessRunner::runPreset(s_dict, "PLAINS", "RELAX", v_opt, v_out);
+
+	T10_CHECK(memcmp(&v_before, &g_A20_prng, sizeof(v_before)) == 0, "headless run consumed global g_A20_prng");
+}
+
+static void T10_testUnknownPreset() {
+	ST_S10_HeadlessOpt_t v_opt;
+	CL_S10_HeadlessRunner::defaultOpt(v_opt);
+	CL_T10_StrPrint v_out;
+	T10_CHECK(CL_S10_HeadlessRunner::runPreset(s_dict, "NO_SUCH", "BALANCE", v_opt, v_out) == 0u, "unknown preset must fail");
+}
+
+static void T10_testProfileCsvDrift() {
+	ST_A20_ResolvedWind_t v_wind;
+	T10_CHECK(S20_resolveWindParams(s_dict, "OCEAN", "BALANCE", nullptr, v_wind), "resolve OCEAN/BALANCE");
+
+	ST_S10_HeadlessOpt_t v_opt;
+	CL_S10_HeadlessRunner::defaultOpt(v_opt);
+	v_opt.durationSec = 1800u;
+
+	ST_S10_WindProfileStat_t v_st;
+	T10_CHECK(CL_S10_HeadlessRunner::profile(v_wind, v_opt, v_st), "profile");
+
+	CL_T10_StrPrint v_csv;
+	CL_S10_HeadlessRunner::statToCsv(v_st, EN_S10_DRIFT_NONE, v_csv);
+
+	ST_S10_WindProfileStat_t v_back;
+	T10_CHECK(CL_S10_HeadlessRunner::statFromCsv(v_csv.buf.c_str(), v_back), "statFromCsv: %s", v_csv.buf.c_str());
+	T10_CHECK(strcmp(v_back.presetCode, "OCEAN") == 0 && strcmp(v_back.styleCode, "BALANCE") == 0, "codes");
+	T10_CHECK(v_back.phaseVisits[EN_A20_WEATHER_PHASE_NORMAL] == v_st.phaseVisits[EN_A20_WEATHER_PHASE_NORMAL], "visits");
+
+	ST_S10_WindProfileStat_t v_hdr;
+	T10_CHECK(!CL_S10_HeadlessRunner::statFromCsv(G_S10_PROFILE_CSV_HEADER, v_hdr), "header line must be skipped");
+	T10_CHECK(!CL_S10_HeadlessRunner::statFromCsv("# comment\n", v_hdr), "comment line must be skipped");
+
+	ST_S10_ProfileTol_t v_tol;
+	CL_S10_HeadlessRunner::defaultTol(v_tol);
+	T10_CHECK(CL_S10_HeadlessRunner::checkDrift(v_st, v_back, v_tol) == EN_S10_DRIFT_NONE, "round-trip must not drift");
+
+	ST_S10_WindProfileStat_t v_bad = v_back;
+	v_bad.meanWind *= 1.2f;
+	v_bad.psdSlope += 1.0f;
+	const uint32_t v_mask = CL_S10_HeadlessRunner::checkDrift(v_st, v_bad, v_tol);
+	T10_CHECK((v_mask & EN_S10_DRIFT_MEAN) && (v_mask & EN_S10_DRIFT_PSD), "tampered baseline not detected (0x%02lx)", (unsigned long)v_mask);
+}
+
+static void T10_testWindCacheSplit() {
+	static ST_S20_WindCache_t v_cache;
+	memset(&v_cache, 0, sizeof(v_cache));
+
+	ST_A20_AdjustDelta_t v_adj[2];
+	v_adj[1].windIntensity = 5.0f;
+	v_adj[1].minFan		   = -3.0f;
+
+	uint32_t v_n = 0;
+	for (int16_t v_p = 0; v_p < s_dict.presetCount; v_p++) {
+		for (int16_t v_s = -1; v_s < s_dict.styleCount; v_s++) {
+			for (uint8_t v_a = 0; v_a < 2; v_a++) {
+				ST_A20_ResolvedWind_t v_ref, v_got;
+				T10_CHECK(S20_resolveWindByIndex(s_dict, v_p, v_s, &v_adj[v_a], v_ref), "direct resolve %d/%d", v_p, v_s);
+
+				ST_S20_WindCacheKey_t v_key;
+				T10_CHECK(S20_windCacheKey(s_dict, 1u, v_p, v_s, &v_adj[v_a], v_key), "key %d/%d", v_p, v_s);
+				T10_CHECK(!S20_windCacheLookup(v_cache, v_key, v_got), "unexpected hit %d/%d", v_p, v_s);
+				// 경합 모사: 같은 키 2회 등록 → 슬롯 1개만 사용
+				S20_windCacheInsert(v_cache, v_key, v_ref);
+				S20_windCacheInsert(v_cache, v_key, v_ref);
+				T10_CHECK(S20_windCacheLookup(v_cache, v_key, v_got), "miss after insert %d/%d", v_p, v_s);
+				T10_CHECK(memcmp(&v_got, &v_ref, sizeof(v_ref)) == 0, "cached != direct %d/%d", v_p, v_s);
+
+				uint8_t v_dup = 0;
+				for (uint8_t v_i = 0; v_i < G_S20_WIND_CACHE_SIZE; v_i++) {
+					if (S20_windCacheMatch(v_cache.entry[v_i], v_key)) v_dup++;
+				}
+				T10_CHECK(v_dup == 1u, "duplicate slots %u", (unsigned)v_dup);
+				v_n++;
+			}
+		}
+	}
+	T10_CHECK(v_cache.hits == v_n && v_cache.misses == v_n, "hits %lu misses %lu n %lu", (unsigned long)v_cache.hits, (unsigned long)v_cache.misses, (unsigned long)v_n);
+	T10_CHECK(v_cache.evictions == (v_n > G_S20_WIND_CACHE_SIZE ? v_n - G_S20_WIND_CACHE_SIZE : 0u), "evictions %lu", (unsigned long)v_cache.evictions);
+
+	ST_S20_WindCacheKey_t v_bad;
+	T10_CHECK(!S20_windCacheKey(s_dict, 1u, s_dict.presetCount, -1, nullptr, v_bad), "out-of-range preset key must fail");
+}
+
+int main(int p_argc, char** p_argv) {
+	if (p_argc < 2 || !T10_loadWindDict(p_argv[1], s_dict)) {
+		fprintf(stderr, "usage: t10_test_headless <cfg_windDict.json>\n");
+		return 2;
+	}
+
+	T10_testDeterminism();
+	T10_testBinary();
+	T10_testGlobalPrngUntouched();
+	T10_testUnknownPreset();
+	T10_testProfileCsvDrift();
+	T10_testWindCacheSplit();
+
+	fprintf(stderr, "[T10] headless: %lu failure(s)\n", (unsigned long)g_T10_failCount);
+	return g_T10_failCount == 0u ? 0 : 1;
+}
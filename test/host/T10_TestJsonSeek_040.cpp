@@ -0,0 +1,271 @@
+/*
+ * ------------------------------------------------------
+ * 소스명 : T10_TestJsonSeek_040.cpp
+ * 모듈약어 : T10
+ * 모듈명 : C10_ioSeekKey (설정 배열 스트리밍 위치 탐색) host 테스트
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - 합성 문서: 중첩 object / 배열 항목 안의 동명 key, 문자열 값 / escape 가 앞에 있어도
+ *   경로상 직속 key 값 위치로 이동하는지 검사 (이동 후 값의 첫 항목 표식 비교)
+ *   . 같은 문서에서 이전 방식(Stream::find "key" + ':')이 잘못된 위치를 잡는 것도 확인 (케이스 유효성)
+ * - key 없음 → 0, 형식 오류/잘린 문서 → -1 (호출측 fallback)
+ * - C10_ioSeekArray / C10_ioNextItem 항목 pull 순회: 빈 배열 / 배열 아님 / 구분자 오류 / 잘린 문서
+ * - 실 설정 파일(data_v015/json): loader key 경로로 seek → 항목 단위 pull(skip) 개수 == DOM 파싱 개수
+ *   배열 전체/최대 항목 text byte 보고 (항목 스트리밍 시 문서 1개가 담는 입력 크기 비교용,
+ *   ArduinoJson pool byte는 실기 /api/diag cfgParse)
+ * - 인자: argv[1] = data_v015/json 디렉터리
+ * ------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+
+#include "C10_Config_JsonSeek_041.h"
+#include "T10_Host_040.h"
+
+// 문자열 입력 Stream
+class CL_T10_StrStream : public Stream {
+  public:
+	explicit CL_T10_StrStream(const std::string& p_text) : _text(p_text) {}
+
+	int available() override {
+		return (int)(_text.size() - _pos);
+	}
+	int read() override {
+		return _pos < _text.size() ? (uint8_t)_text[_pos++] : -1;
+	}
+	int peek() override {
+		return _pos < _text.size() ? (uint8_t)_text[_pos] : -1;
+	}
+	size_t write(uint8_t) override {
+		return 0;
+	}
+	size_t pos() const {
+		return _pos;
+	}
+
+  private:
+	std::string _text;
+	size_t		_pos = 0;
+};
+
+// key 경로 seek (loader와 동일 순서). 반환: C10_ioSeekKey 마지막 결과
+static int8_t T10_seekPath(CL_T10_StrStream& p_s, const char* const* p_keys, uint8_t p_count) {
+	for (uint8_t v_i = 0; v_i < p_count; v_i++) {
+		int8_t v_r = C10_ioSeekKey(p_s, p_keys[v_i]);
+		if (v_r <= 0) return v_r;
+	}
+	return 1;
+}
+
+// 이전 방식: 각 key를 문서 어디서든 첫 "key" 뒤 ':' 로 탐색 → 값 시작 offset (-1: 없음)
+static long T10_legacySeek(const std::string& p_text, const char* const* p_keys, uint8_t p_count) {
+	size_t v_pos = 0;
+	for (uint8_t v_i = 0; v_i < p_count; v_i++) {
+		const std::string v_pat = std::string("\"") + p_keys[v_i] + "\"";
+		for (;;) {
+			size_t v_hit = p_text.find(v_pat, v_pos);
+			if (v_hit == std::string::npos) return -1;
+			v_pos = v_hit + v_pat.size();
+			while (v_pos < p_text.size() && strchr(" \t\r\n", p_text[v_pos])) v_pos++;
+			if (v_pos < p_text.size() && p_text[v_pos] == ':') {
+				v_pos++;
+				break;
+			}
+		}
+	}
+	return (long)v_pos;
+}
+
+// 값 시작 위치의 표식: 공백 건너뛴 뒤 최대 p_len 문자
+static std::string T10_headAt(const std::string& p_text, size_t p_pos, size_t p_len) {
+	while (p_pos < p_text.size() && strchr(" \t\r\n", p_text[p_pos])) p_pos++;
+	return p_text.substr(p_pos, p_len);
+}
+
+typedef struct {
+	const char* name;
+	const char* json;
+	const char* keys[2];
+	uint8_t		keyCount;
+	int8_t		expect;		 // C10_ioSeekKey 결과
+	const char* head;		 // expect == 1: 이동 위치 값 앞부분
+	bool		legacyWrong; // 이전 방식이 다른 위치를 잡는 케이스
+} ST_T10_SeekCase_t;
+
+static const ST_T10_SeekCase_t G_T10_SEEK_CASES[] = {
+	{ "nested-first", "{\"meta\":{\"presets\":[\"x\"]},\"presets\":[{\"id\":\"OK\"}]}", { "presets" }, 1, 1, "[{\"id\":\"OK\"", true },
+	{ "in-array-item", "{\"list\":[{\"pages\":[]}],\"pages\":[{\"id\":\"OK\"}]}", { "pages" }, 1, 1, "[{\"id\":\"OK\"", true },
+	{ "string-value", "{\"note\":\"\\\"schedules\\\": [9]\",\"schedules\":[{\"id\":\"OK\"}]}", { "schedules" }, 1, 1, "[{\"id\":\"OK\"", false },
+	{ "string-as-key-text", "{\"a\":\"schedules\",\"schedules\" : [ {\"id\":\"OK\"}]}", { "schedules" }, 1, 1, "[ {\"id\":\"OK\"", false },
+	{ "escape-braces", "{\"a\":\"}\\\\\\\"{[\",\"b\":{\"c\":\"]}\"},\"pages\":[{\"id\":\"OK\"}]}", { "pages" }, 1, 1, "[{\"id\":\"OK\"", false },
+	{ "path-inner-first",
+	  "{\"x\":{\"userProfiles\":{\"profiles\":[0]}},\"userProfiles\":{\"meta\":{\"profiles\":[1]},\"profiles\":[{\"id\":\"OK\"}]}}",
+	  { "userProfiles", "profiles" }, 2, 1, "[{\"id\":\"OK\"", true },
+	{ "path-sibling-section", "{\"windDict\":{\"styles\":[{\"presets\":[\"bad\"]}],\"presets\":[{\"id\":\"OK\"}]}}", { "windDict", "presets" }, 2, 1, "[{\"id\":\"OK\"", true },
+	{ "scalars", "{\"n\":-1.5e3,\"t\":true,\"z\":null,\"pages\":[{\"id\":\"OK\"}]}", { "pages" }, 1, 1, "[{\"id\":\"OK\"", false },
+	{ "missing-top", "{\"meta\":{\"pages\":[1]}}", { "pages" }, 1, 0, nullptr, true },
+	{ "missing-empty", "{ }", { "pages" }, 1, 0, nullptr, false },
+	{ "path-not-object", "{\"windDict\":[1,2]}", { "windDict", "presets" }, 2, 0, nullptr, false },
+	{ "truncated", "{\"meta\":{\"a\":[1,2", { "pages" }, 1, -1, nullptr, false },
+	{ "unterminated-string", "{\"a\":\"abc", { "pages" }, 1, -1, nullptr, false },
+	{ "bad-separator", "{\"a\":1;\"pages\":[]}", { "pages" }, 1, -1, nullptr, false },
+	{ "empty-input", "", { "pages" }, 1, -1, nullptr, false },
+};
+
+static void T10_runCases() {
+	for (const ST_T10_SeekCase_t& v_c : G_T10_SEEK_CASES) {
+		const std::string v_text(v_c.json);
+		CL_T10_StrStream  v_s(v_text);
+		int8_t			  v_r = T10_seekPath(v_s, v_c.keys, v_c.keyCount);
+
+		T10_CHECK(v_r == v_c.expect, "%s: result %d != %d", v_c.name, (int)v_r, (int)v_c.expect);
+		if (v_r == 1 && v_c.head) {
+			const std::string v_head = T10_headAt(v_text, v_s.pos(), strlen(v_c.head));
+			T10_CHECK(v_head == v_c.head, "%s: landed at '%s'", v_c.name, v_head.c_str());
+		}
+
+		// 이전 방식 비교: 케이스가 실제로 오판 경로를 포함하는지
+		const long v_old	  = T10_legacySeek(v_text, v_c.keys, v_c.keyCount);
+		bool	   v_oldWrong = false;
+		if (v_c.expect == 1) {
+			v_oldWrong = (v_old < 0) || T10_headAt(v_text, (size_t)v_old, strlen(v_c.head)) != v_c.head;
+		} else if (v_c.expect == 0) {
+			v_oldWrong = (v_old >= 0 && T10_headAt(v_text, (size_t)v_old, 1) == "[");
+		}
+		T10_CHECK(v_oldWrong == v_c.legacyWrong, "%s: legacy wrong=%d expected %d", v_c.name, (int)v_oldWrong, (int)v_c.legacyWrong);
+	}
+}
+
+// --------------------------------------------------
+// 배열 항목 pull 순회 (ioForEachJsonItem / W10 chunked windDict 공용 경로)
+// --------------------------------------------------
+typedef struct {
+	const char* name;
+	const char* text;
+	int8_t		seek;	// C10_ioSeekArray 결과
+	int			items;	// 정상 종료 시 항목 수, -1: 순회 중 형식 오류
+} ST_T10_ItemCase_t;
+
+static const char* const G_T10_ITEM_KEYS[] = { "windDict", "presets" };
+
+static const ST_T10_ItemCase_t G_T10_ITEM_CASES[] = {
+	{ "two-items", "{\"windDict\":{\"presets\":[{\"a\":1},{\"b\":[1,{\"c\":\"]\"}]}]}}", 1, 2 },
+	{ "empty-array", "{\"windDict\":{\"presets\":[ ]}}", 1, 0 },
+	{ "key-absent", "{\"windDict\":{\"styles\":[{}]}}", 0, 0 },
+	{ "not-array", "{\"windDict\":{\"presets\":{}}}", 0, 0 },
+	{ "trailing-comma", "{\"windDict\":{\"presets\":[{},]}}", 1, -1 },
+	{ "missing-comma", "{\"windDict\":{\"presets\":[{} {}]}}", 1, -1 },
+	{ "scalar-item", "{\"windDict\":{\"presets\":[1]}}", 1, -1 },
+	{ "truncated", "{\"windDict\":{\"presets\":[{\"a\":1}", 1, -1 },
+	{ "truncated-key", "{\"windDict\":{\"pre", -1, 0 },
+};
+
+// seek 후 항목 pull (항목 본문은 skip) → 항목 수, 형식 오류 -1
+static int T10_pullItems(CL_T10_StrStream& p_s, size_t* p_itemMax) {
+	int v_n = 0;
+	for (;;) {
+		int8_t v_r = C10_ioNextItem(p_s, (uint16_t)v_n);
+		if (v_r == 0) return v_n;
+		if (v_r < 0) return -1;
+
+		const size_t v_p0 = p_s.pos();
+		if (!C10_ioSkipValue(p_s)) return -1;
+		if (p_itemMax && p_s.pos() - v_p0 > *p_itemMax) *p_itemMax = p_s.pos() - v_p0;
+		v_n++;
+	}
+}
+
+static void T10_runItemCases() {
+	for (const ST_T10_ItemCase_t& v_c : G_T10_ITEM_CASES) {
+		CL_T10_StrStream v_s(v_c.text);
+		const int8_t	 v_seek = C10_ioSeekArray(v_s, G_T10_ITEM_KEYS, 2);
+		T10_CHECK(v_seek == v_c.seek, "%s: seekArray=%d expected %d", v_c.name, (int)v_seek, (int)v_c.seek);
+		if (v_seek != 1) continue;
+
+		const int v_items = T10_pullItems(v_s, nullptr);
+		T10_CHECK(v_items == v_c.items, "%s: items=%d expected %d", v_c.name, v_items, v_c.items);
+	}
+}
+
+// --------------------------------------------------
+// 실 설정 파일: seek 후 항목 skip 개수 == DOM 개수
+// --------------------------------------------------
+typedef struct {
+	const char* file;
+	const char* keys[2];
+	uint8_t		keyCount;
+} ST_T10_FileCase_t;
+
+// C10 loader key 경로 (C10_Config_Schedule_042.cpp / C10_Config_Extras_041.cpp)
+static const ST_T10_FileCase_t G_T10_FILE_CASES[] = {
+	{ "cfg_schedules_030.json", { "schedules" }, 1 },
+	{ "cfg_userProfile_030.json", { "userProfiles", "profiles" }, 2 },
+	{ "cfg_windDict_030.json", { "windDict", "presets" }, 2 },
+	{ "cfg_windDict_030.json", { "windDict", "styles" }, 2 },
+	{ "cfg_pages_040.json", { "pages" }, 1 },
+};
+
+static void T10_runFiles(const char* p_dir) {
+	for (const ST_T10_FileCase_t& v_c : G_T10_FILE_CASES) {
+		const std::string v_path = std::string(p_dir) + "/" + v_c.file;
+		std::string		  v_text;
+		ST_T10_JsonVal_t  v_root;
+		if (!T10_readFile(v_path.c_str(), v_text) || !T10_jsonParse(v_text, v_root)) {
+			T10_CHECK(false, "read/parse %s", v_path.c_str());
+			continue;
+		}
+
+		const ST_T10_JsonVal_t* v_node = &v_root;
+		for (uint8_t v_i = 0; v_node && v_i < v_c.keyCount; v_i++) v_node = v_node->get(v_c.keys[v_i]);
+		const size_t v_domCount = (v_node && v_node->type == ST_T10_JsonVal_t::EN_T10_JSON_ARR) ? v_node->arr.size() : 0u;
+
+		CL_T10_StrStream v_s(v_text);
+		int8_t			 v_r = T10_seekPath(v_s, v_c.keys, v_c.keyCount);
+		T10_CHECK(v_r == 1, "%s %s: seek %d", v_c.file, v_c.keys[v_c.keyCount - 1], (int)v_r);
+		if (v_r != 1) continue;
+
+		const size_t v_arrStart = v_s.pos();
+		size_t		 v_itemMax	= 0;
+		const bool	 v_isArr	= (C10_ioPeekNonWs(v_s) == '[');
+		if (v_isArr) v_s.read();
+		const int	 v_pulled = v_isArr ? T10_pullItems(v_s, &v_itemMax) : -1;
+		const size_t v_n	  = v_pulled > 0 ? (size_t)v_pulled : 0u;
+
+		T10_CHECK(v_pulled >= 0, "%s %s: item pull failed", v_c.file, v_c.keys[v_c.keyCount - 1]);
+		T10_CHECK(v_n == v_domCount, "%s %s: items %zu != DOM %zu", v_c.file, v_c.keys[v_c.keyCount - 1], v_n, v_domCount);
+
+		// C10_ioSeekArray 경로(chunked windDict / loader)도 같은 개수
+		CL_T10_StrStream v_s2(v_text);
+		const int8_t	 v_r2 = C10_ioSeekArray(v_s2, v_c.keys, v_c.keyCount);
+		T10_CHECK(v_r2 == 1 && T10_pullItems(v_s2, nullptr) == (int)v_domCount, "%s %s: seekArray pull mismatch", v_c.file, v_c.keys[v_c.keyCount - 1]);
+
+		fprintf(stderr, "[T10] seek %-24s %-9s items=%zu arrayText=%zuB maxItemText=%zuB fileText=%zuB\n",
+				v_c.file,
+				v_c.keys[v_c.keyCount - 1],
+				v_n,
+				v_s.pos() - v_arrStart,
+				v_itemMax,
+				v_text.size());
+	}
+}
+
+int main(int p_argc, char** p_argv) {
+	if (p_argc < 2) {
+		fprintf(stderr, "usage: t10_test_json_seek <data_v015/json dir>\n");
+		return 2;
+	}
+
+	T10_runCases();
+	T10_runItemCases();
+	T10_runFiles(p_argv[1]);
+
+	fprintf(stderr, "[T10] json seek: cases=%zu itemCases=%zu files=%zu fail=%lu\n",
+			sizeof(G_T10_SEEK_CASES) / sizeof(G_T10_SEEK_CASES[0]),
+			sizeof(G_T10_ITEM_CASES) / sizeof(G_T10_ITEM_CASES[0]),
+			sizeof(G_T10_FILE_CASES) / sizeof(G_T10_FILE_CASES[0]),
+			(unsigned long)g_T10_failCount);
+	return g_T10_failCount == 0u ? 0 : 1;
+}
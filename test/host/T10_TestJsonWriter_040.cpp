@@ -0,0 +1,338 @@
+/*
+ * ------------------------------------------------------
+ * 소스명 : T10_TestJsonWriter_040.cpp
+ * 모듈약어 : T10
+ * 모듈명 : CL_A20_JsonWriter / S10 field list host 테스트 + 스트리밍 직렬화 벤치
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - float 출력: ArduinoJson 7 serializeJson 기대 문자열 표와 byte 일치
+ *   (float 6자리 / double 9자리, 1e7·1e-5 경계 지수 표기, 반올림 자리올림, NaN/Inf → null)
+ * - 문자열 escape / 중첩 구분자 / 용량 초과(overflow) 동작
+ * - S10_emitSimState / S10_emitChartMeta / S10_emitChartEntry:
+ *   writer 출력 → T10_jsonParse 파싱 성공, key 순서 == UI 계약 목록, 수치 왕복 오차 검사
+ * - 벤치: headless sim writeJson 반복 (payload당 ns, 출력 byte, 루프 중 heap 할당 수 == 0)
+ *   최악값 스냅샷(-x.xxxxxxe-N, 최대 길이 코드) sim payload byte 보고
+ * - JsonDocument 경로 비교는 실기 /api/diag?jsonbench=1 (host에는 ArduinoJson 구현 없음)
+ * - 인자: argv[1] = cfg_windDict_xxx.json 경로
+ * ------------------------------------------------------
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <string>
+
+#include "A20_JsonWriter_041.h"
+#include "S10_Headless_040.h"
+#include "S20_WindSolver_040.h"
+#include "T10_Host_040.h"
+
+static const uint32_t G_T10_JW_BENCH_ITERS = 50000u;
+static const size_t	  G_T10_JW_BUF_BYTES   = 1536u;	 // CT10 state 채널 고정 버퍼와 동일
+
+// --------------------------------------------------
+// heap 할당 계수 (writer 경로 무할당 검사)
+// --------------------------------------------------
+static std::atomic<uint32_t> s_allocCount{ 0 };
+
+void* operator new(size_t p_n) {
+	s_allocCount.fetch_add(1u, std::memory_order_relaxed);
+	void* v_p = malloc(p_n ? p_n : 1u);
+	if (!v_p) throw std::bad_alloc();
+	return v_p;
+}
+void operator delete(void* p_p) noexcept {
+	free(p_p);
+}
+void operator delete(void* p_p, size_t) noexcept {
+	free(p_p);
+}
+
+// --------------------------------------------------
+// float 출력 (기대값: ArduinoJson 7.4 TextFormatter::writeFloat 규칙)
+// --------------------------------------------------
+template <typename T>
+static void T10_expectValue(T p_v, const char* p_expect) {
+	char			  v_buf[64];
+	CL_A20_JsonWriter v_w(v_buf, sizeof(v_buf));
+	v_w.beginArray();
+	v_w.value(p_v);
+	v_w.endArray();
+
+	char v_expect[64];
+	snprintf(v_expect, sizeof(v_expect), "[%s]", p_expect);
+	T10_CHECK(strcmp(v_buf, v_expect) == 0, "value %.17g: got %s expect %s", (double)p_v, v_buf, v_expect);
+}
+
+static void T10_testFloat() {
+	// float (6자리)
+	T10_expectValue(3.2f, "3.2");
+	T10_expectValue(42.0f, "42");
+	T10_expectValue(-0.5f, "-0.5");
+	T10_expectValue(0.1f, "0.1");
+	T10_expectValue(0.0f, "0");
+	T10_expectValue(-0.0f, "0");
+	T10_expectValue(123456.789f, "123456.8");
+	T10_expectValue(1234.5f, "1234.5");
+	T10_expectValue(-273.15f, "-273.15");
+	T10_expectValue(99.99999f, "99.99999");
+	T10_expectValue(0.9999999f, "1");
+	T10_expectValue(1.0f / 3.0f, "0.333333");
+	T10_expectValue(0.000123f, "0.000123");
+	T10_expectValue(1e-5f, "1e-5");
+	T10_expectValue(1.5e-6f, "1.5e-6");
+	T10_expectValue(1e-7f, "1e-7");
+	T10_expectValue(1e7f, "1e7");
+	T10_expectValue(12345678.0f, "1.234568e7");
+	T10_expectValue(3.4e38f, "3.4e38");
+	T10_expectValue(NAN, "null");
+	T10_expectValue(INFINITY, "null");
+	T10_expectValue(-INFINITY, "null");
+
+	// double: float로 정확히 표현되면 6자리, 아니면 9자리
+	T10_expectValue(2.5, "2.5");
+	T10_expectValue(0.1, "0.1");
+	T10_expectValue(1.0 / 3.0, "0.333333333");
+	T10_expectValue(1e10, "1e10");
+	T10_expectValue(-1e-9, "-1e-9");
+}
+
+// --------------------------------------------------
+// 문자열 / 구조 / overflow
+// --------------------------------------------------
+static void T10_testStructure() {
+	char			  v_buf[128];
+	CL_A20_JsonWriter v_w(v_buf, sizeof(v_buf));
+	v_w.beginObject();
+	v_w.kv("s", "a\"b\\c\n\t\x01/");
+	v_w.kv("n", (const char*)nullptr);
+	v_w.kv("i", -42);
+	v_w.kv("u", 4000000000u);
+	v_w.kv("b", true);
+	v_w.beginArray("arr");
+	v_w.value(1);
+	v_w.beginObject();
+	v_w.kvNull("z");
+	v_w.endObject();
+	v_w.endArray();
+	v_w.beginObject("empty");
+	v_w.endObject();
+	v_w.endObject();
+
+	const char* v_expect = "{\"s\":\"a\\\"b\\\\c\\n\\t\\u0001/\",\"n\":null,\"i\":-42,\"u\":4000000000,\"b\":true,"
+						   "\"arr\":[1,{\"z\":null}],\"empty\":{}}";
+	T10_CHECK(!v_w.overflow(), "unexpected overflow");
+	T10_CHECK(strcmp(v_buf, v_expect) == 0, "structure: got %s", v_buf);
+	T10_CHECK(v_w.length() == strlen(v_expect), "length %lu", (unsigned long)v_w.length());
+
+	// 용량 초과: overflow 후 length 0, 버퍼는 NUL 종료 유지
+	char			  v_small[16];
+	CL_A20_JsonWriter v_o(v_small, sizeof(v_small));
+	v_o.beginObject();
+	v_o.kv("key", "0123456789abcdef");
+	v_o.endObject();
+	T10_CHECK(v_o.overflow(), "overflow not detected");
+	T10_CHECK(v_o.length() == 0u, "overflow length %lu", (unsigned long)v_o.length());
+	T10_CHECK(strlen(v_small) < sizeof(v_small), "buffer not terminated");
+}
+
+// --------------------------------------------------
+// S10 field list: 파싱 + key 순서 + 수치 왕복
+// --------------------------------------------------
+static const char* const G_T10_SIM_KEYS[] = {
+	"active",		"fanPowerEnabled", "phase",		  "windSpeed",	  "targetWind",	  "gustActive",
+	"thermalActive", "pwmDuty",		   "presetCode",  "styleCode",	  "intensity",	  "variability",
+	"gustFreq",		"fanLimit",		   "minFan",	  "turbSigma",	  "turbLenScale", "thermalStrength",
+	"thermalRadius", "baseMinWind",	   "baseMaxWind", "gustProbBase", "gustStrengthMax", "thermalFreqBase",
+	"seed",
+};
+static const char* const G_T10_META_KEYS[]	= { "phase", "avgWind", "gustActive", "thermalActive", "samples" };
+static const char* const G_T10_ENTRY_KEYS[] = { "seq", "ts", "wind", "pwm", "gustActive", "thermalActive" };
+
+static void T10_checkKeys(const ST_T10_JsonVal_t& p_obj, const char* const* p_keys, size_t p_n, const char* p_what) {
+	T10_CHECK(p_obj.type == ST_T10_JsonVal_t::EN_T10_JSON_OBJ, "%s: not an object", p_what);
+	T10_CHECK(p_obj.obj.size() == p_n, "%s: key count %lu != %lu", p_what, (unsigned long)p_obj.obj.size(), (unsigned long)p_n);
+	for (size_t v_i = 0; v_i < p_n && v_i < p_obj.obj.size(); v_i++) {
+		T10_CHECK(p_obj.obj[v_i].first == p_keys[v_i], "%s: key[%lu] %s != %s", p_what, (unsigned long)v_i, p_obj.obj[v_i].first.c_str(), p_keys[v_i]);
+	}
+}
+
+// 6자리 출력 → 정수부 자릿수 포함 유효숫자 7자리 수준 왕복
+static void T10_checkNum(const ST_T10_JsonVal_t& p_obj, const char* p_key, float p_v) {
+	const ST_T10_JsonVal_t* v_n = p_obj.get(p_key);
+	T10_CHECK(v_n && v_n->type == ST_T10_JsonVal_t::EN_T10_JSON_NUM, "%s: missing number", p_key);
+	if (!v_n) return;
+	const double v_tol = 1e-6 * fmax(1.0, fabs((double)p_v)) * 10.0;
+	T10_CHECK(fabs(v_n->num - (double)p_v) <= v_tol, "%s: %.9g != %.9g", p_key, v_n->num, (double)p_v);
+}
+
+static void T10_testSimFields(CL_S10_Simulation& p_sim) {
+	char			  v_buf[G_T10_JW_BUF_BYTES];
+	CL_A20_JsonWriter v_w(v_buf, sizeof(v_buf));
+	v_w.beginObject();
+	T10_CHECK(p_sim.writeJson(v_w), "writeJson false");
+	v_w.endObject();
+	T10_CHECK(!v_w.overflow(), "sim state overflow");
+
+	ST_T10_JsonVal_t v_root;
+	T10_CHECK(T10_jsonParse(std::string(v_buf, v_w.length()), v_root), "sim state parse failed: %s", v_buf);
+	const ST_T10_JsonVal_t* v_sim = v_root.get("sim");
+	T10_CHECK(v_sim != nullptr, "no sim object");
+	if (!v_sim) return;
+	T10_checkKeys(*v_sim, G_T10_SIM_KEYS, sizeof(G_T10_SIM_KEYS) / sizeof(G_T10_SIM_KEYS[0]), "sim");
+
+	ST_S10_SimSnapshot_t v_s;
+	p_sim.readSnapshot(v_s);
+	T10_checkNum(*v_sim, "windSpeed", v_s.windSpeed);
+	T10_checkNum(*v_sim, "targetWind", v_s.targetWind);
+	T10_checkNum(*v_sim, "turbSigma", v_s.turbSigma);
+	T10_checkNum(*v_sim, "gustProbBase", v_s.gustProbBase);
+	T10_checkNum(*v_sim, "thermalFreqBase", v_s.thermalFreqBase);
+	T10_CHECK(strcmp(v_sim->strOr("presetCode", ""), v_s.presetCode) == 0, "presetCode");
+
+	// chart meta + entry (공유 차트 버퍼 미사용 → 합성 record)
+	CL_S10_Simulation::ST_ChartEntry v_e;
+	memset(&v_e, 0, sizeof(v_e));
+	v_e.timestamp	   = 123456789UL;
+	v_e.wind_speed	   = 3.14159f;
+	v_e.pwm_duty	   = 42.5f;
+	v_e.gust_active	   = true;
+
+	v_w.reset();
+	v_w.beginObject();
+	v_w.beginObject("meta");
+	S10_emitChartMeta(v_w, v_s);
+	v_w.endObject();
+	v_w.beginArray("chart");
+	S10_emitChartEntry(v_w, 77u, v_e);
+	v_w.endArray();
+	v_w.endObject();
+
+	ST_T10_JsonVal_t v_chart;
+	T10_CHECK(T10_jsonParse(std::string(v_buf, v_w.length()), v_chart), "chart parse failed: %s", v_buf);
+	const ST_T10_JsonVal_t* v_meta = v_chart.get("meta");
+	const ST_T10_JsonVal_t* v_arr  = v_chart.get("chart");
+	T10_CHECK(v_meta && v_arr && v_arr->arr.size() == 1u, "chart shape");
+	if (!v_meta || !v_arr || v_arr->arr.size() != 1u) return;
+	T10_checkKeys(*v_meta, G_T10_META_KEYS, sizeof(G_T10_META_KEYS) / sizeof(G_T10_META_KEYS[0]), "meta");
+	T10_checkKeys(v_arr->arr[0], G_T10_ENTRY_KEYS, sizeof(G_T10_ENTRY_KEYS) / sizeof(G_T10_ENTRY_KEYS[0]), "entry");
+	T10_CHECK(strstr(v_buf, "\"seq\":77,\"ts\":123456,\"wind\":3.14159,\"pwm\":42.5,\"gustActive\":true,\"thermalActive\":false") != nullptr,
+			  "entry text: %s", v_buf);
+}
+
+// --------------------------------------------------
+// 벤치: writeJson 반복 + 최악값 payload 크기
+// --------------------------------------------------
+static void T10_benchSim(CL_S10_Simulation& p_sim, CL_S10_VirtualClock& p_clock) {
+	char			  v_buf[G_T10_JW_BUF_BYTES];
+	CL_A20_JsonWriter v_w(v_buf, sizeof(v_buf));
+	size_t			  v_bytes = 0, v_maxBytes = 0;
+
+	const uint32_t v_alloc0 = s_allocCount.load();
+	const auto	   v_t0		= std::chrono::steady_clock::now();
+	for (uint32_t v_i = 0; v_i < G_T10_JW_BENCH_ITERS; v_i++) {
+		if ((v_i & 0x3Fu) == 0u) {
+			p_clock.advanceMs(100u);
+			p_sim.tick();
+		}
+		v_w.reset();
+		v_w.beginObject();
+		(void)p_sim.writeJson(v_w);
+		v_w.endObject();
+		v_bytes += v_w.length();
+		if (v_w.length() > v_maxBytes) v_maxBytes = v_w.length();
+	}
+	const double   v_ns		= (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - v_t0).count();
+	const uint32_t v_allocs = s_allocCount.load() - v_alloc0;
+
+	// 최악값: 모든 float 12자(-d.dddddde-N), 코드 최대 길이
+	ST_S10_SimSnapshot_t v_worst;
+	p_sim.readSnapshot(v_worst);
+	const float v_wf		 = -1.234567e-6f;
+	v_worst.windSpeed		 = v_wf;
+	v_worst.targetWind		 = v_wf;
+	v_worst.pwmDuty			 = v_wf;
+	v_worst.intensity		 = v_wf;
+	v_worst.variability		 = v_wf;
+	v_worst.gustFreq		 = v_wf;
+	v_worst.fanLimit		 = v_wf;
+	v_worst.minFan			 = v_wf;
+	v_worst.turbSigma		 = v_wf;
+	v_worst.turbLenScale	 = v_wf;
+	v_worst.thermalStrength	 = v_wf;
+	v_worst.thermalRadius	 = v_wf;
+	v_worst.baseMinWind		 = v_wf;
+	v_worst.baseMaxWind		 = v_wf;
+	v_worst.gustProbBase	 = v_wf;
+	v_worst.gustStrengthMax	 = v_wf;
+	v_worst.thermalFreqBase	 = v_wf;
+	v_worst.seed			 = 0xFFFFFFFFu;
+	memset(v_worst.presetCode, 'P', sizeof(v_worst.presetCode) - 1u);
+	memset(v_worst.styleCode, 'S', sizeof(v_worst.styleCode) - 1u);
+	v_worst.presetCode[sizeof(v_worst.presetCode) - 1u] = '\0';
+	v_worst.styleCode[sizeof(v_worst.styleCode) - 1u]	= '\0';
+
+	v_w.reset();
+	v_w.beginObject();
+	v_w.beginObject("sim");
+	S10_emitSimState(v_w, v_worst);
+	v_w.endObject();
+	v_w.endObject();
+	T10_CHECK(!v_w.overflow(), "worst-case sim payload overflow");
+	ST_T10_JsonVal_t v_root;
+	T10_CHECK(T10_jsonParse(std::string(v_buf, v_w.length()), v_root), "worst-case parse failed");
+
+	fprintf(stderr,
+			"[T10] jsonWriter: iters=%lu nsPerPayload=%.0f avgBytes=%lu maxBytes=%lu allocs=%lu worstSimBytes=%lu bufBytes=%lu\n",
+			(unsigned long)G_T10_JW_BENCH_ITERS,
+			v_ns / (double)G_T10_JW_BENCH_ITERS,
+			(unsigned long)(v_bytes / G_T10_JW_BENCH_ITERS),
+			(unsigned long)v_maxBytes,
+			(unsigned long)v_allocs,
+			(unsigned long)v_w.length(),
+			(unsigned long)G_T10_JW_BUF_BYTES);
+
+	T10_CHECK(v_allocs == 0u, "writer path allocated %lu times", (unsigned long)v_allocs);
+}
+
+int main(int p_argc, char** p_argv) {
+	static ST_A20_WindProfileDict_t s_dict;
+	if (p_argc < 2 || !T10_loadWindDict(p_argv[1], s_dict)) {
+		fprintf(stderr, "usage: t10_test_json_writer <cfg_windDict.json>\n");
+		return 2;
+	}
+
+	T10_testFloat();
+	T10_testStructure();
+
+	ST_A20_ResolvedWind_t v_wind;
+	T10_CHECK(S20_resolveWindParams(s_dict, "OCEAN", "ACTIVE", nullptr, v_wind), "resolve");
+	if (g_T10_failCount) return 1;
+
+	CL_S10_VirtualClock v_clock;
+	CL_P10_PWM			v_pwm;
+	v_clock.setMs(G_S10_HEADLESS_T0_MS);
+	v_pwm.beginVirtual();
+
+	static CL_S10_Simulation s_sim;
+	s_sim.seedPrng(3u);
+	s_sim.setHeadless(true);
+	s_sim.setClock(&v_clock);
+	s_sim.setFixedStep(true);
+	s_sim.begin(v_pwm);
+	s_sim.applyResolvedWind(v_wind);
+	for (uint32_t v_i = 0; v_i < 600u; v_i++) {
+		v_clock.advanceMs(100u);
+		s_sim.tick();
+	}
+
+	T10_testSimFields(s_sim);
+	T10_benchSim(s_sim, v_clock);
+
+	return g_T10_failCount == 0u ? 0 : 1;
+}
@@ -0,0 +1,185 @@
+/*
+ * ------------------------------------------------------
+ * 소스명 : T10_TestRcu_040.cpp
+ * 모듈약어 : T10
+ * 모듈명 : C10 RCU publish/retire/reclaim host 동시성 테스트
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - writer 2개: C10 mutex 대용 mutex 보유 중 clone → publishSection 반복
+ *   → publish 1회 최대 소요시간이 grace보다 충분히 작은지 검사 (mutex 내 grace 대기 없음)
+ * - reader N개: C10_rcuRead 1회 load 후 grace 미만 보유하며 내용 일관성 재검사
+ *   → 해제된 섹션(operator delete에서 poison) 관측 시 use-after-free 판정
+ * - reclaimer 1개: A00 loop 대용으로 rcuReclaim 주기 호출
+ * - 종료 후 grace 경과 → retired == reclaimed == publish 수, pending 0, allocFail 0
+ * - G_C10_RCU_GRACE_MS 는 테스트 target에서 축소 정의 (CMakeLists)
+ * ------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include "C10_Config_041.h"
+#include "T10_Host_040.h"
+
+// C10_Config_Core_041.cpp 정의분 (host 빌드 제외 TU)
+uint32_t CL_C10_ConfigManager::s_windDictGen = 0;
+
+static const uint8_t  G_T10_RCU_READERS	  = 3u;
+static const uint8_t  G_T10_RCU_WRITERS	  = 2u;
+static const uint32_t G_T10_RCU_RUN_MS	  = 1500u;
+static const uint32_t G_T10_RCU_PAYLOAD	  = 64u;
+static const uint32_t G_T10_RCU_POISON	  = 0xDEADDEADu;
+static const uint32_t G_T10_RCU_HOLD_US	  = (uint32_t)G_C10_RCU_GRACE_MS * 1000u / 4u;
+
+// 검사용 섹션: 해제 시 poison 후 격리 (실제 free 없음 → 해제 후 읽기를 확정적으로 검출)
+struct ST_T10_RcuSection_t {
+	uint32_t seq;
+	uint32_t payload[G_T10_RCU_PAYLOAD];
+
+	static std::atomic<uint32_t> s_deleted;
+
+	static void operator delete(void* p_ptr) {
+		uint32_t* v_w = (uint32_t*)p_ptr;
+		for (size_t v_i = 0; v_i < sizeof(ST_T10_RcuSection_t) / sizeof(uint32_t); v_i++) {
+			__atomic_store_n(&v_w[v_i], G_T10_RCU_POISON, __ATOMIC_RELAXED);
+		}
+		s_deleted.fetch_add(1u);
+	}
+};
+std::atomic<uint32_t> ST_T10_RcuSection_t::s_deleted{ 0 };
+
+static ST_T10_RcuSection_t* s_slot = nullptr;
+
+static void T10_fill(ST_T10_RcuSection_t& p_s, uint32_t p_seq) {
+	p_s.seq = p_seq;
+	for (uint32_t v_i = 0; v_i < G_T10_RCU_PAYLOAD; v_i++) p_s.payload[v_i] = p_seq * 2654435761u + v_i;
+}
+
+static bool T10_valid(const ST_T10_RcuSection_t* p_s) {
+	const uint32_t v_seq = __atomic_load_n(&p_s->seq, __ATOMIC_RELAXED);
+	if (v_seq == G_T10_RCU_POISON) return false;
+	for (uint32_t v_i = 0; v_i < G_T10_RCU_PAYLOAD; v_i++) {
+		if (__atomic_load_n(&p_s->payload[v_i], __ATOMIC_RELAXED) != v_seq * 2654435761u + v_i) return false;
+	}
+	return true;
+}
+
+int main() {
+	std::mutex v_cfgMutex;	  // C10 mutex 대용 (writer 직렬화)
+
+	{
+		ST_T10_RcuSection_t* v_first = new ST_T10_RcuSection_t();
+		T10_fill(*v_first, 0u);
+		std::lock_guard<std::mutex> v_lk(v_cfgMutex);
+		CL_C10_ConfigManager::publishSection(s_slot, v_first);
+	}
+
+	std::atomic<bool>	  v_stop{ false };
+	std::atomic<uint32_t> v_seq{ 1 }, v_publishes{ 1 }, v_reads{ 0 }, v_bad{ 0 }, v_nullReads{ 0 };
+	std::atomic<uint64_t> v_maxPublishUs{ 0 };
+
+	std::vector<std::thread> v_threads;
+
+	for (uint8_t v_w = 0; v_w < G_T10_RCU_WRITERS; v_w++) {
+		v_threads.emplace_back([&]() {
+			while (!v_stop.load(std::memory_order_relaxed)) {
+				const auto v_t0 = std::chrono::steady_clock::now();
+				{
+					std::lock_guard<std::mutex> v_lk(v_cfgMutex);
+					const ST_T10_RcuSection_t*	v_cur  = C10_rcuRead(s_slot);
+					ST_T10_RcuSection_t*		v_next = new ST_T10_RcuSection_t(*v_cur);
+					T10_fill(*v_next, v_seq.fetch_add(1u));
+					CL_C10_ConfigManager::publishSection(s_slot, v_next);
+				}
+				const uint64_t v_us = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - v_t0).count();
+				uint64_t	   v_prev = v_maxPublishUs.load();
+				while (v_us > v_prev && !v_maxPublishUs.compare_exchange_weak(v_prev, v_us)) {
+				}
+				v_publishes.fetch_add(1u);
+				std::this_thread::sleep_for(std::chrono::microseconds(200));
+			}
+		});
+	}
+
+	for (uint8_t v_r = 0; v_r < G_T10_RCU_READERS; v_r++) {
+		v_threads.emplace_back([&, v_r]() {
+			uint32_t v_hold = 10u + v_r * 37u;
+			while (!v_stop.load(std::memory_order_relaxed)) {
+				const ST_T10_RcuSection_t* v_s = C10_rcuRead(s_slot);
+				if (!v_s) {
+					v_nullReads.fetch_add(1u);
+					continue;
+				}
+				if (!T10_valid(v_s)) v_bad.fetch_add(1u);
+				// 보유 중 교체/retire 진행 → grace 미만 보유는 계속 유효해야 함
+				v_hold = (v_hold * 1103515245u + 12345u);
+				std::this_thread::sleep_for(std::chrono::microseconds(v_hold % G_T10_RCU_HOLD_US));
+				if (!T10_valid(v_s)) v_bad.fetch_add(1u);
+				v_reads.fetch_add(1u, std::memory_order_relaxed);
+			}
+		});
+	}
+
+	v_threads.emplace_back([&]() {
+		while (!v_stop.load(std::memory_order_relaxed)) {
+			CL_C10_ConfigManager::rcuReclaim();
+			std::this_thread::sleep_for(std::chrono::milliseconds(5));
+		}
+	});
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(G_T10_RCU_RUN_MS));
+	v_stop.store(true);
+	for (auto& v_t : v_threads) v_t.join();
+
+	// 잔여 섹션 해제 후 grace 경과 → 전량 회수
+	{
+		std::lock_guard<std::mutex> v_lk(v_cfgMutex);
+		CL_C10_ConfigManager::retireSection(s_slot);
+	}
+	std::this_thread::sleep_for(std::chrono::milliseconds(G_C10_RCU_GRACE_MS + 20u));
+	CL_C10_ConfigManager::rcuReclaim();
+
+	ST_C10_RcuStat_t v_st;
+	CL_C10_ConfigManager::rcuStats(v_st);
+
+	fprintf(stderr,
+			"[T10] rcu: graceMs=%u publishes=%lu reads=%lu bad=%lu maxPublishUs=%llu retired=%lu reclaimed=%lu "
+			"deleted=%lu maxPending=%u overCap=%lu allocFail=%lu gen=%lu\n",
+			(unsigned)G_C10_RCU_GRACE_MS,
+			(unsigned long)v_publishes.load(),
+			(unsigned long)v_reads.load(),
+			(unsigned long)v_bad.load(),
+			(unsigned long long)v_maxPublishUs.load(),
+			(unsigned long)v_st.retired,
+			(unsigned long)v_st.reclaimed,
+			(unsigned long)ST_T10_RcuSection_t::s_deleted.load(),
+			(unsigned)v_st.maxPending,
+			(unsigned long)v_st.overCap,
+			(unsigned long)v_st.allocFail,
+			(unsigned long)CL_C10_ConfigManager::configGen());
+
+	T10_CHECK(v_reads.load() > 0u, "no reads");
+	T10_CHECK(v_nullReads.load() == 0u, "null section during run: %lu", (unsigned long)v_nullReads.load());
+	T10_CHECK(v_bad.load() == 0u, "reader saw retired/poisoned section: %lu", (unsigned long)v_bad.load());
+	// publish 최대 소요 < grace/2 → mutex 보유 중 grace 대기 경로 없음
+	T10_CHECK(v_maxPublishUs.load() < (uint64_t)G_C10_RCU_GRACE_MS * 500u,
+			  "publish blocked %llu us (grace %u ms)",
+			  (unsigned long long)v_maxPublishUs.load(),
+			  (unsigned)G_C10_RCU_GRACE_MS);
+	// 최초 publish(이전 섹션 없음)는 retire 대상 아님, 마지막 retireSection 1회 포함
+	T10_CHECK(v_st.retired == v_publishes.load(), "retired %lu != publishes %lu", (unsigned long)v_st.retired, (unsigned long)v_publishes.load());
+	T10_CHECK(v_st.reclaimed == v_st.retired, "reclaimed %lu != retired %lu", (unsigned long)v_st.reclaimed, (unsigned long)v_st.retired);
+	T10_CHECK(ST_T10_RcuSection_t::s_deleted.load() == v_st.reclaimed, "deleted %lu != reclaimed", (unsigned long)ST_T10_RcuSection_t::s_deleted.load());
+	T10_CHECK(v_st.pending == 0u, "pending %u", (unsigned)v_st.pending);
+	T10_CHECK(v_st.allocFail == 0u, "allocFail %lu", (unsigned long)v_st.allocFail);
+	T10_CHECK(CL_C10_ConfigManager::configGen() == v_publishes.load() + 1u, "gen mismatch");
+
+	return g_T10_failCount == 0u ? 0 : 1;
+}
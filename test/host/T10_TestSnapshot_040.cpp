@@ -0,0 +1,133 @@
+/*
+ * ------------------------------------------------------
+ * 소스명 : T10_TestSnapshot_040.cpp
+ * 모듈약어 : T10
+ * 모듈명 : S10 스냅샷 seqlock torn-read host stress 테스트
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - writer 1개: applyResolvedWind(A/B 교대) + tick() 연속 발행
+ * - reader N개: readSnapshot() 반복 → preset 코드와 파라미터 묶음이 A 또는 B 중
+ *   하나와 전부 일치하는지 검사 (섞이면 torn read)
+ * - readSnapshot 실패(false) 0회, 잠금 fallback 횟수 보고
+ * - 인자: argv[1] = cfg_windDict_xxx.json 경로
+ * ------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "S10_Headless_040.h"
+#include "S20_WindSolver_040.h"
+#include "T10_Host_040.h"
+
+static const uint8_t  G_T10_SNAP_READERS = 3u;
+static const uint32_t G_T10_SNAP_WRITES	 = 200000u;
+
+// 검사 대상 필드 묶음 (applyResolvedWind에서만 변경, tick()에서는 불변)
+typedef struct {
+	char  presetCode[A20_Const::MAX_CODE_LEN];
+	char  styleCode[A20_Const::MAX_CODE_LEN];
+	float intensity, variability, gustFreq, fanLimit, minFan;
+	float turbSigma, turbLenScale, baseMinWind, baseMaxWind;
+} ST_T10_SnapKey_t;
+
+static void T10_keyFrom(const ST_S10_SimSnapshot_t& p_s, ST_T10_SnapKey_t& p_k) {
+	memset(&p_k, 0, sizeof(p_k));
+	memcpy(p_k.presetCode, p_s.presetCode, sizeof(p_k.presetCode));
+	memcpy(p_k.styleCode, p_s.styleCode, sizeof(p_k.styleCode));
+	p_k.intensity	 = p_s.intensity;
+	p_k.variability	 = p_s.variability;
+	p_k.gustFreq	 = p_s.gustFreq;
+	p_k.fanLimit	 = p_s.fanLimit;
+	p_k.minFan		 = p_s.minFan;
+	p_k.turbSigma	 = p_s.turbSigma;
+	p_k.turbLenScale = p_s.turbLenScale;
+	p_k.baseMinWind	 = p_s.baseMinWind;
+	p_k.baseMaxWind	 = p_s.baseMaxWind;
+}
+
+int main(int p_argc, char** p_argv) {
+	static ST_A20_WindProfileDict_t s_dict;
+	if (p_argc < 2 || !T10_loadWindDict(p_argv[1], s_dict)) {
+		fprintf(stderr, "usage: t10_test_snapshot <cfg_windDict.json>\n");
+		return 2;
+	}
+
+	ST_A20_ResolvedWind_t v_wa, v_wb;
+	T10_CHECK(S20_resolveWindParams(s_dict, "OCEAN", "ACTIVE", nullptr, v_wa), "resolve A");
+	T10_CHECK(S20_resolveWindParams(s_dict, "DESERT_NIGHT", "SLEEP", nullptr, v_wb), "resolve B");
+	if (g_T10_failCount) return 1;
+
+	CL_S10_VirtualClock v_clock;
+	CL_P10_PWM			v_pwm;
+	v_clock.setMs(G_S10_HEADLESS_T0_MS);
+	v_pwm.beginVirtual();
+
+	static CL_S10_Simulation s_sim;
+	s_sim.seedPrng(1u);
+	s_sim.setHeadless(true);
+	s_sim.setClock(&v_clock);
+	s_sim.setFixedStep(true);
+	s_sim.begin(v_pwm);
+
+	// 단일 스레드 기준 key (A/B)
+	ST_S10_SimSnapshot_t v_s;
+	ST_T10_SnapKey_t	 v_ka, v_kb;
+	s_sim.applyResolvedWind(v_wa);
+	s_sim.readSnapshot(v_s);
+	T10_keyFrom(v_s, v_ka);
+	s_sim.applyResolvedWind(v_wb);
+	s_sim.readSnapshot(v_s);
+	T10_keyFrom(v_s, v_kb);
+	T10_CHECK(memcmp(&v_ka, &v_kb, sizeof(v_ka)) != 0, "A/B keys must differ");
+
+	std::atomic<bool>	  v_stop{ false };
+	std::atomic<uint32_t> v_reads{ 0 }, v_torn{ 0 }, v_fail{ 0 };
+
+	std::vector<std::thread> v_readers;
+	for (uint8_t v_r = 0; v_r < G_T10_SNAP_READERS; v_r++) {
+		v_readers.emplace_back([&]() {
+			ST_S10_SimSnapshot_t v_rs;
+			ST_T10_SnapKey_t	 v_k;
+			while (!v_stop.load(std::memory_order_relaxed)) {
+				if (!s_sim.readSnapshot(v_rs)) {
+					v_fail.fetch_add(1u);
+					continue;
+				}
+				T10_keyFrom(v_rs, v_k);
+				if (memcmp(&v_k, &v_ka, sizeof(v_k)) != 0 && memcmp(&v_k, &v_kb, sizeof(v_k)) != 0) {
+					v_torn.fetch_add(1u);
+				}
+				v_reads.fetch_add(1u, std::memory_order_relaxed);
+			}
+		});
+	}
+
+	for (uint32_t v_w = 0; v_w < G_T10_SNAP_WRITES; v_w++) {
+		if ((v_w & 0x0Fu) == 0u) {
+			s_sim.applyResolvedWind(((v_w >> 4) & 1u) ? v_wb : v_wa);
+		}
+		v_clock.advanceMs(100u);
+		s_sim.tick();
+	}
+	v_stop.store(true);
+	for (auto& v_t : v_readers) v_t.join();
+
+	fprintf(stderr,
+			"[T10] snapshot: writes=%lu reads=%lu torn=%lu fail=%lu lockedFallback=%lu\n",
+			(unsigned long)G_T10_SNAP_WRITES,
+			(unsigned long)v_reads.load(),
+			(unsigned long)v_torn.load(),
+			(unsigned long)v_fail.load(),
+			(unsigned long)s_sim.snapLockedReads());
+
+	T10_CHECK(v_reads.load() > 0u, "no reads");
+	T10_CHECK(v_torn.load() == 0u, "torn reads: %lu", (unsigned long)v_torn.load());
+	T10_CHECK(v_fail.load() == 0u, "readSnapshot returned false: %lu", (unsigned long)v_fail.load());
+
+	return g_T10_failCount == 0u ? 0 : 1;
+}
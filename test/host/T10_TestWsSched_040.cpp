@@ -0,0 +1,185 @@
+/*
+ * ------------------------------------------------------
+ * 소스명 : T10_TestWsSched_040.cpp
+ * 모듈약어 : T10
+ * 모듈명 : CT10 WS Scheduler pass / fairness aging host 테스트
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - CT10_WS_rankDue: pending/due 필터, aging rank 정렬, 동률 시 기본 우선순위 유지
+ * - CT10_WS_runPass: 최소 1채널 보장, byte/us 예산 중단, aging 승격 계수
+ * - CT10_WS_latencyRecord: EWMA 1/8 / max 값 고정 수열 검증
+ * - 가상 시계 경합 시뮬레이션 (tick 50ms, 전 채널 itv 100ms + 상시 dirty, pass당 1채널)
+ *   - aging 없음: 하위 채널(chart/summary) 기아 (sent == 0)
+ *   - G_CT10_WS_AGING_STEP_MS: 전 채널 전송 + 최대 지연 상한 (itv + 채널수 x step + tick)
+ * ------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "T10_Host_040.h"
+#include "CT10_Control_WSSched_043.h"
+
+#define G_T10_WS_TICK_MS 50u
+#define G_T10_WS_ITV_MS	 100u
+#define G_T10_WS_SIM_MS	 60000u
+
+static const char* const G_T10_WS_CH_NAMES[G_A20_WS_CH_COUNT] = { "state", "metrics", "chart", "summary" };
+
+typedef struct {
+	ST_CT10_WsLatency_t lat[G_A20_WS_CH_COUNT];
+	uint32_t			passes;
+	uint32_t			budgetStops;
+	uint32_t			agedPromotions;
+} ST_T10_WsSimResult_t;
+
+// CT10_WS_tick 경로 재현: collectPending → rankDue → runPass (trySendOne = pending 해소 + 지연 기록)
+static ST_T10_WsSimResult_t T10_wsSimulate(uint16_t p_agingStepMs) {
+	ST_T10_WsSimResult_t v_res;
+	memset(&v_res, 0, sizeof(v_res));
+
+	const uint8_t v_prio[G_A20_WS_CH_COUNT] = { 0, 1, 2, 3 };
+	bool		  v_pending[G_A20_WS_CH_COUNT];
+	uint32_t	  v_sinceMs[G_A20_WS_CH_COUNT];
+	uint32_t	  v_lastSendMs[G_A20_WS_CH_COUNT];
+	memset(v_pending, 0, sizeof(v_pending));
+	memset(v_sinceMs, 0, sizeof(v_sinceMs));
+	memset(v_lastSendMs, 0, sizeof(v_lastSendMs));
+
+	for (uint32_t v_nowMs = G_T10_WS_TICK_MS; v_nowMs <= G_T10_WS_SIM_MS; v_nowMs += G_T10_WS_TICK_MS) {
+		// 1) 상시 dirty → pending 적립 (최초 적립 시각 유지)
+		for (uint8_t v_ch = 0; v_ch < G_A20_WS_CH_COUNT; v_ch++) {
+			if (!v_pending[v_ch]) v_sinceMs[v_ch] = v_nowMs;
+			v_pending[v_ch] = true;
+		}
+
+		// 2) 후보 정렬
+		int32_t v_over[G_A20_WS_CH_COUNT];
+		for (uint8_t v_ch = 0; v_ch < G_A20_WS_CH_COUNT; v_ch++) {
+			v_over[v_ch] = (int32_t)(v_nowMs - v_lastSendMs[v_ch]) - (int32_t)G_T10_WS_ITV_MS;
+		}
+		uint8_t v_cand[G_A20_WS_CH_COUNT];
+		uint8_t v_base[G_A20_WS_CH_COUNT];
+		uint8_t v_n = CT10_WS_rankDue(v_prio, v_pending, v_over, p_agingStepMs, v_cand, v_base);
+		if (v_n == 0) continue;
+
+		// 3) byte 예산 1 → pass당 1채널 (최대 경합)
+		ST_CT10_WsPassResult_t v_pass = CT10_WS_runPass(
+			v_cand, v_base, v_n, 1u, 0xFFFFFFFFu,
+			[&](uint8_t p_ch, uint32_t& p_bytes) {
+				v_pending[p_ch]	   = false;
+				v_lastSendMs[p_ch] = v_nowMs;
+				CT10_WS_latencyRecord(v_res.lat[p_ch], v_nowMs - v_sinceMs[p_ch]);
+				p_bytes = 100u;
+				return true;
+			},
+			[]() { return (uint32_t)0; });
+
+		v_res.passes++;
+		if (v_pass.budgetStop) v_res.budgetStops++;
+		v_res.agedPromotions += v_pass.agedPromotions;
+	}
+	return v_res;
+}
+
+static void T10_wsReport(const char* p_label, const ST_T10_WsSimResult_t& p_r) {
+	fprintf(stderr, "[T10] ws-sched %-8s passes=%lu budgetStops=%lu aged=%lu |", p_label,
+			(unsigned long)p_r.passes, (unsigned long)p_r.budgetStops, (unsigned long)p_r.agedPromotions);
+	for (uint8_t v_ch = 0; v_ch < G_A20_WS_CH_COUNT; v_ch++) {
+		fprintf(stderr, " %s sent=%lu avg=%lu max=%lu", G_T10_WS_CH_NAMES[v_ch],
+				(unsigned long)p_r.lat[v_ch].sent, (unsigned long)p_r.lat[v_ch].avgMs, (unsigned long)p_r.lat[v_ch].maxMs);
+	}
+	fprintf(stderr, "\n");
+}
+
+static void T10_testRank() {
+	const uint8_t v_prio[G_A20_WS_CH_COUNT]	   = { 1, 0, 3, 2 };
+	const bool	  v_pending[G_A20_WS_CH_COUNT] = { true, true, false, true };
+	uint8_t		  v_cand[G_A20_WS_CH_COUNT];
+	uint8_t		  v_base[G_A20_WS_CH_COUNT];
+
+	// aging 미발생: 기본 우선순위 순서, 미 pending(2) / due 전(3) 제외
+	{
+		const int32_t v_over[G_A20_WS_CH_COUNT] = { 0, 10, 5000, -1 };
+		uint8_t		  v_n						= CT10_WS_rankDue(v_prio, v_pending, v_over, 400u, v_cand, v_base);
+		T10_CHECK(v_n == 2, "rank: n=%u expected 2", (unsigned)v_n);
+		T10_CHECK(v_cand[0] == 1 && v_cand[1] == 0, "rank: order %u,%u expected 1,0", (unsigned)v_cand[0], (unsigned)v_cand[1]);
+		T10_CHECK(v_base[0] == 0 && v_base[1] == 1, "rank: base %u,%u expected 0,1", (unsigned)v_base[0], (unsigned)v_base[1]);
+	}
+
+	// 동률(rank 0): 기본 우선순위 유지 / 1 step 더 대기: 앞지름
+	{
+		const int32_t v_over[G_A20_WS_CH_COUNT] = { 400, 0, 0, 0 };
+		CT10_WS_rankDue(v_prio, v_pending, v_over, 400u, v_cand, v_base);
+		T10_CHECK(v_cand[0] == 1, "rank tie: first=%u expected 1", (unsigned)v_cand[0]);
+
+		const int32_t v_over2[G_A20_WS_CH_COUNT] = { 800, 0, 0, 0 };
+		CT10_WS_rankDue(v_prio, v_pending, v_over2, 400u, v_cand, v_base);
+		T10_CHECK(v_cand[0] == 0 && v_base[0] == 1, "rank aged: first=%u base=%u expected 0/1", (unsigned)v_cand[0], (unsigned)v_base[0]);
+	}
+}
+
+static void T10_testPass() {
+	const uint8_t v_cand[G_A20_WS_CH_COUNT] = { 2, 0, 1, 3 };
+	const uint8_t v_base[G_A20_WS_CH_COUNT] = { 2, 0, 1, 3 };
+	auto		  v_send					= [](uint8_t, uint32_t& p_bytes) { p_bytes = 300u; return true; };
+
+	// us 예산 이미 초과: 최소 1채널 후 중단, 첫 채널은 기본 순위 0/1보다 앞섬 → 승격 1
+	ST_CT10_WsPassResult_t v_r = CT10_WS_runPass(v_cand, v_base, 4, 100000u, 10u, v_send, []() { return (uint32_t)50; });
+	T10_CHECK(v_r.sent == 1 && v_r.budgetStop && v_r.bytes == 300u, "pass us: sent=%u stop=%d bytes=%lu",
+			  (unsigned)v_r.sent, (int)v_r.budgetStop, (unsigned long)v_r.bytes);
+	T10_CHECK(v_r.agedPromotions == 1, "pass us: aged=%u expected 1", (unsigned)v_r.agedPromotions);
+
+	// byte 예산 700: 300+300 후 600 < 700 → 3번째 전송, 900 ≥ 700 → 중단
+	v_r = CT10_WS_runPass(v_cand, v_base, 4, 700u, 0xFFFFFFFFu, v_send, []() { return (uint32_t)0; });
+	T10_CHECK(v_r.sent == 3 && v_r.budgetStop && v_r.bytes == 900u, "pass bytes: sent=%u stop=%d bytes=%lu",
+			  (unsigned)v_r.sent, (int)v_r.budgetStop, (unsigned long)v_r.bytes);
+
+	// 예산 충분: 전 후보 전송, 중단 없음 / 전송 실패 채널은 건너뜀
+	v_r = CT10_WS_runPass(v_cand, v_base, 4, 100000u, 0xFFFFFFFFu,
+						  [](uint8_t p_ch, uint32_t& p_bytes) { p_bytes = 10u; return p_ch != 0; }, []() { return (uint32_t)0; });
+	T10_CHECK(v_r.sent == 3 && !v_r.budgetStop && v_r.bytes == 30u, "pass all: sent=%u stop=%d bytes=%lu",
+			  (unsigned)v_r.sent, (int)v_r.budgetStop, (unsigned long)v_r.bytes);
+}
+
+static void T10_testLatency() {
+	ST_CT10_WsLatency_t v_lat;
+	memset(&v_lat, 0, sizeof(v_lat));
+
+	const uint32_t v_seq[]	   = { 800, 0, 1600, 80 };
+	const uint32_t v_expAvg[]  = { 800, 700, 812, 720 };  // (avg*7 + ms) / 8 정수 절사
+	for (uint8_t v_i = 0; v_i < 4; v_i++) {
+		CT10_WS_latencyRecord(v_lat, v_seq[v_i]);
+		T10_CHECK(v_lat.avgMs == v_expAvg[v_i], "latency[%u]: avg=%lu expected %lu", (unsigned)v_i,
+				  (unsigned long)v_lat.avgMs, (unsigned long)v_expAvg[v_i]);
+	}
+	T10_CHECK(v_lat.sent == 4 && v_lat.lastMs == 80u && v_lat.maxMs == 1600u, "latency: sent=%lu last=%lu max=%lu",
+			  (unsigned long)v_lat.sent, (unsigned long)v_lat.lastMs, (unsigned long)v_lat.maxMs);
+}
+
+int main() {
+	T10_testRank();
+	T10_testPass();
+	T10_testLatency();
+
+	// aging 없음 (step 최대): 상위 2채널이 pass를 독점
+	const ST_T10_WsSimResult_t v_noAging = T10_wsSimulate(0xFFFFu);
+	T10_wsReport("noAging", v_noAging);
+	T10_CHECK(v_noAging.lat[2].sent == 0 && v_noAging.lat[3].sent == 0, "noAging: chart/summary sent=%lu/%lu expected starvation",
+			  (unsigned long)v_noAging.lat[2].sent, (unsigned long)v_noAging.lat[3].sent);
+	T10_CHECK(v_noAging.agedPromotions == 0, "noAging: aged=%lu expected 0", (unsigned long)v_noAging.agedPromotions);
+
+	// 실제 aging step: 전 채널 전송 + 지연 상한
+	const ST_T10_WsSimResult_t v_aging	= T10_wsSimulate(G_CT10_WS_AGING_STEP_MS);
+	const uint32_t			   v_boundMs = G_T10_WS_ITV_MS + (uint32_t)G_A20_WS_CH_COUNT * G_CT10_WS_AGING_STEP_MS + G_T10_WS_TICK_MS;
+	T10_wsReport("aging", v_aging);
+	T10_CHECK(v_aging.agedPromotions > 0, "aging: no promotion");
+	for (uint8_t v_ch = 0; v_ch < G_A20_WS_CH_COUNT; v_ch++) {
+		T10_CHECK(v_aging.lat[v_ch].sent > 0, "aging: %s starved", G_T10_WS_CH_NAMES[v_ch]);
+		T10_CHECK(v_aging.lat[v_ch].maxMs <= v_boundMs, "aging: %s max=%lu > bound %lu", G_T10_WS_CH_NAMES[v_ch],
+				  (unsigned long)v_aging.lat[v_ch].maxMs, (unsigned long)v_boundMs);
+	}
+
+	fprintf(stderr, "[T10] ws-sched: boundMs=%lu fail=%lu\n", (unsigned long)v_boundMs, (unsigned long)g_T10_failCount);
+	return g_T10_failCount == 0u ? 0 : 1;
+}
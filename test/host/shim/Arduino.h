@@ -0,0 +1,172 @@
+#pragma once
+/*
+ * ------------------------------------------------------
+ * 소스명 : Arduino.h (host shim)
+ * 모듈명 : Smart Nature Wind host 빌드용 Arduino 최소 대체 헤더
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - Linux host에서 S10/S20/C10(RCU) 코드를 그대로 컴파일하기 위한 최소 API
+ *   - millis/micros: 프로세스 시작 기준 steady clock
+ *   - Print/Stream: write/print/println/printf (HostFilePrint: FILE* 출력), Stream peek/read (입력 stream 테스트용)
+ *   - esp_random: std::random_device (seed 생성 전용)
+ *   - ledc*: no-op (P10 virtual 출력만 사용)
+ * - 실기 전용 기능(String/WiFi/GPIO 등)은 제공하지 않음 → host 대상 TU에서 사용 금지
+ * ------------------------------------------------------
+ */
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <thread>
+
+using std::isinf;
+using std::isnan;
+using std::max;
+using std::min;
+
+#ifndef M_PI
+#	define M_PI 3.14159265358979323846
+#endif
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define F(p_str)				  (p_str)
+
+// ------------------------------------------------------
+// 시간
+// ------------------------------------------------------
+inline std::chrono::steady_clock::time_point& HOST_t0() {
+	static std::chrono::steady_clock::time_point s_t0 = std::chrono::steady_clock::now();
+	return s_t0;
+}
+
+inline unsigned long millis() {
+	return (unsigned long)(uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - HOST_t0()).count();
+}
+
+inline unsigned long micros() {
+	return (unsigned long)(uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - HOST_t0()).count();
+}
+
+inline void delay(uint32_t p_ms) {
+	std::this_thread::sleep_for(std::chrono::milliseconds(p_ms));
+}
+
+inline void yield() {
+	std::this_thread::yield();
+}
+
+// ------------------------------------------------------
+// 난수 / 문자열
+// ------------------------------------------------------
+inline uint32_t esp_random() {
+	static std::random_device s_rd;
+	return (uint32_t)s_rd();
+}
+
+#if !defined(__GLIBC__) || !__GLIBC_PREREQ(2, 38)
+inline size_t strlcpy(char* p_dst, const char* p_src, size_t p_n) {
+	const size_t v_len = strlen(p_src);
+	if (p_n > 0) {
+		const size_t v_cp = (v_len >= p_n) ? (p_n - 1) : v_len;
+		memcpy(p_dst, p_src, v_cp);
+		p_dst[v_cp] = '\0';
+	}
+	return v_len;
+}
+#endif
+
+// ------------------------------------------------------
+// Print / Stream
+// ------------------------------------------------------
+class Print {
+  public:
+	virtual ~Print() {}
+
+	virtual size_t write(uint8_t p_c) = 0;
+	virtual size_t write(const uint8_t* p_buf, size_t p_len) {
+		size_t v_n = 0;
+		while (p_len--) v_n += write(*p_buf++);
+		return v_n;
+	}
+
+	size_t print(const char* p_str) {
+		return write((const uint8_t*)p_str, strlen(p_str));
+	}
+	size_t println(const char* p_str = "") {
+		return print(p_str) + print("\r\n");
+	}
+	size_t printf(const char* p_fmt, ...) __attribute__((format(printf, 2, 3))) {
+		char	v_buf[512];
+		va_list v_args;
+		va_start(v_args, p_fmt);
+		int v_n = vsnprintf(v_buf, sizeof(v_buf), p_fmt, v_args);
+		va_end(v_args);
+		if (v_n <= 0) return 0;
+		return write((const uint8_t*)v_buf, (size_t)std::min(v_n, (int)sizeof(v_buf) - 1));
+	}
+};
+
+// 입력: Arduino Stream 최소 API (peek/read/available). 입력 없는 Stream은 EOF(-1)
+class Stream : public Print {
+  public:
+	virtual int available() {
+		return 0;
+	}
+	virtual int read() {
+		return -1;
+	}
+	virtual int peek() {
+		return -1;
+	}
+	void setTimeout(unsigned long) {}
+};
+
+// FILE* 출력 (stdout/stderr/fopen 결과)
+class HostFilePrint : public Stream {
+  public:
+	explicit HostFilePrint(FILE* p_fp) : _fp(p_fp) {}
+
+	size_t write(uint8_t p_c) override {
+		return (fputc(p_c, _fp) == EOF) ? 0 : 1;
+	}
+	size_t write(const uint8_t* p_buf, size_t p_len) override {
+		return fwrite(p_buf, 1, p_len, _fp);
+	}
+
+  private:
+	FILE* _fp;
+};
+
+inline HostFilePrint Serial(stderr);
+
+// ------------------------------------------------------
+// ESP / LEDC
+// ------------------------------------------------------
+class HostEspClass {
+  public:
+	uint32_t getFreeHeap() const {
+		return 0;
+	}
+};
+inline HostEspClass ESP;
+
+inline bool psramFound() {
+	return false;
+}
+
+inline bool ledcSetup(uint8_t, uint32_t, uint8_t) {
+	return true;
+}
+inline void ledcAttachPin(int16_t, uint8_t) {}
+inline void ledcWrite(uint8_t, uint32_t) {}
+inline uint32_t ledcRead(uint8_t) {
+	return 0;
+}
@@ -0,0 +1,32 @@
+#pragma once
+/*
+ * ------------------------------------------------------
+ * 소스명 : ArduinoJson.h (host shim, 선언 전용)
+ * 모듈명 : Smart Nature Wind host 빌드용 ArduinoJson 전방 선언
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - 헤더의 함수 선언(JsonDocument& 등 인자)만 통과시키는 불완전 타입 선언
+ * - JsonDocument를 실제 사용하는 TU(*_IO_*, W10, CT10, C10 load/save)는 host 빌드 대상 아님
+ *   → host 대상 TU에서 JSON 사용 시 "incomplete type" 컴파일 오류로 즉시 드러남
+ * ------------------------------------------------------
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef ARDUINOJSON_DEFAULT_NESTING_LIMIT
+#	define ARDUINOJSON_DEFAULT_NESTING_LIMIT 10
+#endif
+
+namespace ArduinoJson {
+class JsonDocument;
+class JsonObject;
+class JsonObjectConst;
+class JsonArray;
+class JsonArrayConst;
+class JsonVariant;
+class JsonVariantConst;
+class Allocator;
+}  // namespace ArduinoJson
+
+using namespace ArduinoJson;
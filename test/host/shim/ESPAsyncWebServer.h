@@ -0,0 +1,12 @@
+#pragma once
+/*
+ * ------------------------------------------------------
+ * 소스명 : ESPAsyncWebServer.h (host shim, 선언 전용)
+ * 모듈명 : Smart Nature Wind host 빌드용 AsyncWebServer 전방 선언 (W10/WS TU는 host 빌드 대상 아님)
+ * ------------------------------------------------------
+ */
+
+class AsyncWebServer;
+class AsyncWebServerRequest;
+class AsyncWebSocket;
+class AsyncWebSocketClient;
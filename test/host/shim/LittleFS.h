@@ -0,0 +1,14 @@
+#pragma once
+/*
+ * ------------------------------------------------------
+ * 소스명 : LittleFS.h (host shim, 선언 전용)
+ * 모듈명 : Smart Nature Wind host 빌드용 LittleFS 전방 선언 (파일 IO TU는 host 빌드 대상 아님)
+ * ------------------------------------------------------
+ */
+
+namespace fs {
+class File;
+class FS;
+}  // namespace fs
+
+using fs::File;
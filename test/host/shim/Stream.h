@@ -0,0 +1,8 @@
+#pragma once
+/*
+ * ------------------------------------------------------
+ * 소스명 : Stream.h (host shim) - Arduino.h host shim의 Print/Stream 사용
+ * ------------------------------------------------------
+ */
+
+#include <Arduino.h>
@@ -0,0 +1,37 @@
+#pragma once
+/*
+ * ------------------------------------------------------
+ * 소스명 : esp_heap_caps.h (host shim)
+ * 모듈명 : Smart Nature Wind host 빌드용 heap_caps 대체 (malloc 위임)
+ * ------------------------------------------------------
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_8BIT		(1u << 2)
+#define MALLOC_CAP_SPIRAM	(1u << 10)
+#define MALLOC_CAP_INTERNAL (1u << 11)
+#define MALLOC_CAP_DEFAULT	(1u << 12)
+
+typedef struct {
+	size_t total_free_bytes;
+	size_t total_allocated_bytes;
+	size_t largest_free_block;
+	size_t minimum_free_bytes;
+	size_t allocated_blocks;
+	size_t free_blocks;
+	size_t total_blocks;
+} multi_heap_info_t;
+
+inline void* heap_caps_malloc(size_t p_size, uint32_t) {
+	return malloc(p_size);
+}
+
+inline void heap_caps_free(void* p_ptr) {
+	free(p_ptr);
+}
+
+inline void heap_caps_get_info(multi_heap_info_t* p_info, uint32_t) {
+	*p_info = multi_heap_info_t{};
+}
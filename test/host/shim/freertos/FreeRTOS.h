@@ -0,0 +1,68 @@
+#pragma once
+/*
+ * ------------------------------------------------------
+ * 소스명 : freertos/FreeRTOS.h (host shim)
+ * 모듈명 : Smart Nature Wind host 빌드용 FreeRTOS 최소 대체
+ * ------------------------------------------------------
+ * 기능 요약:
+ * - portMUX_TYPE: std::atomic 기반 spinlock (동일 thread 재진입 허용, ESP32 동작과 동일)
+ *   → host 동시성 테스트에서 실기와 같은 임계구역 의미 유지
+ * - tick 단위 = 1ms (configTICK_RATE_HZ 1000)
+ * ------------------------------------------------------
+ */
+
+#include <stdint.h>
+
+#include <atomic>
+#include <functional>
+#include <thread>
+
+typedef uint32_t TickType_t;
+typedef int32_t	 BaseType_t;
+typedef uint32_t UBaseType_t;
+
+#define pdTRUE			   ((BaseType_t)1)
+#define pdFALSE			   ((BaseType_t)0)
+#define pdPASS			   pdTRUE
+#define pdFAIL			   pdFALSE
+#define portMAX_DELAY	   ((TickType_t)0xFFFFFFFFu)
+#define configTICK_RATE_HZ 1000u
+#define portTICK_PERIOD_MS 1u
+#define pdMS_TO_TICKS(p_ms) ((TickType_t)(p_ms))
+
+typedef struct {
+	std::atomic<uint32_t> owner;  // 0: unlocked, 그 외: thread 식별값
+	uint32_t			  count;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED {}
+
+inline uint32_t HOST_threadTag() {
+	static thread_local uint32_t s_tag = (uint32_t)(std::hash<std::thread::id>()(std::this_thread::get_id()) | 1u);
+	return s_tag;
+}
+
+inline void vPortEnterCritical(portMUX_TYPE* p_mux) {
+	const uint32_t v_me = HOST_threadTag();
+	if (p_mux->owner.load(std::memory_order_relaxed) == v_me) {
+		p_mux->count++;
+		return;
+	}
+	uint32_t v_free = 0;
+	while (!p_mux->owner.compare_exchange_weak(v_free, v_me, std::memory_order_acquire, std::memory_order_relaxed)) {
+		v_free = 0;
+		std::this_thread::yield();
+	}
+	p_mux->count = 1;
+}
+
+inline void vPortExitCritical(portMUX_TYPE* p_mux) {
+	if (--p_mux->count == 0) {
+		p_mux->owner.store(0, std::memory_order_release);
+	}
+}
+
+#define portENTER_CRITICAL(p_mux)	  vPortEnterCritical(p_mux)
+#define portEXIT_CRITICAL(p_mux)	  vPortExitCritical(p_mux)
+#define portENTER_CRITICAL_ISR(p_mux) vPortEnterCritical(p_mux)
+#define portEXIT_CRITICAL_ISR(p_mux)  vPortExitCritical(p_mux)
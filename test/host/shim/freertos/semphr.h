@@ -0,0 +1,31 @@
+#pragma once
+/*
+ * ------------------------------------------------------
+ * 소스명 : freertos/semphr.h (host shim)
+ * 모듈명 : Smart Nature Wind host 빌드용 recursive mutex 대체 (std::recursive_timed_mutex)
+ * ------------------------------------------------------
+ */
+
+#include <chrono>
+#include <mutex>
+
+#include "FreeRTOS.h"
+
+typedef std::recursive_timed_mutex* SemaphoreHandle_t;
+
+inline SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() {
+	return new std::recursive_timed_mutex();
+}
+
+inline BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t p_sem, TickType_t p_ticks) {
+	if (p_ticks == portMAX_DELAY) {
+		p_sem->lock();
+		return pdTRUE;
+	}
+	return p_sem->try_lock_for(std::chrono::milliseconds(p_ticks)) ? pdTRUE : pdFALSE;
+}
+
+inline BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t p_sem) {
+	p_sem->unlock();
+	return pdTRUE;
+}
@@ -0,0 +1,23 @@
+#pragma once
+/*
+ * ------------------------------------------------------
+ * 소스명 : freertos/task.h (host shim)
+ * 모듈명 : Smart Nature Wind host 빌드용 FreeRTOS task API 최소 대체
+ * ------------------------------------------------------
+ */
+
+#include <chrono>
+#include <thread>
+
+#include "FreeRTOS.h"
+
+typedef void* TaskHandle_t;
+
+inline void vTaskDelay(TickType_t p_ticks) {
+	std::this_thread::sleep_for(std::chrono::milliseconds(p_ticks));
+}
+
+inline TickType_t xTaskGetTickCount() {
+	static const auto s_t0 = std::chrono::steady_clock::now();
+	return (TickType_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - s_t0).count();
+}